@@ -0,0 +1,357 @@
+#ifndef __BINARYFILE_H__
+#define __BINARYFILE_H__
+
+#include <fstream>
+
+#include "MatView.h"
+#include "Mat4.h"
+#include "Quaternion.h"
+#include "Ref3.h"
+#include "Vec2.h"
+
+/* version written in the file header, files of an other version are refused */
+#define QX_BINARY_VERSION 1
+/* alignment in bytes of every header and array in the file */
+#define QX_BINARY_ALIGNMENT 64
+
+namespace Math
+{
+	/*
+	 * File layout, all values in the endianness of the writer:
+	 *
+	 *     [file header, 64 bytes] ([array header, 64 bytes] [array data, padded to 64 bytes])*
+	 *
+	 * An array is finished when its header is patched by EndArray, a file cut while writing is read up to its last finished array.
+	 */
+
+	#pragma region Format
+
+	/**
+	 * @brief Kind of element stored in an array
+	 */
+	enum class QXarrayType : QXuint
+	{
+		Scalar		= 0,
+		Vec2		= 1,
+		Vec3		= 2,
+		Vec4		= 3,
+		Quaternion	= 4,
+		Mat4		= 5,
+		Ref3		= 6,
+		/* lines of a QXmat, column scalars each */
+		Mat			= 7
+	};
+
+	/**
+	 * @brief First 64 bytes of a file
+	 */
+	struct QXbinaryFileHeader
+	{
+		char		magic[4];
+		QXushort	version;
+		/* 0xFEFF in the writer endianness */
+		QXushort	byteOrder;
+		QXuint		alignment;
+		char		reserved[52];
+	};
+
+	/**
+	 * @brief 64 bytes before the data of each array
+	 */
+	struct QXbinaryArrayHeader
+	{
+		QXarrayType	type;
+		/* size of one scalar, 4 for float and 8 for double */
+		QXuint		scalarSize;
+		/* scalars per line for QXarrayType::Mat, 0 otherwise */
+		QXuint		column;
+		/* 0 while the array is written, 1 once EndArray patched the header */
+		QXuint		finished;
+		QXuint64	count;
+		/* size of the data with its padding */
+		QXuint64	byteSize;
+		char		name[32];
+	};
+
+	/**
+	 * @brief Array type and scalar of a storable element
+	 *
+	 * @tparam T Element type
+	 */
+	template<typename T>
+	struct QXarrayTraits;
+
+	template<>
+	struct QXarrayTraits<QXfloat> { static constexpr QXarrayType type{ QXarrayType::Scalar }; using Scalar = QXfloat; };
+	template<>
+	struct QXarrayTraits<QXdouble> { static constexpr QXarrayType type{ QXarrayType::Scalar }; using Scalar = QXdouble; };
+	template<typename T>
+	struct QXarrayTraits<QXvec2t<T>> { static constexpr QXarrayType type{ QXarrayType::Vec2 }; using Scalar = T; };
+	template<typename T>
+	struct QXarrayTraits<QXvec3t<T>> { static constexpr QXarrayType type{ QXarrayType::Vec3 }; using Scalar = T; };
+	template<typename T>
+	struct QXarrayTraits<QXvec4t<T>> { static constexpr QXarrayType type{ QXarrayType::Vec4 }; using Scalar = T; };
+	template<typename T>
+	struct QXarrayTraits<QXquaterniont<T>> { static constexpr QXarrayType type{ QXarrayType::Quaternion }; using Scalar = T; };
+	template<typename T>
+	struct QXarrayTraits<QXmat4t<T>> { static constexpr QXarrayType type{ QXarrayType::Mat4 }; using Scalar = T; };
+	template<typename T>
+	struct QXarrayTraits<QXref3t<T>> { static constexpr QXarrayType type{ QXarrayType::Ref3 }; using Scalar = T; };
+
+	/**
+	 * @brief Read only contiguous range of elements
+	 *
+	 * @tparam T Element type
+	 */
+	template<typename T>
+	struct QXspan
+	{
+		const T*	data{ nullptr };
+		QXuint64	count{ 0 };
+
+		constexpr const T*	begin() const noexcept { return data; }
+		constexpr const T*	end() const noexcept { return data + count; }
+		constexpr QXbool	empty() const noexcept { return count == 0; }
+		constexpr const T&	operator[](QXuint64 i) const noexcept { return data[i]; }
+	};
+
+	#pragma endregion Format
+
+	#pragma region Writer
+
+	/**
+	 * @brief Streaming writer of the binary format
+	 *
+	 * Arrays are written one after the other, each with BeginArray, any number of Append and EndArray,
+	 * or at once with WriteArray. Memory use does not depend on the size of the arrays.
+	 */
+	class QXbinaryWriter
+	{
+	private:
+		#pragma region Attributes
+		std::ofstream			_file;
+		std::streamoff			_arrayStart;
+		QXbinaryArrayHeader		_header;
+		QXbool					_inArray;
+		#pragma endregion Attributes
+
+		#pragma region Functions
+		void	Pad(QXuint64 size);
+		#pragma endregion Functions
+
+	public:
+		#pragma region Constructor/Destructor
+		/**
+		 * @brief Construct a closed QXbinaryWriter object
+		 */
+		QXbinaryWriter() noexcept;
+
+		/**
+		 * @brief Destroy the QXbinaryWriter object, finishes the file
+		 */
+		~QXbinaryWriter();
+		#pragma endregion Constructor/Destructor
+
+		#pragma region Functions
+		/**
+		 * @brief Create or truncate a file and write its header
+		 *
+		 * @param path Path of the file
+		 * @return true File ready
+		 * @return false File could not be created
+		 */
+		QXbool	Open(const QXstring& path);
+
+		/**
+		 * @brief Finish the current array and close the file
+		 *
+		 * @return true Everything was written
+		 * @return false A write failed
+		 */
+		QXbool	Close();
+
+		/**
+		 * @brief Start a new array, the current one is finished
+		 *
+		 * @param type Kind of element
+		 * @param scalarSize Size of one scalar, 4 or 8
+		 * @param name Name of the array, cut to 31 characters
+		 * @param column Scalars per line for QXarrayType::Mat
+		 */
+		void	BeginArray(QXarrayType type, QXuint scalarSize, const QXstring& name = "", QXuint column = 0);
+
+		/**
+		 * @brief Append raw elements to the current array
+		 *
+		 * @param data Elements, in the layout given to BeginArray
+		 * @param count Number of elements
+		 */
+		void	Append(const void* data, QXuint64 count);
+
+		/**
+		 * @brief Finish the current array: write its padding and patch its header
+		 */
+		void	EndArray();
+
+		/**
+		 * @brief Start a new array of T
+		 *
+		 * @param name Name of the array
+		 */
+		template<typename T>
+		void	BeginArray(const QXstring& name = "")
+		{
+			BeginArray(QXarrayTraits<T>::type, sizeof(typename QXarrayTraits<T>::Scalar), name);
+		}
+
+		/**
+		 * @brief Append elements to the current array
+		 *
+		 * @param data Elements, of the type given to BeginArray
+		 * @param count Number of elements
+		 */
+		template<typename T>
+		void	Append(const T* data, QXuint64 count)
+		{
+			Append(static_cast<const void*>(data), count);
+		}
+
+		/**
+		 * @brief Write a whole array of T
+		 *
+		 * @param data Elements
+		 * @param count Number of elements
+		 * @param name Name of the array
+		 */
+		template<typename T>
+		void	WriteArray(const T* data, QXuint64 count, const QXstring& name = "")
+		{
+			BeginArray<T>(name);
+			Append(data, count);
+			EndArray();
+		}
+
+		/**
+		 * @brief Write a matrix as an array of lines
+		 *
+		 * @param mat Matrix, viewed lines do not need to be contiguous
+		 * @param name Name of the array
+		 */
+		void	WriteMat(const QXconstMatView& mat, const QXstring& name = "");
+		#pragma endregion Functions
+	};
+
+	#pragma endregion Writer
+
+	#pragma region Reader
+
+	/**
+	 * @brief Zero copy reader of the binary format, the file is memory mapped
+	 *
+	 * Open only walks the array headers, data pages are loaded by the system when first read.
+	 * Spans and views stay valid until Close.
+	 */
+	class QXbinaryReader
+	{
+	private:
+		#pragma region Attributes
+		const char*								_data;
+		QXuint64								_size;
+		void*									_file;
+		void*									_mapping;
+		std::vector<const QXbinaryArrayHeader*>	_arrays;
+		#pragma endregion Attributes
+
+	public:
+		#pragma region Constructor/Destructor
+		/**
+		 * @brief Construct a closed QXbinaryReader object
+		 */
+		QXbinaryReader() noexcept;
+
+		QXbinaryReader(const QXbinaryReader&) = delete;
+		QXbinaryReader& operator=(const QXbinaryReader&) = delete;
+
+		/**
+		 * @brief Destroy the QXbinaryReader object, unmaps the file
+		 */
+		~QXbinaryReader();
+		#pragma endregion Constructor/Destructor
+
+		#pragma region Functions
+		/**
+		 * @brief Map a file and read its array headers
+		 *
+		 * @param path Path of the file
+		 * @return true File mapped
+		 * @return false Missing file, bad magic, other version or other endianness
+		 */
+		QXbool	Open(const QXstring& path);
+
+		/**
+		 * @brief Unmap the file, every span and view becomes invalid
+		 */
+		void	Close() noexcept;
+
+		/**
+		 * @brief Number of finished arrays in the file
+		 *
+		 * @return QXuint Array count
+		 */
+		QXuint	ArrayCount() const noexcept;
+
+		/**
+		 * @brief Header of one array
+		 *
+		 * @param i Index of the array
+		 * @return const QXbinaryArrayHeader& Header
+		 */
+		const QXbinaryArrayHeader&	Header(QXuint i) const noexcept;
+
+		/**
+		 * @brief Index of the first array with the given name
+		 *
+		 * @param name Name to look for
+		 * @return QXint Index, -1 if no array has this name
+		 */
+		QXint	Find(const QXstring& name) const noexcept;
+
+		/**
+		 * @brief Raw data of one array
+		 *
+		 * @param i Index of the array
+		 * @return const void* First element, aligned on QX_BINARY_ALIGNMENT
+		 */
+		const void*	Data(QXuint i) const noexcept;
+
+		/**
+		 * @brief Elements of one array, without copy
+		 *
+		 * @param i Index of the array
+		 * @return QXspan<T> Elements, empty if the array does not hold T
+		 */
+		template<typename T>
+		QXspan<T>	Get(QXuint i) const noexcept
+		{
+			const QXbinaryArrayHeader& header{ Header(i) };
+
+			if (header.type != QXarrayTraits<T>::type || header.scalarSize != sizeof(typename QXarrayTraits<T>::Scalar))
+				return {};
+
+			return { static_cast<const T*>(Data(i)), header.count };
+		}
+
+		/**
+		 * @brief Matrix array as a view, without copy
+		 *
+		 * @param i Index of the array
+		 * @return QXconstMatView View on the matrix, empty if the array is not a float QXmat
+		 */
+		QXconstMatView	GetMat(QXuint i) const noexcept;
+		#pragma endregion Functions
+	};
+
+	#pragma endregion Reader
+}
+
+#endif // __BINARYFILE_H__
@@ -0,0 +1,248 @@
+#ifndef __COMPRESSION_H__
+#define __COMPRESSION_H__
+
+#include "Quaternion.h"
+
+namespace Math::Compression
+{
+	/**
+	 * @brief Quaternion packed on 48 bits (smallest three, 15 bits per component)
+	 */
+	struct QXpackedQuaternion48
+	{
+		QXushort	e[3];
+	};
+
+	/**
+	 * @brief Vector3 packed on 48 bits (half floats or quantized range)
+	 */
+	struct QXpackedVec3
+	{
+		QXushort	x, y, z;
+	};
+
+	#pragma region Quaternion
+
+	/**
+	 * @brief Pack a unit quaternion on 32 bits (smallest three, 2 bits index + 3 * 10 bits)
+	 *
+	 * Maximum error per component is 0.0018 (the largest one is rebuilt from the three others).
+	 * q and -q are the same rotation, the unpacked quaternion can be -q.
+	 *
+	 * @param q Unit quaternion to pack
+	 * @return QXuint Packed quaternion
+	 */
+	QXuint					PackQuaternion32(const QXquaternion& q) noexcept;
+
+	/**
+	 * @brief Unpack a quaternion packed with PackQuaternion32
+	 *
+	 * @param packed Packed quaternion
+	 * @return QXquaternion Unit quaternion
+	 */
+	QXquaternion			UnpackQuaternion32(QXuint packed) noexcept;
+
+	/**
+	 * @brief Pack a unit quaternion on 48 bits (smallest three, 2 bits index + 3 * 15 bits)
+	 *
+	 * Maximum error per component is 0.00006 (the largest one is rebuilt from the three others).
+	 *
+	 * @param q Unit quaternion to pack
+	 * @return QXpackedQuaternion48 Packed quaternion
+	 */
+	QXpackedQuaternion48	PackQuaternion48(const QXquaternion& q) noexcept;
+
+	/**
+	 * @brief Unpack a quaternion packed with PackQuaternion48
+	 *
+	 * @param packed Packed quaternion
+	 * @return QXquaternion Unit quaternion
+	 */
+	QXquaternion			UnpackQuaternion48(const QXpackedQuaternion48& packed) noexcept;
+
+	/**
+	 * @brief Pack an array of unit quaternions on 32 bits, 4 at a time with SIMD
+	 *
+	 * @param q Quaternions to pack
+	 * @param packed Output array of count packed quaternions
+	 * @param count Number of quaternions
+	 */
+	void					PackQuaternion32(const QXquaternion* q, QXuint* packed, QXuint count) noexcept;
+
+	/**
+	 * @brief Unpack an array of quaternions packed on 32 bits, 4 at a time with SIMD
+	 *
+	 * @param packed Packed quaternions
+	 * @param q Output array of count quaternions
+	 * @param count Number of quaternions
+	 */
+	void					UnpackQuaternion32(const QXuint* packed, QXquaternion* q, QXuint count) noexcept;
+
+	/**
+	 * @brief Pack an array of unit quaternions on 48 bits
+	 *
+	 * @param q Quaternions to pack
+	 * @param packed Output array of count packed quaternions
+	 * @param count Number of quaternions
+	 */
+	void					PackQuaternion48(const QXquaternion* q, QXpackedQuaternion48* packed, QXuint count) noexcept;
+
+	/**
+	 * @brief Unpack an array of quaternions packed on 48 bits
+	 *
+	 * @param packed Packed quaternions
+	 * @param q Output array of count quaternions
+	 * @param count Number of quaternions
+	 */
+	void					UnpackQuaternion48(const QXpackedQuaternion48* packed, QXquaternion* q, QXuint count) noexcept;
+
+	#pragma endregion Quaternion
+
+	#pragma region Unit Vector
+
+	/**
+	 * @brief Pack a unit vector on 32 bits (octahedral mapping, 2 * 16 bits)
+	 *
+	 * Maximum angular error is below 0.00005 radian.
+	 *
+	 * @param vec Vector to pack, does not need to be normalized but must not be null
+	 * @return QXuint Packed vector
+	 */
+	QXuint					PackUnitVector(const QXvec3& vec) noexcept;
+
+	/**
+	 * @brief Unpack a vector packed with PackUnitVector
+	 *
+	 * @param packed Packed vector
+	 * @return QXvec3 Unit vector
+	 */
+	QXvec3					UnpackUnitVector(QXuint packed) noexcept;
+
+	/**
+	 * @brief Pack an array of unit vectors on 32 bits, 4 at a time with SIMD
+	 *
+	 * @param vec Vectors to pack
+	 * @param packed Output array of count packed vectors
+	 * @param count Number of vectors
+	 */
+	void					PackUnitVector(const QXvec3* vec, QXuint* packed, QXuint count) noexcept;
+
+	/**
+	 * @brief Unpack an array of unit vectors packed on 32 bits, 4 at a time with SIMD
+	 *
+	 * @param packed Packed vectors
+	 * @param vec Output array of count unit vectors
+	 * @param count Number of vectors
+	 */
+	void					UnpackUnitVector(const QXuint* packed, QXvec3* vec, QXuint count) noexcept;
+
+	#pragma endregion Unit Vector
+
+	#pragma region Half Float
+
+	/**
+	 * @brief Convert float to IEEE 754 half float (round to nearest even)
+	 *
+	 * Relative error is below 2^-11 in [6.1e-5, 65504], bigger values become infinity.
+	 *
+	 * @param value Float to convert
+	 * @return QXushort Half float bits
+	 */
+	QXushort				FloatToHalf(QXfloat value) noexcept;
+
+	/**
+	 * @brief Convert IEEE 754 half float to float (exact)
+	 *
+	 * @param half Half float bits
+	 * @return QXfloat Float value
+	 */
+	QXfloat					HalfToFloat(QXushort half) noexcept;
+
+	/**
+	 * @brief Pack vector with one half float per component
+	 *
+	 * @param vec Vector to pack
+	 * @return QXpackedVec3 Packed vector
+	 */
+	QXpackedVec3			PackHalfVec3(const QXvec3& vec) noexcept;
+
+	/**
+	 * @brief Unpack vector packed with PackHalfVec3
+	 *
+	 * @param packed Packed vector
+	 * @return QXvec3 Vector
+	 */
+	QXvec3					UnpackHalfVec3(const QXpackedVec3& packed) noexcept;
+
+	/**
+	 * @brief Pack an array of vectors with half floats (F16C when available)
+	 *
+	 * @param vec Vectors to pack
+	 * @param packed Output array of count packed vectors
+	 * @param count Number of vectors
+	 */
+	void					PackHalfVec3(const QXvec3* vec, QXpackedVec3* packed, QXuint count) noexcept;
+
+	/**
+	 * @brief Unpack an array of half float vectors (F16C when available)
+	 *
+	 * @param packed Packed vectors
+	 * @param vec Output array of count vectors
+	 * @param count Number of vectors
+	 */
+	void					UnpackHalfVec3(const QXpackedVec3* packed, QXvec3* vec, QXuint count) noexcept;
+
+	#pragma endregion Half Float
+
+	#pragma region Quantized Position
+
+	/**
+	 * @brief Pack position inside [min, max] on 16 bits per component
+	 *
+	 * Maximum error per component is (max - min) / 131070 plus float rounding, positions outside are clamped.
+	 *
+	 * @param pos Position to pack
+	 * @param min Minimum of the range
+	 * @param max Maximum of the range
+	 * @return QXpackedVec3 Packed position
+	 */
+	QXpackedVec3			PackPosition(const QXvec3& pos, const QXvec3& min, const QXvec3& max) noexcept;
+
+	/**
+	 * @brief Unpack position packed with PackPosition
+	 *
+	 * @param packed Packed position
+	 * @param min Minimum of the range
+	 * @param max Maximum of the range
+	 * @return QXvec3 Position
+	 */
+	QXvec3					UnpackPosition(const QXpackedVec3& packed, const QXvec3& min, const QXvec3& max) noexcept;
+
+	/**
+	 * @brief Pack an array of positions inside [min, max], 4 at a time with SIMD
+	 *
+	 * @param pos Positions to pack
+	 * @param packed Output array of count packed positions
+	 * @param count Number of positions
+	 * @param min Minimum of the range
+	 * @param max Maximum of the range
+	 */
+	void					PackPosition(const QXvec3* pos, QXpackedVec3* packed, QXuint count,
+										const QXvec3& min, const QXvec3& max) noexcept;
+
+	/**
+	 * @brief Unpack an array of positions packed inside [min, max], 4 at a time with SIMD
+	 *
+	 * @param packed Packed positions
+	 * @param pos Output array of count positions
+	 * @param count Number of positions
+	 * @param min Minimum of the range
+	 * @param max Maximum of the range
+	 */
+	void					UnpackPosition(const QXpackedVec3* packed, QXvec3* pos, QXuint count,
+										const QXvec3& min, const QXvec3& max) noexcept;
+
+	#pragma endregion Quantized Position
+}
+
+#endif // __COMPRESSION_H__
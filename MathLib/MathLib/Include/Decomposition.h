@@ -0,0 +1,177 @@
+#ifndef __DECOMPOSITION_H__
+#define __DECOMPOSITION_H__
+
+#include "Mat.h"
+#include "Mat4.h"
+#include "Quaternion.h"
+
+/* Jacobi sweeps of the 3x3 SVD and batch symmetric eigen decomposition, 4 reach float precision */
+#define QX_SVD_SWEEPS 4
+
+namespace Math
+{
+	#pragma region Dynamic Matrix
+
+	/**
+	 * @brief In place LDLT (Cholesky without square root) of a symmetric matrix, no allocation
+	 *
+	 * Only the lower triangle is read. On success the strict lower triangle holds L (unit diagonal implied)
+	 * and the diagonal holds D. No pivoting, the matrix should be positive definite.
+	 *
+	 * @param mat Square symmetric matrix, receives L and D
+	 * @return true Decomposition done
+	 * @return false A pivot is null, mat is left partially decomposed
+	 */
+	QXbool	DecomposeLDLT(QXmat& mat) noexcept;
+
+	/**
+	 * @brief Solve mat * x = b in place with the result of DecomposeLDLT, no allocation
+	 *
+	 * @param ldlt Matrix decomposed by DecomposeLDLT
+	 * @param b Right hand side of line values, receives x
+	 */
+	void	SolveLDLT(const QXmat& ldlt, QXfloat* b) noexcept;
+
+	/**
+	 * @brief In place Householder QR of a matrix with line >= column
+	 *
+	 * Allocates one temporary array of column floats. On return the upper triangle holds R and the Householder vectors are stored below the diagonal
+	 * (first component 1 implied), Q = H0 * H1 * ... with Hk = I - tau[k] * vk * vk^T.
+	 *
+	 * @param mat Matrix to decompose, receives R and the Householder vectors
+	 * @param tau Output array of column scalars
+	 */
+	void	DecomposeQR(QXmat& mat, QXfloat* tau);
+
+	/**
+	 * @brief Least squares solution of mat * x = b with the result of DecomposeQR, no allocation
+	 *
+	 * @param qr Matrix decomposed by DecomposeQR
+	 * @param tau Scalars from DecomposeQR
+	 * @param b Right hand side of line values, overwritten by Q^T * b
+	 * @param x Output array of column values
+	 * @return true Solution found
+	 * @return false R is singular
+	 */
+	QXbool	SolveLeastSquares(const QXmat& qr, const QXfloat* tau, QXfloat* b, QXfloat* x) noexcept;
+
+	/**
+	 * @brief Eigen decomposition of a symmetric matrix (Householder tridiagonalization + implicit QL)
+	 *
+	 * Allocates one temporary array of line floats.
+	 *
+	 * @param mat Square symmetric matrix, receives the eigen vectors in its columns
+	 * @param eigenValues Output array of line eigen values, sorted from biggest to smallest
+	 * @return true Decomposition done
+	 * @return false QL iterations did not converge
+	 */
+	QXbool	EigenSymmetric(QXmat& mat, QXfloat* eigenValues);
+
+	#pragma endregion Dynamic Matrix
+
+	#pragma region Matrix 3x3
+
+	/* 3x3 versions work on the upper left part of a QXmat4, other values are ignored and written as identity */
+
+	/**
+	 * @brief LDLT of a symmetric 3x3 matrix, unrolled
+	 *
+	 * @param mat Symmetric matrix, receives L in its strict lower part and D on its diagonal
+	 * @return true Decomposition done
+	 * @return false A pivot is null
+	 */
+	QXbool	DecomposeLDLT3(QXmat4& mat) noexcept;
+
+	/**
+	 * @brief Solve mat * x = b with the result of DecomposeLDLT3
+	 *
+	 * @param ldlt Matrix decomposed by DecomposeLDLT3
+	 * @param b Right hand side
+	 * @return QXvec3 Solution
+	 */
+	QXvec3	SolveLDLT3(const QXmat4& ldlt, const QXvec3& b) noexcept;
+
+	/**
+	 * @brief QR of a 3x3 matrix (modified Gram-Schmidt)
+	 *
+	 * @param mat Matrix to decompose
+	 * @param q Receives the orthonormal factor
+	 * @param r Receives the upper triangular factor
+	 */
+	void	DecomposeQR3(const QXmat4& mat, QXmat4& q, QXmat4& r) noexcept;
+
+	/**
+	 * @brief Eigen decomposition of a symmetric 3x3 matrix (cyclic Jacobi)
+	 *
+	 * @param mat Symmetric matrix
+	 * @param eigenVectors Receives a rotation matrix with the eigen vectors in its columns
+	 * @return QXvec3 Eigen values sorted from biggest to smallest
+	 */
+	QXvec3	EigenSymmetric3(const QXmat4& mat, QXmat4& eigenVectors) noexcept;
+
+	/**
+	 * @brief Eigen decomposition of an array of symmetric 3x3 matrices, 8 (AVX) or 4 (SSE) matrices at once
+	 *
+	 * Runs the branch free Jacobi of SVD3 for QX_SVD_SWEEPS sweeps instead of iterating to convergence, so the
+	 * results can differ from the single matrix version in the last bits.
+	 *
+	 * @param mats Symmetric matrices
+	 * @param eigenValues Output array of count eigen values
+	 * @param eigenVectors Output array of count rotation matrices
+	 * @param count Number of matrices
+	 */
+	void	EigenSymmetric3(const QXmat4* mats, QXvec3* eigenValues, QXmat4* eigenVectors, QXuint count) noexcept;
+
+	#pragma endregion Matrix 3x3
+
+	#pragma region SVD 3x3
+
+	/**
+	 * @brief Singular value decomposition mat = u * diag(sigma) * transpose(v) of a 3x3 matrix
+	 *
+	 * Branch free Jacobi on transpose(mat) * mat with exact Givens rotations (angle from a refined rsqrt instead of
+	 * a trigonometric call), then Givens QR (McAdams et al.).
+	 * u and v are rotations, sigma is sorted by decreasing magnitude and only sigma.z can be negative (det(mat) < 0).
+	 *
+	 * @param mat Matrix to decompose
+	 * @param u Receives the left rotation
+	 * @param sigma Receives the singular values
+	 * @param v Receives the right rotation
+	 */
+	void			SVD3(const QXmat4& mat, QXmat4& u, QXvec3& sigma, QXmat4& v) noexcept;
+
+	/**
+	 * @brief SVD of an array of 3x3 matrices, 8 (AVX) or 4 (SSE) matrices at once
+	 *
+	 * @param mats Matrices to decompose
+	 * @param u Output array of count left rotations
+	 * @param sigma Output array of count singular values
+	 * @param v Output array of count right rotations
+	 * @param count Number of matrices
+	 */
+	void			SVD3(const QXmat4* mats, QXmat4* u, QXvec3* sigma, QXmat4* v, QXuint count) noexcept;
+
+	/**
+	 * @brief Polar decomposition mat = rotation * stretch of a 3x3 matrix
+	 *
+	 * The rotation is always proper, for a reflection (det(mat) < 0) the stretch has a negative eigen value.
+	 *
+	 * @param mat Matrix to decompose
+	 * @param stretch If not null, receives the symmetric stretch matrix
+	 * @return QXquaternion Rotation
+	 */
+	QXquaternion	Polar3(const QXmat4& mat, QXmat4* stretch = nullptr) noexcept;
+
+	/**
+	 * @brief Rotation of the polar decomposition of an array of 3x3 matrices, 8 (AVX) or 4 (SSE) matrices at once
+	 *
+	 * @param mats Matrices to decompose
+	 * @param rotations Output array of count rotations
+	 * @param count Number of matrices
+	 */
+	void			Polar3(const QXmat4* mats, QXquaternion* rotations, QXuint count) noexcept;
+
+	#pragma endregion SVD 3x3
+}
+
+#endif // __DECOMPOSITION_H__
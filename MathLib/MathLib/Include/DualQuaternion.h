@@ -0,0 +1,215 @@
+#ifndef __DUALQUATERNION_H__
+#define __DUALQUATERNION_H__
+
+#include "Ref3.h"
+
+namespace Math
+{
+	/**
+	 * @brief Dual quaternion structure (rigid transformation: rotation + translation)
+	 *
+	 */
+	struct QXdualQuaternion
+	{
+		#pragma region Attributes
+
+		QXquaternion	real;
+		QXquaternion	dual;
+
+		#pragma endregion Attributes
+
+		#pragma region Constructors/Destructor
+
+		/**
+		 * @brief Construct a new identity QXdualQuaternion object
+		 *
+		 */
+		QXdualQuaternion() noexcept;
+
+		/**
+		 * @brief Construct a new QXdualQuaternion object
+		 *
+		 * @param r Value for real part
+		 * @param d Value for dual part
+		 */
+		QXdualQuaternion(const QXquaternion& r, const QXquaternion& d) noexcept;
+
+		/**
+		 * @brief Construct a new QXdualQuaternion object from a rigid transformation
+		 *
+		 * @param rotation Unit quaternion of rotation
+		 * @param translation Vector of translation
+		 */
+		QXdualQuaternion(const QXquaternion& rotation, const QXvec3& translation) noexcept;
+
+		/**
+		 * @brief Construct a new QXdualQuaternion object
+		 *
+		 * @param dq Dual quaternion to copy
+		 */
+		QXdualQuaternion(const QXdualQuaternion& dq) noexcept;
+
+		/**
+		 * @brief Construct a new QXdualQuaternion object
+		 *
+		 * @param dq Dual quaternion to move
+		 */
+		QXdualQuaternion(QXdualQuaternion&& dq) noexcept;
+
+		/**
+		 * @brief Destroy the QXdualQuaternion object
+		 *
+		 */
+		~QXdualQuaternion() = default;
+
+		#pragma endregion Constructors/Destructor
+
+		#pragma region Operators
+
+		/**
+		 * @brief Operator = by copy
+		 *
+		 * @param dq Dual quaternion to copy
+		 * @return QXdualQuaternion& Reference of current dual quaternion
+		 */
+		QXdualQuaternion&	operator=(const QXdualQuaternion& dq) noexcept;
+
+		/**
+		 * @brief Operator = by move
+		 *
+		 * @param dq Dual quaternion to move
+		 * @return QXdualQuaternion& Reference of current dual quaternion
+		 */
+		QXdualQuaternion&	operator=(QXdualQuaternion&& dq) noexcept;
+
+		/**
+		 * @brief Operator * composition, dq is applied first then the current dual quaternion
+		 *
+		 * @param dq Dual quaternion to compose with
+		 * @return QXdualQuaternion New dual quaternion result of the composition
+		 */
+		QXdualQuaternion	operator*(const QXdualQuaternion& dq) const noexcept;
+
+		/**
+		 * @brief Operator * multiplication by scalar
+		 *
+		 * @param s Scalar to multiply
+		 * @return QXdualQuaternion New dual quaternion
+		 */
+		QXdualQuaternion	operator*(QXfloat s) const noexcept;
+
+		/**
+		 * @brief Operator + addition
+		 *
+		 * @param dq Dual quaternion to add
+		 * @return QXdualQuaternion New dual quaternion
+		 */
+		QXdualQuaternion	operator+(const QXdualQuaternion& dq) const noexcept;
+
+		#pragma endregion Operators
+
+		#pragma region Functions
+
+		/**
+		 * @brief Quaternion conjugate of both parts, inverse of a unit dual quaternion
+		 *
+		 * @return QXdualQuaternion New dual quaternion
+		 */
+		QXdualQuaternion	Conjugate() const noexcept;
+
+		/**
+		 * @brief Normalize current dual quaternion (unit real part, dual part orthogonal to real part)
+		 *
+		 * @return QXdualQuaternion& Reference of current dual quaternion
+		 */
+		QXdualQuaternion&	Normalize() noexcept;
+
+		/**
+		 * @brief Normalize dual quaternion
+		 *
+		 * @return QXdualQuaternion New normalized dual quaternion
+		 */
+		QXdualQuaternion	Normalized() const noexcept;
+
+		/**
+		 * @brief Get the rotation part
+		 *
+		 * @return QXquaternion Unit quaternion of rotation
+		 */
+		QXquaternion		GetRotation() const noexcept;
+
+		/**
+		 * @brief Get the translation part
+		 *
+		 * @return QXvec3 Vector of translation
+		 */
+		QXvec3				GetTranslation() const noexcept;
+
+		/**
+		 * @brief Apply rotation and translation to a point
+		 *
+		 * @param point Point to transform
+		 * @return QXvec3 Transformed point
+		 */
+		QXvec3				TransformPoint(const QXvec3& point) const noexcept;
+
+		/**
+		 * @brief Apply rotation only to a vector
+		 *
+		 * @param vec Vector to transform
+		 * @return QXvec3 Transformed vector
+		 */
+		QXvec3				TransformVector(const QXvec3& vec) const noexcept;
+
+		/**
+		 * @brief Convert dual quaternion into Mat4 object (translation in m[i][3])
+		 *
+		 * @return QXmat4 New matrix
+		 */
+		QXmat4				ConvertToMat() const noexcept;
+
+		/**
+		 * @brief Convert dual quaternion into referential
+		 *
+		 * @return QXref3 New referential
+		 */
+		QXref3				ConvertToRef() const noexcept;
+
+		/**
+		 * @brief String of dual quaternion object
+		 *
+		 * @return QXstring String of the real part then the dual part
+		 */
+		QXstring			ToString() const noexcept;
+
+		#pragma region Static Functions
+
+		/**
+		 * @brief Convert rigid Mat4 object (translation in m[i][3]) into dual quaternion
+		 *
+		 * @param m Mat4 for conversion
+		 * @return QXdualQuaternion New dual quaternion
+		 */
+		static QXdualQuaternion	ConvertMatToDualQuaternion(const QXmat4& m) noexcept;
+
+		/**
+		 * @brief Convert referential into dual quaternion
+		 *
+		 * @param ref Referential for conversion
+		 * @return QXdualQuaternion New dual quaternion
+		 */
+		static QXdualQuaternion	ConvertRefToDualQuaternion(const QXref3& ref) noexcept;
+
+		/**
+		 * @brief Get identity dual quaternion
+		 *
+		 * @return QXdualQuaternion Identity
+		 */
+		static QXdualQuaternion	Identity() noexcept;
+
+		#pragma endregion Static Functions
+		#pragma endregion Functions
+	};
+}
+
+#endif // __DUALQUATERNION_H__
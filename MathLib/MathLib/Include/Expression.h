@@ -0,0 +1,359 @@
+#ifndef __EXPRESSION_H__
+#define __EXPRESSION_H__
+
+#include <cassert>
+#include <type_traits>
+
+#include "Mat.h"
+#include "Mat4.h"
+#include "MatView.h"
+
+namespace Math::Expression
+{
+	/*
+	 * Lazy element-wise arithmetic, opt-in with Lazy():
+	 *
+	 *     QXmat res{ Eval<QXmat>(Lazy(a) + Lazy(b) * Lazy(c) * 0.5f) };
+	 *
+	 * builds a small tree of nodes and computes every element in one pass, without intermediate QXmat.
+	 * Vectors are seen as column matrices. Operands of one expression must have the same size, nodes assert it when
+	 * they are built (debug builds only).
+	 */
+
+	#pragma region Base
+
+	/**
+	 * @brief Base of every expression node (CRTP)
+	 *
+	 * @tparam E Type of the node
+	 */
+	template<typename E>
+	struct QXexpr
+	{
+		/**
+		 * @brief Get the node as its real type
+		 *
+		 * @return const E& Node
+		 */
+		constexpr const E&	Self() const noexcept { return static_cast<const E&>(*this); }
+
+		/**
+		 * @brief Number of lines of the result
+		 *
+		 * @return QXint Lines
+		 */
+		constexpr QXint		Line() const noexcept { return Self().Line(); }
+
+		/**
+		 * @brief Number of columns of the result
+		 *
+		 * @return QXint Columns
+		 */
+		constexpr QXint		Column() const noexcept { return Self().Column(); }
+
+		/**
+		 * @brief Compute one element of the result
+		 *
+		 * @param i Line of the element
+		 * @param j Column of the element
+		 * @return QXfloat Element value
+		 */
+		constexpr QXfloat	operator()(QXint i, QXint j) const noexcept { return Self()(i, j); }
+	};
+
+	#pragma endregion Base
+
+	#pragma region Leaves
+
+	/**
+	 * @brief Reference to a QXvec3, seen as a 3x1 matrix
+	 */
+	struct QXvec3Ref : QXexpr<QXvec3Ref>
+	{
+		const QXvec3&	vec;
+
+		constexpr explicit QXvec3Ref(const QXvec3& v) noexcept : vec{ v } {}
+
+		constexpr QXint		Line() const noexcept { return 3; }
+		constexpr QXint		Column() const noexcept { return 1; }
+		constexpr QXfloat	operator()(QXint i, QXint) const noexcept { return vec[i]; }
+	};
+
+	/**
+	 * @brief Reference to a QXvec4, seen as a 4x1 matrix
+	 */
+	struct QXvec4Ref : QXexpr<QXvec4Ref>
+	{
+		const QXvec4&	vec;
+
+		constexpr explicit QXvec4Ref(const QXvec4& v) noexcept : vec{ v } {}
+
+		constexpr QXint		Line() const noexcept { return 4; }
+		constexpr QXint		Column() const noexcept { return 1; }
+		constexpr QXfloat	operator()(QXint i, QXint) const noexcept { return vec[i]; }
+	};
+
+	/**
+	 * @brief Reference to a QXmat4
+	 */
+	struct QXmat4Ref : QXexpr<QXmat4Ref>
+	{
+		const QXmat4&	mat;
+
+		constexpr explicit QXmat4Ref(const QXmat4& m) noexcept : mat{ m } {}
+
+		constexpr QXint		Line() const noexcept { return 4; }
+		constexpr QXint		Column() const noexcept { return 4; }
+		constexpr QXfloat	operator()(QXint i, QXint j) const noexcept { return mat.array[i * 4 + j]; }
+	};
+
+	/**
+	 * @brief Reference to a dynamic QXmat
+	 */
+	struct QXmatRef : QXexpr<QXmatRef>
+	{
+		const QXmat&	mat;
+
+		explicit QXmatRef(const QXmat& m) noexcept : mat{ m } {}
+
+		QXint		Line() const noexcept { return mat.line; }
+		QXint		Column() const noexcept { return mat.column; }
+		QXfloat		operator()(QXint i, QXint j) const noexcept { return mat.array[i * mat.column + j]; }
+	};
+
+	/**
+	 * @brief Copy of a strided QXmatView, the viewed memory is referenced
+	 */
+	struct QXmatViewRef : QXexpr<QXmatViewRef>
+	{
+		QXconstMatView	view;
+
+		constexpr explicit QXmatViewRef(const QXconstMatView& v) noexcept : view{ v } {}
+
+		constexpr QXint		Line() const noexcept { return view.line; }
+		constexpr QXint		Column() const noexcept { return view.column; }
+		constexpr QXfloat	operator()(QXint i, QXint j) const noexcept { return view(i, j); }
+	};
+
+	#pragma endregion Leaves
+
+	#pragma region Nodes
+
+	/**
+	 * @brief Element-wise binary node (addition or substraction)
+	 *
+	 * @tparam L Left operand
+	 * @tparam R Right operand
+	 * @tparam Sign 1 for addition, -1 for substraction
+	 */
+	template<typename L, typename R, QXint Sign>
+	struct QXsumExpr : QXexpr<QXsumExpr<L, R, Sign>>
+	{
+		L	lhs;
+		R	rhs;
+
+		constexpr QXsumExpr(const L& l, const R& r) noexcept : lhs{ l }, rhs{ r }
+		{
+			assert(lhs.Line() == rhs.Line() && lhs.Column() == rhs.Column() && "element-wise operands must have the same size");
+		}
+
+		constexpr QXint		Line() const noexcept { return lhs.Line(); }
+		constexpr QXint		Column() const noexcept { return lhs.Column(); }
+		constexpr QXfloat	operator()(QXint i, QXint j) const noexcept
+		{
+			if constexpr (Sign > 0)
+				return lhs(i, j) + rhs(i, j);
+			else
+				return lhs(i, j) - rhs(i, j);
+		}
+	};
+
+	/**
+	 * @brief Multiplication of an expression by a scalar
+	 *
+	 * @tparam E Operand
+	 */
+	template<typename E>
+	struct QXscaleExpr : QXexpr<QXscaleExpr<E>>
+	{
+		E		expr;
+		QXfloat	scale;
+
+		constexpr QXscaleExpr(const E& e, QXfloat s) noexcept : expr{ e }, scale{ s } {}
+
+		constexpr QXint		Line() const noexcept { return expr.Line(); }
+		constexpr QXint		Column() const noexcept { return expr.Column(); }
+		constexpr QXfloat	operator()(QXint i, QXint j) const noexcept { return expr(i, j) * scale; }
+	};
+
+	/**
+	 * @brief Matrix product, each element is a dot product computed on demand
+	 *
+	 * Operands are evaluated column count times per element, keep them as leaves for big matrices.
+	 *
+	 * @tparam L Left operand
+	 * @tparam R Right operand
+	 */
+	template<typename L, typename R>
+	struct QXproductExpr : QXexpr<QXproductExpr<L, R>>
+	{
+		L	lhs;
+		R	rhs;
+
+		constexpr QXproductExpr(const L& l, const R& r) noexcept : lhs{ l }, rhs{ r }
+		{
+			assert(lhs.Column() == rhs.Line() && "product needs as many columns on the left as lines on the right");
+		}
+
+		constexpr QXint		Line() const noexcept { return lhs.Line(); }
+		constexpr QXint		Column() const noexcept { return rhs.Column(); }
+		constexpr QXfloat	operator()(QXint i, QXint j) const noexcept
+		{
+			QXfloat res{ 0.f };
+
+			for (QXint k = 0; k < lhs.Column(); k++)
+				res += lhs(i, k) * rhs(k, j);
+
+			return res;
+		}
+	};
+
+	#pragma endregion Nodes
+
+	#pragma region Functions
+
+	/**
+	 * @brief Start a lazy expression from a vector or matrix
+	 *
+	 * The referenced object must outlive the expression.
+	 *
+	 * @param v Operand
+	 * @return Leaf node referencing v
+	 */
+	constexpr QXvec3Ref	Lazy(const QXvec3& v) noexcept { return QXvec3Ref(v); }
+	constexpr QXvec4Ref	Lazy(const QXvec4& v) noexcept { return QXvec4Ref(v); }
+	constexpr QXmat4Ref	Lazy(const QXmat4& m) noexcept { return QXmat4Ref(m); }
+	inline QXmatRef		Lazy(const QXmat& m) noexcept { return QXmatRef(m); }
+	constexpr QXmatViewRef	Lazy(const QXconstMatView& m) noexcept { return QXmatViewRef(m); }
+	constexpr QXmatViewRef	Lazy(const QXmatView& m) noexcept { return QXmatViewRef(m); }
+
+	template<typename L, typename R>
+	constexpr QXsumExpr<L, R, 1>	operator+(const QXexpr<L>& lhs, const QXexpr<R>& rhs) noexcept
+	{
+		return { lhs.Self(), rhs.Self() };
+	}
+
+	template<typename L, typename R>
+	constexpr QXsumExpr<L, R, -1>	operator-(const QXexpr<L>& lhs, const QXexpr<R>& rhs) noexcept
+	{
+		return { lhs.Self(), rhs.Self() };
+	}
+
+	template<typename E>
+	constexpr QXscaleExpr<E>		operator-(const QXexpr<E>& expr) noexcept
+	{
+		return { expr.Self(), -1.f };
+	}
+
+	template<typename E>
+	constexpr QXscaleExpr<E>		operator*(const QXexpr<E>& expr, QXfloat scale) noexcept
+	{
+		return { expr.Self(), scale };
+	}
+
+	template<typename E>
+	constexpr QXscaleExpr<E>		operator*(QXfloat scale, const QXexpr<E>& expr) noexcept
+	{
+		return { expr.Self(), scale };
+	}
+
+	template<typename E>
+	constexpr QXscaleExpr<E>		operator/(const QXexpr<E>& expr, QXfloat value) noexcept
+	{
+		return { expr.Self(), 1.f / value };
+	}
+
+	template<typename L, typename R>
+	constexpr QXproductExpr<L, R>	operator*(const QXexpr<L>& lhs, const QXexpr<R>& rhs) noexcept
+	{
+		return { lhs.Self(), rhs.Self() };
+	}
+
+	/**
+	 * @brief Write the result of an expression in an existing matrix in one pass
+	 *
+	 * The buffer of dst is reused when it has the right size, so no allocation happens.
+	 * dst can be an operand of element-wise nodes but not of a matrix product.
+	 *
+	 * @param dst Matrix receiving the result
+	 * @param expr Expression to evaluate
+	 * @return QXmat& Reference of dst
+	 */
+	template<typename E>
+	QXmat&		Assign(QXmat& dst, const QXexpr<E>& expr)
+	{
+		const QXint line{ expr.Line() };
+		const QXint column{ expr.Column() };
+
+		if (dst.array == nullptr || dst.line * dst.column != line * column)
+		{
+			delete[] dst.array;
+			dst.array = new QXfloat[line * column];
+		}
+
+		dst.line = line;
+		dst.column = column;
+
+		for (QXint i = 0; i < line; i++)
+			for (QXint j = 0; j < column; j++)
+				dst.array[i * column + j] = expr(i, j);
+
+		return dst;
+	}
+
+	/**
+	 * @brief Evaluate an expression into a new object
+	 *
+	 * @tparam T QXvec3, QXvec4, QXmat4 or QXmat, must match the size of the expression
+	 * @param expr Expression to evaluate
+	 * @return T Result
+	 */
+	template<typename T, typename E>
+	constexpr T	Eval(const QXexpr<E>& expr)
+	{
+		if constexpr (std::is_same_v<T, QXvec3>)
+		{
+			assert(expr.Line() == 3 && expr.Column() == 1 && "expression is not 3x1");
+			return QXvec3(expr(0, 0), expr(1, 0), expr(2, 0));
+		}
+		else if constexpr (std::is_same_v<T, QXvec4>)
+		{
+			assert(expr.Line() == 4 && expr.Column() == 1 && "expression is not 4x1");
+			return QXvec4(expr(0, 0), expr(1, 0), expr(2, 0), expr(3, 0));
+		}
+		else if constexpr (std::is_same_v<T, QXmat4>)
+		{
+			assert(expr.Line() == 4 && expr.Column() == 4 && "expression is not 4x4");
+			QXmat4 res;
+
+			for (QXint i = 0; i < 4; i++)
+				for (QXint j = 0; j < 4; j++)
+					res.array[i * 4 + j] = expr(i, j);
+
+			return res;
+		}
+		else
+		{
+			static_assert(std::is_same_v<T, QXmat>, "Eval supports QXvec3, QXvec4, QXmat4 and QXmat");
+
+			QXmat res(expr.Line(), expr.Column());
+			Assign(res, expr);
+
+			return res;
+		}
+	}
+
+	#pragma endregion Functions
+}
+
+#endif // __EXPRESSION_H__
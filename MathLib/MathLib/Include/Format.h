@@ -0,0 +1,96 @@
+#ifndef __FORMAT_H__
+#define __FORMAT_H__
+
+#include <charconv>
+
+#include "Mat4.h"
+#include "Quaternion.h"
+#include "Vec2.h"
+
+namespace Math
+{
+	/*
+	 * Text conversion without allocation, built on std::to_chars / std::from_chars:
+	 *
+	 *     char buffer[64];
+	 *     std::to_chars_result res{ Format(buffer, buffer + 64, vec) };     // "1,2.5,-3"
+	 *
+	 * Scalars are written in their shortest form that reads back to the same value, separated by one separator character.
+	 * Quaternions are written w first, matrices line by line. Parsers accept spaces and tabs around the values.
+	 */
+
+	#pragma region Format
+
+	/**
+	 * @brief Write a vector in a caller buffer
+	 *
+	 * @param first Start of the buffer
+	 * @param last End of the buffer
+	 * @param vec Vector to write
+	 * @param separator Character between two values
+	 * @return std::to_chars_result ptr past the last written character, ec is std::errc::value_too_large if the buffer is too small
+	 */
+	template<typename T>
+	std::to_chars_result	Format(char* first, char* last, const QXvec2t<T>& vec, char separator = ',') noexcept;
+	template<typename T>
+	std::to_chars_result	Format(char* first, char* last, const QXvec3t<T>& vec, char separator = ',') noexcept;
+	template<typename T>
+	std::to_chars_result	Format(char* first, char* last, const QXvec4t<T>& vec, char separator = ',') noexcept;
+	template<typename T>
+	std::to_chars_result	Format(char* first, char* last, const QXquaterniont<T>& quat, char separator = ',') noexcept;
+	template<typename T>
+	std::to_chars_result	Format(char* first, char* last, const QXmat4t<T>& mat, char separator = ',') noexcept;
+
+	/**
+	 * @brief Write an array of elements, one per line
+	 *
+	 * The string is allocated once for the worst case and shrunk at the end.
+	 *
+	 * @param data Elements to write
+	 * @param count Number of elements
+	 * @param separator Character between two values of an element
+	 * @return QXstring Text of count lines
+	 */
+	template<typename E>
+	QXstring				FormatArray(const E* data, size_t count, char separator = ',');
+
+	#pragma endregion Format
+
+	#pragma region Parse
+
+	/**
+	 * @brief Read a vector from text
+	 *
+	 * @param first Start of the text
+	 * @param last End of the text
+	 * @param vec Receives the vector, untouched on error
+	 * @param separator Character between two values
+	 * @return std::from_chars_result ptr past the last value, ec is std::errc::invalid_argument on malformed text
+	 */
+	template<typename T>
+	std::from_chars_result	Parse(const char* first, const char* last, QXvec2t<T>& vec, char separator = ',') noexcept;
+	template<typename T>
+	std::from_chars_result	Parse(const char* first, const char* last, QXvec3t<T>& vec, char separator = ',') noexcept;
+	template<typename T>
+	std::from_chars_result	Parse(const char* first, const char* last, QXvec4t<T>& vec, char separator = ',') noexcept;
+	template<typename T>
+	std::from_chars_result	Parse(const char* first, const char* last, QXquaterniont<T>& quat, char separator = ',') noexcept;
+	template<typename T>
+	std::from_chars_result	Parse(const char* first, const char* last, QXmat4t<T>& mat, char separator = ',') noexcept;
+
+	/**
+	 * @brief Read elements until the end of the text, one per line, blank lines are skipped
+	 *
+	 * @param first Start of the text
+	 * @param last End of the text
+	 * @param elements Parsed elements are appended to it
+	 * @param separator Character between two values of an element
+	 * @return std::from_chars_result ptr where reading stopped, last on success
+	 */
+	template<typename E>
+	std::from_chars_result	ParseArray(const char* first, const char* last, std::vector<E>& elements, char separator = ',');
+
+	#pragma endregion Parse
+}
+
+#endif // __FORMAT_H__
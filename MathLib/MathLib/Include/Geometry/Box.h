@@ -8,14 +8,15 @@ namespace Math::Geometry
 	/**
 	 * @brief Class for Box Object
 	 */
-	class QXbox
+	template<typename T>
+	class QXboxt
 	{
 	private:
 
 	#pragma region Attributes
 
-		QXvec3	_position;
-		QXvec3	_halfSizes;
+		QXvec3t<T>	_position;
+		QXvec3t<T>	_halfSizes;
 
 	#pragma endregion
 
@@ -31,8 +32,8 @@ namespace Math::Geometry
 		 * @param y Value for _halfSizes.y parameter 1 by default
 		 * @param z Value for _halfSizes.z parameter 1 by default
 		 */
-		QXbox(const QXvec3& position = QXvec3(0), const QXfloat& x = 1.f,
-					const QXfloat & y = 1.f, const QXfloat & z = 1.f) noexcept;
+		QXboxt(const QXvec3t<T>& position = QXvec3t<T>(0), const T& x = 1.f,
+					const T & y = 1.f, const T & z = 1.f) noexcept;
 
 		/**
 		 * @brief Construct a new QXbox object
@@ -40,26 +41,36 @@ namespace Math::Geometry
 		 * @param position Value for _position
 		 * @param sizes Value for _halfSizes
 		 */
-		QXbox(const QXvec3& position, const QXvec3& sizes) noexcept;
+		QXboxt(const QXvec3t<T>& position, const QXvec3t<T>& sizes) noexcept;
 
 		/**
 		 * @brief Construct a new QXbox object
 		 * 
 		 * @param QXbox Box to copy
 		 */
-		QXbox(const QXbox& QXbox) noexcept;
+		QXboxt(const QXboxt& QXboxt) noexcept;
 
 		/**
 		 * @brief Construct a new QXbox object
 		 * 
 		 * @param QXbox Box to move
 		 */
-		QXbox(QXbox&& QXbox) noexcept;
+		QXboxt(QXboxt&& QXboxt) noexcept;
+
+		/**
+		 * @brief Construct a QXbox object from an other scalar type, conversion is explicit only
+		 *
+		 * @param box Box to convert
+		 */
+		template<typename U>
+		explicit QXboxt(const QXboxt<U>& box) noexcept :
+			_position{ box.GetPosition() }, _halfSizes{ box.GetHalfSizes() }
+		{}
 
 		/**
 		 * @brief Destroy the QXbox object
 		 */
-		~QXbox() = default;
+		~QXboxt() = default;
 
 	#pragma endregion
 
@@ -74,7 +85,7 @@ namespace Math::Geometry
 		 * @param box Box to copy
 		 * @return QXbox& Reference of the current bow
 		 */
-		QXbox&			operator=(const QXbox& box) noexcept;
+		QXboxt&			operator=(const QXboxt& box) noexcept;
 
 		/**
 		 * @brief Operator = by move
@@ -82,7 +93,7 @@ namespace Math::Geometry
 		 * @param box Box to move
 		 * @return QXbox& Reference of the current box
 		 */
-		QXbox& 			operator=(QXbox&& box) noexcept;
+		QXboxt& 			operator=(QXboxt&& box) noexcept;
 
 	#pragma endregion Operators
 
@@ -96,33 +107,36 @@ namespace Math::Geometry
 		 * 
 		 * @return const QXvec3 
 		 */
-		inline const QXvec3	GetPosition() const noexcept {return _position;}
+		inline const QXvec3t<T>	GetPosition() const noexcept {return _position;}
 
 		/**
 		 * @brief Set the Position object
 		 * 
 		 * @return QXvec3& 
 		 */
-		inline QXvec3&		SetPosition() noexcept {return _position;}
+		inline QXvec3t<T>&		SetPosition() noexcept {return _position;}
 		
 		/**
 		 * @brief Get the Half Sizes object
 		 * 
 		 * @return const QXvec3 
 		 */
-		inline const QXvec3	GetHalfSizes() const noexcept {return _halfSizes;}
+		inline const QXvec3t<T>	GetHalfSizes() const noexcept {return _halfSizes;}
 		
 		/**
 		 * @brief Set the Half Sizes object
 		 * 
 		 * @return QXvec3& 
 		 */
-		inline QXvec3&		SetHalfSizes() noexcept {return _halfSizes;}
+		inline QXvec3t<T>&		SetHalfSizes() noexcept {return _halfSizes;}
 
 	#pragma endregion Accessors
 
 	#pragma endregion Functions
 	};
+
+	using QXbox	= QXboxt<QXfloat>;
+	using QXdbox	= QXboxt<QXdouble>;
 }
 
 
@@ -0,0 +1,126 @@
+#ifndef __CAPSULE_H__
+#define __CAPSULE_H__
+
+#include "Segment.h"
+
+namespace Math::Geometry
+{
+	/**
+	 * @brief Class for Capsule, the points within a radius of a segment
+	 */
+	template<typename T>
+	class QXcapsulet
+	{
+	private:
+
+	#pragma region Attributes
+
+		QXsegmentt<T>	_segment;
+		T	_radius;
+
+	#pragma endregion Attributes
+
+	public:
+
+	#pragma region Constructors
+
+		/**
+		 * @brief Construct a new QXcapsule object
+		 * 
+		 * @param segment Value for _segment parameter, joins the centers of the two half spheres, Segment() by default
+		 * @param radius Value for _radius parameter 1 by default
+		 */
+		QXcapsulet(const QXsegmentt<T>& segment = QXsegmentt<T>(), const T& radius = 1.f) noexcept;
+
+		/**
+		 * @brief Construct a new QXcapsule object
+		 * 
+		 * @param capsule Capsule to copy
+		 */
+		QXcapsulet(const QXcapsulet& capsule) noexcept;
+
+		/**
+		 * @brief Construct a new QXcapsule object
+		 * 
+		 * @param capsule Capsule to move
+		 */
+		QXcapsulet(QXcapsulet&& capsule) noexcept;
+
+		/**
+		 * @brief Construct a QXcapsule object from an other scalar type, conversion is explicit only
+		 *
+		 * @param capsule Capsule to convert
+		 */
+		template<typename U>
+		explicit QXcapsulet(const QXcapsulet<U>& capsule) noexcept :
+			_segment{ capsule.GetSegment() }, _radius{ static_cast<T>(capsule.GetRadius()) }
+		{}
+
+		/**
+		 * @brief Destroy the QXcapsule object
+		 */
+		~QXcapsulet() = default;
+
+	#pragma endregion Constructors
+
+	#pragma region Functions
+
+	#pragma region Operators
+
+		/**
+		 * @brief Operator = by copy
+		 * 
+		 * @param capsule Capsule to copy
+		 * @return QXcapsule& Reference of the new Capsule
+		 */
+		QXcapsulet& operator=(const QXcapsulet& capsule) noexcept;
+
+		/**
+		 * @brief Operator = by move
+		 * 
+		 * @param capsule Capsule to move
+		 * @return QXcapsule& Reference of the new Capsule
+		 */
+		QXcapsulet& operator=(QXcapsulet&& capsule) noexcept;
+	
+	#pragma endregion Operators
+
+	#pragma region Accessors
+
+		/**
+		 * @brief Set the Segment object
+		 * 
+		 * @return Segment& 
+		 */
+		inline QXsegmentt<T>&	SetSegment() noexcept { return _segment; }
+
+		/**
+		 * @brief Get the Segment object
+		 * 
+		 * @return Segment 
+		 */
+		inline const QXsegmentt<T>&	GetSegment() const noexcept { return _segment; }
+
+		/**
+		 * @brief Set the Radius object
+		 * 
+		 * @return QXfloat& 
+		 */
+		inline T&	SetRadius() noexcept { return _radius; }
+
+		/**
+		 * @brief Get the Radius object
+		 * 
+		 * @return QXfloat 
+		 */
+		inline T	GetRadius() const noexcept { return _radius; }
+
+	#pragma endregion Accessors
+	#pragma endregion Functions
+	};
+
+	using QXcapsule		= QXcapsulet<QXfloat>;
+	using QXdcapsule	= QXcapsulet<QXdouble>;
+}
+
+#endif // __CAPSULE_H__
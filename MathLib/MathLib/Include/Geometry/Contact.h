@@ -0,0 +1,141 @@
+#ifndef __CONTACT_H__
+#define __CONTACT_H__
+
+#include <utility>
+
+#include "Capsule.h"
+#include "OrientedBox.h"
+#include "Plane.h"
+
+#define QX_CONTACT_MAX_POINTS 4
+/* a box face is kept as reference over the other box face, or over an edge pair, unless the other is deeper by this ratio ... */
+#define QX_CONTACT_RELATIVE_TOLERANCE 0.95f
+/* ... plus this distance, so the chosen features do not flip between frames of a resting contact */
+#define QX_CONTACT_ABSOLUTE_TOLERANCE 1e-3f
+
+namespace Math::Geometry
+{
+	/**
+	 * @brief One point of a contact manifold
+	 */
+	struct QXcontactPoint
+	{
+		/* halfway between the two surfaces */
+		QXvec3	position;
+		/* penetration along the manifold normal, positive */
+		QXfloat	depth{ 0.f };
+		/* features of both shapes that made the point, equal ids across frames mean the same point */
+		QXuint	id{ 0 };
+		/* accumulated normal impulse of the solver, carried to the next frame for points whose id is found again */
+		QXfloat	impulse{ 0.f };
+	};
+
+	/**
+	 * @brief Contact points between two shapes, kept across frames for the same pair
+	 */
+	struct QXcontactManifold
+	{
+		QXcontactPoint	points[QX_CONTACT_MAX_POINTS];
+		QXuint			count{ 0 };
+		/* unit vector from A to B: moving B by normal * depth separates the shapes */
+		QXvec3			normal;
+		/* separating axis test of the last frame: 0-2 faces of A, 3-5 faces of B, 6-14 edge pairs, ~0u when unknown */
+		QXuint			axis{ ~0u };
+	};
+
+	#pragma region Functions
+
+	/**
+	 * @brief Contact manifold between two oriented boxes
+	 *
+	 * Separating axis test on the 15 axes, starting with the axis of the previous frame, which usually still separates
+	 * resting or distant pairs. For a face axis the incident face of the other box is clipped against the sides of the
+	 * reference face, for an edge pair the closest points of the two edges give one point. Impulses of the previous
+	 * points are copied to the new points of same id. Nothing is allocated.
+	 *
+	 * @param a First box
+	 * @param b Second box
+	 * @param manifold Manifold of the pair at the previous frame, receives the new one
+	 * @return QXbool true if the boxes touch, manifold.count is 0 otherwise
+	 */
+	QXbool	CollideBoxes(const QXorientedBox& a, const QXorientedBox& b, QXcontactManifold& manifold) noexcept;
+
+	/**
+	 * @brief Contact manifold between an oriented box and the half space behind a plane
+	 *
+	 * The box corners on the negative side of the plane are the contact points, reduced to the 4 that span the
+	 * largest area. Their id is the corner index.
+	 *
+	 * @param box Box, A
+	 * @param plane Ground plane, B, solid on its negative side
+	 * @param manifold Manifold of the pair at the previous frame, receives the new one, its normal is minus the plane normal
+	 * @return QXbool true if the box touches the half space
+	 */
+	QXbool	CollideBoxPlane(const QXorientedBox& box, const QXplane& plane, QXcontactManifold& manifold) noexcept;
+
+	/**
+	 * @brief Contact manifolds of many box pairs, such as the pairs of a broadphase
+	 *
+	 * @param boxes Boxes
+	 * @param pairs Indices of the two boxes of each pair
+	 * @param count Number of pairs
+	 * @param manifolds One manifold per pair, of the previous frame, receive the new ones
+	 * @param parallel Split the pairs on every hardware thread
+	 */
+	void	CollideBoxes(const QXorientedBox* boxes, const std::pair<QXuint, QXuint>* pairs, QXuint count, QXcontactManifold* manifolds, QXbool parallel = true);
+
+	/**
+	 * @brief Contact manifold between two capsules
+	 *
+	 * The closest points of the two segments give one point, parallel segments give one point at each end of their
+	 * overlap, with ids 0 and 1, so a capsule resting on another does not roll. Nothing is allocated.
+	 *
+	 * @param a First capsule
+	 * @param b Second capsule
+	 * @param manifold Manifold of the pair at the previous frame, receives the new one
+	 * @return QXbool true if the capsules touch, manifold.count is 0 otherwise
+	 */
+	QXbool	CollideCapsules(const QXcapsule& a, const QXcapsule& b, QXcontactManifold& manifold) noexcept;
+
+	/**
+	 * @brief Contact manifold between a capsule and an oriented box
+	 *
+	 * The closest points of the segment and of the box give one point, a capsule lying on a face gives one point at
+	 * each end of the part of its segment over the face. A segment crossing the box falls back to EPA on the capsule.
+	 *
+	 * @param capsule Capsule, A
+	 * @param box Box, B
+	 * @param manifold Manifold of the pair at the previous frame, receives the new one
+	 * @return QXbool true if the capsule touches the box, manifold.count is 0 otherwise
+	 */
+	QXbool	CollideCapsuleBox(const QXcapsule& capsule, const QXorientedBox& box, QXcontactManifold& manifold) noexcept;
+
+	/**
+	 * @brief Contact manifolds of many capsule pairs
+	 *
+	 * @param capsules Capsules
+	 * @param pairs Indices of the two capsules of each pair
+	 * @param count Number of pairs
+	 * @param manifolds One manifold per pair, of the previous frame, receive the new ones
+	 * @param parallel Split the pairs on every hardware thread
+	 */
+	void	CollideCapsules(const QXcapsule* capsules, const std::pair<QXuint, QXuint>* pairs, QXuint count, QXcontactManifold* manifolds,
+							QXbool parallel = true);
+
+	/**
+	 * @brief Contact manifolds of many capsule-box pairs
+	 *
+	 * @param capsules Capsules
+	 * @param boxes Boxes
+	 * @param pairs Index of the capsule, then index of the box of each pair
+	 * @param count Number of pairs
+	 * @param manifolds One manifold per pair, of the previous frame, receive the new ones
+	 * @param parallel Split the pairs on every hardware thread
+	 */
+	void	CollideCapsuleBox(const QXcapsule* capsules, const QXorientedBox* boxes, const std::pair<QXuint, QXuint>* pairs, QXuint count,
+							QXcontactManifold* manifolds, QXbool parallel = true);
+
+	#pragma endregion Functions
+}
+
+#endif // __CONTACT_H__
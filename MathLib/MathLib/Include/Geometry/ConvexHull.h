@@ -0,0 +1,167 @@
+#ifndef __CONVEXHULL_H__
+#define __CONVEXHULL_H__
+
+#include <vector>
+
+#include "Plane.h"
+
+/* point sets smaller than this are culled on the calling thread, starting threads costs more than the pass */
+#define QX_HULL_PARALLEL_POINTS 65536
+/* points closer to a face than this times the sum of the largest absolute coordinates on each axis are on it (3 float epsilons) */
+#define QX_HULL_EPSILON 3.6e-7f
+
+namespace Math::Geometry
+{
+	/**
+	 * @brief Triangle of a convex hull, counter clockwise seen from outside
+	 */
+	struct QXhullFace
+	{
+		/* indices in the hull vertices */
+		QXuint	vertices[3];
+		/* face across the edge from vertices[i] to vertices[(i + 1) % 3] */
+		QXuint	neighbours[3];
+	};
+
+	/**
+	 * @brief Convex hull of a point set (quickhull)
+	 *
+	 * The points extreme along the 13 axes of a 26-DOP are found in one SIMD pass, their hull is built first and every
+	 * point inside it is culled in a second SIMD pass, both split on the hardware threads. Quickhull then adds the
+	 * furthest point outside a face until none is left. Points closer to the hull than the tolerance are dropped, the
+	 * faces a new point sees are found on the sign of an orientation in double, so the hull stays convex around thin
+	 * faces. Faces are triangles, coplanar neighbours are not merged.
+	 *
+	 * The working buffers are kept between builds and deleted faces are reused, so rebuilding a hull of about the
+	 * same size does not allocate.
+	 */
+	class QXconvexHull
+	{
+	private:
+		#pragma region Attributes
+		struct QXworkFace
+		{
+			QXuint	vertices[3];
+			QXuint	neighbours[3];
+			QXplane	plane;
+			/* first point of the outside set, linked by _next */
+			QXuint	outside;
+			QXuint	furthest;
+			QXfloat	furthestDistance;
+			/* build step which found the face visible */
+			QXuint	visibleStep;
+			QXbool	deleted;
+		};
+
+		/* step of the depth first search of the visible faces */
+		struct QXhorizonStep
+		{
+			QXuint	face;
+			QXuint	edge;
+			QXuint	left;
+		};
+
+		/* edge from a to b of a visible face, across it the face outside, on its own edge index */
+		struct QXhorizonEdge
+		{
+			QXuint	a;
+			QXuint	b;
+			QXuint	outside;
+			QXuint	outsideEdge;
+		};
+
+		std::vector<QXvec3>		_vertices;
+		std::vector<QXuint>		_sources;
+		std::vector<QXhullFace>	_faces;
+		std::vector<QXplane>	_planes;
+
+		/* arena of the build, cleared but not freed between builds */
+		std::vector<QXvec3>			_points;
+		std::vector<QXuint>			_pointSources;
+		std::vector<QXuint>			_next;
+		std::vector<QXworkFace>		_work;
+		std::vector<QXuint>			_freeFaces;
+		std::vector<QXuint>			_pending;
+		std::vector<QXhorizonStep>	_search;
+		std::vector<QXhorizonEdge>	_horizon;
+		std::vector<QXuint>			_visible;
+		std::vector<QXuint>			_created;
+		/* index in _cullFaces of the face each point is outside of, ~0u inside */
+		std::vector<QXuint>			_culled;
+		std::vector<QXuint>			_cullFaces;
+		std::vector<QXfloat>		_cullPlanes;
+		std::vector<QXuint>			_vertexRemap;
+		std::vector<QXuint>			_faceRemap;
+
+		QXfloat	_epsilon{ 0.f };
+		QXuint	_step{ 0 };
+		#pragma endregion Attributes
+
+		#pragma region Functions
+		QXuint	AddPoint(const QXvec3* points, QXuint index);
+		QXuint	AddFace(QXuint a, QXuint b, QXuint c);
+		void	AddOutside(QXuint face, QXuint point, QXfloat distance);
+		void	AssignOutside(QXuint point, const QXuint* faces, QXuint count);
+		QXbool	BuildTetrahedron(const QXvec3* points, QXuint count);
+		void	AddFurthest(QXuint face);
+		void	Expand();
+		void	Cull(const QXvec3* points, QXuint count, QXbool parallel);
+		void	Extract();
+		#pragma endregion Functions
+
+	public:
+		#pragma region Constructors/Destructor
+		/**
+		 * @brief Construct an empty QXconvexHull object
+		 */
+		QXconvexHull() = default;
+
+		/**
+		 * @brief Destroy the QXconvexHull object
+		 */
+		~QXconvexHull() = default;
+		#pragma endregion Constructors/Destructor
+
+		#pragma region Methods
+		/**
+		 * @brief Rebuild the hull of points
+		 *
+		 * @param points Points
+		 * @param count Number of points
+		 * @param parallel Split the passes over large sets on every hardware thread
+		 * @return QXbool False and an empty hull when the points are all in a plane, or fewer than 4
+		 */
+		QXbool	Build(const QXvec3* points, QXuint count, QXbool parallel = true);
+
+		/**
+		 * @brief Positions of the hull vertices
+		 *
+		 * @return const std::vector<QXvec3>& Vertices, in no particular order
+		 */
+		inline const std::vector<QXvec3>&		GetVertices() const noexcept { return _vertices; }
+
+		/**
+		 * @brief Index in the built points of each hull vertex
+		 *
+		 * @return const std::vector<QXuint>& Point index of each vertex
+		 */
+		inline const std::vector<QXuint>&		GetVertexSources() const noexcept { return _sources; }
+
+		/**
+		 * @brief Triangles of the hull and their neighbours
+		 *
+		 * @return const std::vector<QXhullFace>& Faces
+		 */
+		inline const std::vector<QXhullFace>&	GetFaces() const noexcept { return _faces; }
+
+		/**
+		 * @brief Plane of each face, its normal points outside
+		 *
+		 * @return const std::vector<QXplane>& Plane of each face
+		 */
+		inline const std::vector<QXplane>&		GetPlanes() const noexcept { return _planes; }
+		#pragma endregion Methods
+	};
+}
+
+#endif // __CONVEXHULL_H__
@@ -8,14 +8,15 @@ namespace Math::Geometry
 	/**
 	 * @brief Class for Cylinder
 	 */
-	class QXcylinder
+	template<typename T>
+	class QXcylindert
 	{
 	private:
 
 	#pragma region Attributes
 
-		QXsegment	_segment;
-		QXfloat	_radius;
+		QXsegmentt<T>	_segment;
+		T	_radius;
 
 	#pragma endregion Attributes
 
@@ -29,26 +30,36 @@ namespace Math::Geometry
 		 * @param segment Value for _segment parameter Segment() by default
 		 * @param radius Value for _radius parameter 1 by default
 		 */
-		QXcylinder(const QXsegment& segment = QXsegment(), const QXfloat& radius = 1.f) noexcept;
+		QXcylindert(const QXsegmentt<T>& segment = QXsegmentt<T>(), const T& radius = 1.f) noexcept;
 
 		/**
 		 * @brief Construct a new QXcylinder object
 		 * 
 		 * @param cylinder Cylinder to copy
 		 */
-		QXcylinder(const QXcylinder& cylinder) noexcept;
+		QXcylindert(const QXcylindert& cylinder) noexcept;
 
 		/**
 		 * @brief Construct a new QXcylinder object
 		 * 
 		 * @param cylinder Cylinder to move
 		 */
-		QXcylinder(QXcylinder&& cylinder) noexcept;
+		QXcylindert(QXcylindert&& cylinder) noexcept;
+
+		/**
+		 * @brief Construct a QXcylinder object from an other scalar type, conversion is explicit only
+		 *
+		 * @param cylinder Cylinder to convert
+		 */
+		template<typename U>
+		explicit QXcylindert(const QXcylindert<U>& cylinder) noexcept :
+			_segment{ cylinder.GetSegment() }, _radius{ static_cast<T>(cylinder.GetRadius()) }
+		{}
 
 		/**
 		 * @brief Destroy the QXcylinder object
 		 */
-		~QXcylinder() = default;
+		~QXcylindert() = default;
 
 	#pragma endregion Constructors
 
@@ -62,7 +73,7 @@ namespace Math::Geometry
 		 * @param cylinder Cylinder to copy
 		 * @return QXcylinder& Reference of the new Cylinder
 		 */
-		QXcylinder& operator=(const QXcylinder& cylinder) noexcept;
+		QXcylindert& operator=(const QXcylindert& cylinder) noexcept;
 
 		/**
 		 * @brief Operator = by move
@@ -70,7 +81,7 @@ namespace Math::Geometry
 		 * @param cylinder Cylinder to move
 		 * @return QXcylinder& Reference of the new Cylinder
 		 */
-		QXcylinder& operator=(QXcylinder&& cylinder) noexcept;
+		QXcylindert& operator=(QXcylindert&& cylinder) noexcept;
 	
 	#pragma endregion Operators
 
@@ -84,39 +95,42 @@ namespace Math::Geometry
 		 * 
 		 * @return Segment& 
 		 */
-		inline QXsegment&	SetSegment() { return _segment; }
+		inline QXsegmentt<T>&	SetSegment() { return _segment; }
 
 		/**
 		 * @brief Get the Segment object
 		 * 
 		 * @return Segment 
 		 */
-		inline QXsegment	GetSegment() const noexcept { return _segment; }
+		inline QXsegmentt<T>	GetSegment() const noexcept { return _segment; }
 
 		/**
 		 * @brief Set the Radius object
 		 * 
 		 * @return QXfloat& 
 		 */
-		inline QXfloat&	SetRadius() noexcept { return _radius; }
+		inline T&	SetRadius() noexcept { return _radius; }
 
 		/**
 		 * @brief Get the Radius object
 		 * 
 		 * @return QXfloat 
 		 */
-		inline QXfloat	GetRadius() const noexcept { return _radius; }
+		inline T	GetRadius() const noexcept { return _radius; }
 
 		/**
 		 * @brief Get the Square Radius object
 		 * 
 		 * @return QXfloat 
 		 */
-		inline QXfloat	GetSqrtRadius() const noexcept {return _radius * _radius;}
+		inline T	GetSqrtRadius() const noexcept {return _radius * _radius;}
 
 	#pragma endregion Accessors
 	#pragma endregion Functions
 	};
+
+	using QXcylinder	= QXcylindert<QXfloat>;
+	using QXdcylinder	= QXcylindert<QXdouble>;
 }
 
 
@@ -0,0 +1,55 @@
+#ifndef __DISTANCE_H__
+#define __DISTANCE_H__
+
+#include "OrientedBox.h"
+#include "Segment.h"
+
+/* segments whose squared sine is below this are parallel, their closest points are taken in the middle of the overlap */
+#define QX_SEGMENT_PARALLEL_EPSILON 1e-6f
+
+namespace Math::Geometry
+{
+	#pragma region Functions
+
+	/**
+	 * @brief Squared distance between a segment and a point
+	 *
+	 * @param segment Segment, may be a single point
+	 * @param point Point
+	 * @param along Receives the ratio of the closest point on the segment, in [0, 1], if not nullptr
+	 * @return QXfloat Squared distance
+	 */
+	QXfloat	SqrDistance(const QXsegment& segment, const QXvec3& point, QXfloat* along = nullptr) noexcept;
+
+	/**
+	 * @brief Squared distance between two segments
+	 *
+	 * Either segment may be a single point. Parallel overlapping segments get the closest points in the middle of the
+	 * overlap, so resting capsules do not jump from one end to the other.
+	 *
+	 * @param first First segment
+	 * @param second Second segment
+	 * @param alongFirst Receives the ratio of the closest point on the first segment, in [0, 1], if not nullptr
+	 * @param alongSecond Receives the ratio of the closest point on the second segment, in [0, 1], if not nullptr
+	 * @return QXfloat Squared distance
+	 */
+	QXfloat	SqrDistance(const QXsegment& first, const QXsegment& second, QXfloat* alongFirst = nullptr, QXfloat* alongSecond = nullptr) noexcept;
+
+	/**
+	 * @brief Squared distance between a segment and an oriented box, 0 when the segment crosses the box
+	 *
+	 * The squared distance to the box is a piecewise quadratic of the ratio along the segment, with pieces cut where
+	 * the segment crosses the planes of the faces: each piece is minimized exactly.
+	 *
+	 * @param segment Segment
+	 * @param box Box
+	 * @param along Receives the ratio of the closest point on the segment, in [0, 1], if not nullptr
+	 * @param closest Receives the closest point of the box if not nullptr
+	 * @return QXfloat Squared distance
+	 */
+	QXfloat	SqrDistance(const QXsegment& segment, const QXorientedBox& box, QXfloat* along = nullptr, QXvec3* closest = nullptr) noexcept;
+
+	#pragma endregion Functions
+}
+
+#endif // __DISTANCE_H__
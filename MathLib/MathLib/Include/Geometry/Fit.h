@@ -0,0 +1,75 @@
+#ifndef __FIT_H__
+#define __FIT_H__
+
+#include "Box.h"
+#include "OrientedBox.h"
+#include "Sphere.h"
+
+/* point sets smaller than this are fitted on the calling thread, starting threads costs more than the scan */
+#define QX_FIT_PARALLEL_POINTS 65536
+/* points within this relative squared radius of the Welzl sphere are inside, so round-off does not restart its loops */
+#define QX_FIT_SPHERE_EPSILON 1e-7
+/* random points the Welzl search starts from, the points left out of their sphere are added until there are none */
+#define QX_FIT_WELZL_SAMPLE 1024u
+
+namespace Math::Geometry
+{
+	#pragma region Functions
+
+	/**
+	 * @brief Axis aligned box of a point set, min and max on the widest SIMD lanes available
+	 *
+	 * @param points Points
+	 * @param count Number of points, an empty set gives a null box at the origin
+	 * @param parallel Split large sets on every hardware thread
+	 * @return QXbox Smallest axis aligned box holding the points
+	 */
+	QXbox			FitBox(const QXvec3* points, QXuint count, QXbool parallel = true);
+
+	/**
+	 * @brief Bounding sphere of a point set (Ritter)
+	 *
+	 * The sphere across the farthest pair of the extreme points on x, y and z grows to hold every point, then its
+	 * radius is fitted to its center. Three linear passes, usually 5 to 20 % larger than the minimal sphere. In parallel
+	 * each chunk grows its own sphere and the spheres are merged, so the result can differ slightly from the one of a
+	 * single thread.
+	 *
+	 * @param points Points
+	 * @param count Number of points, an empty set gives a null sphere at the origin
+	 * @param parallel Split large sets on every hardware thread
+	 * @return QXsphere Sphere holding the points
+	 */
+	QXsphere		FitSphereRitter(const QXvec3* points, QXuint count, QXbool parallel = true);
+
+	/**
+	 * @brief Minimal bounding sphere of a point set (Welzl)
+	 *
+	 * Randomized incremental form on a random sample, in expected linear time, then again on the sample plus the points
+	 * left out of its sphere until none is (Clarkson): large sets are only scanned, usually twice. Spheres through 2 to 4
+	 * points are computed in double, then the radius is fitted to the float center, so every point is inside. The seed
+	 * is fixed so the result is reproducible.
+	 *
+	 * @param points Points
+	 * @param count Number of points, an empty set gives a null sphere at the origin
+	 * @param parallel Split the scans of large sets on every hardware thread
+	 * @return QXsphere Smallest sphere holding the points
+	 */
+	QXsphere		FitSphereWelzl(const QXvec3* points, QXuint count, QXbool parallel = true);
+
+	/**
+	 * @brief Oriented box of a point set along the principal axes of its covariance (PCA)
+	 *
+	 * The covariance is summed in double, its eigen vectors give a right handed frame. The axis aligned box of the
+	 * same pass is returned instead when its surface is smaller, as for point sets without a main direction.
+	 *
+	 * @param points Points
+	 * @param count Number of points, an empty set gives a null box at the origin
+	 * @param parallel Split large sets on every hardware thread
+	 * @return QXorientedBox Box holding the points, its ref has unit axes
+	 */
+	QXorientedBox	FitOrientedBox(const QXvec3* points, QXuint count, QXbool parallel = true);
+
+	#pragma endregion Functions
+}
+
+#endif // __FIT_H__
@@ -0,0 +1,195 @@
+#ifndef __GJK_H__
+#define __GJK_H__
+
+#include "Box.h"
+#include "Capsule.h"
+#include "Cylinder.h"
+#include "OrientedBox.h"
+#include "Quad.h"
+#include "Sphere.h"
+
+#define QX_GJK_MAX_ITERATIONS 64
+/* GJK stops when the distance improves by less than this fraction */
+#define QX_GJK_TOLERANCE 1e-5f
+#define QX_EPA_MAX_ITERATIONS 64
+#define QX_EPA_MAX_VERTICES 64
+/* EPA stops when the closest face moves by less than this distance */
+#define QX_EPA_TOLERANCE 1e-4f
+
+namespace Math::Geometry
+{
+	#pragma region Support Functions
+
+	/**
+	 * @brief Farthest point of a sphere along a direction
+	 *
+	 * @param sphere Shape
+	 * @param direction Search direction, does not need to be normalized
+	 * @return QXvec3 Support point
+	 */
+	QXvec3	Support(const QXsphere& sphere, const QXvec3& direction) noexcept;
+
+	/**
+	 * @brief Farthest point of an axis aligned box along a direction
+	 *
+	 * @param box Shape
+	 * @param direction Search direction, does not need to be normalized
+	 * @return QXvec3 Support point
+	 */
+	QXvec3	Support(const QXbox& box, const QXvec3& direction) noexcept;
+
+	/**
+	 * @brief Farthest point of an oriented box along a direction
+	 *
+	 * @param box Shape, half sizes along the i, j, k axes of its reference
+	 * @param direction Search direction, does not need to be normalized
+	 * @return QXvec3 Support point
+	 */
+	QXvec3	Support(const QXorientedBox& box, const QXvec3& direction) noexcept;
+
+	/**
+	 * @brief Farthest point of a cylinder along a direction
+	 *
+	 * @param cylinder Shape, its segment joins the centers of the two caps
+	 * @param direction Search direction, does not need to be normalized
+	 * @return QXvec3 Support point
+	 */
+	QXvec3	Support(const QXcylinder& cylinder, const QXvec3& direction) noexcept;
+
+	/**
+	 * @brief Farthest point of a capsule along a direction
+	 *
+	 * @param capsule Shape
+	 * @param direction Search direction, does not need to be normalized
+	 * @return QXvec3 Support point
+	 */
+	QXvec3	Support(const QXcapsule& capsule, const QXvec3& direction) noexcept;
+
+	/**
+	 * @brief Farthest point of a segment along a direction
+	 *
+	 * @param segment Shape
+	 * @param direction Search direction, does not need to be normalized
+	 * @return QXvec3 Support point
+	 */
+	QXvec3	Support(const QXsegment& segment, const QXvec3& direction) noexcept;
+
+	/**
+	 * @brief Farthest point of a quad along a direction
+	 *
+	 * @param quad Shape, half sizes along the i and j axes of its reference
+	 * @param direction Search direction, does not need to be normalized
+	 * @return QXvec3 Support point
+	 */
+	QXvec3	Support(const QXquad& quad, const QXvec3& direction) noexcept;
+
+	#pragma endregion Support Functions
+
+	/**
+	 * @brief Any convex primitive seen through its support function, so one GJK serves every pair of shapes
+	 *
+	 * Holds a pointer to the shape, which must outlive the QXconvex.
+	 */
+	class QXconvex
+	{
+	private:
+		#pragma region Attributes
+		const void*	_shape;
+		QXvec3		(*_support)(const void*, const QXvec3&) noexcept;
+		QXvec3		_center;
+		#pragma endregion Attributes
+
+	public:
+		#pragma region Constructors/Destructor
+		/**
+		 * @brief Construct a new QXconvex object from a primitive
+		 *
+		 * @param shape Sphere, box, oriented box, cylinder, segment or quad
+		 */
+		template<typename Shape>
+		QXconvex(const Shape& shape) noexcept;
+
+		/**
+		 * @brief Destroy the QXconvex object
+		 */
+		~QXconvex() = default;
+		#pragma endregion Constructors/Destructor
+
+		#pragma region Methods
+		/**
+		 * @brief Farthest point of the shape along a direction
+		 *
+		 * @param direction Search direction
+		 * @return QXvec3 Support point
+		 */
+		inline QXvec3	Support(const QXvec3& direction) const noexcept { return _support(_shape, direction); }
+
+		/**
+		 * @brief Get Center, a point inside the shape that starts the search
+		 *
+		 * @return QXvec3 Center
+		 */
+		inline QXvec3	GetCenter() const noexcept { return _center; }
+		#pragma endregion Methods
+	};
+
+	/**
+	 * @brief Last simplex of a query, reused as the start of the next query on the same pair
+	 *
+	 * Only the search directions are kept, the points are taken again from the moved shapes.
+	 */
+	struct QXgjkSimplex
+	{
+		QXvec3	directions[4];
+		QXuint	count{ 0 };
+	};
+
+	/**
+	 * @brief Result of a GJK or EPA query
+	 */
+	struct QXgjkResult
+	{
+		/* true when the shapes touch or overlap */
+		QXbool	overlap{ false };
+		/* distance between the shapes when separated, 0 otherwise */
+		QXfloat	distance{ 0.f };
+		/* penetration depth found by EPA */
+		QXfloat	depth{ 0.f };
+		/* unit vector from A to B: moving B by normal * depth separates the shapes */
+		QXvec3	normal;
+		/* closest points when separated, deepest points when overlapping */
+		QXvec3	pointA;
+		QXvec3	pointB;
+		QXuint	iterations{ 0 };
+	};
+
+	#pragma region Functions
+
+	/**
+	 * @brief GJK distance between two convex shapes
+	 *
+	 * @param a First shape
+	 * @param b Second shape
+	 * @param result Receives overlap, distance, closest points and normal when separated
+	 * @param cache Simplex of the previous query on this pair, updated, nullptr for a cold start
+	 * @return QXbool true if the shapes overlap
+	 */
+	QXbool	GjkDistance(const QXconvex& a, const QXconvex& b, QXgjkResult& result, QXgjkSimplex* cache = nullptr) noexcept;
+
+	/**
+	 * @brief GJK then EPA when the shapes overlap: penetration depth, normal and deepest points
+	 *
+	 * Curved shapes (spheres, cylinders) are approximated by the EPA polytope, within QX_EPA_TOLERANCE.
+	 *
+	 * @param a First shape
+	 * @param b Second shape
+	 * @param result Receives the GJK result, plus depth, normal and points when overlapping
+	 * @param cache Simplex of the previous query on this pair, updated, nullptr for a cold start
+	 * @return QXbool true if the shapes overlap
+	 */
+	QXbool	GjkPenetration(const QXconvex& a, const QXconvex& b, QXgjkResult& result, QXgjkSimplex* cache = nullptr) noexcept;
+
+	#pragma endregion Functions
+}
+
+#endif // __GJK_H__
@@ -0,0 +1,116 @@
+#ifndef __KDTREE_H__
+#define __KDTREE_H__
+
+#include <vector>
+
+#include "Vec3.h"
+
+/* ranges of at most this many points are not split and are scanned */
+#define QX_KDTREE_LEAF_SIZE 8
+
+namespace Math::Geometry
+{
+	/**
+	 * @brief Static k-d tree over a point set, for nearest neighbours and radius searches
+	 *
+	 * The tree is implicit: points are reordered so that every subtree is a contiguous range whose middle point
+	 * is the splitting node, only the split axis of each node is stored. Each range is split at its median
+	 * on the widest side of its cell, so the tree is balanced.
+	 */
+	class QXkdTree
+	{
+	private:
+		#pragma region Attributes
+		struct QXentry
+		{
+			QXvec3	point;
+			QXuint	index;
+		};
+
+		struct QXneighbours;
+		struct QXbuildTask;
+
+		std::vector<QXentry>	_entries;
+		/* split axis of the node in the middle of each range, unused in the leaves */
+		std::vector<uint8_t>	_axes;
+		#pragma endregion Attributes
+
+		#pragma region Functions
+		void	BuildRange(QXuint begin, QXuint end, QXvec3 min, QXvec3 max, QXuint depth, std::vector<QXbuildTask>* tasks);
+		void	SearchNearest(QXuint begin, QXuint end, const QXvec3& query, QXneighbours& neighbours) const;
+		void	SearchRadius(QXuint begin, QXuint end, const QXvec3& center, QXfloat sqrRadius, std::vector<QXuint>& result) const;
+		#pragma endregion Functions
+
+	public:
+		#pragma region Constructors/Destructor
+		/**
+		 * @brief Construct an empty QXkdTree object
+		 */
+		QXkdTree() = default;
+
+		/**
+		 * @brief Destroy the QXkdTree object
+		 */
+		~QXkdTree() = default;
+		#pragma endregion Constructors/Destructor
+
+		#pragma region Methods
+		/**
+		 * @brief Rebuild the tree from points
+		 *
+		 * @param points Points, the index of point i is i
+		 * @param count Number of points
+		 * @param parallel The top levels are split on the calling thread, the 64 subtrees below on every hardware thread
+		 */
+		void	Build(const QXvec3* points, QXuint count, QXbool parallel = false);
+
+		/**
+		 * @brief Find the closest point
+		 *
+		 * @param query Query position
+		 * @param sqrDistance Receives the squared distance to the closest point if not nullptr
+		 * @return QXuint Index of the closest point, ~0u if the tree is empty
+		 */
+		QXuint	Nearest(const QXvec3& query, QXfloat* sqrDistance = nullptr) const;
+
+		/**
+		 * @brief Find the k closest points
+		 *
+		 * @param query Query position
+		 * @param k Number of neighbours
+		 * @param result Receives min(k, Count()) indices, closest first
+		 * @param sqrDistances Receives their squared distances if not nullptr
+		 */
+		void	KNearest(const QXvec3& query, QXuint k, std::vector<QXuint>& result, std::vector<QXfloat>* sqrDistances = nullptr) const;
+
+		/**
+		 * @brief Find the k closest points of many queries
+		 *
+		 * @param queries Query positions
+		 * @param count Number of queries
+		 * @param k Number of neighbours
+		 * @param result k indices per query, closest first, ~0u past Count()
+		 * @param parallel Split the queries on every hardware thread
+		 */
+		void	KNearest(const QXvec3* queries, QXuint count, QXuint k, QXuint* result, QXbool parallel = true) const;
+
+		/**
+		 * @brief Find the points inside a sphere
+		 *
+		 * @param center Center of the sphere
+		 * @param radius Radius of the sphere
+		 * @param result Receives the indices, in no particular order
+		 */
+		void	QueryRadius(const QXvec3& center, QXfloat radius, std::vector<QXuint>& result) const;
+
+		/**
+		 * @brief Number of points
+		 *
+		 * @return QXuint Point count
+		 */
+		inline QXuint	Count() const noexcept { return (QXuint)_entries.size(); }
+		#pragma endregion Methods
+	};
+}
+
+#endif // __KDTREE_H__
@@ -0,0 +1,107 @@
+#ifndef __MESH_H__
+#define __MESH_H__
+
+#include "Triangle.h"
+
+/* meshes with fewer triangles than this are processed on the calling thread, starting threads costs more than the pass */
+#define QX_MESH_PARALLEL_TRIANGLES 65536
+
+namespace Math::Geometry
+{
+	/**
+	 * @brief Non owning view on an indexed triangle mesh
+	 *
+	 * Triangle i joins positions[indices[3 * i]], positions[indices[3 * i + 1]] and positions[indices[3 * i + 2]],
+	 * counter clockwise on its front face. The viewed memory must outlive the view.
+	 */
+	struct QXmeshView
+	{
+		#pragma region Attributes
+		const QXvec3*	positions;
+		QXuint			vertexCount;
+		const QXuint*	indices;
+		QXuint			triangleCount;
+		#pragma endregion Attributes
+
+		#pragma region Constructor/Destructor
+		/**
+		 * @brief Construct an empty QXmeshView object
+		 */
+		constexpr QXmeshView() noexcept :
+			positions{ nullptr }, vertexCount{ 0 }, indices{ nullptr }, triangleCount{ 0 }
+		{}
+
+		/**
+		 * @brief Construct a QXmeshView object on external buffers
+		 *
+		 * @param vertices Vertex positions
+		 * @param vertexNumber Number of vertices
+		 * @param triangleIndices 3 vertex indices per triangle, all below vertexNumber
+		 * @param triangleNumber Number of triangles
+		 */
+		constexpr QXmeshView(const QXvec3* vertices, QXuint vertexNumber, const QXuint* triangleIndices, QXuint triangleNumber) noexcept :
+			positions{ vertices }, vertexCount{ vertexNumber }, indices{ triangleIndices }, triangleCount{ triangleNumber }
+		{}
+
+		/**
+		 * @brief Destroy the QXmeshView object, the viewed memory is untouched
+		 */
+		~QXmeshView() = default;
+		#pragma endregion Constructor/Destructor
+
+		#pragma region Functions
+		/**
+		 * @brief Copy of a triangle of the mesh
+		 *
+		 * @param i Index of the triangle
+		 * @return QXtriangle Triangle i
+		 */
+		inline QXtriangle	GetTriangle(QXuint i) const noexcept
+		{
+			return { positions[indices[3 * i]], positions[indices[3 * i + 1]], positions[indices[3 * i + 2]] };
+		}
+		#pragma endregion Functions
+	};
+
+	#pragma region Functions
+
+	/**
+	 * @brief Unit normal and area of every triangle of a mesh, on the widest SIMD lanes available
+	 *
+	 * @param mesh Mesh
+	 * @param normals Normal of each triangle, null for degenerate ones, skipped when nullptr
+	 * @param areas Area of each triangle, skipped when nullptr
+	 * @param parallel Split large meshes on every hardware thread
+	 */
+	void	FaceNormals(const QXmeshView& mesh, QXvec3* normals, QXfloat* areas, QXbool parallel = true);
+
+	/**
+	 * @brief Unit vertex normals, sum of the normals of the triangles around each vertex weighted by their area
+	 *
+	 * In parallel each chunk of triangles but the first sums into its own buffer of mesh.vertexCount normals, then the
+	 * buffers are added in a fixed order, so the result only depends on the number of hardware threads.
+	 *
+	 * @param mesh Mesh
+	 * @param normals Normal of each vertex, null for vertices without a triangle of non null area
+	 * @param parallel Split large meshes on every hardware thread
+	 */
+	void	VertexNormals(const QXmeshView& mesh, QXvec3* normals, QXbool parallel = true);
+
+	/**
+	 * @brief Point of a mesh closest to a point
+	 *
+	 * Squared distances to the triangles are computed on the widest SIMD lanes available, then the closest point is
+	 * searched on the nearest triangle only. The lowest index wins ties.
+	 *
+	 * @param mesh Mesh
+	 * @param point Point
+	 * @param triangle Index of the nearest triangle, mesh.triangleCount for an empty mesh, not written when nullptr
+	 * @param parallel Split large meshes on every hardware thread
+	 * @return QXvec3 Closest point, point itself for an empty mesh
+	 */
+	QXvec3	ClosestPoint(const QXmeshView& mesh, const QXvec3& point, QXuint* triangle = nullptr, QXbool parallel = true);
+
+	#pragma endregion Functions
+}
+
+#endif // __MESH_H__
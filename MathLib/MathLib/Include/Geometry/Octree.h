@@ -0,0 +1,203 @@
+#ifndef __OCTREE_H__
+#define __OCTREE_H__
+
+#include <vector>
+
+#include "Box.h"
+#include "Plane.h"
+#include "Segment.h"
+#include "Sphere.h"
+
+/* deepest level, the sort keys hold 3 bits per level */
+#define QX_OCTREE_MAX_DEPTH 16
+/* loose bounds of a node are its cell scaled by this, an item fits a node when its extent is at most the cell half size */
+#define QX_OCTREE_LOOSENESS 2.f
+
+namespace Math::Geometry
+{
+	/**
+	 * @brief Loose octree of points, spheres and boxes, for static geometry and point clouds
+	 *
+	 * An item is stored in the node of the cell holding its center, at the deepest level whose cell half size is
+	 * at least its extent, so inserting or removing an item never moves other items. Items are tested by their AABB
+	 * (the bounding box for spheres). Nodes live in one array, the bulk build lays them and their items out in
+	 * Morton order. Items centered outside the bounds stay in the root and are always tested.
+	 */
+	class QXlooseOctree
+	{
+	private:
+		#pragma region Attributes
+		struct QXnode
+		{
+			QXvec3	center;
+			QXfloat	halfSize;
+			/* 0 when there is no child, the root is never a child */
+			QXuint	children[8];
+			QXuint	firstItem;
+		};
+
+		struct QXitem
+		{
+			QXvec3	center;
+			QXvec3	halfSizes;
+			QXuint	handle;
+			QXuint	node;
+			QXuint	previous;
+			QXuint	next;
+		};
+
+		QXvec3					_center;
+		QXfloat					_halfSize;
+		QXuint					_maxDepth;
+
+		std::vector<QXnode>		_nodes;
+		std::vector<QXitem>		_items;
+		/* item of each handle, ~0u for removed handles */
+		std::vector<QXuint>		_slots;
+		std::vector<QXuint>		_freeHandles;
+		std::vector<QXuint>		_freeItems;
+		#pragma endregion Attributes
+
+		#pragma region Functions
+		static QXnode	ChildNode(const QXnode& parent, QXuint digit) noexcept;
+
+		QXuint		Depth(const QXvec3& center, const QXvec3& halfSizes) const noexcept;
+		QXuint64	Morton(const QXvec3& center, QXuint depth) const noexcept;
+		QXuint		Descend(std::vector<QXnode>& nodes, QXuint node, QXuint level, QXuint64 morton, QXuint depth) const;
+		void		Link(QXnode& node, QXuint nodeIndex, QXuint item) noexcept;
+		void		Build(std::vector<QXitem>& items, QXbool parallel);
+		QXuint		Insert(const QXvec3& center, const QXvec3& halfSizes);
+
+		template<typename NodeTest, typename ItemTest>
+		void		Query(NodeTest nodeTest, ItemTest itemTest, std::vector<QXuint>& result) const;
+		#pragma endregion Functions
+
+	public:
+		#pragma region Constructors/Destructor
+		/**
+		 * @brief Construct an empty QXlooseOctree object
+		 *
+		 * @param bounds Region split by the tree, the root is the cube around it
+		 * @param maxDepth Deepest level, clamped to QX_OCTREE_MAX_DEPTH
+		 */
+		QXlooseOctree(const QXbox& bounds, QXuint maxDepth = 8);
+
+		/**
+		 * @brief Destroy the QXlooseOctree object
+		 */
+		~QXlooseOctree() = default;
+		#pragma endregion Constructors/Destructor
+
+		#pragma region Methods
+		/**
+		 * @brief Replace the items by points, the handle of point i is i
+		 *
+		 * Items are sorted by Morton code of their cell, each of the 64 subtrees of level 2 is sorted and built on its own thread.
+		 *
+		 * @param points Points to store
+		 * @param count Number of points
+		 * @param parallel Build on every hardware thread
+		 */
+		void	Build(const QXvec3* points, QXuint count, QXbool parallel = false);
+
+		/**
+		 * @brief Replace the items by spheres, the handle of sphere i is i
+		 *
+		 * @param spheres Spheres to store
+		 * @param count Number of spheres
+		 * @param parallel Build on every hardware thread
+		 */
+		void	Build(const QXsphere* spheres, QXuint count, QXbool parallel = false);
+
+		/**
+		 * @brief Replace the items by boxes, the handle of box i is i
+		 *
+		 * @param boxes Boxes to store
+		 * @param count Number of boxes
+		 * @param parallel Build on every hardware thread
+		 */
+		void	Build(const QXbox* boxes, QXuint count, QXbool parallel = false);
+
+		/**
+		 * @brief Add a point
+		 *
+		 * @param point Point to store
+		 * @return QXuint Handle of the item, handles of removed items are reused
+		 */
+		QXuint	Insert(const QXvec3& point);
+
+		/**
+		 * @brief Add a sphere
+		 *
+		 * @param sphere Sphere to store
+		 * @return QXuint Handle of the item, handles of removed items are reused
+		 */
+		QXuint	Insert(const QXsphere& sphere);
+
+		/**
+		 * @brief Add a box
+		 *
+		 * @param box Box to store
+		 * @return QXuint Handle of the item, handles of removed items are reused
+		 */
+		QXuint	Insert(const QXbox& box);
+
+		/**
+		 * @brief Remove an item, its node is kept until the next build
+		 *
+		 * @param handle Handle of the item
+		 * @return QXbool false if the handle is not in the tree
+		 */
+		QXbool	Remove(QXuint handle);
+
+		/**
+		 * @brief Find the items overlapping a box
+		 *
+		 * @param box Query box
+		 * @param result Receives the handles, in no particular order
+		 */
+		void	QueryBox(const QXbox& box, std::vector<QXuint>& result) const;
+
+		/**
+		 * @brief Find the items overlapping a sphere
+		 *
+		 * @param sphere Query sphere
+		 * @param result Receives the handles, in no particular order
+		 */
+		void	QuerySphere(const QXsphere& sphere, std::vector<QXuint>& result) const;
+
+		/**
+		 * @brief Find the items not fully behind any plane of a frustum, conservative near its edges
+		 *
+		 * @param planes Planes of the frustum, normals pointing inside
+		 * @param planeCount Number of planes, 6 for a camera frustum
+		 * @param result Receives the handles, in no particular order
+		 */
+		void	QueryFrustum(const QXplane* planes, QXuint planeCount, std::vector<QXuint>& result) const;
+
+		/**
+		 * @brief Find the items crossed by a segment, a ray is a long segment
+		 *
+		 * @param segment Query segment
+		 * @param result Receives the handles, in no particular order
+		 */
+		void	QuerySegment(const QXsegment& segment, std::vector<QXuint>& result) const;
+
+		/**
+		 * @brief Number of items
+		 *
+		 * @return QXuint Item count
+		 */
+		QXuint	Count() const noexcept;
+
+		/**
+		 * @brief Number of nodes, empty nodes included
+		 *
+		 * @return QXuint Node count
+		 */
+		inline QXuint	NodeCount() const noexcept { return (QXuint)_nodes.size(); }
+		#pragma endregion Methods
+	};
+}
+
+#endif // __OCTREE_H__
@@ -11,13 +11,14 @@ namespace Math::Geometry
 	/**
 	 * @brief QXorientedBox class
 	 */
-	class QXorientedBox
+	template<typename T>
+	class QXorientedBoxt
 	{
 	private:
 		#pragma region Attributes
 
-		QXref3 _ref;
-		QXvec3 _halfSizes;
+		QXref3t<T> _ref;
+		QXvec3t<T> _halfSizes;
 
 		#pragma endregion Attributes
 
@@ -30,7 +31,7 @@ namespace Math::Geometry
 		 * @param ref Value for _ref parameter QXref3() by default
 		 * @param halfSizes Value for _halfSizes parameter QXvec3() by default
 		 */
-		QXorientedBox(const QXref3& ref = QXref3(), const QXvec3& halfSizes = QXvec3()) noexcept;
+		QXorientedBoxt(const QXref3t<T>& ref = QXref3t<T>(), const QXvec3t<T>& halfSizes = QXvec3t<T>()) noexcept;
 
 		/**
 		 * @brief Construct a new QXorientedBox object
@@ -38,19 +39,29 @@ namespace Math::Geometry
 		 * @param box QXorientedBox to copy
 		 * @param offsetExtention 
 		 */
-		QXorientedBox(const QXorientedBox& box, const QXfloat& offsetExtention = 0.f) noexcept;
+		QXorientedBoxt(const QXorientedBoxt& box, const T& offsetExtention = 0.f) noexcept;
 
 		/**
 		 * @brief Construct a new QXorientedBox object
 		 * 
 		 * @param box QXorientedBox to move
 		 */
-		QXorientedBox(QXorientedBox&& box) noexcept;
+		QXorientedBoxt(QXorientedBoxt&& box) noexcept;
+
+		/**
+		 * @brief Construct a QXorientedBox object from an other scalar type, conversion is explicit only
+		 *
+		 * @param box Oriented box to convert
+		 */
+		template<typename U>
+		explicit QXorientedBoxt(const QXorientedBoxt<U>& box) noexcept :
+			_ref{ box.GetRef() }, _halfSizes{ box.GetHalfSizes() }
+		{}
 
 		/**
 		 * @brief Destroy the QXorientedBox object
 		 */
-		~QXorientedBox() = default;
+		~QXorientedBoxt() = default;
 		#pragma endregion Constructors/Destructor
 
 		#pragma region Methods
@@ -63,7 +74,7 @@ namespace Math::Geometry
 		 * @param box to copy
 		 * @return QXorientedBox& 
 		 */
-		QXorientedBox&	operator=(const QXorientedBox& box) noexcept;
+		QXorientedBoxt&	operator=(const QXorientedBoxt& box) noexcept;
 
 		/**
 		 * @brief Operator = by move
@@ -71,7 +82,7 @@ namespace Math::Geometry
 		 * @param box Box to move
 		 * @return QXorientedBox& Reference of the new Box 
 		 */
-		QXorientedBox& operator=(QXorientedBox&& box) noexcept;
+		QXorientedBoxt& operator=(QXorientedBoxt&& box) noexcept;
 		
 		#pragma endregion Operator
 
@@ -82,91 +93,91 @@ namespace Math::Geometry
 		 * 
 		 * @return Box 
 		 */
-		inline QXbox	GetBox() const  noexcept {return QXbox(_ref.o, _halfSizes);}
+		inline QXboxt<T>	GetBox() const  noexcept {return QXboxt<T>(_ref.o, _halfSizes);}
 
 		/**
 		 * @brief Get the Ref object
 		 * 
 		 * @return QXref3 
 		 */
-		inline QXref3	GetRef() const noexcept {return _ref;}
+		inline QXref3t<T>	GetRef() const noexcept {return _ref;}
 
 		/**
 		 * @brief Set the Ref object
 		 * 
 		 * @return QXref3& 
 		 */
-		inline QXref3&	SetRef() noexcept {return _ref;}
+		inline QXref3t<T>&	SetRef() noexcept {return _ref;}
 
 		/**
 		 * @brief Get the Half Sizes object
 		 * 
 		 * @return QXvec3 
 		 */
-		inline QXvec3	GetHalfSizes() const noexcept {return _halfSizes;}
+		inline QXvec3t<T>	GetHalfSizes() const noexcept {return _halfSizes;}
 
 		/**
 		 * @brief Set the Half Sizes object
 		 * 
 		 * @return QXvec3& 
 		 */
-		inline QXvec3&	SetHalfSizes() noexcept {return _halfSizes;}
+		inline QXvec3t<T>&	SetHalfSizes() noexcept {return _halfSizes;}
 
 		/**
 		 * @brief Get the AABB of the oriented box
 		 * 
 		 * @return QXBox 
 		 */
-		QXbox			GetAABB() const noexcept;
+		QXboxt<T>			GetAABB() const noexcept;
 
 		/**
 		 * @brief Get the Points object
 		 * 
 		 * @return QXvec3* 
 		 */
-		QXvec3*			GetPoints() const noexcept;
+		QXvec3t<T>*			GetPoints() const noexcept;
 
 		/**
 		 * @brief Get the Top Plane object
 		 * 
 		 * @return QXplane 
 		 */
-		QXplane			GetTopPlane() const noexcept;
+		QXplanet<T>			GetTopPlane() const noexcept;
 
 		/**
 		 * @brief Get the Bottom Plane object
 		 * 
 		 * @return QXplane 
 		 */
-		QXplane			GetBottomPlane() const noexcept;
+		QXplanet<T>			GetBottomPlane() const noexcept;
 
 		/**
 		 * @brief Get the Front Plane object
 		 * 
 		 * @return QXplane 
 		 */
-		QXplane			GetFrontPlane() const noexcept;
+		QXplanet<T>			GetFrontPlane() const noexcept;
 
 		/**
 		 * @brief Get the Back Plane object
 		 * 
 		 * @return QXplane 
 		 */
-		QXplane			GetBackPlane() const noexcept;
+		QXplanet<T>			GetBackPlane() const noexcept;
 
 		/**
 		 * @brief Get the Left Plane object
 		 * 
 		 * @return QXplane 
 		 */
-		QXplane			GetLeftPlane() const noexcept;
+		QXplanet<T>			GetLeftPlane() const noexcept;
 
 		/**
 		 * @brief Get the Right Plane object
 		 * 
 		 * @return QXplane 
 		 */
-		QXplane			GetRightPlane() const noexcept;
+		QXplanet<T>			GetRightPlane() const noexcept;
 
 		/**
 		 * @brief Get the Number Plane Good Side object
@@ -174,7 +185,7 @@ namespace Math::Geometry
 		 * @param point QXvec 
 		 * @return QXint number of planes that are in the good side
 		 */
-		QXint			GetNumberPlaneGoodSide(const QXvec3& point) const noexcept;
+		QXint			GetNumberPlaneGoodSide(const QXvec3t<T>& point) const noexcept;
 
 		/**
 		 * @brief Get the Segments With This Point object
@@ -182,10 +193,13 @@ namespace Math::Geometry
 		 * @param point 
 		 * @return QXsegment* between the point and the oriented box
 		 */
-		QXsegment*		GetSegmentsWithThisPoint(const QXvec3& point) const noexcept;
+		QXsegmentt<T>*		GetSegmentsWithThisPoint(const QXvec3t<T>& point) const noexcept;
 		#pragma endregion Accessors
 		#pragma endregion Methods
 	};
+
+	using QXorientedBox	= QXorientedBoxt<QXfloat>;
+	using QXdorientedBox	= QXorientedBoxt<QXdouble>;
 }
 
 
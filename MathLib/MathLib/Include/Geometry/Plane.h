@@ -10,12 +10,13 @@ namespace Math::Geometry
 	/**
 	 * @brief QXplane class
 	 */
-	class QXplane
+	template<typename T>
+	class QXplanet
 	{
 	private:
 		#pragma region Attributes
-		QXvec3	_normal;
-		QXfloat	_d;
+		QXvec3t<T>	_normal;
+		T	_d;
 		#pragma endregion Attributes
 
 	public:
@@ -24,21 +25,21 @@ namespace Math::Geometry
 		 * @brief Construct a new QXplane object
 		 * 
 		 */
-		QXplane();
+		QXplanet();
 
 		/**
 		 * @brief Construct a new QXplane object
 		 * 
 		 * @param plane to copy
 		 */
-		QXplane(const QXplane& plane);
+		QXplanet(const QXplanet& plane);
 
 		/**
 		 * @brief Construct a new QXplane object
 		 * 
 		 * @param plane to move 
 		 */
-		QXplane(QXplane&& plane);
+		QXplanet(QXplanet&& plane);
 
 		/**
 		 * @brief Construct a new QXplane object
@@ -46,7 +47,7 @@ namespace Math::Geometry
 		 * @param normal of the plane
 		 * @param d distance
 		 */
-		QXplane(const QXvec3& normal, const QXfloat& d);
+		QXplanet(const QXvec3t<T>& normal, const T& d);
 
 		/**
 		 * @brief Construct a new QXplane object
@@ -55,7 +56,7 @@ namespace Math::Geometry
 		 * @param p2 QXvec3 of the second point
 		 * @param p3 QXvec3 of the third point
 		 */
-		QXplane(const QXvec3& p1, const QXvec3& p2, const QXvec3& p3);
+		QXplanet(const QXvec3t<T>& p1, const QXvec3t<T>& p2, const QXvec3t<T>& p3);
 
 		/**
 		 * @brief Construct a new QXplane object
@@ -63,13 +64,23 @@ namespace Math::Geometry
 		 * @param normal of the plane
 		 * @param p point on the plane
 		 */
-		QXplane(const QXvec3& normal, const QXvec3& p);
+		QXplanet(const QXvec3t<T>& normal, const QXvec3t<T>& p);
+
+		/**
+		 * @brief Construct a QXplane object from an other scalar type, conversion is explicit only
+		 *
+		 * @param plane Plane to convert
+		 */
+		template<typename U>
+		explicit QXplanet(const QXplanet<U>& plane) noexcept :
+			_normal{ plane.GetNormal() }, _d{ static_cast<T>(plane.GetDistance()) }
+		{}
 
 		/**
 		 * @brief Destroy the QXplane object
 		 * 
 		 */
-		~QXplane() = default;
+		~QXplanet() = default;
 		#pragma endregion Constructors/Destructor
 
 		#pragma region Methods
@@ -81,7 +92,7 @@ namespace Math::Geometry
 		 * @param p2 QXvec3
 		 * @return QXbool 
 		 */
-		QXbool			SameSide(const QXvec3& p1, const QXvec3& p2) const;
+		QXbool			SameSide(const QXvec3t<T>& p1, const QXvec3t<T>& p2) const;
 
 		#pragma region Accessors
 		/**
@@ -89,14 +100,14 @@ namespace Math::Geometry
 		 * 
 		 * @return QXvec3 
 		 */
-		inline QXvec3	GetNormal() const {return _normal;}
+		inline QXvec3t<T>	GetNormal() const {return _normal;}
 
 		/**
 		 * @brief Get the Distance object
 		 * 
 		 * @return QXfloat 
 		 */
-		inline QXfloat	GetDistance() const {return _d;}
+		inline T	GetDistance() const {return _d;}
 
 		/**
 		 * @brief Get the Distance To Point object
@@ -104,7 +115,7 @@ namespace Math::Geometry
 		 * @param p QXvec3
 		 * @return QXfloat 
 		 */
-		QXfloat			GetDistanceToPoint(const QXvec3& p) const;
+		T			GetDistanceToPoint(const QXvec3t<T>& p) const;
 
 		/**
 		 * @brief Get the Closest Point On Plane object
@@ -112,7 +123,7 @@ namespace Math::Geometry
 		 * @param p QXvec3
 		 * @return QXvec3 
 		 */
-		QXvec3			GetClosestPointOnPlane(const QXvec3& p) const;
+		QXvec3t<T>			GetClosestPointOnPlane(const QXvec3t<T>& p) const;
 
 		/**
 		 * @brief Get the Side object
@@ -120,7 +131,7 @@ namespace Math::Geometry
 		 * @param p QXvec3
 		 * @return QXbool 
 		 */
-		QXbool			GetSide(const QXvec3& p) const;
+		QXbool			GetSide(const QXvec3t<T>& p) const;
 		#pragma endregion Accessors
 
 		#pragma region Static Methods
@@ -133,8 +144,8 @@ namespace Math::Geometry
 		 * @param plane3 third plane
 		 * @return QXvec3 point
 		 */
-		static QXvec3	PlanesIntersection(const QXplane& plane1, const QXplane& plane2,
-										const QXplane& plane3);
+		static QXvec3t<T>	PlanesIntersection(const QXplanet& plane1, const QXplanet& plane2,
+										const QXplanet& plane3);
 		#pragma endregion Static Methods
 
 		#pragma region Operator
@@ -145,10 +156,13 @@ namespace Math::Geometry
 		 * @param plane to copy
 		 * @return QXplane& 
 		 */
-		QXplane& 			operator=(const QXplane& plane);
+		QXplanet& 			operator=(const QXplanet& plane);
 		#pragma endregion Operator
 		#pragma endregion Methods
 	};
+
+	using QXplane	= QXplanet<QXfloat>;
+	using QXdplane	= QXplanet<QXdouble>;
 }
 
 
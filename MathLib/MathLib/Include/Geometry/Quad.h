@@ -6,13 +6,14 @@
 
 namespace Math::Geometry
 {
-	class QXquad
+	template<typename T>
+	class QXquadt
 	{
 	private:
 		#pragma region Attributes
 
-		QXref3 		_ref;
-		QXvec2		_halfSizes;
+		QXref3t<T> 		_ref;
+		QXvec2t<T>		_halfSizes;
 
 		#pragma endregion Attributes
 
@@ -30,9 +31,9 @@ namespace Math::Geometry
 		 * @param x Value for _halfSizes.x parameter 1 by default
 		 * @param y Value for _halfSizes.y parameter 1 by default
 		 */
-		QXquad(const QXvec3& position = QXvec3(0), const QXvec3& i = QXvec3(1, 0, 0),
-				const QXvec3& j = QXvec3(0, 1, 0), const QXvec3& k = QXvec3(0, 0, 1),
-				const QXfloat& x = 1.f, const QXfloat & y = 1.f) noexcept;
+		QXquadt(const QXvec3t<T>& position = QXvec3t<T>(0), const QXvec3t<T>& i = QXvec3t<T>(1, 0, 0),
+				const QXvec3t<T>& j = QXvec3t<T>(0, 1, 0), const QXvec3t<T>& k = QXvec3t<T>(0, 0, 1),
+				const T& x = 1.f, const T & y = 1.f) noexcept;
 
 		/**
 		 * @brief Construct a new QXquad object
@@ -40,26 +41,36 @@ namespace Math::Geometry
 		 * @param ref Value for _ref
 		 * @param halfSizes Value for _halfSizes
 		 */
-		QXquad(const QXref3& ref, const QXvec2& halfSizes) noexcept;
+		QXquadt(const QXref3t<T>& ref, const QXvec2t<T>& halfSizes) noexcept;
 
 		/**
 		 * @brief Construct a new QXquad object
 		 * 
 		 * @param quad Quad to copy
 		 */
-		QXquad(const QXquad& quad) noexcept;
+		QXquadt(const QXquadt& quad) noexcept;
 
 		/**
 		 * @brief Construct a new QXquad object
 		 * 
 		 * @param quad Quad to move
 		 */
-		QXquad(QXquad&& quad) noexcept;
+		QXquadt(QXquadt&& quad) noexcept;
+
+		/**
+		 * @brief Construct a QXquad object from an other scalar type, conversion is explicit only
+		 *
+		 * @param quad Quad to convert
+		 */
+		template<typename U>
+		explicit QXquadt(const QXquadt<U>& quad) noexcept :
+			_ref{ quad.GetRef() }, _halfSizes{ quad.GetHalfSizes() }
+		{}
 
 		/**
 		 * @brief Destroy the QXquad object
 		 */
-		~QXquad() = default;
+		~QXquadt() = default;
 
 		#pragma endregion Contructors
 
@@ -73,7 +84,7 @@ namespace Math::Geometry
 		 * @param quad Quad to copy
 		 * @return QXquad& Reference of the new quad
 		 */
-		QXquad&			operator=(const QXquad& quad) noexcept;
+		QXquadt&			operator=(const QXquadt& quad) noexcept;
 
 		/**
 		 * @brief Operator = by move
@@ -81,7 +92,7 @@ namespace Math::Geometry
 		 * @param quad Quad to move
 		 * @return QXquad& Reference of the new quad
 		 */
-		QXquad&			operator=(QXquad&& quad) noexcept;
+		QXquadt&			operator=(QXquadt&& quad) noexcept;
 
 		#pragma endregion Operators
 
@@ -92,34 +103,37 @@ namespace Math::Geometry
 		 * 
 		 * @return QXref3 
 		 */
-		inline QXref3	GetRef() const noexcept {return _ref;}
+		inline QXref3t<T>	GetRef() const noexcept {return _ref;}
 
 		/**
 		 * @brief Set the Ref object
 		 * 
 		 * @return QXref3& 
 		 */
-		inline QXref3&	SetRef() noexcept {return _ref;}
+		inline QXref3t<T>&	SetRef() noexcept {return _ref;}
 
 		/**
 		 * @brief Get the Half Sizes object
 		 * 
 		 * @return QXvec2 
 		 */
-		inline QXvec2	GetHalfSizes() const noexcept {return _halfSizes;}
+		inline QXvec2t<T>	GetHalfSizes() const noexcept {return _halfSizes;}
 
 		/**
 		 * @brief Set the Half Sizes object
 		 * 
 		 * @return QXvec2& 
 		 */
-		inline QXvec2&	SetHalfSizes() noexcept {return _halfSizes;}
+		inline QXvec2t<T>&	SetHalfSizes() noexcept {return _halfSizes;}
 		
 
 		#pragma endregion Accessors
 
 		#pragma endregion Functions
 	};
+
+	using QXquad	= QXquadt<QXfloat>;
+	using QXdquad	= QXquadt<QXdouble>;
 }
 
 
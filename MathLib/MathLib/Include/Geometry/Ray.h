@@ -0,0 +1,271 @@
+#ifndef __RAY_H__
+#define __RAY_H__
+
+#include <cfloat>
+
+#include "Box.h"
+#include "Capsule.h"
+#include "Cylinder.h"
+#include "Plane.h"
+#include "Segment.h"
+#include "Sphere.h"
+
+/* rays whose determinant with the two edges of a triangle is below this are parallel to it and miss it */
+#define QX_RAY_TRIANGLE_EPSILON 1e-8f
+/* rays whose squared sine with the axis of a cylinder or capsule is below this are parallel to it */
+#define QX_RAY_AXIS_EPSILON 1e-6f
+
+namespace Math::Geometry
+{
+	/**
+	 * @brief Half line from an origin along a direction
+	 *
+	 * The direction does not need to be normalized, hit distances are in units of its length.
+	 */
+	struct QXray
+	{
+		QXvec3	origin;
+		QXvec3	direction;
+
+		/**
+		 * @brief Construct a new QXray object
+		 *
+		 * @param origin Start of the ray
+		 * @param direction Direction of the ray
+		 */
+		QXray(const QXvec3& origin = QXvec3(0.f), const QXvec3& direction = QXvec3(0.f, 0.f, 1.f)) noexcept :
+			origin{ origin }, direction{ direction } {}
+
+		/**
+		 * @brief Construct a new QXray object along a segment, the segment is the part of the ray before distance 1
+		 *
+		 * @param segment Segment from A to B
+		 */
+		QXray(const QXsegment& segment) noexcept : origin{ segment.GetPointA() }, direction{ segment.GetSegmentAB() } {}
+	};
+
+	/**
+	 * @brief Nearest hit of a ray
+	 */
+	struct QXrayHit
+	{
+		/* only hits closer than this are kept, so it also limits the ray, FLT_MAX when nothing was hit */
+		QXfloat	distance{ FLT_MAX };
+		/* outward normal for boxes, spheres, cylinders and capsules, the plane normal, the winding normal of triangles */
+		QXvec3	normal;
+		/* index of the shape hit in the array of the query, ~0u when nothing was hit */
+		QXuint	index{ ~0u };
+	};
+
+	/**
+	 * @brief N rays stored as structure of arrays, cast together on the widest SIMD lanes available
+	 *
+	 * Each lane keeps its own nearest hit, so the packet can be cast against several arrays of shapes,
+	 * for instance the leaves of an acceleration structure visited after IntersectBounds.
+	 *
+	 * @tparam N Number of rays, a multiple of 4
+	 */
+	template<QXuint N>
+	struct QXrayPacket
+	{
+		static_assert(N % 4 == 0, "ray packets hold a multiple of 4 rays");
+
+		QXfloat	originX[N], originY[N], originZ[N];
+		QXfloat	directionX[N], directionY[N], directionZ[N];
+		/* 1 / direction, for the slab tests */
+		QXfloat	inverseX[N], inverseY[N], inverseZ[N];
+		QXfloat	distance[N];
+		QXfloat	normalX[N], normalY[N], normalZ[N];
+		QXuint	index[N];
+
+		/**
+		 * @brief Set a ray and reset its hit
+		 *
+		 * @param lane Lane of the ray
+		 * @param ray Ray to cast
+		 * @param maxDistance Hits farther than this are ignored
+		 */
+		void	SetRay(QXuint lane, const QXray& ray, QXfloat maxDistance = FLT_MAX) noexcept
+		{
+			originX[lane] = ray.origin.x;
+			originY[lane] = ray.origin.y;
+			originZ[lane] = ray.origin.z;
+			directionX[lane] = ray.direction.x;
+			directionY[lane] = ray.direction.y;
+			directionZ[lane] = ray.direction.z;
+			inverseX[lane] = 1.f / ray.direction.x;
+			inverseY[lane] = 1.f / ray.direction.y;
+			inverseZ[lane] = 1.f / ray.direction.z;
+			distance[lane] = maxDistance;
+			normalX[lane] = normalY[lane] = normalZ[lane] = 0.f;
+			index[lane] = ~0u;
+		}
+
+		/**
+		 * @brief Get the nearest hit of a ray
+		 *
+		 * @param lane Lane of the ray
+		 * @return QXrayHit Hit, distance is the max distance when nothing was hit
+		 */
+		QXrayHit	GetHit(QXuint lane) const noexcept
+		{
+			return { distance[lane], QXvec3(normalX[lane], normalY[lane], normalZ[lane]), index[lane] };
+		}
+	};
+
+	using QXrayPacket4	= QXrayPacket<4>;
+	using QXrayPacket8	= QXrayPacket<8>;
+	using QXrayPacket16	= QXrayPacket<16>;
+
+	#pragma region Functions
+
+	/**
+	 * @brief Cast a ray against a box
+	 *
+	 * A ray starting inside the box hits it where it leaves.
+	 *
+	 * @param ray Ray
+	 * @param box Box
+	 * @param hit Nearest hit so far, updated with index 0 if the box is closer
+	 * @return QXbool true if the box is closer than the previous hit
+	 */
+	QXbool	Raycast(const QXray& ray, const QXbox& box, QXrayHit& hit) noexcept;
+
+	/**
+	 * @brief Cast a ray against a sphere
+	 *
+	 * A ray starting inside the sphere hits it where it leaves.
+	 *
+	 * @param ray Ray
+	 * @param sphere Sphere
+	 * @param hit Nearest hit so far, updated with index 0 if the sphere is closer
+	 * @return QXbool true if the sphere is closer than the previous hit
+	 */
+	QXbool	Raycast(const QXray& ray, const QXsphere& sphere, QXrayHit& hit) noexcept;
+
+	/**
+	 * @brief Cast a ray against a plane, both sides are hit
+	 *
+	 * @param ray Ray
+	 * @param plane Plane
+	 * @param hit Nearest hit so far, updated with index 0 if the plane is closer
+	 * @return QXbool true if the plane is closer than the previous hit
+	 */
+	QXbool	Raycast(const QXray& ray, const QXplane& plane, QXrayHit& hit) noexcept;
+
+	/**
+	 * @brief Cast a ray against a triangle, both sides are hit (Moller-Trumbore)
+	 *
+	 * @param ray Ray
+	 * @param a First vertex
+	 * @param b Second vertex
+	 * @param c Third vertex
+	 * @param hit Nearest hit so far, updated with index 0 if the triangle is closer
+	 * @return QXbool true if the triangle is closer than the previous hit
+	 */
+	QXbool	Raycast(const QXray& ray, const QXvec3& a, const QXvec3& b, const QXvec3& c, QXrayHit& hit) noexcept;
+
+	/**
+	 * @brief Cast a ray against a cylinder with flat caps
+	 *
+	 * The infinite cylinder around the axis is intersected with the slab between the caps. A ray starting inside
+	 * the cylinder hits it where it leaves, a cylinder with a null axis is never hit.
+	 *
+	 * @param ray Ray
+	 * @param cylinder Cylinder
+	 * @param hit Nearest hit so far, updated with index 0 if the cylinder is closer
+	 * @return QXbool true if the cylinder is closer than the previous hit
+	 */
+	QXbool	Raycast(const QXray& ray, const QXcylinder& cylinder, QXrayHit& hit) noexcept;
+
+	/**
+	 * @brief Cast a ray against a capsule
+	 *
+	 * The capsule is the union of the cylinder around its segment and of the spheres at both ends, the ray crosses it
+	 * from the first entry to the last exit of the three. A ray starting inside the capsule hits it where it leaves.
+	 *
+	 * @param ray Ray
+	 * @param capsule Capsule
+	 * @param hit Nearest hit so far, updated with index 0 if the capsule is closer
+	 * @return QXbool true if the capsule is closer than the previous hit
+	 */
+	QXbool	Raycast(const QXray& ray, const QXcapsule& capsule, QXrayHit& hit) noexcept;
+
+	/**
+	 * @brief Cast a packet against boxes, each ray keeps its nearest hit
+	 *
+	 * @param packet Rays and their nearest hit so far, hit indices are box indices
+	 * @param boxes Boxes
+	 * @param count Number of boxes
+	 */
+	template<QXuint N>
+	void	Raycast(QXrayPacket<N>& packet, const QXbox* boxes, QXuint count) noexcept;
+
+	/**
+	 * @brief Cast a packet against spheres, each ray keeps its nearest hit
+	 *
+	 * @param packet Rays and their nearest hit so far, hit indices are sphere indices
+	 * @param spheres Spheres
+	 * @param count Number of spheres
+	 */
+	template<QXuint N>
+	void	Raycast(QXrayPacket<N>& packet, const QXsphere* spheres, QXuint count) noexcept;
+
+	/**
+	 * @brief Cast a packet against planes, each ray keeps its nearest hit
+	 *
+	 * @param packet Rays and their nearest hit so far, hit indices are plane indices
+	 * @param planes Planes
+	 * @param count Number of planes
+	 */
+	template<QXuint N>
+	void	Raycast(QXrayPacket<N>& packet, const QXplane* planes, QXuint count) noexcept;
+
+	/**
+	 * @brief Cast a packet against an indexed triangle mesh, each ray keeps its nearest hit
+	 *
+	 * @param packet Rays and their nearest hit so far, hit indices are triangle indices
+	 * @param vertices Vertex positions
+	 * @param indices 3 vertex indices per triangle
+	 * @param count Number of triangles
+	 */
+	template<QXuint N>
+	void	Raycast(QXrayPacket<N>& packet, const QXvec3* vertices, const QXuint* indices, QXuint count) noexcept;
+
+	/**
+	 * @brief Cast a packet against cylinders, each ray keeps its nearest hit
+	 *
+	 * @param packet Rays and their nearest hit so far, hit indices are cylinder indices
+	 * @param cylinders Cylinders
+	 * @param count Number of cylinders
+	 */
+	template<QXuint N>
+	void	Raycast(QXrayPacket<N>& packet, const QXcylinder* cylinders, QXuint count) noexcept;
+
+	/**
+	 * @brief Cast a packet against capsules, each ray keeps its nearest hit
+	 *
+	 * @param packet Rays and their nearest hit so far, hit indices are capsule indices
+	 * @param capsules Capsules
+	 * @param count Number of capsules
+	 */
+	template<QXuint N>
+	void	Raycast(QXrayPacket<N>& packet, const QXcapsule* capsules, QXuint count) noexcept;
+
+	/**
+	 * @brief Traversal hook of acceleration structures: which rays of a packet enter a node before their nearest hit
+	 *
+	 * A node with no lane set is skipped by the whole packet, children can be visited by increasing entry distance.
+	 *
+	 * @param packet Rays and their nearest hit so far
+	 * @param bounds Bounds of the node
+	 * @param entry Receives the smallest entry distance of the lanes set if not nullptr
+	 * @return QXuint One bit per lane, set when the ray enters the bounds before its nearest hit
+	 */
+	template<QXuint N>
+	QXuint	IntersectBounds(const QXrayPacket<N>& packet, const QXbox& bounds, QXfloat* entry = nullptr) noexcept;
+
+	#pragma endregion Functions
+}
+
+#endif // __RAY_H__
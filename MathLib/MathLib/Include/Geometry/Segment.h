@@ -5,12 +5,13 @@
 
 namespace Math::Geometry
 {
-	class QXsegment
+	template<typename T>
+	class QXsegmentt
 	{
 	private:
 		#pragma region Attributes
-		QXvec3	_a;
-		QXvec3	_b;
+		QXvec3t<T>	_a;
+		QXvec3t<T>	_b;
 		#pragma endregion Attributes
 
 	public:
@@ -21,27 +22,37 @@ namespace Math::Geometry
 		 * @param a first point
 		 * @param b second point
 		 */
-		QXsegment(const QXvec3& a = 0.f, const QXvec3 & b = 1.f);
+		QXsegmentt(const QXvec3t<T>& a = 0.f, const QXvec3t<T> & b = 1.f);
 
 		/**
 		 * @brief Construct a new QXsegment object
 		 * 
 		 * @param seg QXsegment to copy
 		 */
-		QXsegment(const QXsegment& seg);
+		QXsegmentt(const QXsegmentt& seg);
 
 		/**
 		 * @brief Construct a new QXsegment object
 		 * 
 		 * @param seg QXsegment to move
 		 */
-		QXsegment(QXsegment&& seg) noexcept;
+		QXsegmentt(QXsegmentt&& seg) noexcept;
+
+		/**
+		 * @brief Construct a QXsegment object from an other scalar type, conversion is explicit only
+		 *
+		 * @param seg Segment to convert
+		 */
+		template<typename U>
+		explicit QXsegmentt(const QXsegmentt<U>& seg) noexcept :
+			_a{ seg.GetPointA() }, _b{ seg.GetPointB() }
+		{}
 
 		/**
 		 * @brief Destroy the QXsegment object
 		 * 
 		 */
-		~QXsegment() = default;
+		~QXsegmentt() = default;
 		#pragma endregion Constructors/Destructor
 
 		#pragma region Methods
@@ -52,28 +63,28 @@ namespace Math::Geometry
 		 * 
 		 * @return QXvec3 
 		 */
-		inline QXvec3	GetPointA() const {return _a;}
+		inline QXvec3t<T>	GetPointA() const {return _a;}
 
 		/**
 		 * @brief Get the Point B object
 		 * 
 		 * @return QXvec3 
 		 */
-		inline QXvec3	GetPointB() const {return _b;}
+		inline QXvec3t<T>	GetPointB() const {return _b;}
 
 		/**
 		 * @brief Get the Segment AB object
 		 * 
 		 * @return QXvec3 
 		 */
-		inline QXvec3	GetSegmentAB() const {return _b - _a;}
+		inline QXvec3t<T>	GetSegmentAB() const {return _b - _a;}
 
 		/**
 		 * @brief Get the Segment BA object
 		 * 
 		 * @return QXvec3 
 		 */
-		inline QXvec3	GetSegmentBA() const {return _a - _b;}
+		inline QXvec3t<T>	GetSegmentBA() const {return _a - _b;}
 
 		/**
 		 * @brief Get the Point object
@@ -81,7 +92,7 @@ namespace Math::Geometry
 		 * @param t QXfloat ratio
 		 * @return QXvec3 point on the segment
 		 */
-		inline QXvec3	GetPoint(const QXfloat& t) const {return _a + (_b - _a) * t;}
+		inline QXvec3t<T>	GetPoint(const T& t) const {return _a + (_b - _a) * t;}
 		#pragma endregion Accessors
 
 		#pragma region Operator
@@ -92,10 +103,13 @@ namespace Math::Geometry
 		 * @param seg QXsegment to copy
 		 * @return QXsegment& 
 		 */
-		QXsegment&		operator=(const QXsegment& seg);
+		QXsegmentt&		operator=(const QXsegmentt& seg);
 		#pragma endregion Operator
 		#pragma endregion Methods
 	};
+
+	using QXsegment	= QXsegmentt<QXfloat>;
+	using QXdsegment	= QXsegmentt<QXdouble>;
 }
 
 
@@ -0,0 +1,121 @@
+#ifndef __SPATIALHASH_H__
+#define __SPATIALHASH_H__
+
+#include <utility>
+#include <vector>
+
+#include "Sphere.h"
+
+/* buckets of an empty grid, the table grows to the power of two above twice the item count */
+#define QX_SPATIAL_HASH_MIN_BUCKETS 16u
+
+namespace Math::Geometry
+{
+	/**
+	 * @brief Uniform grid of cubic cells stored in a hash table, for points or spheres
+	 *
+	 * Items are bucketed by the cell of their center and sorted by bucket (counting sort), so the items of one bucket
+	 * are contiguous in memory. Spheres are found by extending the searched cells by the biggest radius,
+	 * the cell size should be close to the query radius.
+	 */
+	class QXspatialHashGrid
+	{
+	private:
+		#pragma region Attributes
+		QXfloat					_cellSize;
+		QXfloat					_inverseCellSize;
+		QXfloat					_maxRadius;
+		QXuint					_bucketMask;
+
+		/* items of bucket b are [_bucketStart[b], _bucketStart[b + 1]) in the sorted arrays */
+		std::vector<QXuint>		_bucketStart;
+		std::vector<QXuint>		_indices;
+		std::vector<QXvec3>		_positions;
+		std::vector<QXfloat>	_radii;
+		#pragma endregion Attributes
+
+		#pragma region Functions
+		QXuint	Bucket(QXint x, QXint y, QXint z) const noexcept;
+		void	Build(const QXvec3* positions, const QXfloat* radii, QXuint count, QXbool parallel);
+		void	FindBuckets(const QXvec3& center, QXfloat extent, std::vector<QXuint>& buckets) const;
+		#pragma endregion Functions
+
+	public:
+		#pragma region Constructors/Destructor
+		/**
+		 * @brief Construct an empty QXspatialHashGrid object
+		 *
+		 * @param cellSize Edge length of a cell
+		 */
+		QXspatialHashGrid(QXfloat cellSize = 1.f);
+
+		/**
+		 * @brief Destroy the QXspatialHashGrid object
+		 */
+		~QXspatialHashGrid() = default;
+		#pragma endregion Constructors/Destructor
+
+		#pragma region Methods
+		/**
+		 * @brief Rebuild the grid from points, the hash table has 2 buckets per point
+		 *
+		 * @param points Positions, item i is points[i]
+		 * @param count Number of points
+		 * @param parallel Hash and copy the points on every hardware thread
+		 */
+		void	Build(const QXvec3* points, QXuint count, QXbool parallel = false);
+
+		/**
+		 * @brief Rebuild the grid from spheres
+		 *
+		 * @param spheres Spheres, item i is spheres[i]
+		 * @param count Number of spheres
+		 * @param parallel Hash and copy the spheres on every hardware thread
+		 */
+		void	Build(const QXsphere* spheres, QXuint count, QXbool parallel = false);
+
+		/**
+		 * @brief Find the items touching a sphere
+		 *
+		 * @param center Center of the query
+		 * @param radius Radius of the query
+		 * @param result Receives the indices of the points inside, or of the spheres overlapping, in no particular order
+		 */
+		void	QueryRadius(const QXvec3& center, QXfloat radius, std::vector<QXuint>& result) const;
+
+		/**
+		 * @brief Find every pair of items closer than a distance, each pair once
+		 *
+		 * For spheres the distance is between their surfaces.
+		 *
+		 * @param distance Maximum distance, 0 gives the overlapping spheres
+		 * @param pairs Receives the pairs, first index smaller than the second
+		 * @param parallel Search on every hardware thread, the order of the pairs then changes from run to run
+		 */
+		void	FindPairs(QXfloat distance, std::vector<std::pair<QXuint, QXuint>>& pairs, QXbool parallel = false) const;
+
+		/**
+		 * @brief Number of items of the last build
+		 *
+		 * @return QXuint Item count
+		 */
+		QXuint	Count() const noexcept;
+
+		/**
+		 * @brief Get Cell Size
+		 *
+		 * @return QXfloat Edge length of a cell
+		 */
+		inline QXfloat	GetCellSize() const noexcept { return _cellSize; }
+
+		/**
+		 * @brief Set Cell Size, used from the next build
+		 *
+		 * @param cellSize Edge length of a cell
+		 */
+		void	SetCellSize(QXfloat cellSize) noexcept;
+		#pragma endregion Methods
+	};
+}
+
+#endif // __SPATIALHASH_H__
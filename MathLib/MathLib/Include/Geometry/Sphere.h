@@ -10,12 +10,13 @@ namespace Math::Geometry
 	 * @brief QXsphere class
 	 * 
 	 */
-	class QXsphere
+	template<typename T>
+	class QXspheret
 	{
 	private:
 		#pragma region Attributes
-		QXvec3	_position;
-		QXfloat	_radius;
+		QXvec3t<T>	_position;
+		T	_radius;
 		#pragma endregion Attributes
 
 	public:
@@ -26,24 +27,34 @@ namespace Math::Geometry
 		 * @param position QXvec3 for the center
 		 * @param radius QXfloat for the radius
 		 */
-		QXsphere(const QXvec3& position = QXvec3(0), const QXfloat& radius = 1.f);
+		QXspheret(const QXvec3t<T>& position = QXvec3t<T>(0), const T& radius = 1.f);
 		/**
 		 * @brief Construct a QXsphere object
 		 * 
 		 * @param sphere QXsphere to copy
 		 */
-		QXsphere(const QXsphere& sphere);
+		QXspheret(const QXspheret& sphere);
 		/**
 		 * @brief Construct a QXsphere object
 		 * 
 		 * @param sphere QXsphere to move
 		 */
-		QXsphere(QXsphere&& sphere);
+		QXspheret(QXspheret&& sphere);
+		/**
+		 * @brief Construct a QXsphere object from an other scalar type, conversion is explicit only
+		 *
+		 * @param sphere Sphere to convert
+		 */
+		template<typename U>
+		explicit QXspheret(const QXspheret<U>& sphere) noexcept :
+			_position{ sphere.GetPosition() }, _radius{ static_cast<T>(sphere.GetRadius()) }
+		{}
+
 		/**
 		 * @brief Destroy a QXsphere object
 		 * 
 		 */
-		~QXsphere() = default;
+		~QXspheret() = default;
 		#pragma endregion Constructors/Destructor
 
 		#pragma region Methods
@@ -54,28 +65,28 @@ namespace Math::Geometry
 		 * 
 		 * @return QXvec3 position of the center of the sphere
 		 */
-		inline QXvec3	GetPosition() const {return _position;}
+		inline QXvec3t<T>	GetPosition() const {return _position;}
 
 		/**
 		 * @brief Set Position
 		 * 
 		 * @return Reference QXvec3 position of the center of the sphere
 		 */
-		inline QXvec3&	SetPosition() {return _position;}
+		inline QXvec3t<T>&	SetPosition() {return _position;}
 
 		/**
 		 * @brief Get Radius
 		 * 
 		 * @return QXfloat radius of the sphere
 		 */
-		inline QXfloat	GetRadius() const {return _radius;}
+		inline T	GetRadius() const {return _radius;}
 
 		/**
 		 * @brief Set Radius
 		 * 
 		 * @return Reference QXfloat radius of the sphere
 		 */
-		inline QXfloat&	SetRadius() {return _radius;}
+		inline T&	SetRadius() {return _radius;}
 		#pragma endregion Accessors
 
 		#pragma region Operator
@@ -86,10 +97,13 @@ namespace Math::Geometry
 		 * @param sphere QXsphere to move
 		 * @return QXsphere& Reference of current sphere
 		 */
-		QXsphere&			operator=(const QXsphere& sphere);
+		QXspheret&			operator=(const QXspheret& sphere);
 		#pragma endregion Operator
 		#pragma endregion Methods
 	};
+
+	using QXsphere	= QXspheret<QXfloat>;
+	using QXdsphere	= QXspheret<QXdouble>;
 }
 
 
@@ -0,0 +1,163 @@
+#ifndef __SWEEP_H__
+#define __SWEEP_H__
+
+#include <cfloat>
+
+#include "Box.h"
+#include "OrientedBox.h"
+#include "Plane.h"
+#include "Quad.h"
+#include "Segment.h"
+#include "Sphere.h"
+
+/* conservative advancement stops when the boxes are closer than this */
+#define QX_TOI_TOLERANCE 1e-3f
+#define QX_TOI_MAX_ITERATIONS 32
+
+namespace Math::Geometry
+{
+	/**
+	 * @brief First contact of a moving shape
+	 */
+	struct QXsweepHit
+	{
+		/* fraction of the motion at the contact, 0 when the shapes overlap at the start, only earlier hits are kept */
+		QXfloat	time{ FLT_MAX };
+		/* unit normal of the obstacle at the contact, towards the moving shape */
+		QXvec3	normal;
+		/* contact point, on the surface of the obstacle */
+		QXvec3	point;
+		/* index of the obstacle in the array of a batch query, ~0u when nothing was hit */
+		QXuint	index{ ~0u };
+	};
+
+	#pragma region Functions
+
+	/**
+	 * @brief Sweep a sphere against a sphere
+	 *
+	 * @param sphere Moving sphere at the start of the motion
+	 * @param motion Displacement during the step, relative to the obstacle
+	 * @param obstacle Other sphere
+	 * @param hit Earliest hit so far, updated with index 0 if this contact is earlier
+	 * @return QXbool true if the spheres touch during the motion, earlier than the previous hit
+	 */
+	QXbool	SweepSphere(const QXsphere& sphere, const QXvec3& motion, const QXsphere& obstacle, QXsweepHit& hit) noexcept;
+
+	/**
+	 * @brief Sweep a sphere against a plane, from the side where the sphere starts
+	 *
+	 * @param sphere Moving sphere at the start of the motion
+	 * @param motion Displacement during the step
+	 * @param plane Obstacle
+	 * @param hit Earliest hit so far, updated with index 0 if this contact is earlier
+	 * @return QXbool true if the sphere touches the plane during the motion, earlier than the previous hit
+	 */
+	QXbool	SweepSphere(const QXsphere& sphere, const QXvec3& motion, const QXplane& plane, QXsweepHit& hit) noexcept;
+
+	/**
+	 * @brief Sweep a sphere against an axis aligned box: its faces, edges and corners inflated by the radius
+	 *
+	 * @param sphere Moving sphere at the start of the motion
+	 * @param motion Displacement during the step
+	 * @param box Obstacle
+	 * @param hit Earliest hit so far, updated with index 0 if this contact is earlier
+	 * @return QXbool true if the sphere touches the box during the motion, earlier than the previous hit
+	 */
+	QXbool	SweepSphere(const QXsphere& sphere, const QXvec3& motion, const QXbox& box, QXsweepHit& hit) noexcept;
+
+	/**
+	 * @brief Sweep a sphere against an oriented box
+	 *
+	 * @param sphere Moving sphere at the start of the motion
+	 * @param motion Displacement during the step
+	 * @param box Obstacle
+	 * @param hit Earliest hit so far, updated with index 0 if this contact is earlier
+	 * @return QXbool true if the sphere touches the box during the motion, earlier than the previous hit
+	 */
+	QXbool	SweepSphere(const QXsphere& sphere, const QXvec3& motion, const QXorientedBox& box, QXsweepHit& hit) noexcept;
+
+	/**
+	 * @brief Sweep a sphere against a quad, a box with no thickness
+	 *
+	 * @param sphere Moving sphere at the start of the motion
+	 * @param motion Displacement during the step
+	 * @param quad Obstacle
+	 * @param hit Earliest hit so far, updated with index 0 if this contact is earlier
+	 * @return QXbool true if the sphere touches the quad during the motion, earlier than the previous hit
+	 */
+	QXbool	SweepSphere(const QXsphere& sphere, const QXvec3& motion, const QXquad& quad, QXsweepHit& hit) noexcept;
+
+	/**
+	 * @brief Sweep a sphere against a segment, a capsule of the sphere radius
+	 *
+	 * @param sphere Moving sphere at the start of the motion
+	 * @param motion Displacement during the step
+	 * @param segment Obstacle
+	 * @param hit Earliest hit so far, updated with index 0 if this contact is earlier
+	 * @return QXbool true if the sphere touches the segment during the motion, earlier than the previous hit
+	 */
+	QXbool	SweepSphere(const QXsphere& sphere, const QXvec3& motion, const QXsegment& segment, QXsweepHit& hit) noexcept;
+
+	/**
+	 * @brief Sweep two moving axis aligned boxes, entry time of the slabs of their relative motion
+	 *
+	 * @param a First box at the start of the motion
+	 * @param motionA Displacement of the first box
+	 * @param b Second box at the start of the motion
+	 * @param motionB Displacement of the second box
+	 * @param hit Earliest hit so far, updated with index 0 if this contact is earlier, the normal is a face normal of b
+	 * @return QXbool true if the boxes touch during the motion, earlier than the previous hit
+	 */
+	QXbool	SweepBoxes(const QXbox& a, const QXvec3& motionA, const QXbox& b, const QXvec3& motionB, QXsweepHit& hit) noexcept;
+
+	/**
+	 * @brief Time of impact of two oriented boxes moving and turning at constant speed, by conservative advancement
+	 *
+	 * The GJK distance and an upper bound of the approach speed give a step that cannot skip the contact,
+	 * the boxes are advanced until they are closer than QX_TOI_TOLERANCE.
+	 *
+	 * @param a First box at the start of the motion
+	 * @param motionA Displacement of the center of the first box
+	 * @param rotationA Rotation of the first box around its center during the step, axis times angle in radians
+	 * @param b Second box at the start of the motion
+	 * @param motionB Displacement of the center of the second box
+	 * @param rotationB Rotation of the second box around its center during the step, axis times angle in radians
+	 * @param hit Earliest hit so far, updated with index 0 if this contact is earlier, the point is halfway between the boxes
+	 * @return QXbool true if the boxes touch during the motion, earlier than the previous hit
+	 */
+	QXbool	TimeOfImpact(const QXorientedBox& a, const QXvec3& motionA, const QXvec3& rotationA, const QXorientedBox& b, const QXvec3& motionB,
+						const QXvec3& rotationB, QXsweepHit& hit) noexcept;
+
+	/**
+	 * @brief Earliest contact of many moving spheres, such as particles, against static boxes
+	 *
+	 * @param spheres Spheres at the start of the motion
+	 * @param motions Displacement of each sphere
+	 * @param count Number of spheres
+	 * @param boxes Obstacles
+	 * @param boxCount Number of obstacles
+	 * @param hits One hit per sphere, updated like the single queries, indices are box indices
+	 * @param parallel Split the spheres on every hardware thread
+	 */
+	void	SweepSpheres(const QXsphere* spheres, const QXvec3* motions, QXuint count, const QXbox* boxes, QXuint boxCount,
+						QXsweepHit* hits, QXbool parallel = true);
+
+	/**
+	 * @brief Earliest contact of many moving spheres, such as particles, against planes
+	 *
+	 * @param spheres Spheres at the start of the motion
+	 * @param motions Displacement of each sphere
+	 * @param count Number of spheres
+	 * @param planes Obstacles
+	 * @param planeCount Number of obstacles
+	 * @param hits One hit per sphere, updated like the single queries, indices are plane indices
+	 * @param parallel Split the spheres on every hardware thread
+	 */
+	void	SweepSpheres(const QXsphere* spheres, const QXvec3* motions, QXuint count, const QXplane* planes, QXuint planeCount,
+						QXsweepHit* hits, QXbool parallel = true);
+
+	#pragma endregion Functions
+}
+
+#endif // __SWEEP_H__
@@ -0,0 +1,150 @@
+#ifndef __SWEEPANDPRUNE_H__
+#define __SWEEPANDPRUNE_H__
+
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "Box.h"
+
+/* more bodies added between two updates than this sort every axis from scratch instead of inserting them one by one */
+#define QX_SAP_REBUILD_ADDITIONS 32
+
+namespace Math::Geometry
+{
+	/**
+	 * @brief Persistent broadphase: finds the overlapping pairs of a set of moving AABBs
+	 *
+	 * The 6 endpoints of each body are kept sorted on the 3 axes across updates with an insertion sort,
+	 * which is close to linear when bodies move a little between two frames. A pair is added when a min endpoint
+	 * passes a max endpoint and the boxes overlap on the 3 axes, and removed when a max endpoint passes a min endpoint.
+	 * Touching boxes overlap.
+	 */
+	class QXsweepAndPrune
+	{
+	private:
+		#pragma region Attributes
+		struct QXendpoint
+		{
+			QXfloat	value;
+			/* body << 1 | 1 for a max endpoint */
+			QXuint	data;
+		};
+
+		struct QXbody
+		{
+			QXfloat	min[3];
+			QXfloat	max[3];
+			QXuint	pairCount;
+			QXbool	alive;
+		};
+
+		std::vector<QXendpoint>					_endpoints[3];
+		std::vector<QXbody>						_bodies;
+		std::vector<QXuint>						_freeHandles;
+		std::vector<QXuint>						_pendingRemovals;
+		QXuint									_pendingAdditions{ 0 };
+		std::unordered_set<QXuint64>			_pairs;
+		std::vector<std::pair<QXuint, QXuint>>	_added;
+		std::vector<std::pair<QXuint, QXuint>>	_removed;
+		#pragma endregion Attributes
+
+		#pragma region Functions
+		QXbool	Overlap(QXuint a, QXuint b) const noexcept;
+		void	AddPair(QXuint a, QXuint b);
+		void	RemovePair(QXuint a, QXuint b);
+		void	SortAxis(QXuint axis);
+		void	Rebuild();
+		#pragma endregion Functions
+
+	public:
+		#pragma region Constructors/Destructor
+		/**
+		 * @brief Construct an empty QXsweepAndPrune object
+		 */
+		QXsweepAndPrune() = default;
+
+		/**
+		 * @brief Destroy the QXsweepAndPrune object
+		 */
+		~QXsweepAndPrune() = default;
+		#pragma endregion Constructors/Destructor
+
+		#pragma region Methods
+		/**
+		 * @brief Add a body, its pairs are found by the next Update
+		 *
+		 * @param box AABB of the body
+		 * @return QXuint Handle of the body, handles of removed bodies are reused
+		 */
+		QXuint	AddBody(const QXbox& box);
+
+		/**
+		 * @brief Remove a body, its pairs are reported removed by the next Update
+		 *
+		 * @param handle Handle returned by AddBody
+		 */
+		void	RemoveBody(QXuint handle);
+
+		/**
+		 * @brief Move a body, the pairs change at the next Update
+		 *
+		 * @param handle Handle returned by AddBody
+		 * @param box New AABB of the body
+		 */
+		void	SetBody(QXuint handle, const QXbox& box);
+
+		/**
+		 * @brief Sort the endpoints and update the pairs, fills the added and removed pair events
+		 */
+		void	Update();
+
+		/**
+		 * @brief Pairs that started overlapping during the last Update, first handle smaller than the second
+		 *
+		 * @return const std::vector<std::pair<QXuint, QXuint>>& Added pairs
+		 */
+		inline const std::vector<std::pair<QXuint, QXuint>>&	GetAddedPairs() const noexcept { return _added; }
+
+		/**
+		 * @brief Pairs that stopped overlapping during the last Update, first handle smaller than the second
+		 *
+		 * A pair can be both added and removed by one Update when its boxes crossed each other.
+		 *
+		 * @return const std::vector<std::pair<QXuint, QXuint>>& Removed pairs
+		 */
+		inline const std::vector<std::pair<QXuint, QXuint>>&	GetRemovedPairs() const noexcept { return _removed; }
+
+		/**
+		 * @brief Every overlapping pair after the last Update
+		 *
+		 * @param pairs Receives the pairs, first handle smaller than the second
+		 */
+		void	GetPairs(std::vector<std::pair<QXuint, QXuint>>& pairs) const;
+
+		/**
+		 * @brief Number of overlapping pairs after the last Update
+		 *
+		 * @return QXuint Pair count
+		 */
+		QXuint	PairCount() const noexcept;
+		#pragma endregion Methods
+
+		#pragma region Statics Functions
+		/**
+		 * @brief One shot box pruning: sort on x then sweep, y and z are tested 4 boxes at once with SSE
+		 *
+		 * Better than the persistent version when most bodies teleport or for a single query.
+		 *
+		 * @param boxes AABBs, index i is boxes[i]
+		 * @param count Number of boxes
+		 * @param pairs Receives the overlapping pairs, first index smaller than the second
+		 * @param parallel Sweep on every hardware thread, the order of the pairs then changes from run to run
+		 */
+		static void	BoxPruning(const QXbox* boxes, QXuint count, std::vector<std::pair<QXuint, QXuint>>& pairs,
+								QXbool parallel = false);
+		#pragma endregion Statics Functions
+	};
+}
+
+#endif // __SWEEPANDPRUNE_H__
@@ -0,0 +1,182 @@
+#ifndef __TRIANGLE_H__
+#define __TRIANGLE_H__
+
+#include "Vec3.h"
+
+namespace Math::Geometry
+{
+	/**
+	 * @brief Class for Triangle, front face is counter clockwise from a to b to c
+	 */
+	template<typename T>
+	class QXtrianglet
+	{
+	private:
+
+	#pragma region Attributes
+
+		QXvec3t<T>	_a;
+		QXvec3t<T>	_b;
+		QXvec3t<T>	_c;
+
+	#pragma endregion Attributes
+
+	public:
+
+	#pragma region Constructors
+
+		/**
+		 * @brief Construct a new QXtriangle object
+		 *
+		 * @param a First point, origin by default
+		 * @param b Second point, x axis by default
+		 * @param c Third point, y axis by default
+		 */
+		QXtrianglet(const QXvec3t<T>& a = QXvec3t<T>(0, 0, 0), const QXvec3t<T>& b = QXvec3t<T>(1, 0, 0),
+					const QXvec3t<T>& c = QXvec3t<T>(0, 1, 0)) noexcept;
+
+		/**
+		 * @brief Construct a new QXtriangle object
+		 *
+		 * @param triangle Triangle to copy
+		 */
+		QXtrianglet(const QXtrianglet& triangle) noexcept;
+
+		/**
+		 * @brief Construct a new QXtriangle object
+		 *
+		 * @param triangle Triangle to move
+		 */
+		QXtrianglet(QXtrianglet&& triangle) noexcept;
+
+		/**
+		 * @brief Construct a QXtriangle object from an other scalar type, conversion is explicit only
+		 *
+		 * @param triangle Triangle to convert
+		 */
+		template<typename U>
+		explicit QXtrianglet(const QXtrianglet<U>& triangle) noexcept :
+			_a{ triangle.GetPointA() }, _b{ triangle.GetPointB() }, _c{ triangle.GetPointC() }
+		{}
+
+		/**
+		 * @brief Destroy the QXtriangle object
+		 */
+		~QXtrianglet() = default;
+
+	#pragma endregion Constructors
+
+	#pragma region Functions
+
+		/**
+		 * @brief Unit normal of the front face, null for a degenerate triangle
+		 *
+		 * @return QXvec3 Normal
+		 */
+		QXvec3t<T>	GetNormal() const noexcept;
+
+		/**
+		 * @brief Area of the triangle
+		 *
+		 * @return T Area, half the length of (b - a) x (c - a)
+		 */
+		T			GetArea() const noexcept;
+
+		/**
+		 * @brief Point of the triangle from its barycentric coordinates
+		 *
+		 * @param barycentric Weights of a, b and c, summing to 1
+		 * @return QXvec3 a * barycentric.x + b * barycentric.y + c * barycentric.z
+		 */
+		QXvec3t<T>	GetPoint(const QXvec3t<T>& barycentric) const noexcept;
+
+		/**
+		 * @brief Point of the triangle closest to a point, searched in the Voronoi regions of its vertices and edges
+		 *
+		 * @param p Point
+		 * @param barycentric Weights of a, b and c of the closest point, not written when nullptr
+		 * @return QXvec3 Closest point
+		 */
+		QXvec3t<T>	GetClosestPoint(const QXvec3t<T>& p, QXvec3t<T>* barycentric = nullptr) const noexcept;
+
+		/**
+		 * @brief Whether the projection of a point on the plane of the triangle is inside it, edges included
+		 *
+		 * @param p Point
+		 * @return QXbool True if inside, always false for a degenerate triangle
+		 */
+		QXbool		IsInside(const QXvec3t<T>& p) const noexcept;
+
+	#pragma region Operators
+
+		/**
+		 * @brief Operator = by copy
+		 *
+		 * @param triangle Triangle to copy
+		 * @return QXtriangle& Reference of the new Triangle
+		 */
+		QXtrianglet& operator=(const QXtrianglet& triangle) noexcept;
+
+		/**
+		 * @brief Operator = by move
+		 *
+		 * @param triangle Triangle to move
+		 * @return QXtriangle& Reference of the new Triangle
+		 */
+		QXtrianglet& operator=(QXtrianglet&& triangle) noexcept;
+
+	#pragma endregion Operators
+
+	#pragma region Accessors
+
+		/**
+		 * @brief Get the Point A object
+		 *
+		 * @return QXvec3
+		 */
+		inline QXvec3t<T>	GetPointA() const noexcept { return _a; }
+
+		/**
+		 * @brief Get the Point B object
+		 *
+		 * @return QXvec3
+		 */
+		inline QXvec3t<T>	GetPointB() const noexcept { return _b; }
+
+		/**
+		 * @brief Get the Point C object
+		 *
+		 * @return QXvec3
+		 */
+		inline QXvec3t<T>	GetPointC() const noexcept { return _c; }
+
+		/**
+		 * @brief Set the Point A object
+		 *
+		 * @return QXvec3&
+		 */
+		inline QXvec3t<T>&	SetPointA() noexcept { return _a; }
+
+		/**
+		 * @brief Set the Point B object
+		 *
+		 * @return QXvec3&
+		 */
+		inline QXvec3t<T>&	SetPointB() noexcept { return _b; }
+
+		/**
+		 * @brief Set the Point C object
+		 *
+		 * @return QXvec3&
+		 */
+		inline QXvec3t<T>&	SetPointC() noexcept { return _c; }
+
+	#pragma endregion Accessors
+	#pragma endregion Functions
+	};
+
+	using QXtriangle	= QXtrianglet<QXfloat>;
+	using QXdtriangle	= QXtrianglet<QXdouble>;
+}
+
+#endif // __TRIANGLE_H__
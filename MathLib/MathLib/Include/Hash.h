@@ -0,0 +1,62 @@
+#ifndef __HASH_H__
+#define __HASH_H__
+
+#include <cstring>
+
+#include "Type.h"
+
+namespace Math
+{
+	#pragma region Functions
+
+	/**
+	 * @brief Finalizer of MurmurHash3, every input bit flips each output bit with a probability close to 1/2
+	 *
+	 * @param h Value to mix
+	 * @return QXuint64 Mixed value
+	 */
+	constexpr QXuint64	HashMix(QXuint64 h) noexcept
+	{
+		h ^= h >> 33;
+		h *= 0xff51afd7ed558ccdull;
+		h ^= h >> 33;
+		h *= 0xc4ceb9fe1a85ec53ull;
+		h ^= h >> 33;
+
+		return h;
+	}
+
+	/**
+	 * @brief Order dependent combination of two hashes, Combine(a, b) != Combine(b, a)
+	 *
+	 * @param seed Hash of the previous values
+	 * @param value Hash of the next value
+	 * @return QXuint64 Combined hash
+	 */
+	constexpr QXuint64	HashCombine(QXuint64 seed, QXuint64 value) noexcept
+	{
+		return HashMix(seed ^ (value + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2)));
+	}
+
+	/**
+	 * @brief Bits of a scalar, +0 and -0 give the same hash as they compare equal
+	 *
+	 * @param value Scalar to hash
+	 * @return QXuint64 Raw bits of value
+	 */
+	template<typename T>
+	inline QXuint64		HashScalar(T value) noexcept
+	{
+		if (value == 0)
+			value = 0;
+
+		QXuint64 bits{ 0 };
+		memcpy(&bits, &value, sizeof(T));
+
+		return bits;
+	}
+
+	#pragma endregion Functions
+}
+
+#endif // __HASH_H__
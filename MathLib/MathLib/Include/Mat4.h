@@ -12,10 +12,11 @@ namespace Math
 	 * @brief QXmat4 structure
 	 * 
 	 */
-	struct QXmat4
+	template<typename T>
+	struct QXmat4t
 	{
 		#pragma region Attributes
-		QXfloat	array[16];
+		T	array[16];
 		#pragma endregion Attributes
 
 		#pragma region Constructor/Destructor
@@ -24,21 +25,29 @@ namespace Math
 		 * @brief Construct a new QXmat4 object
 		 * 
 		 */
-		QXmat4();
+		constexpr QXmat4t();
 
 		/**
 		 * @brief Construct a new QXmat4 object
 		 * 
 		 * @param mat QXmat4 to copy
 		 */
-		QXmat4(const QXmat4& mat);
+		constexpr QXmat4t(const QXmat4t& mat);
+
+		/**
+		 * @brief Construct a new QXmat4 object from an other scalar type, conversion is explicit only
+		 *
+		 * @param mat Matrix to convert
+		 */
+		template<typename U>
+		constexpr explicit QXmat4t(const QXmat4t<U>& mat);
 
 		/* destructor */
 		/**
 		 * @brief Destroy the QXmat4 object
 		 * 
 		 */
-		~QXmat4() = default;
+		~QXmat4t() = default;
 		#pragma endregion Constructor/Destructor
 
 		#pragma region Functions
@@ -48,14 +57,14 @@ namespace Math
 		 * 
 		 * @return QXmat4 Mat inverse matrix
 		 */
-		QXmat4 				Inverse() const;
+		QXmat4t 				Inverse() const;
 
 		/**
 		 * @brief Compute transpose Matrix
 		 * 
 		 * @return QXmat4 Mat transpose matrix
 		 */
-		QXmat4				Transpose() const;
+		constexpr QXmat4t				Transpose() const;
 
 		/* for debug */
 		/**
@@ -65,7 +74,24 @@ namespace Math
 		 */
 		QXstring			ToString() const;
 
+		/**
+		 * @brief Transform an array of points (w = 1), 4 points at once with AVX in double and SSE in float
+		 *
+		 * @param points Points to transform
+		 * @param result Output array of count points, can be points
+		 * @param count Number of points
+		 */
+		void				TransformPoints(const QXvec3t<T>* points, QXvec3t<T>* result, QXuint count) const noexcept;
+
 		#pragma region Operator Functions
+		/**
+		 * @brief Copy a QXmat4
+		 *
+		 * @param mat QXmat4 to copy
+		 * @return QXmat4& This matrix
+		 */
+		constexpr QXmat4t&		operator=(const QXmat4t& mat) = default;
+
 		/* operator for access to the matrix */
 		/**
 		 * @brief Operator [] accessor
@@ -73,7 +99,7 @@ namespace Math
 		 * @param i QXint index to access in matrix
 		 * @return QXfloat* value matrix at index that can be modified
 		 */
-		QXfloat*			operator[](QXint i);
+		constexpr T*			operator[](QXint i);
 
 		/**
 		 * @brief Operator [] accessor
@@ -81,7 +107,7 @@ namespace Math
 		 * @param i QXint index to access in matrix
 		 * @return QXfloat* value matrix at index that cannot be modified
 		 */
-		const QXfloat*		operator[](QXint i) const;
+		constexpr const T*		operator[](QXint i) const;
 
 		/* math operators */
 		/**
@@ -90,7 +116,7 @@ namespace Math
 		 * @param Mat QXmat4 for addition
 		 * @return QXmat4 result of the addition
 		 */
-		QXmat4				operator+(const QXmat4& mat) const;
+		constexpr QXmat4t				operator+(const QXmat4t& mat) const;
 
 		/**
 		 * @brief Operator * multiplication
@@ -98,7 +124,7 @@ namespace Math
 		 * @param Mat QXmat4 for multiplication
 		 * @return new QXmat4 result of the multiplication
 		 */
-		QXmat4				operator*(const QXmat4& mat) const;
+		constexpr QXmat4t				operator*(const QXmat4t& mat) const;
 
 		/**
 		 * @brief Operator * multiplication
@@ -106,7 +132,7 @@ namespace Math
 		 * @param Mat QXmat4 for multiplication
 		 * @return The current QXmat4 mat modify by the multiplication
 		 */
-		QXmat4&				operator*=(const QXmat4& mat);
+		constexpr QXmat4t&				operator*=(const QXmat4t& mat);
 
 		/**
 		 * @brief Operator * multiplication
@@ -114,7 +140,7 @@ namespace Math
 		 * @param vect QXvec3 for multiplication
 		 * @return new QXvec3 result of the multiplication
 		 */
-		QXvec3				operator*(const QXvec3& vec) const;
+		constexpr QXvec3t<T>				operator*(const QXvec3t<T>& vec) const;
 
 		/**
 		 * @brief Operator * multiplication
@@ -122,7 +148,7 @@ namespace Math
 		 * @param vect QXvec4 for multiplication
 		 * @return new QXvec4 result of the multiplication
 		 */
-		QXvec4				operator*(const QXvec4& vec) const;
+		constexpr QXvec4t<T>				operator*(const QXvec4t<T>& vec) const;
 		#pragma endregion Operator Functions
 
 		#pragma region Static Functions
@@ -132,7 +158,7 @@ namespace Math
 		 * @param scale QXvec3 scale vector
 		 * @return new QXmat4 mat4 scale matrix
 		 */
-		static QXmat4		CreateScaleMatrix(const QXvec3& scale);
+		static constexpr QXmat4t		CreateScaleMatrix(const QXvec3t<T>& scale);
 
 		/**
 		 * @brief Create translation matrix
@@ -140,7 +166,7 @@ namespace Math
 		 * @param trans QXvec3 translation vector
 		 * @return new QXmat4 mat4 translation matrix
 		 */
-		static QXmat4		CreateTranslationMatrix(const QXvec3& trans);
+		static constexpr QXmat4t		CreateTranslationMatrix(const QXvec3t<T>& trans);
 
 		/**
 		 * @brief Create rotation matrix
@@ -149,7 +175,7 @@ namespace Math
 		 * @param angle QXfloat the angle in radian
 		 * @return new QXmat4 mat4 rotation matrix
 		 */
-		static QXmat4		CreateRotationMatrix(const QXvec3& axis, const QXfloat& angle);
+		static QXmat4t		CreateRotationMatrix(const QXvec3t<T>& axis, const T& angle);
 
 		/**
 		 * @brief Create rotation on X axis matrix
@@ -157,7 +183,7 @@ namespace Math
 		 * @param angle QXfloat the angle in radian
 		 * @return new QXmat4 mat4 rotation matrix on X axis
 		 */
-		static QXmat4		CreateXRotationMatrix(const QXfloat angle);
+		static QXmat4t		CreateXRotationMatrix(const T angle);
 
 		/**
 		 * @brief Create rotation on Y axis matrix
@@ -165,7 +191,7 @@ namespace Math
 		 * @param angle QXfloat the angle in radian
 		 * @return new QXmat4 mat4 rotation matrix on Y axis
 		 */
-		static QXmat4		CreateYRotationMatrix(const QXfloat angle);
+		static QXmat4t		CreateYRotationMatrix(const T angle);
 
 		/**
 		 * @brief Create rotation on Z axis matrix
@@ -173,7 +199,7 @@ namespace Math
 		 * @param angle QXfloat the angle in radian
 		 * @return new QXmat4 mat4 rotation matrix on Z axis
 		 */
-		static QXmat4		CreateZRotationMatrix(const QXfloat angle);
+		static QXmat4t		CreateZRotationMatrix(const T angle);
 
 		/**
 		 * @brief Create euler rotation matrix
@@ -181,7 +207,7 @@ namespace Math
 		 * @param rotate QXvec3 rotation vector
 		 * @return new QXmat4 mat4 rotation matrix around Y-X-Z axis
 		 */
-		static QXmat4		CreateFixedAngleEulerRotationMatrix(const QXvec3& rotate);
+		static QXmat4t		CreateFixedAngleEulerRotationMatrix(const QXvec3t<T>& rotate);
 
 		/**
 		 * @brief Create TRS matrix
@@ -191,8 +217,8 @@ namespace Math
 		 * @param scale QXvec3 scale vector
 		 * @return new QXmat4 mat4 that is TRS matrix
 		 */
-		static QXmat4		CreateTRSMatrix(const QXvec3& trans, const QXvec3& rotate,
-									const QXvec3& scale);
+		static QXmat4t		CreateTRSMatrix(const QXvec3t<T>& trans, const QXvec3t<T>& rotate,
+									const QXvec3t<T>& scale);
 		/* ============================= */
 
 		/**
@@ -205,8 +231,8 @@ namespace Math
 		 * @param fov QXfloat field of view
 		 * @return new QXmat4 mat4 that is the projection matrix
 		 */
-		static QXmat4		CreateProjectionMatrix(QXint width, QXint height, QXfloat near,
-													QXfloat far, QXfloat fov);
+		static QXmat4t		CreateProjectionMatrix(QXint width, QXint height, T near,
+													T far, T fov);
 
 		/**
 		 * @brief Create orthographic matrix
@@ -217,7 +243,7 @@ namespace Math
 		 * @param far QXfloat far vision
 		 * @return new QXmat4 mat4 that is the orthographic matrix
 		 */
-		static QXmat4		CreateOrthographicProjectionMatrix(QXint width, QXint height, QXfloat near, QXfloat far);
+		static QXmat4t		CreateOrthographicProjectionMatrix(QXint width, QXint height, T near, T far);
 
 		/**
 		 * @brief Create look at matrix
@@ -228,17 +254,199 @@ namespace Math
 		 * @param Scale QXvec3 scale vector
 		 * @return new QXmat4 mat4 that is the look at matrix
 		 */
-		static QXmat4		CreateLookAtMatrix(QXvec3 position, QXvec3 target, QXvec3 up);
+		static QXmat4t		CreateLookAtMatrix(QXvec3t<T> position, QXvec3t<T> target, QXvec3t<T> up);
 
 		/**
 		 * @brief Get Identity Matrix
 		 * 
 		 * @return QXmat4 Mat identity matrix
 		 */
-		static QXmat4		Identity();
+		static constexpr QXmat4t		Identity();
 		#pragma endregion Static Functions
 		#pragma endregion Functions
 	};
+
+	using QXmat4	= QXmat4t<QXfloat>;
+	using QXdmat4	= QXmat4t<QXdouble>;
+
+	#pragma region Constexpr Functions
+
+	template<typename T>
+	constexpr QXmat4t<T>::QXmat4t() :
+		array{}
+	{}
+
+	template<typename T>
+	constexpr QXmat4t<T>::QXmat4t(const QXmat4t<T>& mat) :
+		array{}
+	{
+		for (QXint i = 0; i < 16; i++)
+		{
+			array[i] = mat.array[i];
+		}
+	}
+
+	template<typename T>
+	template<typename U>
+	constexpr QXmat4t<T>::QXmat4t(const QXmat4t<U>& mat) :
+		array{}
+	{
+		for (QXint i = 0; i < 16; i++)
+		{
+			array[i] = static_cast<T>(mat.array[i]);
+		}
+	}
+
+	template<typename T>
+	constexpr QXmat4t<T>	QXmat4t<T>::Transpose() const
+	{
+		QXmat4t<T>	res;
+		T	tmp{ 0 };
+
+	    for (QXint i = 0; i < 4; i++)
+	    {
+	        for (QXint j = 0; j < 4; j++)
+	        {
+	            tmp = array[i * 4 + j];
+	            res[j][i] = tmp;
+	        }
+	    }
+
+	    return res;
+	}
+
+	template<typename T>
+	constexpr T* QXmat4t<T>::operator[](QXint i)
+	{
+		return &array[i * 4];
+	}
+
+	template<typename T>
+	constexpr const T* QXmat4t<T>::operator[](QXint i) const
+	{
+		return &array[i * 4];
+	}
+
+	template<typename T>
+	constexpr QXmat4t<T>	QXmat4t<T>::operator+(const QXmat4t<T>& mat) const
+	{
+		QXmat4t<T>	res;
+
+		for (QXint i = 0; i < 16; i++)
+		{
+			res.array[i] = mat.array[i] + array[i];
+		}
+
+		return res;
+	}
+
+	template<typename T>
+	constexpr QXmat4t<T>	QXmat4t<T>::operator*(const QXmat4t<T>& mat) const
+	{
+		QXmat4t<T>	res;
+		QXint	i{ 0 }, j{ 0 }, k{ 0 };
+
+		for (i = 0; i < 4; i++)
+		{
+			for (j = 0; j < 4; j++)
+			{
+				for (k = 0; k < 4; k++)
+				{
+					res.array[i * 4 + j] += array[i * 4 + k] * mat.array[k * 4 + j];
+				}
+			}
+		}
+
+		return res;
+	}
+
+	template<typename T>
+	constexpr QXmat4t<T>& QXmat4t<T>::operator*=(const QXmat4t<T>& mat)
+	{
+		QXmat4t<T>	res;
+
+		for (QXint i = 0; i < 4; i++)
+		{
+			for (QXint j = 0; j < 4; j++)
+			{
+				for (QXint k = 0; k < 4; k++)
+				{
+					res[i][j] += (*this)[i][k] * mat[k][j];
+				}
+			}
+		}
+
+		(*this) = res;
+
+		return *this;
+	}
+
+	template<typename T>
+	constexpr QXvec3t<T>	QXmat4t<T>::operator*(const QXvec3t<T>& vec) const
+	{
+		return QXvec3t<T>(array[0] * vec.x + array[1] * vec.y + array[2] * vec.z + array[3],
+			array[4] * vec.x + array[5] * vec.y + array[6] * vec.z + array[7],
+			array[8] * vec.x + array[9] * vec.y + array[10] * vec.z + array[11]);
+	}
+
+	template<typename T>
+	constexpr QXvec4t<T>	QXmat4t<T>::operator*(const QXvec4t<T>& vec) const
+	{
+		QXmat4t<T>  matVec;
+		matVec[0][0] = vec.x;
+		matVec[1][0] = vec.y;
+		matVec[2][0] = vec.z;
+		matVec[3][0] = vec.w;
+
+		QXmat4t<T>  res((*this) * matVec);
+
+		QXvec4t<T> vecRes(res[0][0], res[1][0], res[2][0], res[3][0]);
+
+		return vecRes;
+	}
+
+	template<typename T>
+	constexpr QXmat4t<T>	QXmat4t<T>::CreateScaleMatrix(const QXvec3t<T>& scale)
+	{
+		QXmat4t<T>  scaleMatrix;
+
+	    scaleMatrix[0][0] = scale.x;
+	    scaleMatrix[1][1] = scale.y;
+	    scaleMatrix[2][2] = scale.z;
+	    scaleMatrix[3][3] = 1;
+
+	    return scaleMatrix;
+	}
+
+	template<typename T>
+	constexpr QXmat4t<T>	QXmat4t<T>::CreateTranslationMatrix(const QXvec3t<T>& trans)
+	{
+		QXmat4t<T>	transMatrix;
+
+		transMatrix[0][0] = 1;
+		transMatrix[3][0] = trans.x;
+		transMatrix[1][1] = 1;
+		transMatrix[3][1] = trans.y;
+		transMatrix[2][2] = 1;
+		transMatrix[3][2] = trans.z;
+		transMatrix[3][3] = 1;
+
+		return transMatrix;
+	}
+
+	template<typename T>
+	constexpr QXmat4t<T>	QXmat4t<T>::Identity()
+	{
+		QXmat4t<T>	identity;
+
+		identity[0][0] = 1;
+		identity[1][1] = 1;
+		identity[2][2] = 1;
+		identity[3][3] = 1;
+
+		return identity;
+	}
+	#pragma endregion Constexpr Functions
 }
 
 #endif //_MAT4_H_
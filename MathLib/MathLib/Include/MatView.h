@@ -0,0 +1,198 @@
+#ifndef __MATVIEW_H__
+#define __MATVIEW_H__
+
+#include <type_traits>
+
+#include "Mat.h"
+
+namespace Math
+{
+	/**
+	 * @brief Non owning strided view on a matrix of floats
+	 *
+	 * Element (i, j) is data[i * lineStride + j * columnStride], so a view can wrap a QXmat, a sub-block of it,
+	 * its transpose or any external buffer without copy. The viewed memory must outlive the view.
+	 *
+	 * @tparam T QXfloat for a writable view, const QXfloat for a read only view
+	 */
+	template<typename T>
+	struct QXmatViewt
+	{
+		#pragma region Attributes
+		T*		data;
+		QXint	line;
+		QXint	column;
+		QXint	lineStride;
+		QXint	columnStride;
+		#pragma endregion Attributes
+
+		#pragma region Constructor/Destructor
+		/**
+		 * @brief Construct an empty QXmatView object
+		 */
+		constexpr QXmatViewt() noexcept :
+			data{ nullptr }, line{ 0 }, column{ 0 }, lineStride{ 0 }, columnStride{ 1 }
+		{}
+
+		/**
+		 * @brief Construct a QXmatView object on an external buffer
+		 *
+		 * @param buffer First element of the view
+		 * @param ln Number of line
+		 * @param col Number of column
+		 * @param lnStride Distance in floats between two lines
+		 * @param colStride Distance in floats between two columns
+		 */
+		constexpr QXmatViewt(T* buffer, QXint ln, QXint col, QXint lnStride, QXint colStride = 1) noexcept :
+			data{ buffer }, line{ ln }, column{ col }, lineStride{ lnStride }, columnStride{ colStride }
+		{}
+
+		/**
+		 * @brief Construct a QXmatView object on a whole QXmat
+		 *
+		 * @param mat Matrix to view
+		 */
+		QXmatViewt(std::conditional_t<std::is_const_v<T>, const QXmat&, QXmat&> mat) noexcept :
+			data{ mat.array }, line{ mat.line }, column{ mat.column }, lineStride{ mat.column }, columnStride{ 1 }
+		{}
+
+		/**
+		 * @brief Construct a read only QXmatView object from a writable one
+		 *
+		 * @param view View to convert
+		 */
+		template<typename U, typename = std::enable_if_t<std::is_same_v<T, const U>>>
+		constexpr QXmatViewt(const QXmatViewt<U>& view) noexcept :
+			data{ view.data }, line{ view.line }, column{ view.column }, lineStride{ view.lineStride }, columnStride{ view.columnStride }
+		{}
+
+		/**
+		 * @brief Destroy the QXmatView object, the viewed memory is untouched
+		 */
+		~QXmatViewt() = default;
+		#pragma endregion Constructor/Destructor
+
+		#pragma region Functions
+		/**
+		 * @brief Sub-block of the view
+		 *
+		 * @param l First line of the block
+		 * @param c First column of the block
+		 * @param ln Number of line of the block
+		 * @param col Number of column of the block
+		 * @return QXmatViewt View on the block
+		 */
+		constexpr QXmatViewt	Block(QXint l, QXint c, QXint ln, QXint col) const noexcept
+		{
+			return QXmatViewt(&(*this)(l, c), ln, col, lineStride, columnStride);
+		}
+
+		/**
+		 * @brief One line of the view as a 1 x column view
+		 *
+		 * @param l Line index
+		 * @return QXmatViewt View on the line
+		 */
+		constexpr QXmatViewt	Line(QXint l) const noexcept
+		{
+			return Block(l, 0, 1, column);
+		}
+
+		/**
+		 * @brief One column of the view as a line x 1 view
+		 *
+		 * @param c Column index
+		 * @return QXmatViewt View on the column
+		 */
+		constexpr QXmatViewt	Column(QXint c) const noexcept
+		{
+			return Block(0, c, line, 1);
+		}
+
+		/**
+		 * @brief Transpose view, the strides are swapped and nothing is copied
+		 *
+		 * @return QXmatViewt View on the transpose
+		 */
+		constexpr QXmatViewt	Transposed() const noexcept
+		{
+			return QXmatViewt(data, column, line, columnStride, lineStride);
+		}
+
+		/**
+		 * @brief Copy the viewed values in a new matrix
+		 *
+		 * @return QXmat Dense copy
+		 */
+		QXmat					ToMat() const;
+
+		#pragma region Operator Functions
+		/**
+		 * @brief Operator () accessor
+		 *
+		 * @param i Line of the element
+		 * @param j Column of the element
+		 * @return T& Element
+		 */
+		constexpr T&			operator()(QXint i, QXint j) const noexcept
+		{
+			return data[i * lineStride + j * columnStride];
+		}
+		#pragma endregion Operator Functions
+		#pragma endregion Functions
+	};
+
+	using QXmatView			= QXmatViewt<QXfloat>;
+	using QXconstMatView	= QXmatViewt<const QXfloat>;
+
+	#pragma region Functions
+
+	/**
+	 * @brief Copy the values of a view in an other view of same size, they must not overlap
+	 *
+	 * @param src Values to copy
+	 * @param dst Receives the values
+	 */
+	void	Copy(const QXconstMatView& src, const QXmatView& dst) noexcept;
+
+	/**
+	 * @brief Compute result = a + b, result can be a or b
+	 *
+	 * @param a Left operand
+	 * @param b Right operand, same size as a
+	 * @param result Receives the sum, same size as a
+	 */
+	void	Add(const QXconstMatView& a, const QXconstMatView& b, const QXmatView& result) noexcept;
+
+	/**
+	 * @brief Compute result = a * scale, result can be a
+	 *
+	 * @param a Matrix to scale
+	 * @param scale Factor
+	 * @param result Receives the scaled matrix, same size as a
+	 */
+	void	Scale(const QXconstMatView& a, QXfloat scale, const QXmatView& result) noexcept;
+
+	/**
+	 * @brief Compute result = a * b
+	 *
+	 * @param a Left operand
+	 * @param b Right operand, b.line == a.column
+	 * @param result Receives the product (a.line x b.column), must not overlap a or b
+	 */
+	void	Multiply(const QXconstMatView& a, const QXconstMatView& b, const QXmatView& result) noexcept;
+
+	/**
+	 * @brief Solve a * x = b in place by LU with partial pivoting, no allocation
+	 *
+	 * @param a Square matrix, overwritten by its LU factors
+	 * @param b Right hand sides in its columns, receives the solutions
+	 * @return true Solution found
+	 * @return false a is singular
+	 */
+	QXbool	Solve(const QXmatView& a, const QXmatView& b) noexcept;
+
+	#pragma endregion Functions
+}
+
+#endif // __MATVIEW_H__
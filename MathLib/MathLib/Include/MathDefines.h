@@ -7,4 +7,13 @@
 
 #pragma endregion
 
+#pragma region Options
+
+/* define QX_FAST_MATH to build rotations with the float polynomial SinCos (2 ULP) instead of libm */
+
+/* fast SinCos keeps 2 ULP up to this angle, libm is used above */
+#define QX_FAST_SINCOS_RANGE 256.f
+
+#pragma endregion
+
 #endif // __MATHDEFINES_H_
\ No newline at end of file
@@ -10,12 +10,12 @@
 namespace Math
 {
     /**
-     * @brief Solve an quadratic equation
+     * @brief Solve an quadratic equation, see SolveQuadratic in Polynomial.h for every root
      * 
      * @param a Value for coef in x^2
      * @param b Value for coef in x
      * @param c Value for const
-     * @return QXQXfloat Quadratic solver
+     * @return QXfloat Smallest root in [0, 1], -1 if there is none
      */
     QXfloat   QuadraticSolver(const QXfloat& a, const QXfloat& b, const QXfloat& c) noexcept;
     
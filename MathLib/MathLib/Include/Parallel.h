@@ -0,0 +1,50 @@
+#ifndef __PARALLEL_H__
+#define __PARALLEL_H__
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include "Type.h"
+
+namespace Math
+{
+	#pragma region Functions
+
+	/**
+	 * @brief Call func(begin, end) on count items split in one chunk per hardware thread
+	 *
+	 * The calling thread runs the first chunk. Runs func(0, count) on the calling thread when parallel is false
+	 * or when there are fewer items than threads.
+	 *
+	 * @param count Number of items
+	 * @param parallel Allow threads
+	 * @param func Callable taking (QXuint begin, QXuint end)
+	 */
+	template<typename F>
+	void	ParallelFor(QXuint count, QXbool parallel, F func)
+	{
+		QXuint threadCount{ parallel ? std::thread::hardware_concurrency() : 1u };
+		if (threadCount < 2 || count < threadCount)
+		{
+			func(0u, count);
+			return;
+		}
+
+		std::vector<std::thread>	threads;
+		QXuint						chunk{ (count + threadCount - 1) / threadCount };
+
+		threads.reserve(threadCount - 1);
+		for (QXuint begin = chunk; begin < count; begin += chunk)
+			threads.emplace_back(func, begin, std::min(begin + chunk, count));
+
+		func(0u, std::min(chunk, count));
+
+		for (std::thread& thread : threads)
+			thread.join();
+	}
+
+	#pragma endregion Functions
+}
+
+#endif // __PARALLEL_H__
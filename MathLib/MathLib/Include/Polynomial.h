@@ -0,0 +1,94 @@
+#ifndef __POLYNOMIAL_H__
+#define __POLYNOMIAL_H__
+
+#include <cfloat>
+
+#include "Type.h"
+
+/* rounding error of a float polynomial evaluation relative to its magnitude, smaller values are zero and make double roots */
+#define QX_POLYNOMIAL_EPSILON 3e-7f
+/* Newton steps of the root search, bisection when Newton leaves the bracket */
+#define QX_POLYNOMIAL_MAX_ITERATIONS 48
+
+namespace Math
+{
+	/**
+	 * @brief Real roots of a polynomial of degree N
+	 *
+	 * @tparam N Degree of the polynomial, the maximum number of roots
+	 */
+	template<QXuint N>
+	struct QXroots
+	{
+		/* ascending, FLT_MAX after the last root */
+		QXfloat	values[N];
+		QXuint	count{ 0 };
+	};
+
+	#pragma region Functions
+
+	/**
+	 * @brief Real roots of a * x^2 + b * x + c, without cancellation in the smaller root
+	 *
+	 * A null a solves the linear equation. A double root is returned once.
+	 *
+	 * @param a Coef in x^2
+	 * @param b Coef in x
+	 * @param c Constant
+	 * @param lower Roots smaller than this are ignored
+	 * @param upper Roots greater than this are ignored
+	 * @return QXroots<2> Roots in [lower, upper]
+	 */
+	QXroots<2>	SolveQuadratic(QXfloat a, QXfloat b, QXfloat c, QXfloat lower = -FLT_MAX, QXfloat upper = FLT_MAX) noexcept;
+
+	/**
+	 * @brief Real roots of a * x^3 + b * x^2 + c * x + d
+	 *
+	 * The roots of the derivative split [lower, upper] in intervals where the polynomial is monotonic,
+	 * each sign change is refined by Newton steps kept inside the interval. Null leading coefs lower the degree.
+	 *
+	 * @param a Coef in x^3
+	 * @param b Coef in x^2
+	 * @param c Coef in x
+	 * @param d Constant
+	 * @param lower Roots smaller than this are ignored
+	 * @param upper Roots greater than this are ignored
+	 * @return QXroots<3> Roots in [lower, upper]
+	 */
+	QXroots<3>	SolveCubic(QXfloat a, QXfloat b, QXfloat c, QXfloat d, QXfloat lower = -FLT_MAX, QXfloat upper = FLT_MAX) noexcept;
+
+	/**
+	 * @brief Real roots of a * x^4 + b * x^3 + c * x^2 + d * x + e, like SolveCubic
+	 *
+	 * @param a Coef in x^4
+	 * @param b Coef in x^3
+	 * @param c Coef in x^2
+	 * @param d Coef in x
+	 * @param e Constant
+	 * @param lower Roots smaller than this are ignored
+	 * @param upper Roots greater than this are ignored
+	 * @return QXroots<4> Roots in [lower, upper]
+	 */
+	QXroots<4>	SolveQuartic(QXfloat a, QXfloat b, QXfloat c, QXfloat d, QXfloat e, QXfloat lower = -FLT_MAX, QXfloat upper = FLT_MAX) noexcept;
+
+	/**
+	 * @brief Real roots of many polynomials of the same degree, solved together on the widest SIMD lanes available
+	 *
+	 * Ray-quadric tests and time of impact queries pass [0, max distance] or [0, 1] as the interval.
+	 *
+	 * @tparam Degree 2, 3 or 4
+	 * @param coefficients Degree + 1 arrays of count coefs, coefficients[0] holds the coefs of the highest power
+	 * @param count Number of polynomials
+	 * @param roots Degree arrays of count roots, roots[k][i] is the k-th smallest root of polynomial i, FLT_MAX when it has fewer roots
+	 * @param lower Roots smaller than this are ignored
+	 * @param upper Roots greater than this are ignored
+	 * @param parallel Split the polynomials on every hardware thread
+	 */
+	template<QXuint Degree>
+	void	SolvePolynomials(const QXfloat* const* coefficients, QXuint count, QXfloat* const* roots, QXfloat lower = -FLT_MAX,
+							QXfloat upper = FLT_MAX, QXbool parallel = true);
+
+	#pragma endregion Functions
+}
+
+#endif // __POLYNOMIAL_H__
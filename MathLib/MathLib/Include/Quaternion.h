@@ -3,20 +3,23 @@
 #include "Mat.h"
 #include "Mat4.h"
 
+#include <utility>
+
 namespace Math
 {
 	/**
 	 * @brief Quaternion structure
 	 * 
 	 */
-	struct	QXquaternion
+	template<typename T>
+	struct QXquaterniont
 	{
 		#pragma region Attributes
 
 		union
 		{
-			struct { QXfloat w; QXvec3 v; };
-			QXfloat e[4];
+			struct { T w; QXvec3t<T> v; };
+			T e[4];
 		};
 
 		#pragma endregion Attributes
@@ -31,7 +34,7 @@ namespace Math
 		 * @param vy Value for y parameter of Vector
 		 * @param vz Value for z parameter of Vector
 		 */
-		QXquaternion(QXfloat vw = 0.f, QXfloat vx = 0.f, QXfloat vy = 0.f, QXfloat vz = 0.f) noexcept;
+		constexpr QXquaterniont(T vw = 0.f, T vx = 0.f, T vy = 0.f, T vz = 0.f) noexcept;
 
 		/**
 		 * @brief Construct a new Quaternion object
@@ -39,27 +42,35 @@ namespace Math
 		 * @param vw Value of angle in radian
 		 * @param vQ Vector of rotation
 		 */
-		QXquaternion(QXfloat vw, const QXvec3& vQ) noexcept;
+		constexpr QXquaterniont(T vw, const QXvec3t<T>& vQ) noexcept;
 
 		/**
 		 * @brief Construct a new Quaternion object
 		 * 
 		 * @param q Quaternion to copy
 		 */
-		QXquaternion(const QXquaternion& q) noexcept;
+		constexpr QXquaterniont(const QXquaterniont& q) noexcept;
 
 		/**
 		 * @brief Construct a new Quaternion object
 		 *
 		 * @param q Quaternion to move 
 		 */
-		QXquaternion(const QXquaternion&& q) noexcept;
+		constexpr QXquaterniont(const QXquaterniont&& q) noexcept;
+
+		/**
+		 * @brief Construct a new Quaternion object from an other scalar type, conversion is explicit only
+		 *
+		 * @param q Quaternion to convert
+		 */
+		template<typename U>
+		constexpr explicit QXquaterniont(const QXquaterniont<U>& q) noexcept;
 
 		/**
 		 * @brief Destroy the Quaternion object
 		 * 
 		 */
-		~QXquaternion() = default;
+		~QXquaterniont() = default;
 		#pragma endregion Constructors/Destructor
 
 		#pragma region Operators
@@ -70,7 +81,7 @@ namespace Math
 		 * @param q Quaternion to copy
 		 * @return Reference QXquaternion of current Quaternion
 		 */
-		QXquaternion&		operator=(const QXquaternion& q) noexcept;
+		constexpr QXquaterniont&		operator=(const QXquaterniont& q) noexcept;
 
 		/**
 		 * @brief Operator = by move
@@ -78,7 +89,7 @@ namespace Math
 		 * @param q Quaternion to move
 		 * @return QXquaternion& Reference of current Quaternion
 		 */
-		QXquaternion&		operator=(QXquaternion&& q) noexcept;
+		constexpr QXquaterniont&		operator=(QXquaterniont&& q) noexcept;
 
 		/**
 		 * @brief Operator * multiplication
@@ -86,7 +97,7 @@ namespace Math
 		 * @param s float scale value for multiplication
 		 * @return New reference QXquaternion result of multiplication
 		 */
-		QXquaternion		operator*(QXfloat s) const noexcept;
+		constexpr QXquaterniont		operator*(T s) const noexcept;
 
 		/**
 		 * @brief Operator * multiplication
@@ -94,7 +105,7 @@ namespace Math
 		 * @param q Quaternion for multiplication
 		 * @return New reference QXquaternion result of multiplication
 		 */
-		QXquaternion		operator*(const QXquaternion& q) const noexcept;
+		constexpr QXquaterniont		operator*(const QXquaterniont& q) const noexcept;
 
 		/**
 		 * @brief Operator * multiplication with a vector
@@ -102,7 +113,7 @@ namespace Math
 		 * @param vec Vector to multiply
 		 * @return QXvec3& Reference of the new vector
 		 */
-		QXvec3 				operator*(const QXvec3& vec) const noexcept;
+		QXvec3t<T> 				operator*(const QXvec3t<T>& vec) const noexcept;
 
 		/**
 		 * @brief Operator + addition
@@ -110,7 +121,7 @@ namespace Math
 		 * @param q QXquaternion for addition
 		 * @return Reference of new QXquaternion result object
 		 */
-		QXquaternion		operator+(const QXquaternion& q) const noexcept;
+		constexpr QXquaterniont		operator+(const QXquaterniont& q) const noexcept;
 
 		/**
 		 * @brief Operator - substaction
@@ -118,7 +129,7 @@ namespace Math
 		 * @param q QXquaternion for substraction
 		 * @return String quaternion of the current quaternion
 		 */
-		QXquaternion		operator-(const QXquaternion& q) const noexcept;
+		constexpr QXquaterniont		operator-(const QXquaterniont& q) const noexcept;
 
 		/**
 		 * @brief Operator to access quaternion values as an array
@@ -126,7 +137,7 @@ namespace Math
 		 * @param idx Index of the array
 		 * @return QXfloat& Reference of the vector value
 		 */
-		QXfloat& 			operator[](const QXuint idx) noexcept;
+		T& 			operator[](const QXuint idx) noexcept;
 
 		/**
 		 * @brief Operator to access quaternion values as an array
@@ -134,7 +145,7 @@ namespace Math
 		 * @param idx Index of the array
 		 * @return QXfloat Value of the vector array
 		 */
-		QXfloat 			operator[](const QXuint idx) const noexcept;
+		constexpr T 			operator[](const QXuint idx) const noexcept;
 
 		#pragma endregion Operator Functions
 
@@ -145,21 +156,21 @@ namespace Math
 		 * @param q Quaternion to add
 		 * @return Reference of new QXquaternion result object
 		 */
-		QXquaternion		AddQuaternion(const QXquaternion& q) const noexcept;
+		constexpr QXquaterniont		AddQuaternion(const QXquaterniont& q) const noexcept;
 
 		/**
 		 * @brief Conjugate of Quaternion object
 		 * 
 		 * @return Reference of new QXquaternion result object
 		 */
-		QXquaternion		ConjugateQuaternion() const noexcept;
+		constexpr QXquaterniont		ConjugateQuaternion() const noexcept;
 
 		/**
 		 * @brief Convert Quaternion object into Mat4 object
 		 * 
 		 * @return New QXmat4 from the current Quaternion
 		 */
-		QXmat4				ConvertQuaternionToMat() const noexcept;
+		constexpr QXmat4t<T>				ConvertQuaternionToMat() const noexcept;
 
 		/**
 		 * @brief Dot product between two Quaternion object
@@ -167,14 +178,14 @@ namespace Math
 		 * @param q Quaternion to compute dot product
 		 * @return QXfloat float result of dot product
 		 */
-		QXfloat				DotProductQuaternion(const QXquaternion& q) const noexcept;
+		constexpr T				DotProductQuaternion(const QXquaterniont& q) const noexcept;
 
 		/**
 		 * @brief Inverse of the current Quaternion object
 		 * 
 		 * @return Reference QXquaternion of the current Quaternion
 		 */
-		QXquaternion		InverseQuaternion() noexcept;
+		QXquaterniont		InverseQuaternion() noexcept;
 
 		/**
 		 * @brief Multiply Quaternion object with QXfloat
@@ -182,7 +193,7 @@ namespace Math
 		 * @param s float scale value for multiplication
 		 * @return New reference QXquaternion result of multiplication 
 		 */
-		QXquaternion		MultQuaternion(QXfloat s) const noexcept;
+		constexpr QXquaterniont		MultQuaternion(T s) const noexcept;
 
 		/**
 		 * @brief Multiply two Quaternion object
@@ -190,7 +201,7 @@ namespace Math
 		 * @param q Quaternion for multiplication
 		 * @return New reference QXquaternion result of multiplication
 		 */
-		QXquaternion		MultQuaternion(const QXquaternion& q) const noexcept;
+		constexpr QXquaterniont		MultQuaternion(const QXquaterniont& q) const noexcept;
 
 		/**
 		 * @brief Negate of the current Quaternion object
@@ -203,7 +214,7 @@ namespace Math
 		 * 
 		 * @return New reference QXquaternion result of normalize
 		 */
-		QXquaternion		NormalizeQuaternion() noexcept;
+		QXquaterniont		NormalizeQuaternion() noexcept;
 
 		/**
 		 * @brief Nullify the current Quaternion object
@@ -216,21 +227,21 @@ namespace Math
 		 * 
 		 * @return QXfloat length of the current Quaternion
 		 */
-		float				QuaternionLength() const noexcept;
+		T				QuaternionLength() const noexcept;
 
 		/**
 		 * @brief Negate Quaternion object
 		 * 
 		 * @return New reference QXquaternion result of negate Quaternion
 		 */
-		QXquaternion		ReturnNegateQuaternion() const noexcept;
+		constexpr QXquaterniont		ReturnNegateQuaternion() const noexcept;
 
 		/**
 		 * @brief Square root of Quaternion object
 		 * 
 		 * @return QXfloat of the square root of current Quaternion
 		 */
-		float				SqrtRootQuaternion() const noexcept;
+		T				SqrtRootQuaternion() const noexcept;
 
 		/**
 		 * @brief Slerp of Quaternion object
@@ -239,7 +250,7 @@ namespace Math
 		 * @param t float ratio
 		 * @return reference of the current QXquaternion slerp normalize
 		 */
-		QXquaternion		SlerpQuaternion(const QXquaternion& q, QXfloat t) noexcept;
+		QXquaterniont		SlerpQuaternion(const QXquaterniont& q, T t) noexcept;
 
 		/**
 		 * @brief Substract two Quaternion object
@@ -247,7 +258,7 @@ namespace Math
 		 * @param q Quaternion for substraction
 		 * @return New reference QXquaternion result of substraction of two quaternion
 		 */
-		QXquaternion		SubQuaternion(const QXquaternion& q) const noexcept;
+		constexpr QXquaterniont		SubQuaternion(const QXquaterniont& q) const noexcept;
 
 		/**
 		 * @brief String of Quaternion object
@@ -263,7 +274,7 @@ namespace Math
 		 * @param q Quaternion for conversion
 		 * @return New QXmat4 from the Quaternion
 		 */
-		static QXmat4		ConvertQuaternionToMat(const QXquaternion& q) noexcept;
+		static constexpr QXmat4t<T>		ConvertQuaternionToMat(const QXquaterniont& q) noexcept;
 
 		/**
 		 * @brief Convert Mat4 object into Quaternion object
@@ -271,7 +282,7 @@ namespace Math
 		 * @param m Mat4 for conversion
 		 * @return New Quaternion from the Mat4
 		 */
-		static QXquaternion	ConvertMatToQuaternion(const QXmat4& m) noexcept;
+		static QXquaterniont	ConvertMatToQuaternion(const QXmat4t<T>& m) noexcept;
 
 		/**
 		 * @brief Convert Euler angle into Quaternion object
@@ -279,7 +290,7 @@ namespace Math
 		 * @param euler Vec3 for conversion
 		 * @return New Quaternion from Vec3
 		 */
-		static QXquaternion	ConvertEulerAngleToQuaternion(const QXvec3& euler) noexcept;
+		static QXquaterniont	ConvertEulerAngleToQuaternion(const QXvec3t<T>& euler) noexcept;
 
 		/**
 		 * @brief Slerp of Quaternion object
@@ -289,10 +300,224 @@ namespace Math
 		 * @param t float ratio
 		 * @return QXquaternion slerp normalize
 		 */
-		static QXquaternion	SlerpQuaternion(QXquaternion& q1, const QXquaternion& q2, QXfloat t) noexcept;
+		static QXquaterniont	SlerpQuaternion(QXquaterniont& q1, const QXquaterniont& q2, T t) noexcept;
 		#pragma endregion Static Functions
 		#pragma endregion Functions
 
 
 	};
+
+	using QXquaternion	= QXquaterniont<QXfloat>;
+	using QXdquaternion	= QXquaterniont<QXdouble>;
+
+	#pragma region Constexpr Functions
+
+	template<typename T>
+	constexpr QXquaterniont<T>::QXquaterniont(T vw, T vx, T vy, T vz) noexcept : 
+		w(vw), 
+		v(vx, vy, vz)
+	{}
+
+	template<typename T>
+	constexpr QXquaterniont<T>::QXquaterniont(T vw, const QXvec3t<T>& vQ) noexcept :
+		w(vw),
+		v(vQ)
+	{}
+
+	template<typename T>
+	constexpr QXquaterniont<T>::QXquaterniont(const QXquaterniont<T>& q) noexcept : 
+		w{ q.w },
+		v{ q.v }
+	{}
+
+	template<typename T>
+	constexpr QXquaterniont<T>::QXquaterniont(const QXquaterniont<T>&& q) noexcept:
+		w{ std::move(q.w) },
+		v{ std::move(q.v) }
+	{}
+
+	template<typename T>
+	template<typename U>
+	constexpr QXquaterniont<T>::QXquaterniont(const QXquaterniont<U>& q) noexcept :
+		w{ static_cast<T>(q.w) },
+		v{ q.v }
+	{}
+
+	template<typename T>
+	constexpr QXquaterniont<T>& QXquaterniont<T>::operator=(const QXquaterniont<T>& q) noexcept
+	{
+		w = q.w;
+		v = q.v;
+
+		return *this;
+	}
+
+	template<typename T>
+	constexpr QXquaterniont<T>& QXquaterniont<T>::operator=(QXquaterniont<T>&& q) noexcept
+	{
+		w = std::move(q.w);
+		v = std::move(q.v);
+
+		return *this;
+	}
+
+	template<typename T>
+	constexpr QXquaterniont<T> QXquaterniont<T>::operator*(T s) const noexcept
+	{
+		QXquaterniont<T> res = QXquaterniont<T>();
+
+		res.w = s * w;
+		res.v = v * s;
+		return res;
+	}
+
+	template<typename T>
+	constexpr QXquaterniont<T> QXquaterniont<T>::operator*(const QXquaterniont<T>& q) const noexcept
+	{
+		QXquaterniont<T> res{ QXquaterniont<T>() };
+
+		res.w = w * q.w - v.x * q.v.x - v.y * q.v.y - v.z * q.v.z;
+		res.v.x = w * q.v.x + v.x * q.w + v.y * q.v.z - v.z * q.v.y;
+		res.v.y = w * q.v.y - v.x * q.v.z + v.y * q.w + v.z * q.v.x;
+		res.v.z = w * q.v.z + v.x * q.v.y - v.y * q.v.x + v.z * q.w;
+
+		return res;
+	}
+
+	template<typename T>
+	constexpr QXquaterniont<T> QXquaterniont<T>::operator+(const QXquaterniont<T>& q) const noexcept
+	{
+		QXquaterniont<T> res{ QXquaterniont<T>() };
+
+		res.w = w + q.w;
+		res.v = v + q.v;
+		return res;
+	}
+
+	template<typename T>
+	constexpr QXquaterniont<T> QXquaterniont<T>::operator-(const QXquaterniont<T>& q) const noexcept
+	{
+		QXquaterniont<T> res{ QXquaterniont<T>() };
+
+		res.w = w - q.w;
+		res.v = v - q.v;
+		return res;
+	}
+
+	template<typename T>
+	constexpr T QXquaterniont<T>::operator[](const QXuint idx) const noexcept
+	{
+		return idx == 0 ? w : v[idx - 1];
+	}
+
+	template<typename T>
+	constexpr QXquaterniont<T> QXquaterniont<T>::AddQuaternion(const QXquaterniont<T>& q) const noexcept
+	{
+		QXquaterniont<T> res = QXquaterniont<T>();
+
+		res.w = w + q.w;
+		res.v = v + q.v;
+		return res;
+	}
+
+	template<typename T>
+	constexpr QXquaterniont<T> QXquaterniont<T>::ConjugateQuaternion() const noexcept
+	{
+		QXquaterniont<T> res(w, -v.x, -v.y, -v.z);
+		return res;
+	}
+
+	template<typename T>
+	constexpr QXmat4t<T> QXquaterniont<T>::ConvertQuaternionToMat() const noexcept
+	{
+		QXmat4t<T> res;
+
+		res.array[0] = 1 - (2 * v.y * v.y) - (2 * v.z * v.z);
+		res.array[1] = (2 * v.x * v.y) - (2 * w * v.z);
+		res.array[2] = (2 * v.x * v.z) + (2 * w * v.y);
+
+		res.array[4] = (2 * v.x * v.y) + (2 * w * v.z);
+		res.array[5] = 1 - (2 * v.x * v.x) - (2 * v.z * v.z);
+		res.array[6] = (2 * v.y * v.z) - (2 * w * v.x);
+
+		res.array[8] = (2 * v.x * v.z) - (2 * w * v.y);
+		res.array[9] = (2 * v.y * v.z) + (2 * w * v.x);
+		res.array[10] = 1 - (2 * v.x * v.x) - (2 * v.y * v.y);
+		res.array[15] = 1;
+
+		return res;
+	}
+
+	template<typename T>
+	constexpr T QXquaterniont<T>::DotProductQuaternion(const QXquaterniont<T>& q) const noexcept
+	{
+		return (w * q.w + v.Dot(q.v));
+	}
+
+	template<typename T>
+	constexpr QXquaterniont<T> QXquaterniont<T>::MultQuaternion(T s) const noexcept
+	{
+		QXquaterniont<T> res = QXquaterniont<T>();
+
+		res.w = s * w;
+		res.v = v * s;
+		return res;
+	}
+
+	template<typename T>
+	constexpr QXquaterniont<T> QXquaterniont<T>::MultQuaternion(const QXquaterniont<T>& q) const noexcept
+	{
+		QXquaterniont<T> res = QXquaterniont<T>();
+
+		res.w = w * q.w - v.x * q.v.x - v.y * q.v.y - v.z * q.v.z;
+		res.v.x = w * q.v.x + v.x * q.w + v.y * q.v.z - v.z * q.v.y;
+		res.v.y = w * q.v.y - v.x * q.v.z + v.y * q.w + v.z * q.v.x;
+		res.v.z = w * q.v.z + v.x * q.v.y - v.y * q.v.x + v.z * q.w;
+
+		return res;
+	}
+
+	template<typename T>
+	constexpr QXquaterniont<T> QXquaterniont<T>::ReturnNegateQuaternion() const noexcept
+	{
+		QXquaterniont<T> res = QXquaterniont<T>();
+
+		res.w = -w;
+		res.v.x = -v.x;
+		res.v.y = -v.y;
+		res.v.z = -v.z;
+
+		return res;
+	}
+
+	template<typename T>
+	constexpr QXquaterniont<T> QXquaterniont<T>::SubQuaternion(const QXquaterniont<T>& q) const noexcept
+	{
+		QXquaterniont<T> res = QXquaterniont<T>();
+
+		res.w = w - q.w;
+		res.v = v - q.v;
+		return res;
+	}
+
+	template<typename T>
+	constexpr QXmat4t<T> QXquaterniont<T>::ConvertQuaternionToMat(const QXquaterniont<T>& q) noexcept
+	{
+		QXmat4t<T> res;
+		res.array[0] = 1 - (2 * q.v.y * q.v.y) - (2 * q.v.z * q.v.z);
+		res.array[1] = (2 * q.v.x * q.v.y) - (2 * q.w * q.v.z);
+		res.array[2] = (2 * q.v.x * q.v.z) + (2 * q.w * q.v.y);
+
+		res.array[4] = (2 * q.v.x * q.v.y) + (2 * q.w * q.v.z);
+		res.array[5] = 1 - (2 * q.v.x * q.v.x) - (2 * q.v.z * q.v.z);
+		res.array[6] = (2 * q.v.y * q.v.z) - (2 * q.w * q.v.x);
+
+		res.array[8] = (2 * q.v.x * q.v.z) - (2 * q.w * q.v.y);
+		res.array[9] = (2 * q.v.y * q.v.z) + (2 * q.w * q.v.x);
+		res.array[10] = 1 - (2 * q.v.x * q.v.x) - (2 * q.v.y * q.v.y);
+		res.array[15] = 1;
+
+		return res;
+	}
+	#pragma endregion Constexpr Functions
 }
\ No newline at end of file
@@ -9,11 +9,12 @@ namespace Math
 	 * @brief Referentiel3 structure
 	 * 
 	 */
-	struct QXref3
+	template<typename T>
+	struct QXref3t
 	{
 #pragma region Attributes		
 
-		QXvec3 o, i, j, k;
+		QXvec3t<T> o, i, j, k;
 
 #pragma endregion Attributes		
 
@@ -27,7 +28,7 @@ namespace Math
 		 * @param AngleJ Angle around up
 		 * @param AngleK Angle around forward
 		 */
-		QXref3(const QXvec3& O, QXfloat AngleI, QXfloat AngleJ, QXfloat AngleK) noexcept;
+		QXref3t(const QXvec3t<T>& O, T AngleI, T AngleJ, T AngleK) noexcept;
 
 		/**
 		 * @brief Construct a new QXref3 object
@@ -37,27 +38,37 @@ namespace Math
 		 * @param J Value for j parameter by QXvec3::up by default
 		 * @param K Value for k parameter by QXvec3::forward by default
 		 */
-		QXref3(const QXvec3& O = {QXvec3::zero}, const QXvec3& I = {QXvec3::right},
-			const QXvec3& J = {QXvec3::up}, const QXvec3& K = {QXvec3::forward}) noexcept;
+		QXref3t(const QXvec3t<T>& O = {QXvec3t<T>::zero}, const QXvec3t<T>& I = {QXvec3t<T>::right},
+			const QXvec3t<T>& J = {QXvec3t<T>::up}, const QXvec3t<T>& K = {QXvec3t<T>::forward}) noexcept;
 
 		/**
 		 * @brief Construct a new QXref3 object
 		 * 
 		 * @param ref Ref to copy
 		 */
-		QXref3(const QXref3& ref) noexcept;
+		QXref3t(const QXref3t& ref) noexcept;
 
 		/**
 		 * @brief Construct a new QXref3 object
 		 * 
 		 * @param ref Ref to move
 		 */
-		QXref3(QXref3&& ref) noexcept;
+		QXref3t(QXref3t&& ref) noexcept;
+
+		/**
+		 * @brief Construct a new QXref3 object from an other scalar type, conversion is explicit only
+		 *
+		 * @param ref Referential to convert
+		 */
+		template<typename U>
+		explicit QXref3t(const QXref3t<U>& ref) noexcept :
+			o{ ref.o }, i{ ref.i }, j{ ref.j }, k{ ref.k }
+		{}
 
 		/**
 		 * @brief Destroy the QXref3 object
 		 */
-		~QXref3() = default;
+		~QXref3t() = default;
 
 #pragma endregion Constructors
 
@@ -69,7 +80,7 @@ namespace Math
 		 * @param ref Referential to transform
 		 * @return QXref3 New referential
 		 */
-		QXref3 GlobalToLocal(const QXref3& ref) const noexcept;
+		QXref3t GlobalToLocal(const QXref3t& ref) const noexcept;
 
 		/**
 		 * @brief Transform to local referential to a Global referential
@@ -77,7 +88,7 @@ namespace Math
 		 * @param ref Referential to transform
 		 * @return QXref3 New referential
 		 */
-		QXref3 LocalToGlobal(const QXref3& ref) const noexcept;
+		QXref3t LocalToGlobal(const QXref3t& ref) const noexcept;
 		
 		/**
 		 * @brief Rotate axes of referential
@@ -85,7 +96,7 @@ namespace Math
 		 * @param quat QXquaternion of rotation
 		 * @return QXref3& Reference of current referential
 		 */
-		QXref3& Rotate(const QXquaternion& quat) noexcept;
+		QXref3t& Rotate(const QXquaterniont<T>& quat) noexcept;
 				
 		/**
 		 * @brief Rotate axes of referential
@@ -93,7 +104,7 @@ namespace Math
 		 * @param quat QXquaternion of rotation
 		 * @return QXref3 New referential
 		 */
-		QXref3 Rotate(const QXquaternion& quat) const noexcept;
+		QXref3t Rotate(const QXquaterniont<T>& quat) const noexcept;
 
 		/**
 		 * @brief Translate Center of referential
@@ -101,7 +112,7 @@ namespace Math
 		 * @param value Vector of translation
 		 * @return QXref3& Reference of the current referential
 		 */
-		QXref3& Translate(const QXvec3& value) noexcept;
+		QXref3t& Translate(const QXvec3t<T>& value) noexcept;
 
 		
 		/**
@@ -110,7 +121,7 @@ namespace Math
 		 * @param value Vector of translation
 		 * @return QXref3 New referential
 		 */
-		QXref3 Translate(const QXvec3& value) const noexcept;
+		QXref3t Translate(const QXvec3t<T>& value) const noexcept;
 
 #pragma region Operators
 
@@ -122,7 +133,7 @@ namespace Math
 		 * @param ref Referentiel to copy
 		 * @return QXref3& Reference of current referentiel
 		 */
-		QXref3& operator=(const QXref3& ref) noexcept;
+		QXref3t& operator=(const QXref3t& ref) noexcept;
 
 		/**
 		 * @brief Operator = by move
@@ -130,7 +141,7 @@ namespace Math
 		 * @param ref Referentiel to move
 		 * @return QXref3& Reference of current referentiel
 		 */
-		QXref3& operator=(QXref3&& ref) noexcept;
+		QXref3t& operator=(QXref3t&& ref) noexcept;
 
 		/* Mathematics operators */
 
@@ -140,7 +151,7 @@ namespace Math
 		 * @param m Matrix to multiply
 		 * @return QXref3 new Ref3
 		 */
-		QXref3 operator*(const QXmat4& m) const noexcept;
+		QXref3t operator*(const QXmat4t<T>& m) const noexcept;
 		
 		/**
 		 * @brief Operator to multiply a ref by a Matrix4
@@ -148,7 +159,7 @@ namespace Math
 		 * @param m Matrix to multiply
 		 * @return QXref3& Reference of the current Ref3
 		 */
-		QXref3& operator*=(const QXmat4& m) noexcept;
+		QXref3t& operator*=(const QXmat4t<T>& m) noexcept;
 
 		/**
 		 * @brief Operator to compare vectors
@@ -157,7 +168,7 @@ namespace Math
 		 * @return true Referentiels have same vectors
 		 * @return false Referentiels have different vectors
 		 */
-		QXbool 	operator==(const QXref3& ref) const noexcept;
+		QXbool 	operator==(const QXref3t& ref) const noexcept;
 
 		/**
 		 * @brief Operator to compare vectors
@@ -166,12 +177,15 @@ namespace Math
 		 * @return true Referentiels have different vectors
 		 * @return false Referentiels have same vectors
 		 */
-		QXbool  operator!=(const QXref3& ref) const noexcept;
+		QXbool  operator!=(const QXref3t& ref) const noexcept;
 
 #pragma endregion Operators
 
 #pragma endregion Functions
 	};
+
+	using QXref3	= QXref3t<QXfloat>;
+	using QXdref3	= QXref3t<QXdouble>;
 }
 
 #endif //_REFERANTIAL3_H_
@@ -0,0 +1,174 @@
+#ifndef __SIMD_H__
+#define __SIMD_H__
+
+#pragma region Detection
+
+/* SSE2 is part of the x64 baseline, AVX needs /arch:AVX (MSVC) or -mavx (GCC/Clang) */
+#if defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+	#define QX_SIMD_SSE
+	#include <immintrin.h>
+#endif
+
+#if defined(QX_SIMD_SSE) && defined(__AVX__)
+	#define QX_SIMD_AVX
+#endif
+
+/* half float conversions need -mf16c (GCC/Clang), MSVC has no F16C flag: define QX_USE_F16C to opt in */
+#if defined(QX_SIMD_AVX) && (defined(__F16C__) || (defined(_MSC_VER) && defined(QX_USE_F16C)))
+	#define QX_SIMD_F16C
+#endif
+
+#pragma endregion Detection
+
+#include <cmath>
+
+#include "Type.h"
+
+namespace Math
+{
+	#pragma region Lanes
+
+	/* kernels are written once on a lane type: QXfloat, or 4 (SSE) / 8 (AVX) floats, or 4 doubles (AVX), masks are lanes of all ones or zeros */
+
+	template<typename T>
+	inline T		Load(const QXfloat* data) noexcept { return *data; }
+	template<typename T>
+	inline T		Load(const QXdouble* data) noexcept { return *data; }
+	inline void		Store(QXfloat* data, QXfloat value) noexcept { *data = value; }
+
+	inline QXfloat	Sqrt(QXfloat a) noexcept { return sqrtf(a); }
+	inline QXfloat	Min(QXfloat a, QXfloat b) noexcept { return a < b ? a : b; }
+	inline QXfloat	Max(QXfloat a, QXfloat b) noexcept { return a > b ? a : b; }
+	inline QXbool	Less(QXfloat a, QXfloat b) noexcept { return a < b; }
+	inline QXbool	LessEqual(QXfloat a, QXfloat b) noexcept { return a <= b; }
+	inline QXbool	And(QXbool a, QXbool b) noexcept { return a && b; }
+	inline QXbool	Or(QXbool a, QXbool b) noexcept { return a || b; }
+	/* a and not b */
+	inline QXbool	AndNot(QXbool a, QXbool b) noexcept { return a && !b; }
+	inline QXfloat	Abs(QXfloat a) noexcept { return fabsf(a); }
+	inline QXfloat	Select(QXbool mask, QXfloat a, QXfloat b) noexcept { return mask ? a : b; }
+	/* one bit per lane */
+	inline QXuint	Mask(QXbool mask) noexcept { return mask ? 1u : 0u; }
+
+	/* estimate + one Newton step, about 22 bits */
+	inline QXfloat	Rsqrt(QXfloat a) noexcept
+	{
+#ifdef QX_SIMD_SSE
+		QXfloat y{ _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(a))) };
+		return y * (1.5f - 0.5f * a * y * y);
+#else
+		return 1.f / sqrtf(a);
+#endif
+	}
+
+#ifdef QX_SIMD_SSE
+	struct QXlane4
+	{
+		__m128	v;
+
+		QXlane4() = default;
+		QXlane4(__m128 value) noexcept : v{ value } {}
+		QXlane4(QXfloat value) noexcept : v{ _mm_set1_ps(value) } {}
+	};
+
+	template<>
+	inline QXlane4	Load<QXlane4>(const QXfloat* data) noexcept { return _mm_loadu_ps(data); }
+	inline void		Store(QXfloat* data, QXlane4 value) noexcept { _mm_storeu_ps(data, value.v); }
+
+	inline QXlane4	operator+(QXlane4 a, QXlane4 b) noexcept { return _mm_add_ps(a.v, b.v); }
+	inline QXlane4	operator-(QXlane4 a, QXlane4 b) noexcept { return _mm_sub_ps(a.v, b.v); }
+	inline QXlane4	operator-(QXlane4 a) noexcept { return _mm_xor_ps(a.v, _mm_set1_ps(-0.f)); }
+	inline QXlane4	operator*(QXlane4 a, QXlane4 b) noexcept { return _mm_mul_ps(a.v, b.v); }
+	inline QXlane4	operator/(QXlane4 a, QXlane4 b) noexcept { return _mm_div_ps(a.v, b.v); }
+	inline QXlane4	Sqrt(QXlane4 a) noexcept { return _mm_sqrt_ps(a.v); }
+	inline QXlane4	Rsqrt(QXlane4 a) noexcept
+	{
+		QXlane4 y{ _mm_rsqrt_ps(a.v) };
+		return y * (QXlane4(1.5f) - QXlane4(0.5f) * a * y * y);
+	}
+	inline QXlane4	Min(QXlane4 a, QXlane4 b) noexcept { return _mm_min_ps(a.v, b.v); }
+	inline QXlane4	Max(QXlane4 a, QXlane4 b) noexcept { return _mm_max_ps(a.v, b.v); }
+	inline QXlane4	Less(QXlane4 a, QXlane4 b) noexcept { return _mm_cmplt_ps(a.v, b.v); }
+	inline QXlane4	LessEqual(QXlane4 a, QXlane4 b) noexcept { return _mm_cmple_ps(a.v, b.v); }
+	inline QXlane4	And(QXlane4 a, QXlane4 b) noexcept { return _mm_and_ps(a.v, b.v); }
+	inline QXlane4	Or(QXlane4 a, QXlane4 b) noexcept { return _mm_or_ps(a.v, b.v); }
+	inline QXlane4	AndNot(QXlane4 a, QXlane4 b) noexcept { return _mm_andnot_ps(b.v, a.v); }
+	inline QXlane4	Abs(QXlane4 a) noexcept { return _mm_andnot_ps(_mm_set1_ps(-0.f), a.v); }
+	inline QXlane4	Select(QXlane4 mask, QXlane4 a, QXlane4 b) noexcept
+	{
+		return _mm_or_ps(_mm_and_ps(mask.v, a.v), _mm_andnot_ps(mask.v, b.v));
+	}
+	inline QXuint	Mask(QXlane4 mask) noexcept { return (QXuint)_mm_movemask_ps(mask.v); }
+#endif
+
+#ifdef QX_SIMD_AVX
+	struct QXlane8
+	{
+		__m256	v;
+
+		QXlane8() = default;
+		QXlane8(__m256 value) noexcept : v{ value } {}
+		QXlane8(QXfloat value) noexcept : v{ _mm256_set1_ps(value) } {}
+	};
+
+	template<>
+	inline QXlane8	Load<QXlane8>(const QXfloat* data) noexcept { return _mm256_loadu_ps(data); }
+	inline void		Store(QXfloat* data, QXlane8 value) noexcept { _mm256_storeu_ps(data, value.v); }
+
+	inline QXlane8	operator+(QXlane8 a, QXlane8 b) noexcept { return _mm256_add_ps(a.v, b.v); }
+	inline QXlane8	operator-(QXlane8 a, QXlane8 b) noexcept { return _mm256_sub_ps(a.v, b.v); }
+	inline QXlane8	operator-(QXlane8 a) noexcept { return _mm256_xor_ps(a.v, _mm256_set1_ps(-0.f)); }
+	inline QXlane8	operator*(QXlane8 a, QXlane8 b) noexcept { return _mm256_mul_ps(a.v, b.v); }
+	inline QXlane8	operator/(QXlane8 a, QXlane8 b) noexcept { return _mm256_div_ps(a.v, b.v); }
+	inline QXlane8	Sqrt(QXlane8 a) noexcept { return _mm256_sqrt_ps(a.v); }
+	inline QXlane8	Rsqrt(QXlane8 a) noexcept
+	{
+		QXlane8 y{ _mm256_rsqrt_ps(a.v) };
+		return y * (QXlane8(1.5f) - QXlane8(0.5f) * a * y * y);
+	}
+	inline QXlane8	Min(QXlane8 a, QXlane8 b) noexcept { return _mm256_min_ps(a.v, b.v); }
+	inline QXlane8	Max(QXlane8 a, QXlane8 b) noexcept { return _mm256_max_ps(a.v, b.v); }
+	inline QXlane8	Less(QXlane8 a, QXlane8 b) noexcept { return _mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ); }
+	inline QXlane8	LessEqual(QXlane8 a, QXlane8 b) noexcept { return _mm256_cmp_ps(a.v, b.v, _CMP_LE_OQ); }
+	inline QXlane8	And(QXlane8 a, QXlane8 b) noexcept { return _mm256_and_ps(a.v, b.v); }
+	inline QXlane8	Or(QXlane8 a, QXlane8 b) noexcept { return _mm256_or_ps(a.v, b.v); }
+	inline QXlane8	AndNot(QXlane8 a, QXlane8 b) noexcept { return _mm256_andnot_ps(b.v, a.v); }
+	inline QXlane8	Abs(QXlane8 a) noexcept { return _mm256_andnot_ps(_mm256_set1_ps(-0.f), a.v); }
+	inline QXlane8	Select(QXlane8 mask, QXlane8 a, QXlane8 b) noexcept { return _mm256_blendv_ps(b.v, a.v, mask.v); }
+	inline QXuint	Mask(QXlane8 mask) noexcept { return (QXuint)_mm256_movemask_ps(mask.v); }
+
+	struct QXdlane4
+	{
+		__m256d	v;
+
+		QXdlane4() = default;
+		QXdlane4(__m256d value) noexcept : v{ value } {}
+		QXdlane4(QXdouble value) noexcept : v{ _mm256_set1_pd(value) } {}
+	};
+
+	template<>
+	inline QXdlane4	Load<QXdlane4>(const QXdouble* data) noexcept { return _mm256_loadu_pd(data); }
+	inline void		Store(QXdouble* data, QXdlane4 value) noexcept { _mm256_storeu_pd(data, value.v); }
+
+	inline QXdlane4	operator+(QXdlane4 a, QXdlane4 b) noexcept { return _mm256_add_pd(a.v, b.v); }
+	inline QXdlane4	operator-(QXdlane4 a, QXdlane4 b) noexcept { return _mm256_sub_pd(a.v, b.v); }
+	inline QXdlane4	operator-(QXdlane4 a) noexcept { return _mm256_xor_pd(a.v, _mm256_set1_pd(-0.)); }
+	inline QXdlane4	operator*(QXdlane4 a, QXdlane4 b) noexcept { return _mm256_mul_pd(a.v, b.v); }
+	inline QXdlane4	operator/(QXdlane4 a, QXdlane4 b) noexcept { return _mm256_div_pd(a.v, b.v); }
+	inline QXdlane4	Sqrt(QXdlane4 a) noexcept { return _mm256_sqrt_pd(a.v); }
+	inline QXdlane4	Min(QXdlane4 a, QXdlane4 b) noexcept { return _mm256_min_pd(a.v, b.v); }
+	inline QXdlane4	Max(QXdlane4 a, QXdlane4 b) noexcept { return _mm256_max_pd(a.v, b.v); }
+	inline QXdlane4	Less(QXdlane4 a, QXdlane4 b) noexcept { return _mm256_cmp_pd(a.v, b.v, _CMP_LT_OQ); }
+	inline QXdlane4	LessEqual(QXdlane4 a, QXdlane4 b) noexcept { return _mm256_cmp_pd(a.v, b.v, _CMP_LE_OQ); }
+	inline QXdlane4	And(QXdlane4 a, QXdlane4 b) noexcept { return _mm256_and_pd(a.v, b.v); }
+	inline QXdlane4	Or(QXdlane4 a, QXdlane4 b) noexcept { return _mm256_or_pd(a.v, b.v); }
+	inline QXdlane4	AndNot(QXdlane4 a, QXdlane4 b) noexcept { return _mm256_andnot_pd(b.v, a.v); }
+	inline QXdlane4	Abs(QXdlane4 a) noexcept { return _mm256_andnot_pd(_mm256_set1_pd(-0.), a.v); }
+	inline QXdlane4	Select(QXdlane4 mask, QXdlane4 a, QXdlane4 b) noexcept { return _mm256_blendv_pd(b.v, a.v, mask.v); }
+	inline QXuint	Mask(QXdlane4 mask) noexcept { return (QXuint)_mm256_movemask_pd(mask.v); }
+#endif
+
+	#pragma endregion Lanes
+}
+
+#endif // __SIMD_H__
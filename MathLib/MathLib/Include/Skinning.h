@@ -0,0 +1,69 @@
+#ifndef __SKINNING_H__
+#define __SKINNING_H__
+
+#include "DualQuaternion.h"
+
+#define QX_SKIN_MAX_INFLUENCES 4
+
+namespace Math
+{
+	/**
+	 * @brief Skinned vertex streams in SoA layout (one array per component)
+	 *
+	 * Each vertex is influenced by QX_SKIN_MAX_INFLUENCES bones, weights of one vertex sum to 1.
+	 * Unused influences have a weight of 0 and any valid bone index. normalX/Y/Z may be nullptr to skip normals.
+	 */
+	struct QXskinInput
+	{
+		const QXfloat*	positionX;
+		const QXfloat*	positionY;
+		const QXfloat*	positionZ;
+
+		const QXfloat*	normalX;
+		const QXfloat*	normalY;
+		const QXfloat*	normalZ;
+
+		const QXuint*	boneIndices[QX_SKIN_MAX_INFLUENCES];
+		const QXfloat*	boneWeights[QX_SKIN_MAX_INFLUENCES];
+	};
+
+	/**
+	 * @brief Skinned vertex output streams in SoA layout
+	 *
+	 * normalX/Y/Z may be nullptr to skip normals.
+	 */
+	struct QXskinOutput
+	{
+		QXfloat*	positionX;
+		QXfloat*	positionY;
+		QXfloat*	positionZ;
+
+		QXfloat*	normalX;
+		QXfloat*	normalY;
+		QXfloat*	normalZ;
+	};
+
+	/**
+	 * @brief Linear blend skinning with a palette of rigid QXmat4 (translation in m[i][3])
+	 *
+	 * @param palette Bone matrices indexed by input.boneIndices
+	 * @param input Vertex streams to skin
+	 * @param output Skinned vertex streams, can alias input
+	 * @param count Number of vertices
+	 */
+	void	SkinLinearBlend(const QXmat4* palette, const QXskinInput& input,
+							const QXskinOutput& output, QXuint count) noexcept;
+
+	/**
+	 * @brief Dual quaternion skinning with a palette of unit dual quaternions
+	 *
+	 * @param palette Bone dual quaternions indexed by input.boneIndices
+	 * @param input Vertex streams to skin
+	 * @param output Skinned vertex streams, can alias input
+	 * @param count Number of vertices
+	 */
+	void	SkinDualQuaternion(const QXdualQuaternion* palette, const QXskinInput& input,
+							const QXskinOutput& output, QXuint count) noexcept;
+}
+
+#endif // __SKINNING_H__
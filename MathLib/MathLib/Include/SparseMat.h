@@ -0,0 +1,147 @@
+#ifndef __SPARSEMAT_H__
+#define __SPARSEMAT_H__
+
+#include <vector>
+
+#include "Mat.h"
+
+/* number of non zero values from which products are split across threads */
+#define QX_SPARSE_PARALLEL_NNZ 65536
+
+namespace Math
+{
+	/**
+	 * @brief One (line, column, value) entry used to assemble a QXsparseMat
+	 */
+	struct QXtriplet
+	{
+		QXuint	line;
+		QXuint	column;
+		QXfloat	value;
+	};
+
+	/**
+	 * @brief Sparse matrix in CSR layout (compressed rows)
+	 *
+	 * Values of line i are values[rowStart[i]] to values[rowStart[i + 1] - 1],
+	 * with their column in columnIndices, sorted by column.
+	 */
+	struct QXsparseMat
+	{
+		#pragma region Attributes
+		QXint					line;
+		QXint					column;
+
+		std::vector<QXuint>		rowStart;
+		std::vector<QXuint>		columnIndices;
+		std::vector<QXfloat>	values;
+		#pragma endregion Attributes
+
+		#pragma region Constructor/Destructor
+		/**
+		 * @brief Construct an empty QXsparseMat object
+		 *
+		 * @param ln int for number of line
+		 * @param col int for number of column
+		 */
+		QXsparseMat(QXint ln = 0, QXint col = 0);
+
+		/**
+		 * @brief Construct a QXsparseMat object from triplets, duplicated entries are summed
+		 *
+		 * @param ln int for number of line
+		 * @param col int for number of column
+		 * @param triplets Entries of the matrix, in any order
+		 */
+		QXsparseMat(QXint ln, QXint col, const std::vector<QXtriplet>& triplets);
+
+		/**
+		 * @brief Construct a QXsparseMat object from a dense matrix
+		 *
+		 * @param mat QXmat to convert
+		 * @param epsilon Values with absolute value below or equal are dropped
+		 */
+		explicit QXsparseMat(const QXmat& mat, QXfloat epsilon = 0.f);
+
+		/**
+		 * @brief Destroy the QXsparseMat object
+		 */
+		~QXsparseMat() = default;
+		#pragma endregion Constructor/Destructor
+
+		#pragma region Functions
+		/**
+		 * @brief Number of stored values
+		 *
+		 * @return QXuint Non zero count
+		 */
+		QXuint			NonZeros() const noexcept;
+
+		/**
+		 * @brief Get one value, binary search in the line
+		 *
+		 * @param l Line of the value
+		 * @param c Column of the value
+		 * @return QXfloat Value, 0 if not stored
+		 */
+		QXfloat			Get(QXuint l, QXuint c) const noexcept;
+
+		/**
+		 * @brief Compute y = M * x, split across threads for big matrices
+		 *
+		 * @param x Input vector of column values
+		 * @param y Output vector of line values, must not alias x
+		 */
+		void			Multiply(const QXfloat* x, QXfloat* y) const;
+
+		/**
+		 * @brief Compute y = transpose(M) * x without building the transpose
+		 *
+		 * @param x Input vector of line values
+		 * @param y Output vector of column values, must not alias x
+		 */
+		void			MultiplyTranspose(const QXfloat* x, QXfloat* y) const;
+
+		/**
+		 * @brief Solve M * x = b with Jacobi preconditioned conjugate gradient
+		 *
+		 * M must be square, symmetric and positive definite.
+		 * The products inside the iterations run on the calling thread.
+		 *
+		 * @param b Right hand side
+		 * @param x Initial guess, receives the solution
+		 * @param maxIterations Maximum number of iterations
+		 * @param tolerance Stop when |b - M * x| <= tolerance * |b|
+		 * @return QXint Number of iterations done, -1 if it did not converge
+		 */
+		QXint			SolveConjugateGradient(const QXfloat* b, QXfloat* x, QXint maxIterations,
+												QXfloat tolerance = 1e-6f) const;
+
+		/**
+		 * @brief Convert to a dense matrix
+		 *
+		 * @return QXmat Dense matrix
+		 */
+		QXmat			ToMat() const;
+
+		/**
+		 * @brief Compute transpose Matrix
+		 *
+		 * @return QXsparseMat Transpose matrix in CSR
+		 */
+		QXsparseMat		Transpose() const;
+
+		#pragma region Operator Functions
+		/**
+		 * @brief Operator * multiplication with a vector
+		 *
+		 * @param x Vector of column values
+		 * @return std::vector<QXfloat> Vector of line values
+		 */
+		std::vector<QXfloat>	operator*(const std::vector<QXfloat>& x) const;
+		#pragma endregion Operator Functions
+		#pragma endregion Functions
+	};
+}
+
+#endif //__SPARSEMAT_H__
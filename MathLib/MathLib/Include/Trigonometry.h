@@ -0,0 +1,87 @@
+#ifndef __TRIGONOMETRY_H__
+#define __TRIGONOMETRY_H__
+
+#include "Type.h"
+#include "MathDefines.h"
+
+#include <cmath>
+
+namespace Math
+{
+	#pragma region Fast Trigonometry
+
+	/**
+	 * @brief Float sine and cosine with one shared range reduction (Cody-Waite + minimax polynomials)
+	 *
+	 * Maximum error is 2 ULP for |angle| <= QX_FAST_SINCOS_RANGE, above the result comes from libm.
+	 *
+	 * @param angle Angle in radian
+	 * @param sin Sine of angle
+	 * @param cos Cosine of angle
+	 */
+	void	SinCos(QXfloat angle, QXfloat& sin, QXfloat& cos) noexcept;
+
+	/**
+	 * @brief Sine and cosine of an array of angles, 4 at a time with SIMD
+	 *
+	 * Same error as the scalar SinCos.
+	 *
+	 * @param angles Angles in radian
+	 * @param sin Output array of count sines
+	 * @param cos Output array of count cosines
+	 * @param count Number of angles
+	 */
+	void	SinCos(const QXfloat* angles, QXfloat* sin, QXfloat* cos, QXuint count) noexcept;
+
+	/**
+	 * @brief Float sine, see SinCos for the error
+	 *
+	 * @param angle Angle in radian
+	 * @return QXfloat Sine of angle
+	 */
+	QXfloat	FastSin(QXfloat angle) noexcept;
+
+	/**
+	 * @brief Float cosine, see SinCos for the error
+	 *
+	 * @param angle Angle in radian
+	 * @return QXfloat Cosine of angle
+	 */
+	QXfloat	FastCos(QXfloat angle) noexcept;
+
+	/**
+	 * @brief Sine and cosine used by the rotation builders
+	 *
+	 * Fast SinCos when QX_FAST_MATH is defined, float std::sin and std::cos otherwise.
+	 *
+	 * @param angle Angle in radian
+	 * @param sin Sine of angle
+	 * @param cos Cosine of angle
+	 */
+	inline void	BuilderSinCos(QXfloat angle, QXfloat& sin, QXfloat& cos) noexcept
+	{
+#ifdef QX_FAST_MATH
+		SinCos(angle, sin, cos);
+#else
+		sin = std::sin(angle);
+		cos = std::cos(angle);
+#endif
+	}
+
+	/**
+	 * @brief Sine and cosine used by the double precision rotation builders, always libm
+	 *
+	 * @param angle Angle in radian
+	 * @param sin Sine of angle
+	 * @param cos Cosine of angle
+	 */
+	inline void	BuilderSinCos(QXdouble angle, QXdouble& sin, QXdouble& cos) noexcept
+	{
+		sin = std::sin(angle);
+		cos = std::cos(angle);
+	}
+
+	#pragma endregion Fast Trigonometry
+}
+
+#endif // __TRIGONOMETRY_H__
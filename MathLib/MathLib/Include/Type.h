@@ -1,11 +1,13 @@
 #pragma once
 
 #include <cstdint>
+#include <string>
 #include <vector>
 
 typedef uint32_t QXuint;
 typedef int32_t QXint;
 typedef short QXshort;
+typedef uint16_t QXushort;
 
 typedef float QXfloat;
 typedef double QXdouble;
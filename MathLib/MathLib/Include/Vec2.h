@@ -2,7 +2,9 @@
 #define __VEC2_H__
 
 #include <ostream>
+#include <utility>
 
+#include "Hash.h"
 #include "Type.h"
 
 namespace Math
@@ -10,22 +12,23 @@ namespace Math
 	/**
 	* @brief Vector3 structure
 	*/
-	struct QXvec2
+	template<typename T>
+	struct QXvec2t
 	{
 #pragma region Attributes
 
 		union
 		{
-			struct { QXfloat x, y; };
-			struct { QXfloat r, g; };
-			QXfloat e[2];
+			struct { T x, y; };
+			struct { T r, g; };
+			T e[2];
 		};
 
-		static const QXvec2	zero;
-		static const QXvec2	up;
-		static const QXvec2	down;
-		static const QXvec2	left;
-		static const QXvec2	right;
+		static const QXvec2t	zero;
+		static const QXvec2t	up;
+		static const QXvec2t	down;
+		static const QXvec2t	left;
+		static const QXvec2t	right;
 
 #pragma endregion Attributes
 
@@ -37,26 +40,34 @@ namespace Math
 		 * @param posX Value for x parameter 0 by default
 		 * @param posY Value for y parameter 0 by default
 		 */
-		QXvec2(const QXfloat& posX = 0.f, const QXfloat& posY = 0.f) noexcept;
+		constexpr QXvec2t(const T& posX = 0.f, const T& posY = 0.f) noexcept;
 
 		/**
 		 * @brief Construct a new QXvec2 object
 		 * 
 		 * @param vec Vector to copy
 		 */
-		QXvec2(const QXvec2& vec)noexcept;
+		constexpr QXvec2t(const QXvec2t& vec)noexcept;
 
 		/**
 		 * @brief Construct a new QXvec2 object
 		 * 
 		 * @param vec Vector to move
 		 */
-		QXvec2(QXvec2&& vec) noexcept;
+		constexpr QXvec2t(QXvec2t&& vec) noexcept;
+
+		/**
+		 * @brief Construct a new QXvec2 object from an other scalar type, conversion is explicit only
+		 *
+		 * @param vec Vector to convert
+		 */
+		template<typename U>
+		constexpr explicit QXvec2t(const QXvec2t<U>& vec) noexcept;
 
 		/**
 		 * @brief Destroy the QXvec2 object
 		 */
-		~QXvec2() = default;
+		~QXvec2t() = default;
 
 #pragma endregion Constructors
 
@@ -68,7 +79,7 @@ namespace Math
 		 * @param vector Destination vector 
 		 * @return QXfloat Angle value in radian
 		 */
-		QXfloat 	Angle(const QXvec2& vect) const noexcept;
+		T 	Angle(const QXvec2t& vect) const noexcept;
 
 		/**
 		 * @brief Cross product between two vectors
@@ -76,7 +87,7 @@ namespace Math
 		 * @param vector Vector to compute cross product
 		 * @return QXfloat float result of the cross product
 		 */
-		QXfloat		Cross(const QXvec2& vect) const noexcept;
+		constexpr T		Cross(const QXvec2t& vect) const noexcept;
 
 		/**
 		 * @brief Dot product between two vectors
@@ -84,7 +95,7 @@ namespace Math
 		 * @param vector Vector to compute dot product
 		 * @return QXfloat Result of the dot product
 		 */
-		QXfloat		Dot(const QXvec2& vect) const noexcept;
+		constexpr T		Dot(const QXvec2t& vect) const noexcept;
 
 		/**
 		 * @brief Check if two vectors are collinear
@@ -93,28 +104,28 @@ namespace Math
 		 * @return true Vectors are collinear
 		 * @return false Vectors are not collinear
 		 */
-		QXbool		IsCollinear(const QXvec2& vect) const noexcept;
+		QXbool		IsCollinear(const QXvec2t& vect) const noexcept;
 
 		/**
 		 * @brief Length (magnitude) of current vector
 		 * 
 		 * @return QXfloat Length value
 		 */
-		QXfloat		Length() const noexcept;
+		T		Length() const noexcept;
 
 		/**
 		 * @brief Normalize vector
 		 * 
 		 * @return QXvec2& Reference of current vector
 		 */
-		QXvec2&		Normalize() noexcept;
+		QXvec2t&		Normalize() noexcept;
 
 		/**
 		 * @brief Normalize vector
 		 * 
 		 * @return QXvec2 Vector normalized
 		 */
-		QXvec2		Normalized() const noexcept;
+		QXvec2t		Normalized() const noexcept;
 
 		/**
 		 * @brief Multiply vectors values by constant
@@ -122,7 +133,7 @@ namespace Math
 		 * @param value Scaling value
 		 * @return QXvec2& Reference of current vector
 		 */
-		QXvec2&		Scale(QXfloat value) noexcept;
+		constexpr QXvec2t&		Scale(T value) noexcept;
 
 		/**
 		 * @brief Multiply vectors values by constant
@@ -130,14 +141,14 @@ namespace Math
 		 * @param value Scaling value
 		 * @return QXvec2& Scaled vector
 		 */
-		QXvec2		Scale(QXfloat value) const noexcept;
+		constexpr QXvec2t		Scale(T value) const noexcept;
 
 		/**
 		 * @brief Square length of current vector
 		 * 
 		 * @return QXfloat Square length value
 		 */
-		QXfloat		SqrLength() const noexcept;
+		constexpr T		SqrLength() const noexcept;
 
 		/**
 		 * @brief Make a string with vector values
@@ -155,7 +166,7 @@ namespace Math
 		 * @param vect Vector to copy
 		 * @return QXvec2& reference of current vector
 		 */
-		QXvec2& operator=(const QXvec2& vect) noexcept;
+		constexpr QXvec2t& operator=(const QXvec2t& vect) noexcept;
 
 		/**
 		 * @brief Operator = by move
@@ -163,7 +174,7 @@ namespace Math
 		 * @param vect Vector to copy
 		 * @return QXvec2& reference of current vector
 		 */
-		QXvec2& operator=(QXvec2&& vect) noexcept;
+		constexpr QXvec2t& operator=(QXvec2t&& vect) noexcept;
 
 		/* Mathematics operators */
 
@@ -173,7 +184,7 @@ namespace Math
 		 * @param vect Vector to add
 		 * @return QXvec2& reference of current vector
 		 */
-		QXvec2& operator+=(const QXvec2& vect) noexcept;
+		constexpr QXvec2t& operator+=(const QXvec2t& vect) noexcept;
 
 		/**
 		 * @brief Operator for addition
@@ -181,7 +192,7 @@ namespace Math
 		 * @param vect Vector to substract
 		 * @return QXvec2& New vector
 		 */
-		QXvec2		operator+(const QXvec2& vect) const noexcept;
+		constexpr QXvec2t		operator+(const QXvec2t& vect) const noexcept;
 
 		/**
 		 * @brief Operator for substraction
@@ -189,7 +200,7 @@ namespace Math
 		 * @param vect Vector to substract
 		 * @return QXvec2& Reference of current vector
 		 */
-		QXvec2& operator-=(const QXvec2& vect) noexcept;
+		constexpr QXvec2t& operator-=(const QXvec2t& vect) noexcept;
 
 		/**
 		 * @brief Operator for substraction
@@ -197,14 +208,14 @@ namespace Math
 		 * @param vect Vector to substract
 		 * @return QXvec2 New vector
 		 */
-		QXvec2		operator-(const QXvec2& vect) const noexcept;
+		constexpr QXvec2t		operator-(const QXvec2t& vect) const noexcept;
 
 		/**
 		 * @brief Create a new QXvec2 as the oposite of the vector
 		 *
 		 * @return QXvec2 New vector
 		 */
-		QXvec2		operator-() const noexcept;
+		constexpr QXvec2t		operator-() const noexcept;
 
 		/**
 		 * @brief Operator for division by scalar
@@ -212,7 +223,7 @@ namespace Math
 		 * @param value Scalar to divide
 		 * @return QXvec2& Reference of current vector
 		 */
-		QXvec2& operator/=(QXfloat value) noexcept;
+		constexpr QXvec2t& operator/=(T value) noexcept;
 
 		/**
 		 * @brief Operator for division by scalar
@@ -220,7 +231,7 @@ namespace Math
 		 * @param value Scalar to divide
 		 * @return QXvec2 New vector
 		 */
-		QXvec2		operator/(QXfloat value) const noexcept;
+		constexpr QXvec2t		operator/(T value) const noexcept;
 
 		/**
 		 * @brief Operator for multiplication by scalar
@@ -228,7 +239,7 @@ namespace Math
 		 * @param value Scalar to muultiply
 		 * @return QXvec2& Reference of current vector
 		 */
-		QXvec2& operator*=(QXfloat nb) noexcept;
+		constexpr QXvec2t& operator*=(T nb) noexcept;
 
 		/**
 		 * @brief Operator for multiplication by scalar
@@ -236,7 +247,7 @@ namespace Math
 		 * @param value Scalar to multiply
 		 * @return QXvec2 New vector
 		 */
-		QXvec2		operator*(QXfloat value) const noexcept;
+		constexpr QXvec2t		operator*(T value) const noexcept;
 
 		/**
 		 * @brief Operator to compare vector length
@@ -245,7 +256,7 @@ namespace Math
 		 * @return true Vectors have same length
 		 * @return false Vectors have different length
 		 */
-		QXbool		operator==(const QXvec2& vect) const noexcept;
+		QXbool		operator==(const QXvec2t& vect) const noexcept;
 
 		/**
 		 * @brief Operator to compare vector length
@@ -254,7 +265,7 @@ namespace Math
 		 * @return true Vectors have different length
 		 * @return false Vectors have same length
 		 */
-		QXbool		operator!=(const QXvec2& vect) const noexcept;
+		QXbool		operator!=(const QXvec2t& vect) const noexcept;
 
 		/**
 		 * @brief Operator to compare vector length
@@ -263,7 +274,7 @@ namespace Math
 		 * @return true Vector length is inferior to compared vector
 		 * @return false Vector length strickly superior to compared vector
 		 */
-		QXbool		operator<=(const QXvec2& vect) const noexcept;
+		QXbool		operator<=(const QXvec2t& vect) const noexcept;
 
 		/**
 		 * @brief Operator to compare vector length
@@ -272,7 +283,7 @@ namespace Math
 		 * @return true Vector length is strickly inferior to compared vector
 		 * @return false Vector length is superior or equal to compared vector
 		 */
-		QXbool		operator<(const QXvec2& vect) const noexcept;
+		QXbool		operator<(const QXvec2t& vect) const noexcept;
 
 		/**
 		 * @brief Operator to compare vector length
@@ -281,7 +292,7 @@ namespace Math
 		 * @return true Vector length is superior or equal to compared vector
 		 * @return false Vector length is strickly inferior to compared vector
 		 */
-		QXbool		operator>=(const QXvec2& vect) const noexcept;
+		QXbool		operator>=(const QXvec2t& vect) const noexcept;
 
 		/**
 		 * @brief Operator to compare vector length
@@ -290,7 +301,7 @@ namespace Math
 		 * @return true Vector length is strickly superior to compared vector
 		 * @return false Vector length is inferior or equal to compared vector
 		 */
-		QXbool		operator>(const QXvec2& vect) const noexcept;
+		QXbool		operator>(const QXvec2t& vect) const noexcept;
 
 		/* Operator accessor*/
 
@@ -300,7 +311,7 @@ namespace Math
 		 * @param idx Index of the array
 		 * @return QXfloat& reference of the vector value
 		 */
-		const QXfloat 	operator[](const QXuint idx) const noexcept;
+		constexpr const T 	operator[](const QXuint idx) const noexcept;
 
 		/**
 		 * @brief Operator to access vector values as an array
@@ -308,13 +319,209 @@ namespace Math
 		 * @param idx Index of the array
 		 * @return QXfloat& reference of the vector value
 		 */
-		QXfloat& operator[](const QXuint idx) noexcept;
+		T& operator[](const QXuint idx) noexcept;
 
 #pragma endregion Operators
 
 #pragma endregion Functions
 	};
 
+	using QXvec2	= QXvec2t<QXfloat>;
+	using QXdvec2	= QXvec2t<QXdouble>;
+
+#pragma region Constexpr Functions
+
+	template<typename T>
+	constexpr QXvec2t<T>::QXvec2t(const T& posX, const T& posY) noexcept :
+		x {posX},
+		y {posY}
+	{}
+
+	template<typename T>
+	constexpr QXvec2t<T>::QXvec2t(const QXvec2t<T>& vect) noexcept :
+		x{ vect.x },
+		y{ vect.y }
+	{}
+
+	template<typename T>
+	constexpr QXvec2t<T>::QXvec2t(QXvec2t<T>&& vec) noexcept :
+		x { std::move(vec.x) },
+		y { std::move(vec.y) }
+	{}
+
+	template<typename T>
+	template<typename U>
+	constexpr QXvec2t<T>::QXvec2t(const QXvec2t<U>& vec) noexcept :
+		x{ static_cast<T>(vec.x) },
+		y{ static_cast<T>(vec.y) }
+	{}
+
+	template<typename T>
+	constexpr QXvec2t<T>& QXvec2t<T>::operator=(const QXvec2t<T>& vect) noexcept
+	{
+		x = vect.x;
+		y = vect.y;
+
+		return *this;
+	}
+
+	template<typename T>
+	constexpr QXvec2t<T>& QXvec2t<T>::operator=(QXvec2t<T>&& vect) noexcept
+	{
+		x = std::move(vect.x);
+		y = std::move(vect.y);
+
+		return *this;
+	}
+
+	template<typename T>
+	constexpr QXvec2t<T>& QXvec2t<T>::operator+=(const QXvec2t<T>& vect) noexcept
+	{
+		x += vect.x;
+		y += vect.y;
+
+		return *this;
+	}
+
+	template<typename T>
+	constexpr QXvec2t<T>	QXvec2t<T>::operator+(const QXvec2t<T>& vect) const noexcept
+	{
+		QXvec2t<T>	res;
+
+		res.x = x + vect.x;
+		res.y = y + vect.y;
+
+		return res;
+	}
+
+	template<typename T>
+	constexpr QXvec2t<T>& QXvec2t<T>::operator-=(const QXvec2t<T>& vect) noexcept
+	{
+		x -= vect.x;
+		y -= vect.y;
+
+		return *this;
+	}
+
+	template<typename T>
+	constexpr QXvec2t<T>	QXvec2t<T>::operator-(const QXvec2t<T>& vect) const noexcept
+	{
+		QXvec2t<T>	res;
+
+		res.x = x - vect.x;
+		res.y = y - vect.y;
+
+		return res;
+	}
+
+	template<typename T>
+	constexpr QXvec2t<T>	QXvec2t<T>::operator-() const noexcept
+	{
+		QXvec2t<T>	res;
+
+		res.x = -x;
+		res.y = -y;
+
+		return res;
+	}
+
+	template<typename T>
+	constexpr QXvec2t<T>& QXvec2t<T>::operator/=(T value) noexcept
+	{
+		x /= value;
+		y /= value;
+
+		return *this;
+	}
+
+	template<typename T>
+	constexpr QXvec2t<T>	QXvec2t<T>::operator/(T value) const noexcept
+	{
+		QXvec2t<T>	res;
+
+		res.x = x / value;
+		res.y = y / value;
+
+		return res;
+	}
+
+	template<typename T>
+	constexpr QXvec2t<T>& QXvec2t<T>::operator*=(T nb) noexcept
+	{
+		x *= nb;
+		y *= nb;
+
+		return *this;
+	}
+
+	template<typename T>
+	constexpr QXvec2t<T>	QXvec2t<T>::operator*(T value) const noexcept
+	{
+		QXvec2t<T>	res;
+
+		res.x = x * value;
+		res.y = y * value;
+
+		return res;
+	}
+
+	template<typename T>
+	constexpr const T QXvec2t<T>::operator[](const QXuint idx) const noexcept
+	{
+		return idx == 0 ? x : y;
+	}
+
+	template<typename T>
+	constexpr T QXvec2t<T>::Cross(const QXvec2t<T>& vect) const noexcept
+	{
+		return x * vect.y - vect.x * y;
+	}
+
+	template<typename T>
+	constexpr T QXvec2t<T>::Dot(const QXvec2t<T>& vect) const noexcept
+	{
+		return x * vect.x + y * vect.y;
+	}
+
+	template<typename T>
+	constexpr QXvec2t<T>& QXvec2t<T>::Scale(T nb) noexcept
+	{
+		x = x * nb;
+		y = y * nb;
+
+		return *this;
+	}
+
+	template<typename T>
+	constexpr QXvec2t<T>	QXvec2t<T>::Scale(T nb) const noexcept
+	{
+		QXvec2t<T>	res;
+
+		res.x = x * nb;
+		res.y = y * nb;
+
+		return res;
+	}
+
+	template<typename T>
+	constexpr T	QXvec2t<T>::SqrLength() const noexcept
+	{
+		return x * x + y * y;
+	}
+
+	template<typename T>
+	inline constexpr QXvec2t<T>	QXvec2t<T>::zero {0.f, 0.f};
+	template<typename T>
+	inline constexpr QXvec2t<T>	QXvec2t<T>::up {0.f, 1.f};
+	template<typename T>
+	inline constexpr QXvec2t<T>	QXvec2t<T>::down {0.f, -1.f};
+	template<typename T>
+	inline constexpr QXvec2t<T>	QXvec2t<T>::left {-1.f, 0.f};
+	template<typename T>
+	inline constexpr QXvec2t<T>	QXvec2t<T>::right {1.f, 0.f};
+
+#pragma endregion Constexpr Functions
+
 	/**
 	 * @brief Operator to print vector
 	 *
@@ -322,7 +529,8 @@ namespace Math
 	 * @param vector Vector to add to the stream
 	 * @return std::ostream& Reference to the stream
 	 */
-	std::ostream&	operator<<(std::ostream& os, const QXvec2& vect) noexcept;
+	template<typename T>
+	std::ostream&	operator<<(std::ostream& os, const QXvec2t<T>& vect) noexcept;
 
 	/**
 	 * @brief Operator to add a print of vector in string
@@ -331,17 +539,18 @@ namespace Math
 	 * @param vector Vector to add to the stream
 	 * @return QXstring New string
 	 */
-	QXstring		operator+(QXstring& str, const QXvec2& vect) noexcept;
+	template<typename T>
+	QXstring		operator+(QXstring& str, const QXvec2t<T>& vect) noexcept;
 }
 
 namespace std
 {
-	template<>
-	struct hash<Math::QXvec2>
+	template<typename T>
+	struct hash<Math::QXvec2t<T>>
 	{
-		size_t operator()(const Math::QXvec2& v)
+		size_t operator()(const Math::QXvec2t<T>& v) const noexcept
 		{
-			return std::hash<float>{}(v.x) + std::hash<float>{}(v.y);
+			return (size_t)Math::HashCombine(Math::HashMix(Math::HashScalar(v.x)), Math::HashScalar(v.y));
 		}
 	};
 }
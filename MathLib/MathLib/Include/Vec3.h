@@ -1,38 +1,44 @@
 #ifndef __VEC3_H__
 #define __VEC3_H__
 
+#include <limits>
 #include <ostream>
+#include <utility>
 
+#include "Hash.h"
 #include "Type.h"
 
 namespace Math
 {
-	struct QXref3;
-	struct QXmat4;
+	template<typename T>
+	struct QXref3t;
+	template<typename T>
+	struct QXmat4t;
 
 	/**
 	 * @brief Vector3 structure
 	 * 
 	 */
-	struct QXvec3
+	template<typename T>
+	struct QXvec3t
 	{
 #pragma region Attributes
 
 		union
 		{
-			struct { QXfloat x, y, z; };
-			struct { QXfloat r, g, b; };
-			QXfloat	e[3];
+			struct { T x, y, z; };
+			struct { T r, g, b; };
+			T	e[3];
 		};
 
-		static const QXvec3 zero;
-		static const QXvec3 up;
-		static const QXvec3 down;
-		static const QXvec3 right;
-		static const QXvec3 left;
-		static const QXvec3 forward;
-		static const QXvec3 backward;
-		static const QXvec3 infinity;
+		static const QXvec3t zero;
+		static const QXvec3t up;
+		static const QXvec3t down;
+		static const QXvec3t right;
+		static const QXvec3t left;
+		static const QXvec3t forward;
+		static const QXvec3t backward;
+		static const QXvec3t infinity;
 
 #pragma endregion Attributes
 
@@ -45,26 +51,34 @@ namespace Math
 		 * @param y Value for y parameter 0 by default
 		 * @param z Value for z parameter 0 by default
 		 */
-		QXvec3(const QXfloat& x = 0.f, const QXfloat & y = 0.f, const QXfloat & z = 0.f) noexcept;
+		constexpr QXvec3t(const T& x = 0.f, const T & y = 0.f, const T & z = 0.f) noexcept;
 		
 		/**
 		 * @brief Construct a new QXvec3 object
 		 * 
 		 * @param vector Vector to copy
 		 */
-		QXvec3(const QXvec3& vector) noexcept;
+		constexpr QXvec3t(const QXvec3t& vector) noexcept;
 
 		/**
 		 * @brief Construct a new QXvec3 object
 		 * 
 		 * @param vector Vector to move
 		 */
-		QXvec3(QXvec3&& vector) noexcept;
+		constexpr QXvec3t(QXvec3t&& vector) noexcept;
+
+		/**
+		 * @brief Construct a new QXvec3 object from an other scalar type, conversion is explicit only
+		 *
+		 * @param vector Vector to convert
+		 */
+		template<typename U>
+		constexpr explicit QXvec3t(const QXvec3t<U>& vector) noexcept;
 
 		/**
 		 * @brief Destroy the QXvec3 object
 		 */
-		~QXvec3() = default;
+		~QXvec3t() = default;
 
 #pragma endregion Constructors
 
@@ -76,7 +90,7 @@ namespace Math
 		 * @param vector Destination vector 
 		 * @return QXfloat Angle value in radian
 		 */
-		QXfloat			Angle(const QXvec3& vector) const noexcept;
+		T			Angle(const QXvec3t& vector) const noexcept;
 
 		/**
 		 * @brief Cross product between two vectors
@@ -84,7 +98,7 @@ namespace Math
 		 * @param vector Vector to compute cross product
 		 * @return QXvec3 Vector result of the cross product
 		 */
-		QXvec3			Cross(const QXvec3& vector) const noexcept;
+		constexpr QXvec3t			Cross(const QXvec3t& vector) const noexcept;
 
 		/**
 		 * @brief Dot product between two vectors
@@ -92,7 +106,7 @@ namespace Math
 		 * @param vector Vector to compute dot product
 		 * @return QXfloat Result of the dot product
 		 */
-		QXfloat			Dot(const QXvec3& vector) const noexcept;
+		constexpr T			Dot(const QXvec3t& vector) const noexcept;
 
 		/**
 		 * @brief Check if two vectors are collinear
@@ -101,31 +115,31 @@ namespace Math
 		 * @return true Vectors are collinear
 		 * @return false Vectors are not collinear
 		 */
-		QXbool			IsCollinear(const QXvec3& vector) const noexcept;
+		QXbool			IsCollinear(const QXvec3t& vector) const noexcept;
 
 		/**
 		 * @brief Length (magnitude) of current vector
 		 * 
 		 * @return QXfloat Length value
 		 */
-		QXfloat			Length() const noexcept;
+		T			Length() const noexcept;
 
-		QXvec3			WorldToLocal(const QXref3& ref) const noexcept;
-		QXvec3			LocalToWorld(const QXref3& ref) const noexcept;
+		QXvec3t			WorldToLocal(const QXref3t<T>& ref) const noexcept;
+		QXvec3t			LocalToWorld(const QXref3t<T>& ref) const noexcept;
 
 		/**
 		 * @brief Normalize vector
 		 * 
 		 * @return QXvec3& Reference of current vector
 		 */
-		QXvec3&			Normalize() noexcept;
+		QXvec3t&			Normalize() noexcept;
 
 		/**
 		 * @brief Normalize vector
 		 * 
 		 * @return QXvec3 Vector normalized
 		 */
-		const QXvec3	Normalized() const noexcept;
+		const QXvec3t	Normalized() const noexcept;
 
 		/**
 		 * @brief Multiply vectors values by constant
@@ -133,7 +147,7 @@ namespace Math
 		 * @param value Scaling value
 		 * @return QXvec3& Reference of current vector
 		 */
-		QXvec3&			Scale(QXfloat value) noexcept;
+		constexpr QXvec3t&			Scale(T value) noexcept;
 
 		/**
 		 * @brief Multiply vectors values by constant
@@ -141,14 +155,14 @@ namespace Math
 		 * @param value Scaling value
 		 * @return QXvec3& Scaled vector
 		 */
-		QXvec3			Scale(QXfloat value) const noexcept;
+		constexpr QXvec3t			Scale(T value) const noexcept;
 
 		/**
 		 * @brief Square length of current vector
 		 * 
 		 * @return QXfloat Square length value
 		 */
-		QXfloat			SqrLength() const noexcept;
+		constexpr T			SqrLength() const noexcept;
 
 		/**
 		 * @brief Make a string with vector values
@@ -168,7 +182,7 @@ namespace Math
 		 * @param vector Vector to copy
 		 * @return QXvec3& Reference of current vector
 		 */
-		QXvec3& operator=(const QXvec3& vector) noexcept;
+		constexpr QXvec3t& operator=(const QXvec3t& vector) noexcept;
 
 		/**
 		 * @brief Operator = by move
@@ -176,7 +190,7 @@ namespace Math
 		 * @param vector Vector to move
 		 * @return QXvec3& Reference of current vector
 		 */
-		QXvec3& operator=(QXvec3&& vector) noexcept;
+		constexpr QXvec3t& operator=(QXvec3t&& vector) noexcept;
 
 		/* Mathematics operators */
 
@@ -186,7 +200,7 @@ namespace Math
 		 * @param vector Vector to add
 		 * @return QXvec3& Reference of current vector
 		 */
-		QXvec3& operator+=(const QXvec3& vector) noexcept;
+		constexpr QXvec3t& operator+=(const QXvec3t& vector) noexcept;
 
 		/**
 		 * @brief Operator for addition
@@ -194,7 +208,7 @@ namespace Math
 		 * @param vector Vector to add
 		 * @return QXvec3 New vector
 		 */
-		QXvec3 	operator+(const QXvec3& vector) const noexcept;
+		constexpr QXvec3t 	operator+(const QXvec3t& vector) const noexcept;
 
 		/**
 		 * @brief Operator for substraction
@@ -202,7 +216,7 @@ namespace Math
 		 * @param vector Vector to substract
 		 * @return QXvec3& Reference of current vector
 		 */
-		QXvec3& operator-=(const QXvec3& vector) noexcept;
+		constexpr QXvec3t& operator-=(const QXvec3t& vector) noexcept;
 
 		/**
 		 * @brief Operator for substraction
@@ -210,14 +224,14 @@ namespace Math
 		 * @param vector Vector to substract
 		 * @return QXvec3 New vector
 		 */
-		QXvec3 	operator-(const QXvec3& vector) const noexcept;
+		constexpr QXvec3t 	operator-(const QXvec3t& vector) const noexcept;
 
 		/**
 		 * @brief Create a new QXvec3 as the opposite of the vector
 		 *
 		 * @return QXvec3 New vector
 		 */
-		QXvec3	operator-() const noexcept;
+		constexpr QXvec3t	operator-() const noexcept;
 
 		/**
 		 * @brief Operator for division by scalar
@@ -225,7 +239,7 @@ namespace Math
 		 * @param value Scalar to divide
 		 * @return QXvec3& Reference of current vector
 		 */
-		QXvec3& operator/=(QXfloat value) noexcept;
+		constexpr QXvec3t& operator/=(T value) noexcept;
 
 		/**
 		 * @brief Operator for division by scalar
@@ -233,7 +247,7 @@ namespace Math
 		 * @param value Scalar to divide
 		 * @return QXvec3 New vector
 		 */
-		QXvec3 	operator/(QXfloat value) const noexcept;
+		constexpr QXvec3t 	operator/(T value) const noexcept;
 
 		/**
 		 * @brief Operator for multiplication by scalar
@@ -241,7 +255,7 @@ namespace Math
 		 * @param value Scalar to multiply
 		 * @return QXvec3& Reference of current vector
 		 */
-		QXvec3& operator*=(QXfloat value) noexcept;
+		constexpr QXvec3t& operator*=(T value) noexcept;
 
 		/**
 		 * @brief Operator for multiplication by scalar
@@ -249,7 +263,7 @@ namespace Math
 		 * @param value Scalar to multiply
 		 * @return QXvec3 New vector
 		 */
-		QXvec3	operator*(QXfloat value) const noexcept;
+		constexpr QXvec3t	operator*(T value) const noexcept;
 
 		/* Binary operators */
 
@@ -260,7 +274,7 @@ namespace Math
 		 * @return true Vectors have same length
 		 * @return false Vectors have different length
 		 */
-		QXbool	operator==(const QXvec3& vector) const noexcept;
+		QXbool	operator==(const QXvec3t& vector) const noexcept;
 
 		/**
 		 * @brief Operator to compare vector length
@@ -269,7 +283,7 @@ namespace Math
 		 * @return true Vectors have different length
 		 * @return false Vectors have same length
 		 */
-		QXbool	operator!=(const QXvec3& vector) const noexcept;
+		QXbool	operator!=(const QXvec3t& vector) const noexcept;
 
 		/**
 		 * @brief Operator to compare vector length
@@ -278,7 +292,7 @@ namespace Math
 		 * @return true Vector length is strictly inferior to compared vector
 		 * @return false Vector length is superior or equal to compared vector
 		 */
-		QXbool	operator<(const QXvec3& vector) const noexcept;
+		QXbool	operator<(const QXvec3t& vector) const noexcept;
 
 		/**
 		 * @brief Operator to compare vector length
@@ -287,7 +301,7 @@ namespace Math
 		 * @return true Vector length is inferior or equal to compared vector
 		 * @return false Vector length is strictly superior to compared vector
 		 */
-		QXbool	operator<=(const QXvec3& vector) const noexcept;
+		QXbool	operator<=(const QXvec3t& vector) const noexcept;
 
 		/**
 		 * @brief Operator to compare vector length
@@ -296,7 +310,7 @@ namespace Math
 		 * @return true Vector length is strictly superior to compared vector
 		 * @return false Vector length is inferior or equal to compared vector
 		 */
-		QXbool	operator>(const QXvec3& vector) const noexcept;
+		QXbool	operator>(const QXvec3t& vector) const noexcept;
 
 		/**
 		 * @brief Operator to compare vector length
@@ -305,7 +319,7 @@ namespace Math
 		 * @return true Vector length is superior or equal to compared vector
 		 * @return false Vector length is strictly inferior to compared vector
 		 */
-		QXbool	operator>=(const QXvec3& vector) const noexcept;
+		QXbool	operator>=(const QXvec3t& vector) const noexcept;
 
 		/* Operator accessor*/
 
@@ -315,7 +329,7 @@ namespace Math
 		 * @param idx Index of the array
 		 * @return const QXfloat of the vector value
 		 */
-		const QXfloat	operator[](QXuint idx) const noexcept;
+		constexpr const T	operator[](QXuint idx) const noexcept;
 
 		/**
 		* @brief Operator to access vector values as an array
@@ -323,7 +337,7 @@ namespace Math
 		* @param idx Index of the array
 		* @return QXfloat& Reference of the vector value
 		*/
-		QXfloat& operator[](QXuint idx) noexcept;
+		T& operator[](QXuint idx) noexcept;
 
 #pragma endregion Operators
 
@@ -336,7 +350,7 @@ namespace Math
 		 * @param vector2 Destination Vector
 		 * @return QXfloat Angle value in radian
 		 */
-        static QXfloat	Angle(const QXvec3& vector1, const QXvec3& vector2) noexcept;
+        static T	Angle(const QXvec3t& vector1, const QXvec3t& vector2) noexcept;
 
 		/**
 		 * @brief Compute center of a segment
@@ -345,7 +359,7 @@ namespace Math
 		 * @param pointB Second point of the segment
 		 * @return QXvec3 Point that reprensent center of the segment
 		 */
-		static QXvec3 	Center(const QXvec3& pointA, const QXvec3& pointB) noexcept;
+		static constexpr QXvec3t 	Center(const QXvec3t& pointA, const QXvec3t& pointB) noexcept;
 
 		/**
 		 * @brief Lerp a vector to an other
@@ -355,7 +369,7 @@ namespace Math
 		 * @param ratio Ratio of lerp
 		 * @return QXvec3 Vector result of lerp
 		 */
-        static QXvec3		Lerp(const QXvec3& vector1, const QXvec3& vector2, QXfloat ratio) noexcept;
+        static constexpr QXvec3t		Lerp(const QXvec3t& vector1, const QXvec3t& vector2, T ratio) noexcept;
 
 		/**
 		 * @brief Create a new QXvec3 object from two points
@@ -364,13 +378,255 @@ namespace Math
 		 * @param point2 Second point
 		 * @return QXvec3 New vector
 		 */
-        static QXvec3		Vec3FromPoints(const QXvec3& point1, const QXvec3& point2) noexcept;
+        static constexpr QXvec3t		Vec3FromPoints(const QXvec3t& point1, const QXvec3t& point2) noexcept;
 
 #pragma endregion Static Functions
 
 #pragma endregion Functions
 	};
 
+	using QXvec3	= QXvec3t<QXfloat>;
+	using QXdvec3	= QXvec3t<QXdouble>;
+
+#pragma region Constexpr Functions
+
+	template<typename T>
+	constexpr QXvec3t<T>::QXvec3t(const T& x, const T& y, const T& z)  noexcept :
+		x {x},
+		y {y},
+		z {z}
+	{}
+
+	template<typename T>
+	constexpr QXvec3t<T>::QXvec3t(const QXvec3t<T>& vector)  noexcept :
+		x {vector.x},
+		y {vector.y},
+		z {vector.z}
+	{}
+
+	template<typename T>
+	constexpr QXvec3t<T>::QXvec3t(QXvec3t<T>&& vector)  noexcept :
+		x {std::move(vector.x)},
+		y {std::move(vector.y)},
+		z {std::move(vector.z)}
+	{}
+
+	template<typename T>
+	template<typename U>
+	constexpr QXvec3t<T>::QXvec3t(const QXvec3t<U>& vector) noexcept :
+		x {static_cast<T>(vector.x)},
+		y {static_cast<T>(vector.y)},
+		z {static_cast<T>(vector.z)}
+	{}
+
+	template<typename T>
+	constexpr QXvec3t<T>&   QXvec3t<T>::operator=(const QXvec3t<T>& vector) noexcept
+	{
+		x = vector.x;
+		y = vector.y;
+		z = vector.z;
+
+		return *this;
+	}
+
+	template<typename T>
+	constexpr QXvec3t<T>&   QXvec3t<T>::operator=(QXvec3t<T>&& vector) noexcept
+	{
+		x = std::move(vector.x);
+		y = std::move(vector.y);
+		z = std::move(vector.z);
+
+		return *this;
+	}
+
+	template<typename T>
+	constexpr QXvec3t<T>&   QXvec3t<T>::operator+=(const QXvec3t<T>& vector) noexcept
+	{
+		x += vector.x;
+		y += vector.y;
+		z += vector.z;
+
+		return *this;
+	}
+
+	template<typename T>
+	constexpr QXvec3t<T>    QXvec3t<T>::operator+(const QXvec3t<T>& vector) const noexcept
+	{
+		QXvec3t<T> res;
+
+		res.x = vector.x + x;
+		res.y = vector.y + y;
+		res.z = vector.z + z;
+
+		return res;
+	}
+
+	template<typename T>
+	constexpr QXvec3t<T>&   QXvec3t<T>::operator-=(const QXvec3t<T>& vector) noexcept
+	{
+		x -= vector.x;
+		y -= vector.y;
+		z -= vector.z;
+
+		return *this;
+	}
+
+	template<typename T>
+	constexpr QXvec3t<T>    QXvec3t<T>::operator-(const QXvec3t<T>& vector) const noexcept
+	{
+		QXvec3t<T> res;
+
+		res.x = x - vector.x;
+		res.y = y - vector.y;
+		res.z = z - vector.z;
+
+		return res;
+	}
+
+	template<typename T>
+	constexpr QXvec3t<T>    QXvec3t<T>::operator-() const noexcept
+	{
+		return {-x, -y, -z};
+	}
+
+	template<typename T>
+	constexpr QXvec3t<T>&   QXvec3t<T>::operator/=(T value) noexcept
+	{
+		x /= value;
+		y /= value;
+		z /= value;
+
+		return *this;
+	}
+
+	template<typename T>
+	constexpr QXvec3t<T>    QXvec3t<T>::operator/(T value) const noexcept
+	{
+		QXvec3t<T> res;
+
+		res.x = x / value;
+		res.y = y / value;
+		res.z = z / value;
+
+		return res;
+	}
+
+	template<typename T>
+	constexpr QXvec3t<T>&   QXvec3t<T>::operator*=(T value) noexcept
+	{
+		x *= value;
+		y *= value;
+		z *= value;
+
+		return *this;
+	}
+
+	template<typename T>
+	constexpr QXvec3t<T>    QXvec3t<T>::operator*(T value) const noexcept
+	{
+		QXvec3t<T> res;
+
+		res.x = x * value;
+		res.y = y * value;
+		res.z = z * value;
+
+		return res;
+	}
+
+	template<typename T>
+	constexpr const T   QXvec3t<T>::operator[](QXuint idx) const noexcept
+	{
+		switch (idx)
+		{
+		case 0: return x; break;
+
+		case 1: return y; break;
+
+		case 2: return z; break;
+
+		default: return 0.f; break;
+		}
+	}
+
+	template<typename T>
+	constexpr QXvec3t<T>    QXvec3t<T>::Cross(const QXvec3t<T>& vector) const noexcept
+	{
+		return {(y * vector.z) - (z * vector.y), (z * vector.x) - (x * vector.z), (x * vector.y) - (y * vector.x)};
+	}
+
+	template<typename T>
+	constexpr T   QXvec3t<T>::Dot(const QXvec3t<T>& vector) const noexcept
+	{
+		return x * vector.x + y * vector.y + z * vector.z;
+	}
+
+	template<typename T>
+	constexpr QXvec3t<T>& QXvec3t<T>::Scale(T value) noexcept
+	{
+		x = x * value;
+		y = y * value;
+		z = z * value;
+
+		return *this;
+	}
+
+	template<typename T>
+	constexpr QXvec3t<T>	QXvec3t<T>::Scale(T value) const noexcept
+	{
+		QXvec3t<T>	res;
+
+		res.x = x * value;
+		res.y = y * value;
+		res.z = z * value;
+
+		return res;
+	}
+
+	template<typename T>
+	constexpr T QXvec3t<T>::SqrLength() const noexcept
+	{
+		return x * x + y * y + z * z;
+	}
+
+	template<typename T>
+	constexpr QXvec3t<T> QXvec3t<T>::Center(const QXvec3t<T>& pointA, const QXvec3t<T>& pointB) noexcept
+	{
+		return pointA + (pointB - pointA) * 0.5;
+	}
+
+	template<typename T>
+	constexpr QXvec3t<T> QXvec3t<T>::Lerp(const QXvec3t<T>& vector1, const QXvec3t<T>& vector2, T ratio) noexcept
+	{
+		return vector1 + (vector2 - vector1) * ratio;
+	}
+
+	template<typename T>
+	constexpr QXvec3t<T> QXvec3t<T>::Vec3FromPoints(const QXvec3t<T>& point1, const QXvec3t<T>& point2) noexcept
+	{
+		return point1 - point2;
+	}
+
+	template<typename T>
+	inline constexpr QXvec3t<T> QXvec3t<T>::zero		{0.f, 0.f, 0.f};
+	template<typename T>
+	inline constexpr QXvec3t<T> QXvec3t<T>::up			{0.f, 1.f, 0.f};
+	template<typename T>
+	inline constexpr QXvec3t<T> QXvec3t<T>::down		{0.f, -1.f, 0.f};
+	template<typename T>
+	inline constexpr QXvec3t<T> QXvec3t<T>::right		{1.f, 0.f, 0.f};
+	template<typename T>
+	inline constexpr QXvec3t<T> QXvec3t<T>::left		{-1.f, 0.f, 0.f};
+	template<typename T>
+	inline constexpr QXvec3t<T> QXvec3t<T>::forward		{0.f, 0.f, 1.f};
+	template<typename T>
+	inline constexpr QXvec3t<T> QXvec3t<T>::backward	{0.f, 0.f, -1.f};
+	template<typename T>
+	inline constexpr QXvec3t<T> QXvec3t<T>::infinity	{std::numeric_limits<T>::infinity(),
+												std::numeric_limits<T>::infinity(),
+												std::numeric_limits<T>::infinity()};
+
+#pragma endregion Constexpr Functions
+
 	/**
 	 * @brief Operator to print vector
 	 * 
@@ -378,17 +634,18 @@ namespace Math
 	 * @param vector Vector to add to the stream
 	 * @return std::ostream& Reference to the stream
 	 */
-	std::ostream&	operator<<(std::ostream& stream, const QXvec3& vector) noexcept;
+	template<typename T>
+	std::ostream&	operator<<(std::ostream& stream, const QXvec3t<T>& vector) noexcept;
 }
 
 namespace std
 {
-	template<>
-	struct hash<Math::QXvec3>
+	template<typename T>
+	struct hash<Math::QXvec3t<T>>
 	{
-		size_t operator()(const Math::QXvec3& v)
+		size_t operator()(const Math::QXvec3t<T>& v) const noexcept
 		{
-			return std::hash<float>{}(v.x) + std::hash<float>{}(v.y) + std::hash<float>{}(v.z);
+			return (size_t)Math::HashCombine(Math::HashCombine(Math::HashMix(Math::HashScalar(v.x)), Math::HashScalar(v.y)), Math::HashScalar(v.z));
 		}
 	};
 }
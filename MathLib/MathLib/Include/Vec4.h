@@ -3,31 +3,34 @@
 
 #include <iostream>
 #include <string>
+#include <utility>
 
 #include "Vec3.h"
 
+#include "Hash.h"
 #include "Type.h"
 
 namespace Math
 {
-	struct QXvec4
+	template<typename T>
+	struct QXvec4t
 	{
 #pragma region Attributes
 
 		union
 		{
-			struct { QXfloat x, y, z, w; };
-			struct { QXfloat r, g, b, a; };
-			QXfloat e[4];
+			struct { T x, y, z, w; };
+			struct { T r, g, b, a; };
+			T e[4];
 		};
 
-		static const QXvec4	zero;
-		static const QXvec4	up;
-		static const QXvec4	down;
-		static const QXvec4	left;
-		static const QXvec4	right;
-		static const QXvec4	forward;
-		static const QXvec4	backward;
+		static const QXvec4t	zero;
+		static const QXvec4t	up;
+		static const QXvec4t	down;
+		static const QXvec4t	left;
+		static const QXvec4t	right;
+		static const QXvec4t	forward;
+		static const QXvec4t	backward;
 
 #pragma endregion Attributes
 
@@ -41,7 +44,7 @@ namespace Math
 		 * @param posZ Value for z parameter by default
 		 * @param posW Value for w parameter by default
 		 */
-		QXvec4(const QXfloat& posX = 0.f , const QXfloat& posY = 0.f, const QXfloat& posZ = 0.f, const QXfloat& posW = 0.f) noexcept;
+		constexpr QXvec4t(const T& posX = 0.f , const T& posY = 0.f, const T& posZ = 0.f, const T& posW = 0.f) noexcept;
 
 		/**
 		 * @brief Construct a new QXvec4 object
@@ -49,26 +52,34 @@ namespace Math
 		 * @param vec Vector for xyz
 		 * @param posW Value for w parameter
 		 */
-		QXvec4(const QXvec3& vec, QXfloat posW) noexcept;
+		constexpr QXvec4t(const QXvec3t<T>& vec, T posW) noexcept;
 
 		/**
 		 * @brief Construct a new QXvec4 object
 		 * 
 		 * @param vec Vector to copy
 		 */
-		QXvec4(const QXvec4& vec) noexcept;
+		constexpr QXvec4t(const QXvec4t& vec) noexcept;
 
 		/**
 		 * @brief Construct a new QXvec4 object
 		 * 
 		 * @param vec Vector to move
 		 */
-		QXvec4(QXvec4&& vec) noexcept;
+		constexpr QXvec4t(QXvec4t&& vec) noexcept;
+
+		/**
+		 * @brief Construct a new QXvec4 object from an other scalar type, conversion is explicit only
+		 *
+		 * @param vec Vector to convert
+		 */
+		template<typename U>
+		constexpr explicit QXvec4t(const QXvec4t<U>& vec) noexcept;
 
 		/**
 		 * @brief Destroy the QXvec4 object
 		 */
-		~QXvec4() = default;
+		~QXvec4t() = default;
 
 #pragma endregion Constructors
 
@@ -84,21 +95,21 @@ namespace Math
 		 * 
 		 * @return QXfloat Length value
 		 */
-		QXfloat		Length() const noexcept;
+		T		Length() const noexcept;
 
 		/**
 		 * @brief Normalize vector
 		 * 
 		 * @return QXvec4& Reference of current vector
 		 */
-		QXvec4&		Normalize() noexcept;
+		QXvec4t&		Normalize() noexcept;
 
 		/**
 		 * @brief Normalize vector
 		 * 
 		 * @return QXvec4 Vector normalized
 		 */
-		QXvec4		Normalize() const noexcept;
+		QXvec4t		Normalize() const noexcept;
 
 		/**
 		 * @brief Multiply vectors values by constant
@@ -106,7 +117,7 @@ namespace Math
 		 * @param value Scaling value
 		 * @return QXvec4& Reference of current vector
 		 */
-		QXvec4&		Scale(QXfloat nb) noexcept;
+		constexpr QXvec4t&		Scale(T nb) noexcept;
 
 		/**
 		 * @brief Multiply vectors values by constant
@@ -114,14 +125,14 @@ namespace Math
 		 * @param value Scaling value
 		 * @return QXvec4& Scaled vector
 		 */
-		QXvec4		Scale(QXfloat nb) const noexcept;
+		constexpr QXvec4t		Scale(T nb) const noexcept;
 
 		/**
 		 * @brief Square length of current vector
 		 * 
 		 * @return QXfloat Square length value
 		 */
-		QXfloat		SqrLength() const noexcept;
+		constexpr T		SqrLength() const noexcept;
 
 		/**
 		 * @brief Make a string with vector values
@@ -140,7 +151,7 @@ namespace Math
 		 * @param vec Vector to copy
 		 * @return QXvec4& Reference of current vector
 		 */
-		QXvec4& operator=(const QXvec4& vec) noexcept;
+		constexpr QXvec4t& operator=(const QXvec4t& vec) noexcept;
 
 		/**
 		 * @brief Operator = by move
@@ -148,7 +159,7 @@ namespace Math
 		 * @param vec Vector to move
 		 * @return QXvec4& Reference of current vector
 		 */
-		QXvec4& operator=(QXvec4&& vec) noexcept;
+		constexpr QXvec4t& operator=(QXvec4t&& vec) noexcept;
 
 		/* Mathematics operators */
 
@@ -158,7 +169,7 @@ namespace Math
 		 * @param vect Vector to Add
 		 * @return QXvec4& Reference of current vector
 		 */
-		QXvec4& operator+=(const QXvec4& vect) noexcept;
+		constexpr QXvec4t& operator+=(const QXvec4t& vect) noexcept;
 
 		/**
 		 * @brief Operator for addition
@@ -166,7 +177,7 @@ namespace Math
 		 * @param vect Vector to add
 		 * @return QXvec4 New vector
 		 */
-		QXvec4		operator+(const QXvec4& vect) const noexcept;
+		constexpr QXvec4t		operator+(const QXvec4t& vect) const noexcept;
 
 		/**
 		 * @brief Operator for Vector Substraction
@@ -174,7 +185,7 @@ namespace Math
 		 * @param vect Vector to Substract
 		 * @return QXvec4& Reference of current vector
 		 */
-		QXvec4& operator-=(const QXvec4& vect) noexcept;
+		constexpr QXvec4t& operator-=(const QXvec4t& vect) noexcept;
 
 		/**
 		 * @brief Operator for substraction
@@ -182,14 +193,14 @@ namespace Math
 		 * @param vect Vector to substract
 		 * @return QXvec4 New vector
 		 */
-		QXvec4		operator-(const QXvec4& vect) const noexcept;
+		constexpr QXvec4t		operator-(const QXvec4t& vect) const noexcept;
 
 		/**
 		 * @brief Create a new QXvec4 as the opposite of the vector
 		 *
 		 * @return QXvec4 New vector
 		 */
-		QXvec4		operator-() const noexcept;
+		constexpr QXvec4t		operator-() const noexcept;
 
 		/**
 		 * @brief Operator for division by scalar
@@ -197,7 +208,7 @@ namespace Math
 		 * @param value Scalar to divide
 		 * @return QXvec4& Reference of current vector
 		 */
-		QXvec4& operator/=(QXfloat value) noexcept;
+		constexpr QXvec4t& operator/=(T value) noexcept;
 
 		/**
 		 * @brief Operator for division by scalar
@@ -205,7 +216,7 @@ namespace Math
 		 * @param value Scalar to divide
 		 * @return QXvec4 New vector
 		 */
-		QXvec4		operator/(QXfloat value) const noexcept;
+		constexpr QXvec4t		operator/(T value) const noexcept;
 
 		/**
 		 * @brief Operator for multiplication by scalar
@@ -213,7 +224,7 @@ namespace Math
 		 * @param value Scalar to multiply
 		 * @return QXvec4& Reference of current vector
 		 */
-		QXvec4& operator*=(QXfloat value) noexcept;
+		constexpr QXvec4t& operator*=(T value) noexcept;
 
 		/**
 		 * @brief Operator for multiplication by scalar
@@ -221,7 +232,7 @@ namespace Math
 		 * @param value Scalar to multiply
 		 * @return QXvec4 New vector
 		 */
-		QXvec4		operator*(QXfloat value) const noexcept;
+		constexpr QXvec4t		operator*(T value) const noexcept;
 
 		/**
 		 * @brief Operator to compare length
@@ -230,7 +241,7 @@ namespace Math
 		 * @return true Vectors have same length
 		 * @return false Vectors have different length
 		 */
-		QXbool		operator==(const QXvec4& vect) const noexcept;
+		QXbool		operator==(const QXvec4t& vect) const noexcept;
 
 		/**
 		 * @brief Operator to compare vector length
@@ -239,7 +250,7 @@ namespace Math
 		 * @return true Vectors have different length
 		 * @return false Vectors have same length
 		 */
-		QXbool		operator!=(const QXvec4& vect) const noexcept;
+		QXbool		operator!=(const QXvec4t& vect) const noexcept;
 
 		/**
 		 * @brief Operator to compare vector length
@@ -248,7 +259,7 @@ namespace Math
 		 * @return true Vector length is strictly inferior to compared vector
 		 * @return false Vector length is superior or equal to compared vector
 		 */
-		QXbool		operator<(const QXvec4& vect) const noexcept;
+		QXbool		operator<(const QXvec4t& vect) const noexcept;
 
 		/**
 		 * @brief Operator to compare vector length
@@ -257,7 +268,7 @@ namespace Math
 		 * @return true Vector length is inferior or equal to compared vector
 		 * @return false Vector length is strictly superior to compared vector
 		 */
-		QXbool		operator<=(const QXvec4& vect) const noexcept;
+		QXbool		operator<=(const QXvec4t& vect) const noexcept;
 
 		/**
 		 * @brief Operator to compare vector length
@@ -266,7 +277,7 @@ namespace Math
 		 * @return true Vector length is strictly superior to compared vector
 		 * @return false Vector length is inferior or equal to compared vector
 		 */
-		QXbool		operator>(const QXvec4& vect) const noexcept;
+		QXbool		operator>(const QXvec4t& vect) const noexcept;
 
 		/**
 		 * @brief Operator to compare vector length
@@ -275,7 +286,7 @@ namespace Math
 		 * @return true Vector length is superior or equal to compared vector
 		 * @return false Vector length is strictly inferior to compared vector
 		 */
-		QXbool		operator>=(const QXvec4& vect) const noexcept;
+		QXbool		operator>=(const QXvec4t& vect) const noexcept;
 
 		/**
 		 * @brief Operator to access vector values as an array
@@ -283,7 +294,7 @@ namespace Math
 		 * @param idx Index of the array
 		 * @return QXfloat& Reference of the vector value
 		 */
-		QXfloat& operator[](QXuint idx) noexcept;
+		T& operator[](QXuint idx) noexcept;
 
 		/**
 		 * @brief Operator to access vector values as an array
@@ -291,7 +302,7 @@ namespace Math
 		 * @param idx Index of the array
 		 * @return const QXfloat of the vector value
 		 */
-		const QXfloat	operator[](QXuint idx) const noexcept;
+		constexpr const T	operator[](QXuint idx) const noexcept;
 
 
 #pragma endregion Operators
@@ -299,6 +310,243 @@ namespace Math
 #pragma endregion Functions
 	};
 
+	using QXvec4	= QXvec4t<QXfloat>;
+	using QXdvec4	= QXvec4t<QXdouble>;
+
+#pragma region Constexpr Functions
+
+	template<typename T>
+	constexpr QXvec4t<T>::QXvec4t(const T& posX, const T& posY, const T& posZ, const T& posW) noexcept :
+		x (posX),
+		y (posY),
+		z (posZ),
+		w (posW)
+	{
+	}
+
+	template<typename T>
+	constexpr QXvec4t<T>::QXvec4t(const QXvec3t<T>& vec, T posW) noexcept :
+		x { vec.x },
+		y { vec.y },
+		z { vec.z },
+		w { posW }
+	{}
+
+	template<typename T>
+	constexpr QXvec4t<T>::QXvec4t(const QXvec4t<T>& vec)  noexcept :
+		x{ vec.x },
+		y{ vec.y },
+		z{ vec.z },
+		w{ vec.w }
+	{}
+
+	template<typename T>
+	constexpr QXvec4t<T>::QXvec4t(QXvec4t<T>&& vec)  noexcept :
+		x{ std::move(vec.x) },
+		y{ std::move(vec.y) },
+		z{ std::move(vec.z) },
+		w{ std::move(vec.w) }
+	{}
+
+	template<typename T>
+	template<typename U>
+	constexpr QXvec4t<T>::QXvec4t(const QXvec4t<U>& vec) noexcept :
+		x{ static_cast<T>(vec.x) },
+		y{ static_cast<T>(vec.y) },
+		z{ static_cast<T>(vec.z) },
+		w{ static_cast<T>(vec.w) }
+	{}
+
+	template<typename T>
+	constexpr QXvec4t<T>& QXvec4t<T>::operator=(const QXvec4t<T>& vect) noexcept
+	{
+		x = vect.x;
+		y = vect.y;
+	    z = vect.z;
+		w = vect.w;
+
+		return *this;
+	}
+
+	template<typename T>
+	constexpr QXvec4t<T>&	QXvec4t<T>::operator=(QXvec4t<T>&& vec)  noexcept
+	{
+		x = std::move(vec.x);
+		y = std::move(vec.y);
+		z = std::move(vec.z);
+		w = std::move(vec.w);
+
+		return *this;
+	}
+
+	template<typename T>
+	constexpr QXvec4t<T>&	QXvec4t<T>::operator+=(const QXvec4t<T>& vect) noexcept
+	{
+		x += vect.x;
+		y += vect.y;
+	    z += vect.z;
+		w += vect.w;
+
+		return *this;
+	}
+
+	template<typename T>
+	constexpr QXvec4t<T>	QXvec4t<T>::operator+(const QXvec4t<T>& vect) const noexcept
+	{
+		QXvec4t<T>	res;
+
+		res.x = x + vect.x;
+		res.y = y + vect.y;
+	    res.z = z + vect.z;
+		res.w = w + vect.w;
+
+		return res;
+	}
+
+	template<typename T>
+	constexpr QXvec4t<T>&	QXvec4t<T>::operator-=(const QXvec4t<T>& vect) noexcept
+	{
+		x -= vect.x;
+		y -= vect.y;
+	    z -= vect.z;
+		w -= vect.w;
+
+		return *this;
+	}
+
+	template<typename T>
+	constexpr QXvec4t<T>	QXvec4t<T>::operator-(const QXvec4t<T>& vect) const noexcept
+	{
+		QXvec4t<T>	res;
+
+		res.x = x - vect.x;
+		res.y = y - vect.y;
+	    res.z = z - vect.z;
+		res.w = w - vect.w;
+
+		return res;
+	}
+
+	template<typename T>
+	constexpr QXvec4t<T>	QXvec4t<T>::operator-() const noexcept
+	{
+		QXvec4t<T>	res;
+
+		res.x = -x;
+		res.y = -y;
+		res.z = -z;
+		res.w = -w;
+
+		return res;
+	}
+
+	template<typename T>
+	constexpr QXvec4t<T>&	QXvec4t<T>::operator*=(T nb) noexcept
+	{
+		x *= nb;
+		y *= nb;
+	    z *= nb;
+		w *= nb;
+
+		return *this;
+	}
+
+	template<typename T>
+	constexpr QXvec4t<T>	QXvec4t<T>::operator*(T nb) const noexcept
+	{
+		QXvec4t<T>	res;
+
+		res.x = x * nb;
+		res.y = y * nb;
+	    res.z = z * nb;
+		res.w = w * nb;
+
+		return res;
+	}
+
+	template<typename T>
+	constexpr QXvec4t<T>&	QXvec4t<T>::operator/=(T nb) noexcept
+	{
+		x /= nb;
+		y /= nb;
+	    z /= nb;
+		w /= nb;
+
+		return *this;
+	}
+
+	template<typename T>
+	constexpr QXvec4t<T>	QXvec4t<T>::operator/(T nb) const noexcept
+	{
+		QXvec4t<T>	res;
+
+		res.x = x / nb;
+		res.y = y / nb;
+	    res.z = z / nb;
+		res.w = w / nb;
+
+		return res;
+	}
+
+	template<typename T>
+	constexpr const T QXvec4t<T>::operator[](QXuint idx) const noexcept
+	{
+		switch (idx)
+		{
+		case 0: return x;
+		case 1: return y;
+		case 2: return z;
+		default: return w;
+		}
+	}
+
+	template<typename T>
+	constexpr QXvec4t<T>	QXvec4t<T>::Scale(T nb) const noexcept
+	{
+		QXvec4t<T>	res;
+
+		res.x = x * nb;
+		res.y = y * nb;
+	    res.z = z * nb;
+		res.w = w * nb;
+
+		return res;
+	}
+
+	template<typename T>
+	constexpr QXvec4t<T>& QXvec4t<T>::Scale(T nb) noexcept
+	{
+		x = x * nb;
+		y = y * nb;
+	    z = z * nb;
+		w = w * nb;
+
+		return *this;
+	}
+
+	template<typename T>
+	constexpr T	QXvec4t<T>::SqrLength() const noexcept
+	{
+		return x * x + y * y + z * z + w * w;
+	}
+
+	template<typename T>
+	inline constexpr QXvec4t<T>	QXvec4t<T>::zero {0.f, 0.f, 0.f, 0.f};
+	template<typename T>
+	inline constexpr QXvec4t<T>	QXvec4t<T>::up {0.f, 1.f, 0.f, 0.f};
+	template<typename T>
+	inline constexpr QXvec4t<T>	QXvec4t<T>::down {0.f, -1.f, 0.f, 0.f};
+	template<typename T>
+	inline constexpr QXvec4t<T>	QXvec4t<T>::left {-1.f, 0.f, 0.f, 0.f};
+	template<typename T>
+	inline constexpr QXvec4t<T>	QXvec4t<T>::right {1.f, 0.f, 0.f, 0.f};
+	template<typename T>
+	inline constexpr QXvec4t<T>	QXvec4t<T>::forward {0.0f, 0.0f, 1.0f, 0.f};
+	template<typename T>
+	inline constexpr QXvec4t<T>	QXvec4t<T>::backward {0.0f, 0.0f, -1.0f, 0.f};
+
+#pragma endregion Constexpr Functions
+
 	/**
 	 * @brief Operator to print vector
 	 * 
@@ -306,7 +554,8 @@ namespace Math
 	 * @param vector Vector to add to the stream
 	 * @return std::ostream& Reference to the stream
 	 */
-	std::ostream&	operator<<(std::ostream& os, const QXvec4& vect) noexcept;
+	template<typename T>
+	std::ostream&	operator<<(std::ostream& os, const QXvec4t<T>& vect) noexcept;
 
 	/**
 	 * @brief Operator to add a print of vector in string
@@ -315,7 +564,21 @@ namespace Math
 	 * @param vector Vector to add to the stream
 	 * @return QXstring New string
 	 */
-	QXstring		operator+(std::string& str, const QXvec4& vect) noexcept;
+	template<typename T>
+	QXstring		operator+(std::string& str, const QXvec4t<T>& vect) noexcept;
+}
+
+namespace std
+{
+	template<typename T>
+	struct hash<Math::QXvec4t<T>>
+	{
+		size_t operator()(const Math::QXvec4t<T>& v) const noexcept
+		{
+			return (size_t)Math::HashCombine(Math::HashCombine(Math::HashCombine(Math::HashMix(Math::HashScalar(v.x)),
+					Math::HashScalar(v.y)), Math::HashScalar(v.z)), Math::HashScalar(v.w));
+		}
+	};
 }
 
 #endif //_VEC4_H_
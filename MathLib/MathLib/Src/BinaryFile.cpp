@@ -0,0 +1,320 @@
+#include "BinaryFile.h"
+
+#include <algorithm>
+#include <cstring>
+
+#ifdef _WIN32
+	#ifndef NOMINMAX
+		#define NOMINMAX
+	#endif
+	#include <windows.h>
+#else
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+namespace Math
+{
+	static_assert(sizeof(QXbinaryFileHeader) == QX_BINARY_ALIGNMENT, "file header must fill one alignment block");
+	static_assert(sizeof(QXbinaryArrayHeader) == QX_BINARY_ALIGNMENT, "array header must fill one alignment block");
+
+	static constexpr char		magic[4]{ 'Q', 'X', 'M', 'B' };
+	static constexpr QXushort	byteOrderMark{ 0xFEFF };
+
+	#pragma region Static Functions
+
+	static QXuint64	AlignUp(QXuint64 size) noexcept
+	{
+		return (size + QX_BINARY_ALIGNMENT - 1) & ~(QXuint64)(QX_BINARY_ALIGNMENT - 1);
+	}
+
+	/* size of one element of an array, 0 for an unknown type */
+	static QXuint64	ElementSize(const QXbinaryArrayHeader& header) noexcept
+	{
+		switch (header.type)
+		{
+		case QXarrayType::Scalar:		return header.scalarSize;
+		case QXarrayType::Vec2:			return header.scalarSize * 2;
+		case QXarrayType::Vec3:			return header.scalarSize * 3;
+		case QXarrayType::Vec4:			return header.scalarSize * 4;
+		case QXarrayType::Quaternion:	return header.scalarSize * 4;
+		case QXarrayType::Mat4:			return header.scalarSize * 16;
+		case QXarrayType::Ref3:			return header.scalarSize * 12;
+		case QXarrayType::Mat:			return (QXuint64)header.scalarSize * header.column;
+		default:						return 0;
+		}
+	}
+
+	#pragma endregion Static Functions
+
+	#pragma region Writer
+	#pragma region Constructor/Destructor
+	QXbinaryWriter::QXbinaryWriter() noexcept :
+		_arrayStart{ 0 },
+		_header{},
+		_inArray{ false }
+	{}
+
+	QXbinaryWriter::~QXbinaryWriter()
+	{
+		Close();
+	}
+	#pragma endregion Constructor/Destructor
+
+	#pragma region Functions
+	void QXbinaryWriter::Pad(QXuint64 size)
+	{
+		static const char zeros[QX_BINARY_ALIGNMENT]{};
+
+		if (size > 0)
+			_file.write(zeros, (std::streamsize)size);
+	}
+
+	QXbool QXbinaryWriter::Open(const QXstring& path)
+	{
+		Close();
+
+		_file.open(path, std::ios::binary | std::ios::trunc);
+		if (!_file)
+			return false;
+
+		QXbinaryFileHeader header{};
+		memcpy(header.magic, magic, sizeof(magic));
+		header.version = QX_BINARY_VERSION;
+		header.byteOrder = byteOrderMark;
+		header.alignment = QX_BINARY_ALIGNMENT;
+
+		_file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+		return (QXbool)_file;
+	}
+
+	QXbool QXbinaryWriter::Close()
+	{
+		if (!_file.is_open())
+			return true;
+
+		EndArray();
+
+		QXbool good{ (QXbool)_file };
+		_file.close();
+
+		return good;
+	}
+
+	void QXbinaryWriter::BeginArray(QXarrayType type, QXuint scalarSize, const QXstring& name, QXuint column)
+	{
+		EndArray();
+
+		_header = {};
+		_header.type = type;
+		_header.scalarSize = scalarSize;
+		_header.column = column;
+		memcpy(_header.name, name.c_str(), std::min(name.size(), sizeof(_header.name) - 1));
+
+		/* finished stays 0 in the file until EndArray, readers stop on unfinished arrays */
+		_arrayStart = _file.tellp();
+		_file.write(reinterpret_cast<const char*>(&_header), sizeof(_header));
+		_inArray = true;
+	}
+
+	void QXbinaryWriter::Append(const void* data, QXuint64 count)
+	{
+		if (!_inArray || count == 0)
+			return;
+
+		_file.write(static_cast<const char*>(data), (std::streamsize)(count * ElementSize(_header)));
+		_header.count += count;
+	}
+
+	void QXbinaryWriter::EndArray()
+	{
+		if (!_inArray)
+			return;
+
+		QXuint64 size{ _header.count * ElementSize(_header) };
+		Pad(AlignUp(size) - size);
+		_header.byteSize = AlignUp(size);
+		_header.finished = 1;
+
+		std::streamoff end{ _file.tellp() };
+		_file.seekp(_arrayStart);
+		_file.write(reinterpret_cast<const char*>(&_header), sizeof(_header));
+		_file.seekp(end);
+
+		_inArray = false;
+	}
+
+	void QXbinaryWriter::WriteMat(const QXconstMatView& mat, const QXstring& name)
+	{
+		BeginArray(QXarrayType::Mat, sizeof(QXfloat), name, (QXuint)mat.column);
+
+		for (QXint i = 0; i < mat.line; i++)
+		{
+			if (mat.columnStride == 1)
+				_file.write(reinterpret_cast<const char*>(&mat(i, 0)), mat.column * sizeof(QXfloat));
+			else
+				for (QXint j = 0; j < mat.column; j++)
+					_file.write(reinterpret_cast<const char*>(&mat(i, j)), sizeof(QXfloat));
+		}
+		_header.count = (QXuint64)mat.line;
+
+		EndArray();
+	}
+	#pragma endregion Functions
+	#pragma endregion Writer
+
+	#pragma region Reader
+	#pragma region Constructor/Destructor
+	QXbinaryReader::QXbinaryReader() noexcept :
+		_data{ nullptr },
+		_size{ 0 },
+		_file{ nullptr },
+		_mapping{ nullptr }
+	{}
+
+	QXbinaryReader::~QXbinaryReader()
+	{
+		Close();
+	}
+	#pragma endregion Constructor/Destructor
+
+	#pragma region Functions
+	QXbool QXbinaryReader::Open(const QXstring& path)
+	{
+		Close();
+
+#ifdef _WIN32
+		HANDLE file{ CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+								FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr) };
+		if (file == INVALID_HANDLE_VALUE)
+			return false;
+
+		LARGE_INTEGER size;
+		if (!GetFileSizeEx(file, &size) || size.QuadPart < (LONGLONG)sizeof(QXbinaryFileHeader))
+		{
+			CloseHandle(file);
+			return false;
+		}
+
+		HANDLE mapping{ CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr) };
+		if (mapping == nullptr)
+		{
+			CloseHandle(file);
+			return false;
+		}
+
+		_file = file;
+		_mapping = mapping;
+		_size = (QXuint64)size.QuadPart;
+		_data = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+#else
+		int file{ open(path.c_str(), O_RDONLY) };
+		if (file < 0)
+			return false;
+
+		struct stat status;
+		if (fstat(file, &status) != 0 || status.st_size < (off_t)sizeof(QXbinaryFileHeader))
+		{
+			close(file);
+			return false;
+		}
+
+		void* data{ mmap(nullptr, (size_t)status.st_size, PROT_READ, MAP_SHARED, file, 0) };
+		close(file);
+
+		_size = (QXuint64)status.st_size;
+		_data = data == MAP_FAILED ? nullptr : static_cast<const char*>(data);
+#endif
+
+		if (_data == nullptr)
+		{
+			Close();
+			return false;
+		}
+
+		const QXbinaryFileHeader* header{ reinterpret_cast<const QXbinaryFileHeader*>(_data) };
+		if (memcmp(header->magic, magic, sizeof(magic)) != 0 || header->version != QX_BINARY_VERSION ||
+			header->byteOrder != byteOrderMark || header->alignment != QX_BINARY_ALIGNMENT)
+		{
+			Close();
+			return false;
+		}
+
+		/* walk the headers only, the data pages are not touched */
+		QXuint64 offset{ sizeof(QXbinaryFileHeader) };
+		while (offset + sizeof(QXbinaryArrayHeader) <= _size)
+		{
+			const QXbinaryArrayHeader* array{ reinterpret_cast<const QXbinaryArrayHeader*>(_data + offset) };
+			QXuint64 elementSize{ ElementSize(*array) };
+
+			if (array->finished != 1 || elementSize == 0 || array->byteSize < array->count * elementSize ||
+				array->byteSize > _size - offset - sizeof(QXbinaryArrayHeader))
+				break;
+
+			_arrays.push_back(array);
+			offset += sizeof(QXbinaryArrayHeader) + array->byteSize;
+		}
+
+		return true;
+	}
+
+	void QXbinaryReader::Close() noexcept
+	{
+#ifdef _WIN32
+		if (_data != nullptr)
+			UnmapViewOfFile(_data);
+		if (_mapping != nullptr)
+			CloseHandle(_mapping);
+		if (_file != nullptr)
+			CloseHandle(_file);
+#else
+		if (_data != nullptr)
+			munmap(const_cast<char*>(_data), (size_t)_size);
+#endif
+
+		_data = nullptr;
+		_size = 0;
+		_file = nullptr;
+		_mapping = nullptr;
+		_arrays.clear();
+	}
+
+	QXuint QXbinaryReader::ArrayCount() const noexcept
+	{
+		return (QXuint)_arrays.size();
+	}
+
+	const QXbinaryArrayHeader& QXbinaryReader::Header(QXuint i) const noexcept
+	{
+		return *_arrays[i];
+	}
+
+	QXint QXbinaryReader::Find(const QXstring& name) const noexcept
+	{
+		for (QXuint i = 0; i < _arrays.size(); i++)
+			if (strncmp(_arrays[i]->name, name.c_str(), sizeof(_arrays[i]->name)) == 0)
+				return (QXint)i;
+
+		return -1;
+	}
+
+	const void* QXbinaryReader::Data(QXuint i) const noexcept
+	{
+		return _arrays[i] + 1;
+	}
+
+	QXconstMatView QXbinaryReader::GetMat(QXuint i) const noexcept
+	{
+		const QXbinaryArrayHeader& header{ Header(i) };
+
+		if (header.type != QXarrayType::Mat || header.scalarSize != sizeof(QXfloat))
+			return {};
+
+		return QXconstMatView(static_cast<const QXfloat*>(Data(i)), (QXint)header.count, (QXint)header.column, (QXint)header.column);
+	}
+	#pragma endregion Functions
+	#pragma endregion Reader
+}
@@ -0,0 +1,596 @@
+#include "Compression.h"
+#include "Simd.h"
+
+#include <cmath>
+#include <cstring>
+
+namespace Math::Compression
+{
+	static_assert(sizeof(QXvec3) == 3 * sizeof(QXfloat), "QXvec3 arrays are read as float streams");
+	static_assert(sizeof(QXpackedVec3) == 3 * sizeof(QXushort), "QXpackedVec3 arrays are written as ushort streams");
+
+	/* smallest three components are in [-1/sqrt(2), 1/sqrt(2)] */
+	static constexpr QXfloat	HALF_SQRT2{ 0.70710678f };
+	static constexpr QXfloat	SQRT2{ 1.41421356f };
+
+	#pragma region Static Functions
+
+	static QXuint	FloatBits(QXfloat value) noexcept
+	{
+		QXuint bits;
+		memcpy(&bits, &value, sizeof(bits));
+		return bits;
+	}
+
+	static QXfloat	BitsFloat(QXuint bits) noexcept
+	{
+		QXfloat value;
+		memcpy(&value, &bits, sizeof(value));
+		return value;
+	}
+
+	static QXuint	Quantize(QXfloat value, QXfloat maxValue) noexcept
+	{
+		if (value < 0.f)
+			value = 0.f;
+		if (value > maxValue)
+			value = maxValue;
+
+		return (QXuint)std::lrint(value);
+	}
+
+	static QXuint64	PackSmallestThree(const QXquaternion& q, QXuint bits) noexcept
+	{
+		QXfloat c[4]{ q.w, q.v.x, q.v.y, q.v.z };
+		QXuint	idx{ 0 };
+
+		for (QXuint i = 1; i < 4; i++)
+			if (fabsf(c[i]) > fabsf(c[idx]))
+				idx = i;
+
+		/* q and -q are the same rotation, make the dropped component positive */
+		QXfloat		sign{ c[idx] < 0.f ? -1.f : 1.f };
+		QXfloat		maxValue{ (QXfloat)((1u << bits) - 1) };
+		QXuint64	packed{ (QXuint64)idx };
+
+		for (QXuint i = 0; i < 4; i++)
+		{
+			if (i == idx)
+				continue;
+
+			packed = (packed << bits) | Quantize((c[i] * sign * HALF_SQRT2 + 0.5f) * maxValue, maxValue);
+		}
+
+		return packed;
+	}
+
+	static QXquaternion	UnpackSmallestThree(QXuint64 packed, QXuint bits) noexcept
+	{
+		QXuint		mask{ (1u << bits) - 1 };
+		QXfloat		invMax{ 1.f / (QXfloat)mask };
+		QXuint		idx{ (QXuint)(packed >> (3 * bits)) & 3 };
+		QXfloat		c[4];
+		QXfloat		sqrSum{ 0.f };
+
+		for (QXint i = 3, shift = 0; i >= 0; i--)
+		{
+			if ((QXuint)i == idx)
+				continue;
+
+			c[i] = ((QXfloat)((packed >> shift) & mask) * invMax - 0.5f) * SQRT2;
+			sqrSum += c[i] * c[i];
+			shift += bits;
+		}
+
+		c[idx] = sqrtf(sqrSum < 1.f ? 1.f - sqrSum : 0.f);
+
+		return QXquaternion(c[0], c[1], c[2], c[3]);
+	}
+
+	#pragma endregion Static Functions
+
+#ifdef QX_SIMD_SSE
+	#pragma region SIMD Functions
+
+	static inline __m128	Select(__m128 mask, __m128 a, __m128 b) noexcept
+	{
+		return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+	}
+
+	static inline __m128	Abs(__m128 a) noexcept
+	{
+		return _mm_andnot_ps(_mm_set1_ps(-0.f), a);
+	}
+
+	/* 4 int32 in [0, 65535] to 4 ushort, without SSE4.1 packus */
+	static inline void		StoreUShort4(QXushort* out, __m128i v) noexcept
+	{
+		__m128i bias{ _mm_set1_epi32(32768) };
+		__m128i packed{ _mm_packs_epi32(_mm_sub_epi32(v, bias), _mm_setzero_si128()) };
+
+		_mm_storel_epi64((__m128i*)out, _mm_xor_si128(packed, _mm_set1_epi16((short)0x8000)));
+	}
+
+	static inline __m128i	LoadUShort4(const QXushort* in) noexcept
+	{
+		return _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i*)in), _mm_setzero_si128());
+	}
+
+	static inline void		LoadQuaternion4(const QXquaternion* q, __m128& w, __m128& x, __m128& y, __m128& z) noexcept
+	{
+		w = _mm_setr_ps(q[0].w, q[0].v.x, q[0].v.y, q[0].v.z);
+		x = _mm_setr_ps(q[1].w, q[1].v.x, q[1].v.y, q[1].v.z);
+		y = _mm_setr_ps(q[2].w, q[2].v.x, q[2].v.y, q[2].v.z);
+		z = _mm_setr_ps(q[3].w, q[3].v.x, q[3].v.y, q[3].v.z);
+		_MM_TRANSPOSE4_PS(w, x, y, z);
+	}
+
+	static inline void		StoreQuaternion4(QXquaternion* q, __m128 w, __m128 x, __m128 y, __m128 z) noexcept
+	{
+		alignas(16) QXfloat tmp[4][4];
+
+		_MM_TRANSPOSE4_PS(w, x, y, z);
+		_mm_store_ps(tmp[0], w);
+		_mm_store_ps(tmp[1], x);
+		_mm_store_ps(tmp[2], y);
+		_mm_store_ps(tmp[3], z);
+
+		for (QXuint i = 0; i < 4; i++)
+			q[i] = QXquaternion(tmp[i][0], tmp[i][1], tmp[i][2], tmp[i][3]);
+	}
+
+	static void	PackQuaternion32x4(const QXquaternion* q, QXuint* packed) noexcept
+	{
+		__m128 w, x, y, z;
+		LoadQuaternion4(q, w, x, y, z);
+
+		__m128 one{ _mm_set1_ps(1.f) };
+		__m128 idx{ _mm_setzero_ps() };
+		__m128 largest{ w };
+		__m128 absLargest{ Abs(w) };
+
+		__m128 greater{ _mm_cmpgt_ps(Abs(x), absLargest) };
+		idx = Select(greater, one, idx);
+		largest = Select(greater, x, largest);
+		absLargest = Abs(largest);
+
+		greater = _mm_cmpgt_ps(Abs(y), absLargest);
+		idx = Select(greater, _mm_set1_ps(2.f), idx);
+		largest = Select(greater, y, largest);
+		absLargest = Abs(largest);
+
+		greater = _mm_cmpgt_ps(Abs(z), absLargest);
+		idx = Select(greater, _mm_set1_ps(3.f), idx);
+		largest = Select(greater, z, largest);
+
+		/* q and -q are the same rotation, make the dropped component positive */
+		__m128 sign{ _mm_and_ps(largest, _mm_set1_ps(-0.f)) };
+		__m128 a{ _mm_xor_ps(Select(_mm_cmpeq_ps(idx, _mm_setzero_ps()), x, w), sign) };
+		__m128 b{ _mm_xor_ps(Select(_mm_cmple_ps(idx, one), y, x), sign) };
+		__m128 c{ _mm_xor_ps(Select(_mm_cmple_ps(idx, _mm_set1_ps(2.f)), z, y), sign) };
+
+		__m128 half{ _mm_set1_ps(0.5f) };
+		__m128 scale{ _mm_set1_ps(HALF_SQRT2) };
+		__m128 maxValue{ _mm_set1_ps(1023.f) };
+		__m128 zero{ _mm_setzero_ps() };
+
+		a = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(a, scale), half), maxValue), zero), maxValue);
+		b = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(b, scale), half), maxValue), zero), maxValue);
+		c = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(c, scale), half), maxValue), zero), maxValue);
+
+		__m128i res{ _mm_slli_epi32(_mm_cvtps_epi32(idx), 30) };
+		res = _mm_or_si128(res, _mm_slli_epi32(_mm_cvtps_epi32(a), 20));
+		res = _mm_or_si128(res, _mm_slli_epi32(_mm_cvtps_epi32(b), 10));
+		res = _mm_or_si128(res, _mm_cvtps_epi32(c));
+
+		_mm_storeu_si128((__m128i*)packed, res);
+	}
+
+	static void	UnpackQuaternion32x4(const QXuint* packed, QXquaternion* q) noexcept
+	{
+		__m128i p{ _mm_loadu_si128((const __m128i*)packed) };
+		__m128i mask{ _mm_set1_epi32(0x3ff) };
+
+		__m128 invMax{ _mm_set1_ps(1.f / 1023.f) };
+		__m128 half{ _mm_set1_ps(0.5f) };
+		__m128 scale{ _mm_set1_ps(SQRT2) };
+
+		__m128 a{ _mm_mul_ps(_mm_sub_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(p, 20), mask)), invMax), half), scale) };
+		__m128 b{ _mm_mul_ps(_mm_sub_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(p, 10), mask)), invMax), half), scale) };
+		__m128 c{ _mm_mul_ps(_mm_sub_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(p, mask)), invMax), half), scale) };
+		__m128 idx{ _mm_cvtepi32_ps(_mm_srli_epi32(p, 30)) };
+
+		__m128 sqrSum{ _mm_add_ps(_mm_add_ps(_mm_mul_ps(a, a), _mm_mul_ps(b, b)), _mm_mul_ps(c, c)) };
+		__m128 largest{ _mm_sqrt_ps(_mm_max_ps(_mm_sub_ps(_mm_set1_ps(1.f), sqrSum), _mm_setzero_ps())) };
+
+		__m128 is0{ _mm_cmpeq_ps(idx, _mm_setzero_ps()) };
+		__m128 is1{ _mm_cmpeq_ps(idx, _mm_set1_ps(1.f)) };
+		__m128 is2{ _mm_cmpeq_ps(idx, _mm_set1_ps(2.f)) };
+		__m128 is3{ _mm_cmpeq_ps(idx, _mm_set1_ps(3.f)) };
+
+		__m128 w{ Select(is0, largest, a) };
+		__m128 x{ Select(is0, a, Select(is1, largest, b)) };
+		__m128 y{ Select(is2, largest, Select(is3, c, b)) };
+		__m128 z{ Select(is3, largest, c) };
+
+		StoreQuaternion4(q, w, x, y, z);
+	}
+
+	static void	PackUnitVector4(const QXfloat* vec, QXuint* packed) noexcept
+	{
+		__m128 x{ _mm_setr_ps(vec[0], vec[3], vec[6], vec[9]) };
+		__m128 y{ _mm_setr_ps(vec[1], vec[4], vec[7], vec[10]) };
+		__m128 z{ _mm_setr_ps(vec[2], vec[5], vec[8], vec[11]) };
+
+		__m128 signMask{ _mm_set1_ps(-0.f) };
+		__m128 one{ _mm_set1_ps(1.f) };
+		__m128 invL1{ _mm_div_ps(one, _mm_add_ps(_mm_add_ps(Abs(x), Abs(y)), Abs(z))) };
+		__m128 px{ _mm_mul_ps(x, invL1) };
+		__m128 py{ _mm_mul_ps(y, invL1) };
+
+		/* fold the lower hemisphere over the diagonals */
+		__m128 foldX{ _mm_mul_ps(_mm_sub_ps(one, Abs(py)), _mm_or_ps(one, _mm_and_ps(px, signMask))) };
+		__m128 foldY{ _mm_mul_ps(_mm_sub_ps(one, Abs(px)), _mm_or_ps(one, _mm_and_ps(py, signMask))) };
+		__m128 lower{ _mm_cmplt_ps(z, _mm_setzero_ps()) };
+		px = Select(lower, foldX, px);
+		py = Select(lower, foldY, py);
+
+		__m128 half{ _mm_set1_ps(0.5f) };
+		__m128 maxValue{ _mm_set1_ps(65535.f) };
+		__m128i ux{ _mm_cvtps_epi32(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(px, half), half), maxValue)) };
+		__m128i uy{ _mm_cvtps_epi32(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(py, half), half), maxValue)) };
+
+		_mm_storeu_si128((__m128i*)packed, _mm_or_si128(ux, _mm_slli_epi32(uy, 16)));
+	}
+
+	static void	UnpackUnitVector4(const QXuint* packed, QXfloat* vec) noexcept
+	{
+		__m128i p{ _mm_loadu_si128((const __m128i*)packed) };
+		__m128 invMax{ _mm_set1_ps(1.f / 65535.f) };
+		__m128 two{ _mm_set1_ps(2.f) };
+		__m128 one{ _mm_set1_ps(1.f) };
+
+		__m128 x{ _mm_sub_ps(_mm_mul_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(p, _mm_set1_epi32(0xffff))), invMax), two), one) };
+		__m128 y{ _mm_sub_ps(_mm_mul_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(p, 16)), invMax), two), one) };
+		__m128 z{ _mm_sub_ps(_mm_sub_ps(one, Abs(x)), Abs(y)) };
+
+		__m128 signMask{ _mm_set1_ps(-0.f) };
+		__m128 t{ _mm_max_ps(_mm_sub_ps(_mm_setzero_ps(), z), _mm_setzero_ps()) };
+		x = _mm_sub_ps(x, _mm_or_ps(t, _mm_and_ps(x, signMask)));
+		y = _mm_sub_ps(y, _mm_or_ps(t, _mm_and_ps(y, signMask)));
+
+		__m128 sqrLen{ _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z)) };
+		__m128 invLen{ _mm_div_ps(one, _mm_sqrt_ps(sqrLen)) };
+
+		alignas(16) QXfloat tx[4], ty[4], tz[4];
+		_mm_store_ps(tx, _mm_mul_ps(x, invLen));
+		_mm_store_ps(ty, _mm_mul_ps(y, invLen));
+		_mm_store_ps(tz, _mm_mul_ps(z, invLen));
+
+		for (QXuint i = 0; i < 4; i++)
+		{
+			vec[i * 3 + 0] = tx[i];
+			vec[i * 3 + 1] = ty[i];
+			vec[i * 3 + 2] = tz[i];
+		}
+	}
+
+	#pragma endregion SIMD Functions
+#endif
+
+	#pragma region Quaternion
+
+	QXuint	PackQuaternion32(const QXquaternion& q) noexcept
+	{
+		return (QXuint)PackSmallestThree(q, 10);
+	}
+
+	QXquaternion	UnpackQuaternion32(QXuint packed) noexcept
+	{
+		return UnpackSmallestThree(packed, 10);
+	}
+
+	QXpackedQuaternion48	PackQuaternion48(const QXquaternion& q) noexcept
+	{
+		QXuint64 packed{ PackSmallestThree(q, 15) };
+
+		return { { (QXushort)(packed >> 32), (QXushort)(packed >> 16), (QXushort)packed } };
+	}
+
+	QXquaternion	UnpackQuaternion48(const QXpackedQuaternion48& packed) noexcept
+	{
+		QXuint64 bits{ ((QXuint64)packed.e[0] << 32) | ((QXuint64)packed.e[1] << 16) | (QXuint64)packed.e[2] };
+
+		return UnpackSmallestThree(bits, 15);
+	}
+
+	void	PackQuaternion32(const QXquaternion* q, QXuint* packed, QXuint count) noexcept
+	{
+		QXuint i{ 0 };
+
+#ifdef QX_SIMD_SSE
+		for (; i + 4 <= count; i += 4)
+			PackQuaternion32x4(q + i, packed + i);
+#endif
+
+		for (; i < count; i++)
+			packed[i] = PackQuaternion32(q[i]);
+	}
+
+	void	UnpackQuaternion32(const QXuint* packed, QXquaternion* q, QXuint count) noexcept
+	{
+		QXuint i{ 0 };
+
+#ifdef QX_SIMD_SSE
+		for (; i + 4 <= count; i += 4)
+			UnpackQuaternion32x4(packed + i, q + i);
+#endif
+
+		for (; i < count; i++)
+			q[i] = UnpackQuaternion32(packed[i]);
+	}
+
+	void	PackQuaternion48(const QXquaternion* q, QXpackedQuaternion48* packed, QXuint count) noexcept
+	{
+		for (QXuint i = 0; i < count; i++)
+			packed[i] = PackQuaternion48(q[i]);
+	}
+
+	void	UnpackQuaternion48(const QXpackedQuaternion48* packed, QXquaternion* q, QXuint count) noexcept
+	{
+		for (QXuint i = 0; i < count; i++)
+			q[i] = UnpackQuaternion48(packed[i]);
+	}
+
+	#pragma endregion Quaternion
+
+	#pragma region Unit Vector
+
+	QXuint	PackUnitVector(const QXvec3& vec) noexcept
+	{
+		QXfloat invL1{ 1.f / (fabsf(vec.x) + fabsf(vec.y) + fabsf(vec.z)) };
+		QXfloat px{ vec.x * invL1 };
+		QXfloat py{ vec.y * invL1 };
+
+		/* fold the lower hemisphere over the diagonals */
+		if (vec.z < 0.f)
+		{
+			QXfloat foldX{ (1.f - fabsf(py)) * copysignf(1.f, px) };
+			QXfloat foldY{ (1.f - fabsf(px)) * copysignf(1.f, py) };
+			px = foldX;
+			py = foldY;
+		}
+
+		QXuint ux{ Quantize((px * 0.5f + 0.5f) * 65535.f, 65535.f) };
+		QXuint uy{ Quantize((py * 0.5f + 0.5f) * 65535.f, 65535.f) };
+
+		return ux | (uy << 16);
+	}
+
+	QXvec3	UnpackUnitVector(QXuint packed) noexcept
+	{
+		QXfloat x{ (QXfloat)(packed & 0xffff) * (1.f / 65535.f) * 2.f - 1.f };
+		QXfloat y{ (QXfloat)(packed >> 16) * (1.f / 65535.f) * 2.f - 1.f };
+		QXfloat z{ 1.f - fabsf(x) - fabsf(y) };
+		QXfloat t{ -z > 0.f ? -z : 0.f };
+
+		x -= copysignf(t, x);
+		y -= copysignf(t, y);
+
+		return QXvec3(x, y, z).Normalized();
+	}
+
+	void	PackUnitVector(const QXvec3* vec, QXuint* packed, QXuint count) noexcept
+	{
+		QXuint i{ 0 };
+
+#ifdef QX_SIMD_SSE
+		const QXfloat* in{ reinterpret_cast<const QXfloat*>(vec) };
+
+		for (; i + 4 <= count; i += 4)
+			PackUnitVector4(in + i * 3, packed + i);
+#endif
+
+		for (; i < count; i++)
+			packed[i] = PackUnitVector(vec[i]);
+	}
+
+	void	UnpackUnitVector(const QXuint* packed, QXvec3* vec, QXuint count) noexcept
+	{
+		QXuint i{ 0 };
+
+#ifdef QX_SIMD_SSE
+		QXfloat* out{ reinterpret_cast<QXfloat*>(vec) };
+
+		for (; i + 4 <= count; i += 4)
+			UnpackUnitVector4(packed + i, out + i * 3);
+#endif
+
+		for (; i < count; i++)
+			vec[i] = UnpackUnitVector(packed[i]);
+	}
+
+	#pragma endregion Unit Vector
+
+	#pragma region Half Float
+
+	QXushort	FloatToHalf(QXfloat value) noexcept
+	{
+		QXuint bits{ FloatBits(value) };
+		QXuint sign{ (bits >> 16) & 0x8000 };
+		bits &= 0x7fffffff;
+
+		/* NaN stays a (quiet) NaN, overflow becomes infinity */
+		if (bits >= 0x7f800000)
+			return (QXushort)(sign | 0x7c00 | (bits > 0x7f800000 ? 0x200 : 0));
+		if (bits >= 0x47800000)
+			return (QXushort)(sign | 0x7c00);
+
+		/* half denormals: let the float adder round the mantissa */
+		if (bits < 0x38800000)
+			return (QXushort)(sign | (FloatBits(BitsFloat(bits) + 0.5f) - FloatBits(0.5f)));
+
+		QXuint mantissaOdd{ (bits >> 13) & 1 };
+
+		/* rebias exponent and round to nearest even */
+		bits += 0xc8000fff + mantissaOdd;
+
+		return (QXushort)(sign | (bits >> 13));
+	}
+
+	QXfloat	HalfToFloat(QXushort half) noexcept
+	{
+		QXuint bits{ ((QXuint)half & 0x7fff) << 13 };
+		QXuint exponent{ bits & 0x0f800000 };
+
+		bits += (127 - 15) << 23;
+
+		if (exponent == 0x0f800000)
+			bits += (128 - 16) << 23;
+		else if (exponent == 0)
+			bits = FloatBits(BitsFloat(bits + (1 << 23)) - BitsFloat(113 << 23));
+
+		return BitsFloat(bits | (((QXuint)half & 0x8000) << 16));
+	}
+
+	QXpackedVec3	PackHalfVec3(const QXvec3& vec) noexcept
+	{
+		return { FloatToHalf(vec.x), FloatToHalf(vec.y), FloatToHalf(vec.z) };
+	}
+
+	QXvec3	UnpackHalfVec3(const QXpackedVec3& packed) noexcept
+	{
+		return { HalfToFloat(packed.x), HalfToFloat(packed.y), HalfToFloat(packed.z) };
+	}
+
+	void	PackHalfVec3(const QXvec3* vec, QXpackedVec3* packed, QXuint count) noexcept
+	{
+		const QXfloat*	in{ reinterpret_cast<const QXfloat*>(vec) };
+		QXushort*		out{ reinterpret_cast<QXushort*>(packed) };
+		QXuint			size{ count * 3 };
+		QXuint			i{ 0 };
+
+#ifdef QX_SIMD_F16C
+		for (; i + 4 <= size; i += 4)
+			_mm_storel_epi64((__m128i*)(out + i), _mm_cvtps_ph(_mm_loadu_ps(in + i), _MM_FROUND_TO_NEAREST_INT));
+#endif
+
+		for (; i < size; i++)
+			out[i] = FloatToHalf(in[i]);
+	}
+
+	void	UnpackHalfVec3(const QXpackedVec3* packed, QXvec3* vec, QXuint count) noexcept
+	{
+		const QXushort*	in{ reinterpret_cast<const QXushort*>(packed) };
+		QXfloat*		out{ reinterpret_cast<QXfloat*>(vec) };
+		QXuint			size{ count * 3 };
+		QXuint			i{ 0 };
+
+#ifdef QX_SIMD_F16C
+		for (; i + 4 <= size; i += 4)
+			_mm_storeu_ps(out + i, _mm_cvtph_ps(_mm_loadl_epi64((const __m128i*)(in + i))));
+#endif
+
+		for (; i < size; i++)
+			out[i] = HalfToFloat(in[i]);
+	}
+
+	#pragma endregion Half Float
+
+	#pragma region Quantized Position
+
+	static QXvec3	PositionScale(const QXvec3& min, const QXvec3& max) noexcept
+	{
+		QXvec3 range{ max - min };
+
+		return { range.x > 0.f ? 65535.f / range.x : 0.f,
+				range.y > 0.f ? 65535.f / range.y : 0.f,
+				range.z > 0.f ? 65535.f / range.z : 0.f };
+	}
+
+	QXpackedVec3	PackPosition(const QXvec3& pos, const QXvec3& min, const QXvec3& max) noexcept
+	{
+		QXvec3 scale{ PositionScale(min, max) };
+
+		return { (QXushort)Quantize((pos.x - min.x) * scale.x, 65535.f),
+				(QXushort)Quantize((pos.y - min.y) * scale.y, 65535.f),
+				(QXushort)Quantize((pos.z - min.z) * scale.z, 65535.f) };
+	}
+
+	QXvec3	UnpackPosition(const QXpackedVec3& packed, const QXvec3& min, const QXvec3& max) noexcept
+	{
+		QXvec3 step{ (max - min) * (1.f / 65535.f) };
+
+		return { (QXfloat)packed.x * step.x + min.x,
+				(QXfloat)packed.y * step.y + min.y,
+				(QXfloat)packed.z * step.z + min.z };
+	}
+
+	void	PackPosition(const QXvec3* pos, QXpackedVec3* packed, QXuint count,
+						const QXvec3& min, const QXvec3& max) noexcept
+	{
+		QXuint i{ 0 };
+
+#ifdef QX_SIMD_SSE
+		/* 4 positions are 12 floats, so 3 registers with a rotating x y z pattern */
+		QXvec3			scale{ PositionScale(min, max) };
+		const QXfloat*	in{ reinterpret_cast<const QXfloat*>(pos) };
+		QXushort*		out{ reinterpret_cast<QXushort*>(packed) };
+
+		__m128 mins[3]{ _mm_setr_ps(min.x, min.y, min.z, min.x),
+						_mm_setr_ps(min.y, min.z, min.x, min.y),
+						_mm_setr_ps(min.z, min.x, min.y, min.z) };
+		__m128 scales[3]{ _mm_setr_ps(scale.x, scale.y, scale.z, scale.x),
+						_mm_setr_ps(scale.y, scale.z, scale.x, scale.y),
+						_mm_setr_ps(scale.z, scale.x, scale.y, scale.z) };
+		__m128 zero{ _mm_setzero_ps() };
+		__m128 maxValue{ _mm_set1_ps(65535.f) };
+
+		for (; i + 4 <= count; i += 4)
+		{
+			for (QXuint r = 0; r < 3; r++)
+			{
+				__m128 v{ _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(in + i * 3 + r * 4), mins[r]), scales[r]) };
+				v = _mm_min_ps(_mm_max_ps(v, zero), maxValue);
+				StoreUShort4(out + i * 3 + r * 4, _mm_cvtps_epi32(v));
+			}
+		}
+#endif
+
+		for (; i < count; i++)
+			packed[i] = PackPosition(pos[i], min, max);
+	}
+
+	void	UnpackPosition(const QXpackedVec3* packed, QXvec3* pos, QXuint count,
+						const QXvec3& min, const QXvec3& max) noexcept
+	{
+		QXuint i{ 0 };
+
+#ifdef QX_SIMD_SSE
+		QXvec3			step{ (max - min) * (1.f / 65535.f) };
+		const QXushort*	in{ reinterpret_cast<const QXushort*>(packed) };
+		QXfloat*		out{ reinterpret_cast<QXfloat*>(pos) };
+
+		__m128 mins[3]{ _mm_setr_ps(min.x, min.y, min.z, min.x),
+						_mm_setr_ps(min.y, min.z, min.x, min.y),
+						_mm_setr_ps(min.z, min.x, min.y, min.z) };
+		__m128 steps[3]{ _mm_setr_ps(step.x, step.y, step.z, step.x),
+						_mm_setr_ps(step.y, step.z, step.x, step.y),
+						_mm_setr_ps(step.z, step.x, step.y, step.z) };
+
+		for (; i + 4 <= count; i += 4)
+		{
+			for (QXuint r = 0; r < 3; r++)
+			{
+				__m128 v{ _mm_cvtepi32_ps(LoadUShort4(in + i * 3 + r * 4)) };
+				_mm_storeu_ps(out + i * 3 + r * 4, _mm_add_ps(_mm_mul_ps(v, steps[r]), mins[r]));
+			}
+		}
+#endif
+
+		for (; i < count; i++)
+			pos[i] = UnpackPosition(packed[i], min, max);
+	}
+
+	#pragma endregion Quantized Position
+}
@@ -0,0 +1,935 @@
+#include "Decomposition.h"
+#include "Simd.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+namespace Math
+{
+	#pragma region Static Functions
+
+	/* swap eigen pairs so values go from biggest to smallest */
+	static void	SortEigen(QXfloat* values, QXfloat* vectors, QXint size, QXint stride) noexcept
+	{
+		for (QXint i = 0; i < size - 1; i++)
+		{
+			QXint best{ i };
+
+			for (QXint j = i + 1; j < size; j++)
+				if (values[j] > values[best])
+					best = j;
+
+			if (best == i)
+				continue;
+
+			std::swap(values[i], values[best]);
+			for (QXint k = 0; k < size; k++)
+				std::swap(vectors[k * stride + i], vectors[k * stride + best]);
+		}
+	}
+
+	#pragma endregion Static Functions
+
+	#pragma region Dynamic Matrix
+
+	QXbool	DecomposeLDLT(QXmat& mat) noexcept
+	{
+		const QXint	n{ mat.line };
+		QXfloat*	a{ mat.array };
+
+		for (QXint j = 0; j < n; j++)
+		{
+			QXfloat d{ a[j * n + j] };
+			for (QXint k = 0; k < j; k++)
+				d -= a[j * n + k] * a[j * n + k] * a[k * n + k];
+
+			if (d == 0.f || !std::isfinite(d))
+				return false;
+
+			a[j * n + j] = d;
+
+			for (QXint i = j + 1; i < n; i++)
+			{
+				QXfloat l{ a[i * n + j] };
+				for (QXint k = 0; k < j; k++)
+					l -= a[i * n + k] * a[j * n + k] * a[k * n + k];
+
+				a[i * n + j] = l / d;
+			}
+		}
+
+		return true;
+	}
+
+	void	SolveLDLT(const QXmat& ldlt, QXfloat* b) noexcept
+	{
+		const QXint		n{ ldlt.line };
+		const QXfloat*	a{ ldlt.array };
+
+		for (QXint i = 0; i < n; i++)
+			for (QXint k = 0; k < i; k++)
+				b[i] -= a[i * n + k] * b[k];
+
+		for (QXint i = 0; i < n; i++)
+			b[i] /= a[i * n + i];
+
+		for (QXint i = n - 1; i >= 0; i--)
+			for (QXint k = i + 1; k < n; k++)
+				b[i] -= a[k * n + i] * b[k];
+	}
+
+	void	DecomposeQR(QXmat& mat, QXfloat* tau)
+	{
+		const QXint				m{ mat.line };
+		const QXint				n{ mat.column };
+		QXfloat*				a{ mat.array };
+		std::vector<QXfloat>	w(n);
+
+		for (QXint k = 0; k < n; k++)
+		{
+			QXfloat alpha{ a[k * n + k] };
+			QXfloat sqrNorm{ 0.f };
+
+			for (QXint i = k + 1; i < m; i++)
+				sqrNorm += a[i * n + k] * a[i * n + k];
+
+			if (sqrNorm == 0.f)
+			{
+				tau[k] = 0.f;
+				continue;
+			}
+
+			/* reflect the column on beta * e0, with the sign avoiding cancellation */
+			QXfloat beta{ sqrtf(alpha * alpha + sqrNorm) };
+			if (alpha > 0.f)
+				beta = -beta;
+
+			tau[k] = (beta - alpha) / beta;
+
+			QXfloat invV0{ 1.f / (alpha - beta) };
+			for (QXint i = k + 1; i < m; i++)
+				a[i * n + k] *= invV0;
+
+			a[k * n + k] = beta;
+
+			/* w = tau * v^T * A, then A -= v * w, both walking lines to stay contiguous */
+			for (QXint j = k + 1; j < n; j++)
+				w[j] = a[k * n + j];
+
+			for (QXint i = k + 1; i < m; i++)
+			{
+				QXfloat vi{ a[i * n + k] };
+				for (QXint j = k + 1; j < n; j++)
+					w[j] += vi * a[i * n + j];
+			}
+
+			for (QXint j = k + 1; j < n; j++)
+			{
+				w[j] *= tau[k];
+				a[k * n + j] -= w[j];
+			}
+
+			for (QXint i = k + 1; i < m; i++)
+			{
+				QXfloat vi{ a[i * n + k] };
+				for (QXint j = k + 1; j < n; j++)
+					a[i * n + j] -= vi * w[j];
+			}
+		}
+	}
+
+	QXbool	SolveLeastSquares(const QXmat& qr, const QXfloat* tau, QXfloat* b, QXfloat* x) noexcept
+	{
+		const QXint		m{ qr.line };
+		const QXint		n{ qr.column };
+		const QXfloat*	a{ qr.array };
+
+		for (QXint k = 0; k < n; k++)
+		{
+			QXfloat w{ b[k] };
+			for (QXint i = k + 1; i < m; i++)
+				w += a[i * n + k] * b[i];
+
+			w *= tau[k];
+			b[k] -= w;
+			for (QXint i = k + 1; i < m; i++)
+				b[i] -= w * a[i * n + k];
+		}
+
+		for (QXint i = n - 1; i >= 0; i--)
+		{
+			if (a[i * n + i] == 0.f)
+				return false;
+
+			QXfloat sum{ b[i] };
+			for (QXint j = i + 1; j < n; j++)
+				sum -= a[i * n + j] * x[j];
+
+			x[i] = sum / a[i * n + i];
+		}
+
+		return true;
+	}
+
+	QXbool	EigenSymmetric(QXmat& mat, QXfloat* eigenValues)
+	{
+		const QXint				n{ mat.line };
+		QXfloat*				v{ mat.array };
+		QXfloat*				d{ eigenValues };
+		std::vector<QXfloat>	e(n, 0.f);
+
+		if (n == 0)
+			return true;
+
+		/*
+		 * Householder reduction to tridiagonal form, d diagonal and e sub diagonal, v accumulates the transforms.
+		 * v is used transposed (v[column * n + line]) so the inner loops walk contiguous memory.
+		 */
+		for (QXint j = 0; j < n; j++)
+			d[j] = v[j * n + n - 1];
+
+		for (QXint i = n - 1; i > 0; i--)
+		{
+			QXfloat scale{ 0.f }, h{ 0.f };
+
+			for (QXint k = 0; k < i; k++)
+				scale += fabsf(d[k]);
+
+			if (scale == 0.f)
+			{
+				e[i] = d[i - 1];
+				for (QXint j = 0; j < i; j++)
+				{
+					d[j] = v[j * n + i - 1];
+					v[j * n + i] = 0.f;
+					v[i * n + j] = 0.f;
+				}
+			}
+			else
+			{
+				for (QXint k = 0; k < i; k++)
+				{
+					d[k] /= scale;
+					h += d[k] * d[k];
+				}
+
+				QXfloat f{ d[i - 1] };
+				QXfloat g{ sqrtf(h) };
+				if (f > 0.f)
+					g = -g;
+
+				e[i] = scale * g;
+				h -= f * g;
+				d[i - 1] = f - g;
+
+				for (QXint j = 0; j < i; j++)
+					e[j] = 0.f;
+
+				for (QXint j = 0; j < i; j++)
+				{
+					f = d[j];
+					v[i * n + j] = f;
+					g = e[j] + v[j * n + j] * f;
+
+					for (QXint k = j + 1; k <= i - 1; k++)
+					{
+						g += v[j * n + k] * d[k];
+						e[k] += v[j * n + k] * f;
+					}
+
+					e[j] = g;
+				}
+
+				f = 0.f;
+				for (QXint j = 0; j < i; j++)
+				{
+					e[j] /= h;
+					f += e[j] * d[j];
+				}
+
+				QXfloat hh{ f / (h + h) };
+				for (QXint j = 0; j < i; j++)
+					e[j] -= hh * d[j];
+
+				for (QXint j = 0; j < i; j++)
+				{
+					f = d[j];
+					g = e[j];
+
+					for (QXint k = j; k <= i - 1; k++)
+						v[j * n + k] -= f * e[k] + g * d[k];
+
+					d[j] = v[j * n + i - 1];
+					v[j * n + i] = 0.f;
+				}
+			}
+
+			d[i] = h;
+		}
+
+		for (QXint i = 0; i < n - 1; i++)
+		{
+			v[i * n + n - 1] = v[i * n + i];
+			v[i * n + i] = 1.f;
+
+			QXfloat h{ d[i + 1] };
+			if (h != 0.f)
+			{
+				for (QXint k = 0; k <= i; k++)
+					d[k] = v[(i + 1) * n + k] / h;
+
+				for (QXint j = 0; j <= i; j++)
+				{
+					QXfloat g{ 0.f };
+					for (QXint k = 0; k <= i; k++)
+						g += v[(i + 1) * n + k] * v[j * n + k];
+
+					for (QXint k = 0; k <= i; k++)
+						v[j * n + k] -= g * d[k];
+				}
+			}
+
+			for (QXint k = 0; k <= i; k++)
+				v[(i + 1) * n + k] = 0.f;
+		}
+
+		for (QXint j = 0; j < n; j++)
+		{
+			d[j] = v[j * n + n - 1];
+			v[j * n + n - 1] = 0.f;
+		}
+
+		v[(n - 1) * n + n - 1] = 1.f;
+		e[0] = 0.f;
+
+		/* implicit QL iterations on the tridiagonal matrix */
+		for (QXint i = 1; i < n; i++)
+			e[i - 1] = e[i];
+		e[n - 1] = 0.f;
+
+		QXfloat f{ 0.f }, tst1{ 0.f };
+
+		for (QXint l = 0; l < n; l++)
+		{
+			tst1 = std::fmax(tst1, fabsf(d[l]) + fabsf(e[l]));
+
+			QXint m{ l };
+			while (m < n - 1 && fabsf(e[m]) > FLT_EPSILON * tst1)
+				m++;
+
+			if (m > l)
+			{
+				QXint iteration{ 0 };
+
+				do
+				{
+					if (++iteration > 30)
+						return false;
+
+					QXfloat g{ d[l] };
+					QXfloat p{ (d[l + 1] - g) / (2.f * e[l]) };
+					QXfloat r{ hypotf(p, 1.f) };
+					if (p < 0.f)
+						r = -r;
+
+					d[l] = e[l] / (p + r);
+					d[l + 1] = e[l] * (p + r);
+
+					QXfloat dl1{ d[l + 1] };
+					QXfloat h{ g - d[l] };
+
+					for (QXint i = l + 2; i < n; i++)
+						d[i] -= h;
+					f += h;
+
+					p = d[m];
+					QXfloat c{ 1.f }, c2{ 1.f }, c3{ 1.f };
+					QXfloat el1{ e[l + 1] };
+					QXfloat s{ 0.f }, s2{ 0.f };
+
+					for (QXint i = m - 1; i >= l; i--)
+					{
+						c3 = c2;
+						c2 = c;
+						s2 = s;
+						g = c * e[i];
+						h = c * p;
+						r = hypotf(p, e[i]);
+						e[i + 1] = s * r;
+						s = e[i] / r;
+						c = p / r;
+						p = c * d[i] - s * g;
+						d[i + 1] = h + s * (c * g + s * d[i]);
+
+						for (QXint k = 0; k < n; k++)
+						{
+							h = v[(i + 1) * n + k];
+							v[(i + 1) * n + k] = s * v[i * n + k] + c * h;
+							v[i * n + k] = c * v[i * n + k] - s * h;
+						}
+					}
+
+					p = -s * s2 * c3 * el1 * e[l] / dl1;
+					e[l] = s * p;
+					d[l] = c * p;
+				}
+				while (fabsf(e[l]) > FLT_EPSILON * tst1);
+			}
+
+			d[l] += f;
+			e[l] = 0.f;
+		}
+
+		for (QXint i = 0; i < n; i++)
+			for (QXint j = i + 1; j < n; j++)
+				std::swap(v[i * n + j], v[j * n + i]);
+
+		SortEigen(d, v, n, n);
+
+		return true;
+	}
+
+	#pragma endregion Dynamic Matrix
+
+	#pragma region Matrix 3x3
+
+	QXbool	DecomposeLDLT3(QXmat4& mat) noexcept
+	{
+		QXfloat d0{ mat[0][0] };
+		if (d0 == 0.f)
+			return false;
+
+		QXfloat l10{ mat[1][0] / d0 };
+		QXfloat l20{ mat[2][0] / d0 };
+
+		QXfloat d1{ mat[1][1] - l10 * l10 * d0 };
+		if (d1 == 0.f)
+			return false;
+
+		QXfloat l21{ (mat[2][1] - l20 * l10 * d0) / d1 };
+		QXfloat d2{ mat[2][2] - l20 * l20 * d0 - l21 * l21 * d1 };
+		if (d2 == 0.f)
+			return false;
+
+		mat = QXmat4::Identity();
+		mat[0][0] = d0;
+		mat[1][1] = d1;
+		mat[2][2] = d2;
+		mat[1][0] = l10;
+		mat[2][0] = l20;
+		mat[2][1] = l21;
+
+		return true;
+	}
+
+	QXvec3	SolveLDLT3(const QXmat4& ldlt, const QXvec3& b) noexcept
+	{
+		QXfloat y0{ b.x };
+		QXfloat y1{ b.y - ldlt[1][0] * y0 };
+		QXfloat y2{ b.z - ldlt[2][0] * y0 - ldlt[2][1] * y1 };
+
+		QXfloat x2{ y2 / ldlt[2][2] };
+		QXfloat x1{ y1 / ldlt[1][1] - ldlt[2][1] * x2 };
+		QXfloat x0{ y0 / ldlt[0][0] - ldlt[1][0] * x1 - ldlt[2][0] * x2 };
+
+		return QXvec3(x0, x1, x2);
+	}
+
+	void	DecomposeQR3(const QXmat4& mat, QXmat4& q, QXmat4& r) noexcept
+	{
+		QXvec3 c0(mat[0][0], mat[1][0], mat[2][0]);
+		QXvec3 c1(mat[0][1], mat[1][1], mat[2][1]);
+		QXvec3 c2(mat[0][2], mat[1][2], mat[2][2]);
+
+		r = QXmat4::Identity();
+
+		r[0][0] = c0.Length();
+		QXvec3 q0{ r[0][0] != 0.f ? c0 / r[0][0] : QXvec3::right };
+
+		r[0][1] = q0.Dot(c1);
+		c1 -= q0 * r[0][1];
+		r[0][2] = q0.Dot(c2);
+		c2 -= q0 * r[0][2];
+
+		r[1][1] = c1.Length();
+		QXvec3 q1{ r[1][1] != 0.f ? c1 / r[1][1] : q0.Cross(fabsf(q0.x) < 0.9f ? QXvec3::right : QXvec3::up).Normalize() };
+
+		r[1][2] = q1.Dot(c2);
+		c2 -= q1 * r[1][2];
+
+		r[2][2] = c2.Length();
+		QXvec3 q2{ r[2][2] != 0.f ? c2 / r[2][2] : q0.Cross(q1) };
+
+		q = QXmat4::Identity();
+		for (QXint i = 0; i < 3; i++)
+		{
+			q[i][0] = q0[i];
+			q[i][1] = q1[i];
+			q[i][2] = q2[i];
+		}
+	}
+
+	QXvec3	EigenSymmetric3(const QXmat4& mat, QXmat4& eigenVectors) noexcept
+	{
+		QXfloat a[3][3]
+		{
+			{ mat[0][0], mat[0][1], mat[0][2] },
+			{ mat[0][1], mat[1][1], mat[1][2] },
+			{ mat[0][2], mat[1][2], mat[2][2] }
+		};
+		QXfloat v[3][3]{ { 1.f, 0.f, 0.f }, { 0.f, 1.f, 0.f }, { 0.f, 0.f, 1.f } };
+
+		/* cyclic Jacobi, converges quadratically so a few sweeps reach float precision */
+		for (QXint sweep = 0; sweep < 12; sweep++)
+		{
+			QXfloat off{ fabsf(a[0][1]) + fabsf(a[0][2]) + fabsf(a[1][2]) };
+			QXfloat diag{ fabsf(a[0][0]) + fabsf(a[1][1]) + fabsf(a[2][2]) };
+			if (off <= FLT_EPSILON * 0.5f * diag || off < FLT_MIN)
+				break;
+
+			for (QXint p = 0; p < 2; p++)
+			{
+				for (QXint q = p + 1; q < 3; q++)
+				{
+					if (a[p][q] == 0.f)
+						continue;
+
+					QXfloat theta{ (a[q][q] - a[p][p]) / (2.f * a[p][q]) };
+					QXfloat t{ 1.f / (fabsf(theta) + sqrtf(theta * theta + 1.f)) };
+					if (theta < 0.f)
+						t = -t;
+
+					QXfloat c{ 1.f / sqrtf(t * t + 1.f) };
+					QXfloat s{ t * c };
+
+					a[p][p] -= t * a[p][q];
+					a[q][q] += t * a[p][q];
+					a[p][q] = a[q][p] = 0.f;
+
+					QXint r{ 3 - p - q };
+					QXfloat arp{ a[r][p] }, arq{ a[r][q] };
+					a[r][p] = a[p][r] = c * arp - s * arq;
+					a[r][q] = a[q][r] = s * arp + c * arq;
+
+					for (QXint k = 0; k < 3; k++)
+					{
+						QXfloat vkp{ v[k][p] }, vkq{ v[k][q] };
+						v[k][p] = c * vkp - s * vkq;
+						v[k][q] = s * vkp + c * vkq;
+					}
+				}
+			}
+		}
+
+		QXfloat values[3]{ a[0][0], a[1][1], a[2][2] };
+		SortEigen(values, &v[0][0], 3, 3);
+
+		/* Jacobi rotations keep det = 1 but sorting can swap two columns */
+		QXvec3 v0(v[0][0], v[1][0], v[2][0]), v1(v[0][1], v[1][1], v[2][1]);
+		QXvec3 v2{ v0.Cross(v1) };
+
+		eigenVectors = QXmat4::Identity();
+		for (QXint i = 0; i < 3; i++)
+		{
+			eigenVectors[i][0] = v0[i];
+			eigenVectors[i][1] = v1[i];
+			eigenVectors[i][2] = v2[i];
+		}
+
+		return QXvec3(values[0], values[1], values[2]);
+	}
+
+	#pragma endregion Matrix 3x3
+
+	#pragma region SVD 3x3
+
+	/* the 3x3 SVD kernel is written once on the lane types of Simd.h */
+
+	/* one Jacobi rotation zeroing s[p][q], around axis r, (p, q, r) is a cyclic permutation */
+	template<typename T, QXint p, QXint q, QXint r>
+	static void	JacobiConjugate(T (&s)[3][3], T& qw, T (&qv)[3]) noexcept
+	{
+		T spp{ s[p][p] }, sqq{ s[q][q] }, spq{ s[p][q] }, spr{ s[p][r] }, sqr{ s[q][r] };
+
+		/* s is normalized, flushing converged values keeps their squares out of denormals */
+		spq = Select(Less(Max(spq, -spq), T(1e-18f)), T(0.f), spq);
+
+		/* t = tan(angle) from cot(2 * angle) = (spp - sqq) / (2 * spq), written without dividing by spq */
+		T diff{ spp - sqq };
+		T sign{ Select(Less(diff, T(0.f)), T(-1.f), T(1.f)) };
+		T sqrLen{ Max(diff * diff + T(4.f) * spq * spq, T(FLT_MIN)) };
+		T t{ T(2.f) * spq * sign / Max(diff * sign + sqrLen * Rsqrt(sqrLen), T(FLT_MIN)) };
+
+		T c{ Rsqrt(T(1.f) + t * t) };
+		T sn{ t * c };
+
+		s[p][p] = c * c * spp + T(2.f) * c * sn * spq + sn * sn * sqq;
+		s[q][q] = sn * sn * spp - T(2.f) * c * sn * spq + c * c * sqq;
+		s[p][q] = s[q][p] = T(0.f);
+		s[p][r] = s[r][p] = c * spr + sn * sqr;
+		s[q][r] = s[r][q] = c * sqr - sn * spr;
+
+		/* q = q * (ch, sh * axis r) with cos and sin of the half angle */
+		T halfScale{ Rsqrt(T(2.f) + T(2.f) * c) };
+		T ch{ (T(1.f) + c) * halfScale };
+		T sh{ sn * halfScale };
+
+		T w{ qw }, vp{ qv[p] }, vq{ qv[q] }, vr{ qv[r] };
+		qw = ch * w - sh * vr;
+		qv[p] = ch * vp + sh * vq;
+		qv[q] = ch * vq - sh * vp;
+		qv[r] = ch * vr + sh * w;
+	}
+
+	/* swap columns i and j of m and negate the new column j when mask is set, keeps det(m) */
+	template<typename T, typename M>
+	static void	CondNegSwapColumns(M mask, T (&m)[3][3], QXint i, QXint j) noexcept
+	{
+		for (QXint k = 0; k < 3; k++)
+		{
+			T mi{ m[k][i] }, mj{ m[k][j] };
+			m[k][i] = Select(mask, mj, mi);
+			m[k][j] = Select(mask, -mi, mj);
+		}
+	}
+
+	/* swap columns i and j of b and v and their rho when mask is set, keeps det(v) */
+	template<typename T, typename M>
+	static void	CondNegSwap(M mask, T (&b)[3][3], T (&v)[3][3], T (&rho)[3], QXint i, QXint j) noexcept
+	{
+		CondNegSwapColumns(mask, b, i, j);
+		CondNegSwapColumns(mask, v, i, j);
+
+		T ri{ rho[i] }, rj{ rho[j] };
+		rho[i] = Select(mask, rj, ri);
+		rho[j] = Select(mask, ri, rj);
+	}
+
+	/* Givens rotation on lines p and q of b zeroing b[q][col], also applied to ut */
+	template<typename T>
+	static void	GivensQR(T (&b)[3][3], T (&ut)[3][3], QXint p, QXint q, QXint col) noexcept
+	{
+		T a1{ b[p][col] }, a2{ b[q][col] };
+		T sqrRho{ a1 * a1 + a2 * a2 };
+		auto valid{ Less(T(FLT_MIN), sqrRho) };
+		T invRho{ T(1.f) / Sqrt(Max(sqrRho, T(FLT_MIN))) };
+		T c{ Select(valid, a1 * invRho, T(1.f)) };
+		T sn{ Select(valid, a2 * invRho, T(0.f)) };
+
+		for (QXint k = 0; k < 3; k++)
+		{
+			T bp{ b[p][k] }, bq{ b[q][k] };
+			b[p][k] = c * bp + sn * bq;
+			b[q][k] = c * bq - sn * bp;
+
+			T up{ ut[p][k] }, uq{ ut[q][k] };
+			ut[p][k] = c * up + sn * uq;
+			ut[q][k] = c * uq - sn * up;
+		}
+	}
+
+	/* QX_SVD_SWEEPS cyclic Jacobi sweeps on the symmetric s, v receives the rotation with s = v * diag * transpose(v) */
+	template<typename T>
+	static void	JacobiSweeps(T (&s)[3][3], T (&v)[3][3]) noexcept
+	{
+		T qw{ 1.f }, qv[3]{ T(0.f), T(0.f), T(0.f) };
+		for (QXint sweep = 0; sweep < QX_SVD_SWEEPS; sweep++)
+		{
+			JacobiConjugate<T, 0, 1, 2>(s, qw, qv);
+			JacobiConjugate<T, 1, 2, 0>(s, qw, qv);
+			JacobiConjugate<T, 2, 0, 1>(s, qw, qv);
+		}
+
+		T invNorm{ T(1.f) / Sqrt(qw * qw + qv[0] * qv[0] + qv[1] * qv[1] + qv[2] * qv[2]) };
+		T w{ qw * invNorm }, x{ qv[0] * invNorm }, y{ qv[1] * invNorm }, z{ qv[2] * invNorm };
+
+		v[0][0] = T(1.f) - T(2.f) * (y * y + z * z);
+		v[0][1] = T(2.f) * (x * y - w * z);
+		v[0][2] = T(2.f) * (x * z + w * y);
+		v[1][0] = T(2.f) * (x * y + w * z);
+		v[1][1] = T(1.f) - T(2.f) * (x * x + z * z);
+		v[1][2] = T(2.f) * (y * z - w * x);
+		v[2][0] = T(2.f) * (x * z - w * y);
+		v[2][1] = T(2.f) * (y * z + w * x);
+		v[2][2] = T(1.f) - T(2.f) * (x * x + y * y);
+	}
+
+	/* largest absolute value of a, at least FLT_MIN */
+	template<typename T>
+	static T	MaxAbs(const T (&a)[3][3]) noexcept
+	{
+		T scale{ FLT_MIN };
+		for (QXint i = 0; i < 3; i++)
+			for (QXint j = 0; j < 3; j++)
+				scale = Max(scale, Max(a[i][j], -a[i][j]));
+
+		return scale;
+	}
+
+	template<typename T>
+	static void	SVD3Kernel(const T (&a)[3][3], T (&u)[3][3], T (&sigma)[3], T (&v)[3][3]) noexcept
+	{
+		/* work on mat / max|mat| so converged off diagonal values stay far from denormals */
+		T scale{ MaxAbs(a) };
+		T invScale{ T(1.f) / scale };
+		T an[3][3], s[3][3];
+		for (QXint i = 0; i < 3; i++)
+			for (QXint j = 0; j < 3; j++)
+				an[i][j] = a[i][j] * invScale;
+
+		for (QXint i = 0; i < 3; i++)
+			for (QXint j = 0; j < 3; j++)
+				s[i][j] = an[0][i] * an[0][j] + an[1][i] * an[1][j] + an[2][i] * an[2][j];
+
+		JacobiSweeps(s, v);
+
+		T b[3][3], rho[3];
+		for (QXint i = 0; i < 3; i++)
+			for (QXint j = 0; j < 3; j++)
+				b[i][j] = an[i][0] * v[0][j] + an[i][1] * v[1][j] + an[i][2] * v[2][j];
+
+		for (QXint j = 0; j < 3; j++)
+			rho[j] = b[0][j] * b[0][j] + b[1][j] * b[1][j] + b[2][j] * b[2][j];
+
+		CondNegSwap(Less(rho[0], rho[1]), b, v, rho, 0, 1);
+		CondNegSwap(Less(rho[0], rho[2]), b, v, rho, 0, 2);
+		CondNegSwap(Less(rho[1], rho[2]), b, v, rho, 1, 2);
+
+		T ut[3][3]{ { T(1.f), T(0.f), T(0.f) }, { T(0.f), T(1.f), T(0.f) }, { T(0.f), T(0.f), T(1.f) } };
+		GivensQR(b, ut, 0, 1, 0);
+		GivensQR(b, ut, 0, 2, 0);
+		GivensQR(b, ut, 1, 2, 1);
+
+		for (QXint i = 0; i < 3; i++)
+		{
+			sigma[i] = b[i][i] * scale;
+			for (QXint j = 0; j < 3; j++)
+				u[i][j] = ut[j][i];
+		}
+	}
+
+	/* eigen pairs of the symmetric a, values sorted from biggest to smallest and v a rotation */
+	template<typename T>
+	static void	EigenSymmetric3Kernel(const T (&a)[3][3], T (&values)[3], T (&v)[3][3]) noexcept
+	{
+		T scale{ MaxAbs(a) };
+		T invScale{ T(1.f) / scale };
+		T s[3][3];
+		for (QXint i = 0; i < 3; i++)
+			for (QXint j = 0; j < 3; j++)
+				s[i][j] = a[i][j] * invScale;
+
+		JacobiSweeps(s, v);
+
+		for (QXint i = 0; i < 3; i++)
+			values[i] = s[i][i];
+
+		/* sorting network, each swap negates a column so v stays a rotation */
+		const QXint pairs[3][2]{ { 0, 1 }, { 0, 2 }, { 1, 2 } };
+		for (const QXint (&pair)[2] : pairs)
+		{
+			auto	mask{ Less(values[pair[0]], values[pair[1]]) };
+			T		first{ values[pair[0]] }, second{ values[pair[1]] };
+			values[pair[0]] = Select(mask, second, first);
+			values[pair[1]] = Select(mask, first, second);
+			CondNegSwapColumns(mask, v, pair[0], pair[1]);
+		}
+
+		for (QXint i = 0; i < 3; i++)
+			values[i] = values[i] * scale;
+	}
+
+	/* gather Lanes symmetric matrices from their upper triangle, run the kernel and write their eigen pairs */
+	template<typename T, QXuint Lanes>
+	static void	EigenSymmetric3Lanes(const QXmat4* mats, QXvec3* eigenValues, QXmat4* eigenVectors) noexcept
+	{
+		alignas(32) QXfloat in[3][3][Lanes];
+		alignas(32) QXfloat out[12][Lanes];
+
+		for (QXuint l = 0; l < Lanes; l++)
+			for (QXint i = 0; i < 3; i++)
+				for (QXint j = 0; j < 3; j++)
+					in[i][j][l] = mats[l].array[std::min(i, j) * 4 + std::max(i, j)];
+
+		T a[3][3], values[3], v[3][3];
+		for (QXint i = 0; i < 3; i++)
+			for (QXint j = 0; j < 3; j++)
+				std::memcpy(&a[i][j], in[i][j], sizeof(T));
+
+		EigenSymmetric3Kernel(a, values, v);
+
+		for (QXint i = 0; i < 3; i++)
+		{
+			std::memcpy(out[9 + i], &values[i], sizeof(T));
+			for (QXint j = 0; j < 3; j++)
+				std::memcpy(out[i * 3 + j], &v[i][j], sizeof(T));
+		}
+
+		for (QXuint l = 0; l < Lanes; l++)
+		{
+			eigenValues[l] = QXvec3(out[9][l], out[10][l], out[11][l]);
+			eigenVectors[l] = QXmat4::Identity();
+			for (QXint i = 0; i < 3; i++)
+				for (QXint j = 0; j < 3; j++)
+					eigenVectors[l][i][j] = out[i * 3 + j][l];
+		}
+	}
+
+	void	EigenSymmetric3(const QXmat4* mats, QXvec3* eigenValues, QXmat4* eigenVectors, QXuint count) noexcept
+	{
+		QXuint i{ 0 };
+
+#if defined(QX_SIMD_AVX)
+		for (; i + 8 <= count; i += 8)
+			EigenSymmetric3Lanes<QXlane8, 8>(mats + i, eigenValues + i, eigenVectors + i);
+#endif
+#if defined(QX_SIMD_SSE)
+		for (; i + 4 <= count; i += 4)
+			EigenSymmetric3Lanes<QXlane4, 4>(mats + i, eigenValues + i, eigenVectors + i);
+#endif
+		for (; i < count; i++)
+			EigenSymmetric3Lanes<QXfloat, 1>(mats + i, eigenValues + i, eigenVectors + i);
+	}
+
+	static void	SVD3Store(const QXfloat (&u)[3][3], const QXfloat (&sigma)[3], const QXfloat (&v)[3][3],
+							QXmat4& uMat, QXvec3& sigmaVec, QXmat4& vMat) noexcept
+	{
+		uMat = QXmat4::Identity();
+		vMat = QXmat4::Identity();
+
+		for (QXint i = 0; i < 3; i++)
+		{
+			for (QXint j = 0; j < 3; j++)
+			{
+				uMat[i][j] = u[i][j];
+				vMat[i][j] = v[i][j];
+			}
+		}
+
+		sigmaVec = QXvec3(sigma[0], sigma[1], sigma[2]);
+	}
+
+	static QXquaternion	PolarRotation(const QXfloat (&u)[3][3], const QXfloat (&v)[3][3]) noexcept
+	{
+		QXmat4 rotation{ QXmat4::Identity() };
+
+		for (QXint i = 0; i < 3; i++)
+			for (QXint j = 0; j < 3; j++)
+				rotation[i][j] = u[i][0] * v[j][0] + u[i][1] * v[j][1] + u[i][2] * v[j][2];
+
+		return QXquaternion::ConvertMatToQuaternion(rotation);
+	}
+
+	/* gather Lanes matrices in lanes, run the kernel and call store(index, u, sigma, v) for each of them */
+	template<typename T, QXuint Lanes, typename F>
+	static void	SVD3Lanes(const QXmat4* mats, F store) noexcept
+	{
+		alignas(32) QXfloat in[3][3][Lanes];
+		alignas(32) QXfloat out[21][Lanes];
+
+		for (QXuint l = 0; l < Lanes; l++)
+			for (QXint i = 0; i < 3; i++)
+				for (QXint j = 0; j < 3; j++)
+					in[i][j][l] = mats[l].array[i * 4 + j];
+
+		T a[3][3], u[3][3], sigma[3], v[3][3];
+		for (QXint i = 0; i < 3; i++)
+			for (QXint j = 0; j < 3; j++)
+				std::memcpy(&a[i][j], in[i][j], sizeof(T));
+
+		SVD3Kernel(a, u, sigma, v);
+
+		for (QXint i = 0; i < 3; i++)
+		{
+			std::memcpy(out[18 + i], &sigma[i], sizeof(T));
+			for (QXint j = 0; j < 3; j++)
+			{
+				std::memcpy(out[i * 3 + j], &u[i][j], sizeof(T));
+				std::memcpy(out[9 + i * 3 + j], &v[i][j], sizeof(T));
+			}
+		}
+
+		for (QXuint l = 0; l < Lanes; l++)
+		{
+			QXfloat lu[3][3], ls[3], lv[3][3];
+
+			for (QXint i = 0; i < 3; i++)
+			{
+				ls[i] = out[18 + i][l];
+				for (QXint j = 0; j < 3; j++)
+				{
+					lu[i][j] = out[i * 3 + j][l];
+					lv[i][j] = out[9 + i * 3 + j][l];
+				}
+			}
+
+			store(l, lu, ls, lv);
+		}
+	}
+
+	/* run SVD3Lanes on the widest lanes available then finish with scalars */
+	template<typename F>
+	static void	SVD3Batch(const QXmat4* mats, QXuint count, F store) noexcept
+	{
+		QXuint i{ 0 };
+
+#if defined(QX_SIMD_AVX)
+		for (; i + 8 <= count; i += 8)
+			SVD3Lanes<QXlane8, 8>(mats + i, [&](QXuint l, auto& u, auto& sigma, auto& v) { store(i + l, u, sigma, v); });
+#endif
+#if defined(QX_SIMD_SSE)
+		for (; i + 4 <= count; i += 4)
+			SVD3Lanes<QXlane4, 4>(mats + i, [&](QXuint l, auto& u, auto& sigma, auto& v) { store(i + l, u, sigma, v); });
+#endif
+		for (; i < count; i++)
+			SVD3Lanes<QXfloat, 1>(mats + i, [&](QXuint, auto& u, auto& sigma, auto& v) { store(i, u, sigma, v); });
+	}
+
+	void	SVD3(const QXmat4& mat, QXmat4& u, QXvec3& sigma, QXmat4& v) noexcept
+	{
+		SVD3(&mat, &u, &sigma, &v, 1);
+	}
+
+	void	SVD3(const QXmat4* mats, QXmat4* u, QXvec3* sigma, QXmat4* v, QXuint count) noexcept
+	{
+		SVD3Batch(mats, count, [&](QXuint idx, const QXfloat (&lu)[3][3], const QXfloat (&ls)[3], const QXfloat (&lv)[3][3])
+		{
+			SVD3Store(lu, ls, lv, u[idx], sigma[idx], v[idx]);
+		});
+	}
+
+	QXquaternion	Polar3(const QXmat4& mat, QXmat4* stretch) noexcept
+	{
+		QXquaternion rotation;
+
+		SVD3Batch(&mat, 1, [&](QXuint, const QXfloat (&u)[3][3], const QXfloat (&sigma)[3], const QXfloat (&v)[3][3])
+		{
+			rotation = PolarRotation(u, v);
+
+			if (stretch == nullptr)
+				return;
+
+			/* stretch = v * diag(sigma) * transpose(v) */
+			*stretch = QXmat4::Identity();
+			for (QXint i = 0; i < 3; i++)
+				for (QXint j = 0; j < 3; j++)
+					(*stretch)[i][j] = v[i][0] * sigma[0] * v[j][0] + v[i][1] * sigma[1] * v[j][1] + v[i][2] * sigma[2] * v[j][2];
+		});
+
+		return rotation;
+	}
+
+	void	Polar3(const QXmat4* mats, QXquaternion* rotations, QXuint count) noexcept
+	{
+		SVD3Batch(mats, count, [&](QXuint idx, const QXfloat (&u)[3][3], const QXfloat (&)[3], const QXfloat (&v)[3][3])
+		{
+			rotations[idx] = PolarRotation(u, v);
+		});
+	}
+
+	#pragma endregion SVD 3x3
+}
@@ -0,0 +1,186 @@
+#include "DualQuaternion.h"
+
+#include <cmath>
+
+namespace Math
+{
+	#pragma region Constructors
+
+	QXdualQuaternion::QXdualQuaternion() noexcept :
+		real{ 1.f, 0.f, 0.f, 0.f },
+		dual{ 0.f, 0.f, 0.f, 0.f }
+	{}
+
+	QXdualQuaternion::QXdualQuaternion(const QXquaternion& r, const QXquaternion& d) noexcept :
+		real{ r },
+		dual{ d }
+	{}
+
+	QXdualQuaternion::QXdualQuaternion(const QXquaternion& rotation, const QXvec3& translation) noexcept :
+		real{ rotation },
+		dual{ QXquaternion(0.f, translation) * rotation * 0.5f }
+	{}
+
+	QXdualQuaternion::QXdualQuaternion(const QXdualQuaternion& dq) noexcept :
+		real{ dq.real },
+		dual{ dq.dual }
+	{}
+
+	QXdualQuaternion::QXdualQuaternion(QXdualQuaternion&& dq) noexcept :
+		real{ std::move(dq.real) },
+		dual{ std::move(dq.dual) }
+	{}
+
+	#pragma endregion Constructors
+
+	#pragma region Operator Functions
+
+	QXdualQuaternion& QXdualQuaternion::operator=(const QXdualQuaternion& dq) noexcept
+	{
+		real = dq.real;
+		dual = dq.dual;
+
+		return *this;
+	}
+
+	QXdualQuaternion& QXdualQuaternion::operator=(QXdualQuaternion&& dq) noexcept
+	{
+		real = std::move(dq.real);
+		dual = std::move(dq.dual);
+
+		return *this;
+	}
+
+	QXdualQuaternion QXdualQuaternion::operator*(const QXdualQuaternion& dq) const noexcept
+	{
+		return { real * dq.real, real * dq.dual + dual * dq.real };
+	}
+
+	QXdualQuaternion QXdualQuaternion::operator*(QXfloat s) const noexcept
+	{
+		return { real * s, dual * s };
+	}
+
+	QXdualQuaternion QXdualQuaternion::operator+(const QXdualQuaternion& dq) const noexcept
+	{
+		return { real + dq.real, dual + dq.dual };
+	}
+
+	#pragma endregion Operator Functions
+
+	#pragma region Functions
+
+	QXdualQuaternion QXdualQuaternion::Conjugate() const noexcept
+	{
+		return { real.ConjugateQuaternion(), dual.ConjugateQuaternion() };
+	}
+
+	QXdualQuaternion& QXdualQuaternion::Normalize() noexcept
+	{
+		QXfloat len{ real.QuaternionLength() };
+
+		if (len == 0.f)
+			return *this;
+
+		QXfloat invLen{ 1.f / len };
+
+		real = real * invLen;
+		dual = dual * invLen;
+
+		/* remove the component of the dual part along the real part */
+		dual = dual - real * real.DotProductQuaternion(dual);
+
+		return *this;
+	}
+
+	QXdualQuaternion QXdualQuaternion::Normalized() const noexcept
+	{
+		QXdualQuaternion res{ *this };
+
+		return res.Normalize();
+	}
+
+	QXquaternion QXdualQuaternion::GetRotation() const noexcept
+	{
+		return real;
+	}
+
+	QXvec3 QXdualQuaternion::GetTranslation() const noexcept
+	{
+		return (dual * real.ConjugateQuaternion()).v * 2.f;
+	}
+
+	QXvec3 QXdualQuaternion::TransformPoint(const QXvec3& point) const noexcept
+	{
+		return TransformVector(point) + GetTranslation();
+	}
+
+	QXvec3 QXdualQuaternion::TransformVector(const QXvec3& vec) const noexcept
+	{
+		/* v' = v + 2 * q.v x (q.v x v + q.w * v) */
+		QXvec3 t{ real.v.Cross(vec) + vec * real.w };
+
+		return vec + real.v.Cross(t) * 2.f;
+	}
+
+	QXmat4 QXdualQuaternion::ConvertToMat() const noexcept
+	{
+		QXmat4 res{ real.ConvertQuaternionToMat() };
+		QXvec3 t{ GetTranslation() };
+
+		res[0][3] = t.x;
+		res[1][3] = t.y;
+		res[2][3] = t.z;
+
+		return res;
+	}
+
+	QXref3 QXdualQuaternion::ConvertToRef() const noexcept
+	{
+		return QXref3(GetTranslation(), TransformVector(QXvec3::right),
+						TransformVector(QXvec3::up), TransformVector(QXvec3::forward));
+	}
+
+	QXstring QXdualQuaternion::ToString() const noexcept
+	{
+		return real.ToString() + dual.ToString();
+	}
+
+	#pragma region Static Functions
+
+	QXdualQuaternion QXdualQuaternion::ConvertMatToDualQuaternion(const QXmat4& m) noexcept
+	{
+		QXquaternion rotation{ QXquaternion::ConvertMatToQuaternion(m) };
+
+		return QXdualQuaternion(rotation, QXvec3(m[0][3], m[1][3], m[2][3]));
+	}
+
+	QXdualQuaternion QXdualQuaternion::ConvertRefToDualQuaternion(const QXref3& ref) noexcept
+	{
+		QXmat4 m;
+
+		m[0][0] = ref.i.x;
+		m[0][1] = ref.j.x;
+		m[0][2] = ref.k.x;
+		m[0][3] = ref.o.x;
+		m[1][0] = ref.i.y;
+		m[1][1] = ref.j.y;
+		m[1][2] = ref.k.y;
+		m[1][3] = ref.o.y;
+		m[2][0] = ref.i.z;
+		m[2][1] = ref.j.z;
+		m[2][2] = ref.k.z;
+		m[2][3] = ref.o.z;
+		m[3][3] = 1;
+
+		return ConvertMatToDualQuaternion(m);
+	}
+
+	QXdualQuaternion QXdualQuaternion::Identity() noexcept
+	{
+		return QXdualQuaternion();
+	}
+
+	#pragma endregion Static Functions
+	#pragma endregion Functions
+}
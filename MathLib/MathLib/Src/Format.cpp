@@ -0,0 +1,268 @@
+#include "Format.h"
+
+#include <algorithm>
+
+namespace Math
+{
+	#pragma region Static Functions
+
+	/* longest shortest-form scalar: sign, 9 or 17 digits, point, exponent */
+	template<typename T>
+	static constexpr size_t	maxScalarChars{ sizeof(T) == sizeof(QXfloat) ? 16 : 25 };
+
+	template<typename T>
+	static std::to_chars_result	FormatScalars(char* first, char* last, const T* values, QXint count, char separator) noexcept
+	{
+		for (QXint i = 0; i < count; i++)
+		{
+			if (i > 0)
+			{
+				if (first == last)
+					return { last, std::errc::value_too_large };
+				*first++ = separator;
+			}
+
+			std::to_chars_result res{ std::to_chars(first, last, values[i]) };
+			if (res.ec != std::errc())
+				return res;
+
+			first = res.ptr;
+		}
+
+		return { first, std::errc() };
+	}
+
+	static QXbool	IsBlank(char c) noexcept
+	{
+		return c == ' ' || c == '\t';
+	}
+
+	static const char*	SkipBlanks(const char* first, const char* last) noexcept
+	{
+		while (first != last && IsBlank(*first))
+			first++;
+
+		return first;
+	}
+
+	template<typename T>
+	static std::from_chars_result	ParseScalars(const char* first, const char* last, T* values, QXint count, char separator) noexcept
+	{
+		for (QXint i = 0; i < count; i++)
+		{
+			const char* blanks{ first };
+			first = SkipBlanks(first, last);
+
+			if (i > 0)
+			{
+				/* a space or tab separator is one of the run of blanks, any other follows it */
+				if (IsBlank(separator))
+				{
+					if (std::find(blanks, first, separator) == first)
+						return { first, std::errc::invalid_argument };
+				}
+				else
+				{
+					if (first == last || *first != separator)
+						return { first, std::errc::invalid_argument };
+					first = SkipBlanks(first + 1, last);
+				}
+			}
+
+			std::from_chars_result res{ std::from_chars(first, last, values[i]) };
+			if (res.ec != std::errc())
+				return res;
+
+			first = res.ptr;
+		}
+
+		return { first, std::errc() };
+	}
+
+	/* scalar type and count of each element, values are copied so the layout of the type does not matter */
+	template<typename T>
+	static void	ToScalars(const QXvec2t<T>& vec, T* values) noexcept { values[0] = vec.x; values[1] = vec.y; }
+	template<typename T>
+	static void	ToScalars(const QXvec3t<T>& vec, T* values) noexcept { for (QXint i = 0; i < 3; i++) values[i] = vec.e[i]; }
+	template<typename T>
+	static void	ToScalars(const QXvec4t<T>& vec, T* values) noexcept { values[0] = vec.x; values[1] = vec.y; values[2] = vec.z; values[3] = vec.w; }
+	template<typename T>
+	static void	ToScalars(const QXquaterniont<T>& quat, T* values) noexcept { values[0] = quat.w; values[1] = quat.v.x; values[2] = quat.v.y; values[3] = quat.v.z; }
+	template<typename T>
+	static void	ToScalars(const QXmat4t<T>& mat, T* values) noexcept { for (QXint i = 0; i < 16; i++) values[i] = mat.array[i]; }
+
+	template<typename T>
+	static void	FromScalars(QXvec2t<T>& vec, const T* values) noexcept { vec = QXvec2t<T>(values[0], values[1]); }
+	template<typename T>
+	static void	FromScalars(QXvec3t<T>& vec, const T* values) noexcept { vec = QXvec3t<T>(values[0], values[1], values[2]); }
+	template<typename T>
+	static void	FromScalars(QXvec4t<T>& vec, const T* values) noexcept { vec = QXvec4t<T>(values[0], values[1], values[2], values[3]); }
+	template<typename T>
+	static void	FromScalars(QXquaterniont<T>& quat, const T* values) noexcept { quat = QXquaterniont<T>(values[0], QXvec3t<T>(values[1], values[2], values[3])); }
+	template<typename T>
+	static void	FromScalars(QXmat4t<T>& mat, const T* values) noexcept { for (QXint i = 0; i < 16; i++) mat.array[i] = values[i]; }
+
+	template<typename E>
+	struct QXscalars;
+	template<typename T>
+	struct QXscalars<QXvec2t<T>> { using Scalar = T; static constexpr QXint count{ 2 }; };
+	template<typename T>
+	struct QXscalars<QXvec3t<T>> { using Scalar = T; static constexpr QXint count{ 3 }; };
+	template<typename T>
+	struct QXscalars<QXvec4t<T>> { using Scalar = T; static constexpr QXint count{ 4 }; };
+	template<typename T>
+	struct QXscalars<QXquaterniont<T>> { using Scalar = T; static constexpr QXint count{ 4 }; };
+	template<typename T>
+	struct QXscalars<QXmat4t<T>> { using Scalar = T; static constexpr QXint count{ 16 }; };
+
+	template<typename E>
+	static std::to_chars_result	FormatElement(char* first, char* last, const E& element, char separator) noexcept
+	{
+		using Traits = QXscalars<E>;
+		typename Traits::Scalar values[Traits::count];
+
+		ToScalars(element, values);
+
+		return FormatScalars(first, last, values, Traits::count, separator);
+	}
+
+	template<typename E>
+	static std::from_chars_result	ParseElement(const char* first, const char* last, E& element, char separator) noexcept
+	{
+		using Traits = QXscalars<E>;
+		typename Traits::Scalar values[Traits::count];
+
+		std::from_chars_result res{ ParseScalars(first, last, values, Traits::count, separator) };
+		if (res.ec == std::errc())
+			FromScalars(element, values);
+
+		return res;
+	}
+
+	#pragma endregion Static Functions
+
+	#pragma region Format
+	template<typename T>
+	std::to_chars_result	Format(char* first, char* last, const QXvec2t<T>& vec, char separator) noexcept
+	{
+		return FormatElement(first, last, vec, separator);
+	}
+
+	template<typename T>
+	std::to_chars_result	Format(char* first, char* last, const QXvec3t<T>& vec, char separator) noexcept
+	{
+		return FormatElement(first, last, vec, separator);
+	}
+
+	template<typename T>
+	std::to_chars_result	Format(char* first, char* last, const QXvec4t<T>& vec, char separator) noexcept
+	{
+		return FormatElement(first, last, vec, separator);
+	}
+
+	template<typename T>
+	std::to_chars_result	Format(char* first, char* last, const QXquaterniont<T>& quat, char separator) noexcept
+	{
+		return FormatElement(first, last, quat, separator);
+	}
+
+	template<typename T>
+	std::to_chars_result	Format(char* first, char* last, const QXmat4t<T>& mat, char separator) noexcept
+	{
+		return FormatElement(first, last, mat, separator);
+	}
+
+	template<typename E>
+	QXstring	FormatArray(const E* data, size_t count, char separator)
+	{
+		using Traits = QXscalars<E>;
+		const size_t lineChars{ Traits::count * (maxScalarChars<typename Traits::Scalar> + 1) };
+
+		QXstring	text(count * lineChars, '\0');
+		char*		first{ text.data() };
+		char*		last{ text.data() + text.size() };
+
+		for (size_t i = 0; i < count; i++)
+		{
+			first = FormatElement(first, last, data[i], separator).ptr;
+			*first++ = '\n';
+		}
+
+		text.resize(first - text.data());
+
+		return text;
+	}
+	#pragma endregion Format
+
+	#pragma region Parse
+	template<typename T>
+	std::from_chars_result	Parse(const char* first, const char* last, QXvec2t<T>& vec, char separator) noexcept
+	{
+		return ParseElement(first, last, vec, separator);
+	}
+
+	template<typename T>
+	std::from_chars_result	Parse(const char* first, const char* last, QXvec3t<T>& vec, char separator) noexcept
+	{
+		return ParseElement(first, last, vec, separator);
+	}
+
+	template<typename T>
+	std::from_chars_result	Parse(const char* first, const char* last, QXvec4t<T>& vec, char separator) noexcept
+	{
+		return ParseElement(first, last, vec, separator);
+	}
+
+	template<typename T>
+	std::from_chars_result	Parse(const char* first, const char* last, QXquaterniont<T>& quat, char separator) noexcept
+	{
+		return ParseElement(first, last, quat, separator);
+	}
+
+	template<typename T>
+	std::from_chars_result	Parse(const char* first, const char* last, QXmat4t<T>& mat, char separator) noexcept
+	{
+		return ParseElement(first, last, mat, separator);
+	}
+
+	template<typename E>
+	std::from_chars_result	ParseArray(const char* first, const char* last, std::vector<E>& elements, char separator)
+	{
+		while (true)
+		{
+			while (first != last && (*first == ' ' || *first == '\t' || *first == '\r' || *first == '\n'))
+				first++;
+
+			if (first == last)
+				return { last, std::errc() };
+
+			E element;
+			std::from_chars_result res{ ParseElement(first, last, element, separator) };
+			if (res.ec != std::errc())
+				return res;
+
+			elements.push_back(element);
+			first = res.ptr;
+		}
+	}
+	#pragma endregion Parse
+
+	#define QX_INSTANTIATE_FORMAT(E)																		\
+		template std::to_chars_result	Format(char*, char*, const E&, char) noexcept;						\
+		template std::from_chars_result	Parse(const char*, const char*, E&, char) noexcept;					\
+		template QXstring				FormatArray(const E*, size_t, char);								\
+		template std::from_chars_result	ParseArray(const char*, const char*, std::vector<E>&, char);
+
+	QX_INSTANTIATE_FORMAT(QXvec2t<QXfloat>)
+	QX_INSTANTIATE_FORMAT(QXvec2t<QXdouble>)
+	QX_INSTANTIATE_FORMAT(QXvec3t<QXfloat>)
+	QX_INSTANTIATE_FORMAT(QXvec3t<QXdouble>)
+	QX_INSTANTIATE_FORMAT(QXvec4t<QXfloat>)
+	QX_INSTANTIATE_FORMAT(QXvec4t<QXdouble>)
+	QX_INSTANTIATE_FORMAT(QXquaterniont<QXfloat>)
+	QX_INSTANTIATE_FORMAT(QXquaterniont<QXdouble>)
+	QX_INSTANTIATE_FORMAT(QXmat4t<QXfloat>)
+	QX_INSTANTIATE_FORMAT(QXmat4t<QXdouble>)
+
+	#undef QX_INSTANTIATE_FORMAT
+}
@@ -5,22 +5,26 @@ namespace Math::Geometry
 
 	#pragma region Attributes
 
-	QXbox::QXbox(const QXvec3& position, const QXfloat& x, const QXfloat& y, const QXfloat& z) noexcept:
+	template<typename T>
+	QXboxt<T>::QXboxt(const QXvec3t<T>& position, const T& x, const T& y, const T& z) noexcept:
 		_position{position},
-		_halfSizes{QXvec3(x, y, z)}
+		_halfSizes{QXvec3t<T>(x, y, z)}
 	{}
 
-	QXbox::QXbox(const QXvec3& position, const QXvec3& sizes) noexcept :
+	template<typename T>
+	QXboxt<T>::QXboxt(const QXvec3t<T>& position, const QXvec3t<T>& sizes) noexcept :
 		_position{position},
 		_halfSizes{sizes}
 	{}
 
-	QXbox::QXbox(const QXbox& box) noexcept: 
+	template<typename T>
+	QXboxt<T>::QXboxt(const QXboxt<T>& box) noexcept: 
 		_position{box._position},
 		_halfSizes{box._halfSizes}
 	{}
 
-	QXbox::QXbox(QXbox&& box) noexcept:
+	template<typename T>
+	QXboxt<T>::QXboxt(QXboxt<T>&& box) noexcept:
 		_position{std::move(box._position)},
 		_halfSizes{std::move(box._halfSizes)}
 	{}
@@ -31,7 +35,8 @@ namespace Math::Geometry
 
 	#pragma region Operators
 
-	QXbox& QXbox::operator=(const QXbox& box) noexcept
+	template<typename T>
+	QXboxt<T>& QXboxt<T>::operator=(const QXboxt<T>& box) noexcept
 	{
 		_position = box._position;
 		_halfSizes = box._halfSizes;
@@ -39,7 +44,8 @@ namespace Math::Geometry
 		return *this;
 	}
 
-	QXbox& QXbox::operator=(QXbox&& box) noexcept
+	template<typename T>
+	QXboxt<T>& QXboxt<T>::operator=(QXboxt<T>&& box) noexcept
 	{
 		_position = std::move(box._position);
 		_halfSizes = std::move(box._halfSizes);
@@ -49,4 +55,7 @@ namespace Math::Geometry
 	#pragma endregion Operators
 
 	#pragma endregion Functions
+
+	template class QXboxt<QXfloat>;
+	template class QXboxt<QXdouble>;
 }
@@ -0,0 +1,54 @@
+#include "Capsule.h"
+
+namespace Math::Geometry
+{
+	#pragma region Constructors
+	template<typename T>
+	QXcapsulet<T>::QXcapsulet(const QXsegmentt<T>& segment, const T& radius) noexcept:
+		_segment(segment),
+		_radius{radius}
+	{}
+
+	template<typename T>
+	QXcapsulet<T>::QXcapsulet(const QXcapsulet<T>& capsule) noexcept:
+		_segment(capsule._segment),
+		_radius{capsule._radius}
+	{}
+
+	template<typename T>
+	QXcapsulet<T>::QXcapsulet(QXcapsulet<T>&& capsule) noexcept:
+		_segment(std::move(capsule._segment)),
+		_radius{std::move(capsule._radius)}
+	{}
+
+	#pragma endregion Constructors
+
+	#pragma region Functions
+
+	#pragma region Operators
+
+	template<typename T>
+	QXcapsulet<T>& QXcapsulet<T>::operator=(const QXcapsulet<T>& capsule) noexcept
+	{
+		_segment = capsule._segment;
+		_radius = capsule._radius;
+
+		return *this;
+	}
+
+	template<typename T>
+	QXcapsulet<T>& QXcapsulet<T>::operator=(QXcapsulet<T>&& capsule) noexcept
+	{
+		_segment = std::move(capsule._segment);
+		_radius = std::move(capsule._radius);
+
+		return *this;
+	}
+
+	#pragma endregion Operators
+
+	#pragma endregion Functions
+
+	template class QXcapsulet<QXfloat>;
+	template class QXcapsulet<QXdouble>;
+}
@@ -0,0 +1,655 @@
+#include "Contact.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+#include "Distance.h"
+#include "Gjk.h"
+#include "Parallel.h"
+
+namespace Math::Geometry
+{
+	#pragma region Static Functions
+
+	/* kinds of contact, stored in the high byte of the ids */
+	static constexpr QXuint	faceOfA{ 1 };
+	static constexpr QXuint	faceOfB{ 2 };
+	static constexpr QXuint	edgePair{ 3 };
+	static constexpr QXuint	boxCorner{ 4 };
+
+	/* parallel edges give no edge axis */
+	static constexpr QXfloat	parallelEdges{ 1e-5f };
+	/* a capsule lies on a box face when its normal and its segment are within this sine of the face */
+	static constexpr QXfloat	restingSine{ 0.1f };
+
+	/* box seen as its center, 3 unit axes and half sizes */
+	struct QXboxFrame
+	{
+		QXvec3	center;
+		QXvec3	axes[3];
+		QXfloat	halfSizes[3];
+	};
+
+	/* vertex of the clipped polygon with the feature it comes from and the feature its next edge lies on */
+	struct QXclipVertex
+	{
+		QXvec3	point;
+		QXuint	feature;
+		QXuint	edge;
+	};
+
+	static QXboxFrame Frame(const QXorientedBox& box) noexcept
+	{
+		QXref3	ref{ box.GetRef() };
+		QXvec3	halfSizes{ box.GetHalfSizes() };
+
+		return { ref.o, { ref.i, ref.j, ref.k }, { halfSizes.x, halfSizes.y, halfSizes.z } };
+	}
+
+	static QXfloat Project(const QXboxFrame& box, const QXvec3& axis) noexcept
+	{
+		return box.halfSizes[0] * std::abs(box.axes[0].Dot(axis)) + box.halfSizes[1] * std::abs(box.axes[1].Dot(axis)) +
+			box.halfSizes[2] * std::abs(box.axes[2].Dot(axis));
+	}
+
+	/* B seen from A: its axes and center in the axes of A */
+	struct QXrelativeFrame
+	{
+		QXfloat	rotation[3][3];
+		QXfloat	absRotation[3][3];
+		QXfloat	translation[3];
+	};
+
+	static QXrelativeFrame Relative(const QXboxFrame& a, const QXboxFrame& b) noexcept
+	{
+		QXrelativeFrame	relative;
+		QXvec3			delta{ b.center - a.center };
+
+		for (QXuint i = 0; i < 3; i++)
+		{
+			relative.translation[i] = delta.Dot(a.axes[i]);
+			for (QXuint j = 0; j < 3; j++)
+			{
+				relative.rotation[i][j] = a.axes[i].Dot(b.axes[j]);
+				relative.absRotation[i][j] = std::abs(relative.rotation[i][j]);
+			}
+		}
+
+		return relative;
+	}
+
+	/* separation of the boxes along one of the 15 axes, -FLT_MAX for the edge axes of parallel edges */
+	static QXfloat Separation(const QXboxFrame& a, const QXboxFrame& b, const QXrelativeFrame& relative, QXuint axis) noexcept
+	{
+		const QXfloat	(&r)[3][3]{ relative.rotation };
+		const QXfloat	(&absR)[3][3]{ relative.absRotation };
+		const QXfloat	(&t)[3]{ relative.translation };
+
+		if (axis < 3)
+			return std::abs(t[axis]) - a.halfSizes[axis] -
+				(b.halfSizes[0] * absR[axis][0] + b.halfSizes[1] * absR[axis][1] + b.halfSizes[2] * absR[axis][2]);
+
+		if (axis < 6)
+		{
+			QXuint j{ axis - 3 };
+			return std::abs(t[0] * r[0][j] + t[1] * r[1][j] + t[2] * r[2][j]) - b.halfSizes[j] -
+				(a.halfSizes[0] * absR[0][j] + a.halfSizes[1] * absR[1][j] + a.halfSizes[2] * absR[2][j]);
+		}
+
+		/* cross product of edge i of A and edge j of B, written in the axes of A */
+		QXuint	i{ (axis - 6) / 3 }, j{ (axis - 6) % 3 };
+		QXuint	i1{ (i + 1) % 3 }, i2{ (i + 2) % 3 }, j1{ (j + 1) % 3 }, j2{ (j + 2) % 3 };
+		QXfloat	length{ std::sqrt(std::fmax(0.f, 1.f - r[i][j] * r[i][j])) };
+		if (length < parallelEdges)
+			return -FLT_MAX;
+
+		QXfloat distance{ std::abs(t[i2] * r[i1][j] - t[i1] * r[i2][j]) };
+		QXfloat radiusA{ a.halfSizes[i1] * absR[i2][j] + a.halfSizes[i2] * absR[i1][j] };
+		QXfloat radiusB{ b.halfSizes[j1] * absR[i][j2] + b.halfSizes[j2] * absR[i][j1] };
+
+		return (distance - radiusA - radiusB) / length;
+	}
+
+	/* keep the clipped points with dot(point, axis) <= limit, the new points lie on the side plane */
+	static QXuint ClipSide(const QXclipVertex* input, QXuint count, const QXvec3& axis, QXfloat limit, QXuint side, QXclipVertex* output) noexcept
+	{
+		QXuint outputCount{ 0 };
+
+		for (QXuint i = 0; i < count; i++)
+		{
+			const QXclipVertex&	from{ input[i] };
+			const QXclipVertex&	to{ input[i + 1 < count ? i + 1 : 0] };
+			QXfloat				distanceFrom{ from.point.Dot(axis) - limit };
+			QXfloat				distanceTo{ to.point.Dot(axis) - limit };
+
+			if ((distanceFrom <= 0.f) != (distanceTo <= 0.f))
+			{
+				/* incident edges are 0-3, side planes 4-7 */
+				QXuint			feature{ from.edge < 4 ? 4 + from.edge * 4 + side : 20 + (from.edge - 4) * 4 + side };
+				QXvec3			point{ from.point + (to.point - from.point) * (distanceFrom / (distanceFrom - distanceTo)) };
+
+				output[outputCount++] = { point, feature, distanceTo <= 0.f ? from.edge : 4 + side };
+			}
+
+			if (distanceTo <= 0.f)
+				output[outputCount++] = to;
+		}
+
+		return outputCount;
+	}
+
+	/* keep the deepest point, the farthest from it, then the two that span the largest area with them */
+	static QXuint Reduce(QXcontactPoint* points, QXuint count, const QXvec3& normal) noexcept
+	{
+		if (count <= QX_CONTACT_MAX_POINTS)
+			return count;
+
+		QXuint kept[QX_CONTACT_MAX_POINTS]{ 0, 0, 0, 0 };
+		for (QXuint i = 1; i < count; i++)
+			if (points[i].depth > points[kept[0]].depth)
+				kept[0] = i;
+
+		QXfloat best{ -1.f };
+		for (QXuint i = 0; i < count; i++)
+		{
+			QXvec3	offset{ points[i].position - points[kept[0]].position };
+			QXfloat	sqrDistance{ offset.Dot(offset) };
+			if (sqrDistance > best)
+			{
+				best = sqrDistance;
+				kept[1] = i;
+			}
+		}
+
+		const QXvec3&	p0{ points[kept[0]].position };
+		const QXvec3&	p1{ points[kept[1]].position };
+		QXfloat			area2{ 0.f };
+		best = -1.f;
+		for (QXuint i = 0; i < count; i++)
+		{
+			QXfloat area{ (p1 - p0).Cross(points[i].position - p0).Dot(normal) };
+			if (std::abs(area) > best)
+			{
+				best = std::abs(area);
+				area2 = area;
+				kept[2] = i;
+			}
+		}
+
+		/* the last point is the one outside the triangle that adds the most area, across any of its edges */
+		const QXvec3&	p2{ points[kept[2]].position };
+		QXfloat			sign{ area2 >= 0.f ? -1.f : 1.f };
+		best = -FLT_MAX;
+		for (QXuint i = 0; i < count; i++)
+		{
+			if (i == kept[0] || i == kept[1] || i == kept[2])
+				continue;
+
+			const QXvec3&	p{ points[i].position };
+			QXfloat			area{ std::fmax(sign * (p1 - p0).Cross(p - p0).Dot(normal),
+				std::fmax(sign * (p2 - p1).Cross(p - p1).Dot(normal), sign * (p0 - p2).Cross(p - p2).Dot(normal))) };
+			if (area > best)
+			{
+				best = area;
+				kept[3] = i;
+			}
+		}
+
+		QXcontactPoint reduced[QX_CONTACT_MAX_POINTS];
+		for (QXuint i = 0; i < QX_CONTACT_MAX_POINTS; i++)
+			reduced[i] = points[kept[i]];
+		for (QXuint i = 0; i < QX_CONTACT_MAX_POINTS; i++)
+			points[i] = reduced[i];
+
+		return QX_CONTACT_MAX_POINTS;
+	}
+
+	/* replace the manifold by new points, keeping the impulses of the points found again */
+	static void StorePoints(QXcontactManifold& manifold, const QXcontactPoint* points, QXuint count, const QXvec3& normal) noexcept
+	{
+		QXcontactPoint previous[QX_CONTACT_MAX_POINTS];
+		QXuint previousCount{ manifold.count };
+		for (QXuint i = 0; i < previousCount; i++)
+			previous[i] = manifold.points[i];
+
+		for (QXuint i = 0; i < count; i++)
+		{
+			manifold.points[i] = points[i];
+			manifold.points[i].impulse = 0.f;
+
+			for (QXuint j = 0; j < previousCount; j++)
+				if (previous[j].id == points[i].id)
+					manifold.points[i].impulse = previous[j].impulse;
+		}
+
+		manifold.count = count;
+		manifold.normal = normal;
+	}
+
+	/* clip the face of the incident box most opposed to the normal against the sides of the reference face */
+	static QXuint FaceContact(const QXboxFrame& reference, const QXboxFrame& incident, QXuint face, const QXvec3& normal,
+								QXuint kind, QXcontactPoint* points) noexcept
+	{
+		QXuint	incidentAxis{ 0 };
+		QXfloat	best{ -1.f };
+		for (QXuint i = 0; i < 3; i++)
+		{
+			QXfloat alignment{ std::abs(incident.axes[i].Dot(normal)) };
+			if (alignment > best)
+			{
+				best = alignment;
+				incidentAxis = i;
+			}
+		}
+
+		QXfloat	incidentSign{ incident.axes[incidentAxis].Dot(normal) > 0.f ? -1.f : 1.f };
+		QXuint	incidentFace{ incidentAxis * 2 + (incidentSign < 0.f ? 1 : 0) };
+		QXvec3	faceCenter{ incident.center + incident.axes[incidentAxis] * (incident.halfSizes[incidentAxis] * incidentSign) };
+		QXvec3	u{ incident.axes[(incidentAxis + 1) % 3] * incident.halfSizes[(incidentAxis + 1) % 3] };
+		QXvec3	v{ incident.axes[(incidentAxis + 2) % 3] * incident.halfSizes[(incidentAxis + 2) % 3] };
+
+		/* polygon clipped by 4 planes has at most 8 vertices */
+		QXclipVertex polygon[8]
+		{
+			{ faceCenter + u + v, 0, 0 },
+			{ faceCenter - u + v, 1, 1 },
+			{ faceCenter - u - v, 2, 2 },
+			{ faceCenter + u - v, 3, 3 }
+		};
+		QXclipVertex	clipped[8];
+		QXclipVertex*	input{ polygon };
+		QXclipVertex*	output{ clipped };
+		QXuint			count{ 4 };
+
+		QXuint referenceAxis{ face / 2 };
+		for (QXuint side = 0; side < 4 && count > 0; side++)
+		{
+			QXuint	axis{ (referenceAxis + 1 + side / 2) % 3 };
+			QXvec3	direction{ side % 2 == 0 ? reference.axes[axis] : -reference.axes[axis] };
+			QXfloat	limit{ reference.center.Dot(direction) + reference.halfSizes[axis] };
+
+			count = ClipSide(input, count, direction, limit, side, output);
+			std::swap(input, output);
+		}
+
+		QXfloat	facePlane{ reference.center.Dot(normal) + reference.halfSizes[referenceAxis] };
+		QXuint	pointCount{ 0 };
+		for (QXuint i = 0; i < count; i++)
+		{
+			QXfloat depth{ facePlane - input[i].point.Dot(normal) };
+			if (depth < 0.f)
+				continue;
+
+			points[pointCount++] = { input[i].point + normal * (depth * 0.5f), depth,
+										kind << 24 | face << 16 | incidentFace << 8 | input[i].feature, 0.f };
+		}
+
+		return pointCount;
+	}
+
+	/* unit vector orthogonal to a direction, any unit vector when it is null */
+	static QXvec3 Perpendicular(const QXvec3& direction) noexcept
+	{
+		QXvec3 other{ std::abs(direction.x) < std::abs(direction.y) ? QXvec3(1.f, 0.f, 0.f) : QXvec3(0.f, 1.f, 0.f) };
+		QXvec3 normal{ direction.Cross(other) };
+
+		return normal.SqrLength() <= FLT_MIN ? QXvec3(0.f, 1.f, 0.f) : normal.Normalized();
+	}
+
+	/* points of a capsule lying on the box face most opposed to the normal, at both ends of the part of its segment over the face */
+	static QXuint CapsuleOnFace(const QXsegment& segment, QXfloat radius, const QXboxFrame& box, QXvec3& normal, QXcontactPoint* points) noexcept
+	{
+		QXuint	face{ 0 };
+		QXfloat	best{ -1.f };
+		for (QXuint i = 0; i < 3; i++)
+		{
+			QXfloat alignment{ std::abs(box.axes[i].Dot(normal)) };
+			if (alignment > best)
+			{
+				best = alignment;
+				face = i;
+			}
+		}
+
+		QXvec3	faceNormal{ box.axes[face].Dot(normal) > 0.f ? -box.axes[face] : box.axes[face] };
+		QXvec3	start{ segment.GetPointA() - box.center }, axis{ segment.GetSegmentAB() };
+		if (best * best < 1.f - restingSine * restingSine || std::abs(axis.Dot(faceNormal)) > restingSine * axis.Length())
+			return 0;
+
+		QXfloat low{ 0.f }, high{ 1.f };
+		for (QXuint i = 0; i < 3; i++)
+		{
+			if (i == face)
+				continue;
+
+			QXfloat offset{ start.Dot(box.axes[i]) }, along{ axis.Dot(box.axes[i]) };
+			if (std::abs(along) <= FLT_MIN)
+			{
+				if (std::abs(offset) > box.halfSizes[i])
+					return 0;
+				continue;
+			}
+
+			QXfloat first{ (-box.halfSizes[i] - offset) / along }, second{ (box.halfSizes[i] - offset) / along };
+			low = std::max(low, std::min(first, second));
+			high = std::min(high, std::max(first, second));
+		}
+
+		if (high <= low)
+			return 0;
+
+		QXuint count{ 0 };
+		for (QXuint end = 0; end < 2; end++)
+		{
+			QXvec3	point{ segment.GetPoint(end == 0 ? low : high) };
+			QXfloat	height{ (point - box.center).Dot(faceNormal) - box.halfSizes[face] };
+
+			if (height <= radius)
+				points[count++] = { point - faceNormal * ((radius + height) * 0.5f), radius - height, end, 0.f };
+		}
+
+		if (count > 0)
+			normal = -faceNormal;
+
+		return count;
+	}
+
+	#pragma endregion Static Functions
+
+	#pragma region Functions
+	QXbool CollideBoxes(const QXorientedBox& boxA, const QXorientedBox& boxB, QXcontactManifold& manifold) noexcept
+	{
+		QXboxFrame			a{ Frame(boxA) };
+		QXboxFrame			b{ Frame(boxB) };
+		QXvec3				delta{ b.center - a.center };
+		QXrelativeFrame		relative{ Relative(a, b) };
+
+		/* an axis separating last frame usually still does */
+		if (manifold.axis < 15 && Separation(a, b, relative, manifold.axis) > 0.f)
+		{
+			manifold.count = 0;
+			return false;
+		}
+
+		QXuint	axisA{ 0 }, axisB{ 3 }, axisEdge{ ~0u };
+		QXfloat	separationA{ -FLT_MAX }, separationB{ -FLT_MAX }, separationEdge{ -FLT_MAX };
+
+		for (QXuint axis = 0; axis < 15; axis++)
+		{
+			QXfloat separation{ Separation(a, b, relative, axis) };
+			if (separation > 0.f)
+			{
+				manifold.axis = axis;
+				manifold.count = 0;
+				return false;
+			}
+
+			if (axis < 3 && separation > separationA)
+			{
+				separationA = separation;
+				axisA = axis;
+			}
+			else if (axis >= 3 && axis < 6 && separation > separationB)
+			{
+				separationB = separation;
+				axisB = axis;
+			}
+			else if (axis >= 6 && separation > separationEdge)
+			{
+				separationEdge = separation;
+				axisEdge = axis;
+			}
+		}
+
+		QXuint	axis{ axisA };
+		QXfloat	separation{ separationA };
+		if (separationB > QX_CONTACT_RELATIVE_TOLERANCE * separationA + QX_CONTACT_ABSOLUTE_TOLERANCE)
+		{
+			axis = axisB;
+			separation = separationB;
+		}
+		if (axisEdge != ~0u && separationEdge > QX_CONTACT_RELATIVE_TOLERANCE * separation + QX_CONTACT_ABSOLUTE_TOLERANCE)
+			axis = axisEdge;
+
+		manifold.axis = axis;
+
+		QXcontactPoint	points[8];
+		QXuint			count{ 0 };
+		QXvec3			normal;
+
+		if (axis < 3)
+		{
+			normal = delta.Dot(a.axes[axis]) >= 0.f ? a.axes[axis] : -a.axes[axis];
+			count = FaceContact(a, b, axis * 2 + (delta.Dot(a.axes[axis]) >= 0.f ? 0 : 1), normal, faceOfA, points);
+		}
+		else if (axis < 6)
+		{
+			QXvec3 faceNormal{ delta.Dot(b.axes[axis - 3]) <= 0.f ? b.axes[axis - 3] : -b.axes[axis - 3] };
+			count = FaceContact(b, a, (axis - 3) * 2 + (delta.Dot(b.axes[axis - 3]) <= 0.f ? 0 : 1), faceNormal, faceOfB, points);
+			normal = -faceNormal;
+		}
+		else
+		{
+			QXuint edgeA{ (axis - 6) / 3 }, edgeB{ (axis - 6) % 3 };
+
+			normal = a.axes[edgeA].Cross(b.axes[edgeB]).Normalized();
+			if (normal.Dot(delta) < 0.f)
+				normal = -normal;
+
+			/* the edges of the two boxes closest to each other along the normal, and which corners they join */
+			QXvec3	pointA{ a.center }, pointB{ b.center };
+			QXuint	signs{ 0 };
+			for (QXuint i = 0; i < 3; i++)
+			{
+				if (i != edgeA)
+				{
+					QXbool positive{ a.axes[i].Dot(normal) >= 0.f };
+					pointA += a.axes[i] * (positive ? a.halfSizes[i] : -a.halfSizes[i]);
+					signs = signs << 1 | (positive ? 1 : 0);
+				}
+				if (i != edgeB)
+				{
+					QXbool positive{ b.axes[i].Dot(normal) <= 0.f };
+					pointB += b.axes[i] * (positive ? b.halfSizes[i] : -b.halfSizes[i]);
+					signs = signs << 1 | (positive ? 1 : 0);
+				}
+			}
+
+			/* closest points of the two lines, clamped to the edges */
+			const QXvec3&	directionA{ a.axes[edgeA] };
+			const QXvec3&	directionB{ b.axes[edgeB] };
+			QXvec3			offset{ pointA - pointB };
+			QXfloat			cosine{ directionA.Dot(directionB) };
+			QXfloat			alongA{ directionA.Dot(offset) };
+			QXfloat			alongB{ directionB.Dot(offset) };
+			QXfloat			s{ (cosine * alongB - alongA) / (1.f - cosine * cosine) };
+			s = std::fmax(-a.halfSizes[edgeA], std::fmin(a.halfSizes[edgeA], s));
+			QXfloat			t{ std::fmax(-b.halfSizes[edgeB], std::fmin(b.halfSizes[edgeB], cosine * s + alongB)) };
+
+			QXvec3 closestA{ pointA + directionA * s };
+			QXvec3 closestB{ pointB + directionB * t };
+
+			points[0] = { (closestA + closestB) * 0.5f, -separationEdge, edgePair << 24 | edgeA << 16 | edgeB << 8 | signs, 0.f };
+			count = 1;
+		}
+
+		count = Reduce(points, count, normal);
+		StorePoints(manifold, points, count, normal);
+
+		return count > 0;
+	}
+
+	QXbool CollideBoxPlane(const QXorientedBox& box, const QXplane& plane, QXcontactManifold& manifold) noexcept
+	{
+		QXboxFrame	frame{ Frame(box) };
+		QXvec3		normal{ plane.GetNormal() };
+		QXfloat		distance{ plane.GetDistance() };
+
+		/* deepest corner first: no corner touches when it does not */
+		if (frame.center.Dot(normal) - Project(frame, normal) > distance)
+		{
+			manifold.count = 0;
+			return false;
+		}
+
+		QXcontactPoint	points[8];
+		QXuint			count{ 0 };
+
+		for (QXuint corner = 0; corner < 8; corner++)
+		{
+			QXvec3 point{ frame.center };
+			for (QXuint i = 0; i < 3; i++)
+				point += frame.axes[i] * ((corner >> i) & 1 ? frame.halfSizes[i] : -frame.halfSizes[i]);
+
+			QXfloat depth{ distance - point.Dot(normal) };
+			if (depth >= 0.f)
+				points[count++] = { point + normal * (depth * 0.5f), depth, boxCorner << 24 | corner, 0.f };
+		}
+
+		count = Reduce(points, count, -normal);
+		StorePoints(manifold, points, count, -normal);
+
+		return count > 0;
+	}
+
+	QXbool CollideCapsules(const QXcapsule& a, const QXcapsule& b, QXcontactManifold& manifold) noexcept
+	{
+		const QXsegment&	segmentA{ a.GetSegment() };
+		const QXsegment&	segmentB{ b.GetSegment() };
+		QXfloat				radiusA{ a.GetRadius() }, radiusB{ b.GetRadius() }, alongA, alongB;
+		QXfloat				sqrDistance{ SqrDistance(segmentA, segmentB, &alongA, &alongB) };
+
+		if (sqrDistance > (radiusA + radiusB) * (radiusA + radiusB))
+		{
+			manifold.count = 0;
+			return false;
+		}
+
+		QXvec3 pointA{ segmentA.GetPoint(alongA) }, pointB{ segmentB.GetPoint(alongB) };
+		QXvec3 axisA{ segmentA.GetSegmentAB() }, axisB{ segmentB.GetSegmentAB() }, cross{ axisA.Cross(axisB) };
+		QXvec3 normal{ pointB - pointA };
+
+		if (sqrDistance > FLT_MIN)
+			normal = normal * (1.f / std::sqrt(sqrDistance));
+		else
+		{
+			/* the segments cross: across both of them, from A to B */
+			normal = cross.SqrLength() > FLT_MIN ? cross.Normalized() : Perpendicular(axisA.SqrLength() > FLT_MIN ? axisA : axisB);
+			if (normal.Dot(segmentB.GetPoint(0.5f) - segmentA.GetPoint(0.5f)) < 0.f)
+				normal = -normal;
+		}
+
+		QXcontactPoint	points[2];
+		QXuint			count{ 0 };
+
+		/* parallel segments touch along their overlap */
+		if (cross.SqrLength() <= QX_SEGMENT_PARALLEL_EPSILON * axisA.SqrLength() * axisB.SqrLength() && axisA.SqrLength() > FLT_MIN &&
+			axisB.SqrLength() > FLT_MIN)
+		{
+			QXfloat start, end;
+			SqrDistance(segmentA, segmentB.GetPointA(), &start);
+			SqrDistance(segmentA, segmentB.GetPointB(), &end);
+
+			if (std::abs(end - start) > FLT_EPSILON)
+				for (QXuint side = 0; side < 2; side++)
+				{
+					QXvec3	onA{ segmentA.GetPoint(side == 0 ? std::min(start, end) : std::max(start, end)) };
+					QXfloat	ratio;
+					SqrDistance(segmentB, onA, &ratio);
+
+					QXvec3	onB{ segmentB.GetPoint(ratio) };
+					QXfloat	depth{ radiusA + radiusB - (onB - onA).Dot(normal) };
+					if (depth >= 0.f)
+						points[count++] = { (onA + normal * radiusA + onB - normal * radiusB) * 0.5f, depth, side, 0.f };
+				}
+		}
+
+		if (count == 0)
+			points[count++] = { (pointA + normal * radiusA + pointB - normal * radiusB) * 0.5f, radiusA + radiusB - std::sqrt(sqrDistance), 0, 0.f };
+
+		StorePoints(manifold, points, count, normal);
+
+		return true;
+	}
+
+	QXbool CollideCapsuleBox(const QXcapsule& capsule, const QXorientedBox& box, QXcontactManifold& manifold) noexcept
+	{
+		const QXsegment&	segment{ capsule.GetSegment() };
+		QXfloat				radius{ capsule.GetRadius() }, along;
+		QXvec3				closest;
+
+		/* bounding spheres first: most pairs of a broadphase are apart */
+		QXvec3	centers{ segment.GetPoint(0.5f) - box.GetRef().o };
+		QXfloat	reach{ 0.5f * segment.GetSegmentAB().Length() + radius + box.GetHalfSizes().Length() };
+		if (centers.SqrLength() > reach * reach)
+		{
+			manifold.count = 0;
+			return false;
+		}
+
+		QXfloat sqrDistance{ SqrDistance(segment, box, &along, &closest) };
+		if (sqrDistance > radius * radius)
+		{
+			manifold.count = 0;
+			return false;
+		}
+
+		QXcontactPoint	points[2];
+		QXuint			count{ 0 };
+		QXvec3			normal;
+
+		if (sqrDistance <= FLT_MIN)
+		{
+			/* the segment crosses the box: no closest points to start from */
+			QXgjkResult result;
+			GjkPenetration(QXconvex(capsule), QXconvex(box), result);
+
+			normal = result.normal;
+			points[count++] = { (result.pointA + result.pointB) * 0.5f, result.depth, 0, 0.f };
+		}
+		else
+		{
+			QXvec3	point{ segment.GetPoint(along) };
+			QXfloat	distance{ std::sqrt(sqrDistance) };
+
+			normal = (closest - point) * (1.f / distance);
+			count = CapsuleOnFace(segment, radius, Frame(box), normal, points);
+			if (count == 0)
+				points[count++] = { (point + normal * radius + closest) * 0.5f, radius - distance, 0, 0.f };
+		}
+
+		StorePoints(manifold, points, count, normal);
+
+		return true;
+	}
+
+	void CollideBoxes(const QXorientedBox* boxes, const std::pair<QXuint, QXuint>* pairs, QXuint count, QXcontactManifold* manifolds, QXbool parallel)
+	{
+		ParallelFor(count, parallel, [&](QXuint begin, QXuint end)
+		{
+			for (QXuint i = begin; i < end; i++)
+				CollideBoxes(boxes[pairs[i].first], boxes[pairs[i].second], manifolds[i]);
+		});
+	}
+
+	void CollideCapsules(const QXcapsule* capsules, const std::pair<QXuint, QXuint>* pairs, QXuint count, QXcontactManifold* manifolds, QXbool parallel)
+	{
+		ParallelFor(count, parallel, [&](QXuint begin, QXuint end)
+		{
+			for (QXuint i = begin; i < end; i++)
+				CollideCapsules(capsules[pairs[i].first], capsules[pairs[i].second], manifolds[i]);
+		});
+	}
+
+	void CollideCapsuleBox(const QXcapsule* capsules, const QXorientedBox* boxes, const std::pair<QXuint, QXuint>* pairs, QXuint count,
+							QXcontactManifold* manifolds, QXbool parallel)
+	{
+		ParallelFor(count, parallel, [&](QXuint begin, QXuint end)
+		{
+			for (QXuint i = begin; i < end; i++)
+				CollideCapsuleBox(capsules[pairs[i].first], boxes[pairs[i].second], manifolds[i]);
+		});
+	}
+	#pragma endregion Functions
+}
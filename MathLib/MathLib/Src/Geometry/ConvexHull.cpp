@@ -0,0 +1,558 @@
+#include "ConvexHull.h"
+
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+#include <utility>
+
+#include "Parallel.h"
+#include "Simd.h"
+
+namespace Math::Geometry
+{
+	#pragma region Static Functions
+
+	/* axes of the 26-DOP, the points extreme along each one in both directions seed the hull */
+	static constexpr QXfloat	hullAxes[13][3]{ { 1.f, 0.f, 0.f }, { 0.f, 1.f, 0.f }, { 0.f, 0.f, 1.f },
+												{ 1.f, 1.f, 0.f }, { 1.f, -1.f, 0.f }, { 1.f, 0.f, 1.f }, { 1.f, 0.f, -1.f },
+												{ 0.f, 1.f, 1.f }, { 0.f, 1.f, -1.f }, { 1.f, 1.f, 1.f }, { 1.f, 1.f, -1.f },
+												{ 1.f, -1.f, 1.f }, { 1.f, -1.f, -1.f } };
+
+	struct QXhullExtremes
+	{
+		QXfloat	high[13];
+		QXfloat	low[13];
+		QXuint	highIndex[13];
+		QXuint	lowIndex[13];
+	};
+
+	/* coordinates of as many points as lanes from first */
+	template<typename T>
+	static void LoadPoints(const QXvec3* points, QXuint first, T coordinates[3]) noexcept
+	{
+		constexpr QXuint	width{ sizeof(T) / sizeof(QXfloat) };
+		alignas(32) QXfloat	buffer[3][width];
+
+		for (QXuint lane = 0; lane < width; lane++)
+			for (QXuint k = 0; k < 3; k++)
+				buffer[k][lane] = points[first + lane].e[k];
+
+		for (QXuint k = 0; k < 3; k++)
+			coordinates[k] = Load<T>(buffer[k]);
+	}
+
+	/* call block(lanes, first) on whole lanes of points, the widest first, then on the remaining ones one by one */
+	template<typename F>
+	static void ForEachBlock(QXuint begin, QXuint end, F block)
+	{
+		QXuint i{ begin };
+#if defined(QX_SIMD_AVX)
+		for (; i + 8 <= end; i += 8)
+			block(QXlane8(), i);
+#endif
+#if defined(QX_SIMD_SSE)
+		for (; i + 4 <= end; i += 4)
+			block(QXlane4(), i);
+#endif
+		for (; i < end; i++)
+			block(QXfloat(), i);
+	}
+
+	/* lowest and highest projections on every axis, the lanes are only stored when one passes the extremes so far */
+	static QXhullExtremes FindExtremes(const QXvec3* points, QXuint count, QXbool parallel)
+	{
+		std::vector<std::pair<QXuint, QXhullExtremes>>	partials;
+		std::mutex									mutex;
+
+		ParallelFor(count, parallel && count >= QX_HULL_PARALLEL_POINTS, [&](QXuint begin, QXuint end)
+		{
+			QXhullExtremes extremes;
+			for (QXuint axis = 0; axis < 13; axis++)
+			{
+				const QXfloat* direction{ hullAxes[axis] };
+				extremes.high[axis] = extremes.low[axis] = points[begin].x * direction[0] + points[begin].y * direction[1] + points[begin].z * direction[2];
+				extremes.highIndex[axis] = extremes.lowIndex[axis] = begin;
+			}
+
+			ForEachBlock(begin, end, [&](auto lanes, QXuint first)
+			{
+				using T = decltype(lanes);
+				constexpr QXuint width{ sizeof(T) / sizeof(QXfloat) };
+
+				T coordinates[3];
+				LoadPoints(points, first, coordinates);
+
+				for (QXuint axis = 0; axis < 13; axis++)
+				{
+					const QXfloat* direction{ hullAxes[axis] };
+					T projection{ coordinates[0] * T(direction[0]) + coordinates[1] * T(direction[1]) + coordinates[2] * T(direction[2]) };
+					if (Mask(Or(Less(T(extremes.high[axis]), projection), Less(projection, T(extremes.low[axis])))) == 0)
+						continue;
+
+					alignas(32) QXfloat values[width];
+					Store(values, projection);
+					for (QXuint lane = 0; lane < width; lane++)
+					{
+						if (values[lane] > extremes.high[axis])
+						{
+							extremes.high[axis] = values[lane];
+							extremes.highIndex[axis] = first + lane;
+						}
+						if (values[lane] < extremes.low[axis])
+						{
+							extremes.low[axis] = values[lane];
+							extremes.lowIndex[axis] = first + lane;
+						}
+					}
+				}
+			});
+
+			std::lock_guard<std::mutex> lock(mutex);
+			partials.emplace_back(begin, extremes);
+		});
+
+		std::sort(partials.begin(), partials.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+		QXhullExtremes result{ partials[0].second };
+		for (QXuint i = 1; i < (QXuint)partials.size(); i++)
+		{
+			const QXhullExtremes& partial{ partials[i].second };
+			for (QXuint axis = 0; axis < 13; axis++)
+			{
+				if (partial.high[axis] > result.high[axis])
+				{
+					result.high[axis] = partial.high[axis];
+					result.highIndex[axis] = partial.highIndex[axis];
+				}
+				if (partial.low[axis] < result.low[axis])
+				{
+					result.low[axis] = partial.low[axis];
+					result.lowIndex[axis] = partial.lowIndex[axis];
+				}
+			}
+		}
+
+		return result;
+	}
+
+	/* plane through three points, computed in double so thin faces keep a usable normal */
+	static QXplane FacePlane(const QXvec3& a, const QXvec3& b, const QXvec3& c) noexcept
+	{
+		QXdvec3		origin{ a };
+		QXdvec3		normal{ (QXdvec3(b) - origin).Cross(QXdvec3(c) - origin) };
+		QXdouble	length{ normal.Length() };
+		if (length == 0.)
+			return QXplane(QXvec3(0.f, 0.f, 0.f), a);
+
+		return QXplane(QXvec3(normal / length), (QXfloat)(normal.Dot(origin) / length));
+	}
+
+	static QXfloat SignedDistance(const QXplane& plane, const QXvec3& point) noexcept
+	{
+		return point.Dot(plane.GetNormal()) - plane.GetDistance();
+	}
+
+	/* 6 times the signed volume of the tetrahedron, positive when the point is in front of the face abc, in double so
+	 * the sign stays right far from thin faces, whose float plane can tilt by much more than the tolerance */
+	static QXdouble Orientation(const QXvec3& a, const QXvec3& b, const QXvec3& c, const QXvec3& point) noexcept
+	{
+		QXdvec3 origin{ a };
+		return (QXdvec3(b) - origin).Cross(QXdvec3(c) - origin).Dot(QXdvec3(point) - origin);
+	}
+
+	static QXfloat LineDistance(const QXvec3& a, const QXvec3& b, const QXvec3& point) noexcept
+	{
+		QXvec3 axis{ b - a };
+		return (point - a).Cross(axis).Length() / axis.Length();
+	}
+
+	#pragma endregion Static Functions
+
+	#pragma region Functions
+
+	QXuint QXconvexHull::AddPoint(const QXvec3* points, QXuint index)
+	{
+		_points.push_back(points[index]);
+		_pointSources.push_back(index);
+		_next.push_back(~0u);
+
+		return (QXuint)_points.size() - 1;
+	}
+
+	QXuint QXconvexHull::AddFace(QXuint a, QXuint b, QXuint c)
+	{
+		QXuint face;
+		if (_freeFaces.empty())
+		{
+			face = (QXuint)_work.size();
+			_work.emplace_back();
+		}
+		else
+		{
+			face = _freeFaces.back();
+			_freeFaces.pop_back();
+		}
+
+		QXworkFace& work{ _work[face] };
+		work.vertices[0] = a;
+		work.vertices[1] = b;
+		work.vertices[2] = c;
+		work.plane = FacePlane(_points[a], _points[b], _points[c]);
+		work.outside = ~0u;
+		work.furthest = ~0u;
+		work.furthestDistance = 0.f;
+		work.visibleStep = 0;
+		work.deleted = false;
+
+		return face;
+	}
+
+	void QXconvexHull::AddOutside(QXuint face, QXuint point, QXfloat distance)
+	{
+		QXworkFace& work{ _work[face] };
+		if (work.outside == ~0u)
+			_pending.push_back(face);
+
+		_next[point] = work.outside;
+		work.outside = point;
+		if (distance > work.furthestDistance)
+		{
+			work.furthestDistance = distance;
+			work.furthest = point;
+		}
+	}
+
+	void QXconvexHull::AssignOutside(QXuint point, const QXuint* faces, QXuint count)
+	{
+		for (QXuint i = 0; i < count; i++)
+		{
+			QXfloat distance{ SignedDistance(_work[faces[i]].plane, _points[point]) };
+			if (distance > _epsilon)
+			{
+				AddOutside(faces[i], point, distance);
+				return;
+			}
+		}
+	}
+
+	QXbool QXconvexHull::BuildTetrahedron(const QXvec3* points, QXuint count)
+	{
+		QXuint	seedCount{ (QXuint)_points.size() };
+		QXuint	corners[4]{ 0, 0, 0, 0 };
+		QXfloat	longest{ 0.f };
+
+		/* farthest pair of the extreme points, then the farthest point from their line and from the plane of the three */
+		for (QXuint i = 0; i < seedCount; i++)
+			for (QXuint j = i + 1; j < seedCount; j++)
+			{
+				QXfloat length{ (_points[j] - _points[i]).Length() };
+				if (length > longest)
+				{
+					longest = length;
+					corners[0] = i;
+					corners[1] = j;
+				}
+			}
+		if (longest <= _epsilon)
+			return false;
+
+		/* the extreme points can all be on a line or in a plane while others are not, then every point is searched */
+		auto farthest = [&](auto distance) -> QXuint
+		{
+			QXfloat	best{ _epsilon };
+			QXuint	found{ ~0u };
+			for (QXuint i = 0; i < seedCount; i++)
+				if (distance(_points[i]) > best)
+				{
+					best = distance(_points[i]);
+					found = i;
+				}
+			if (found != ~0u)
+				return found;
+
+			for (QXuint i = 0; i < count; i++)
+				if (distance(points[i]) > best)
+				{
+					best = distance(points[i]);
+					found = i;
+				}
+
+			return found == ~0u ? ~0u : AddPoint(points, found);
+		};
+
+		QXvec3 a{ _points[corners[0]] }, b{ _points[corners[1]] };
+		corners[2] = farthest([&](const QXvec3& point) { return LineDistance(a, b, point); });
+		if (corners[2] == ~0u)
+			return false;
+
+		QXplane base{ FacePlane(a, b, _points[corners[2]]) };
+		corners[3] = farthest([&](const QXvec3& point) { return std::abs(SignedDistance(base, point)); });
+		if (corners[3] == ~0u)
+			return false;
+
+		/* each face turned so the fourth corner is behind it */
+		QXuint triangles[4][3]{ { corners[0], corners[1], corners[2] }, { corners[0], corners[1], corners[3] },
+								{ corners[0], corners[2], corners[3] }, { corners[1], corners[2], corners[3] } };
+		QXuint opposite[4]{ corners[3], corners[2], corners[1], corners[0] };
+		QXuint faces[4];
+		for (QXuint f = 0; f < 4; f++)
+		{
+			QXuint* triangle{ triangles[f] };
+			if (SignedDistance(FacePlane(_points[triangle[0]], _points[triangle[1]], _points[triangle[2]]), _points[opposite[f]]) > 0.f)
+				std::swap(triangle[1], triangle[2]);
+			faces[f] = AddFace(triangle[0], triangle[1], triangle[2]);
+		}
+
+		for (QXuint f = 0; f < 4; f++)
+			for (QXuint i = 0; i < 3; i++)
+			{
+				QXworkFace& face{ _work[faces[f]] };
+				QXuint from{ face.vertices[i] }, to{ face.vertices[(i + 1) % 3] };
+				for (QXuint g = 0; g < 4; g++)
+					for (QXuint j = 0; j < 3; j++)
+						if (_work[faces[g]].vertices[j] == to && _work[faces[g]].vertices[(j + 1) % 3] == from)
+							face.neighbours[i] = faces[g];
+			}
+
+		for (QXuint point = 0; point < (QXuint)_points.size(); point++)
+			if (std::find(corners, corners + 4, point) == corners + 4)
+				AssignOutside(point, faces, 4);
+
+		return true;
+	}
+
+	void QXconvexHull::AddFurthest(QXuint face)
+	{
+		QXuint eye{ _work[face].furthest };
+		QXvec3 point{ _points[eye] };
+
+		/* depth first search of the faces the eye sees, its edges to the others are met in order around the horizon */
+		_step++;
+		_visible.clear();
+		_horizon.clear();
+		_work[face].visibleStep = _step;
+		_visible.push_back(face);
+		_search.push_back({ face, 0, 3 });
+		while (!_search.empty())
+		{
+			QXhorizonStep& step{ _search.back() };
+			if (step.left == 0)
+			{
+				_search.pop_back();
+				continue;
+			}
+
+			QXuint current{ step.face }, edge{ step.edge };
+			step.edge = (edge + 1) % 3;
+			step.left--;
+
+			const QXworkFace&	work{ _work[current] };
+			QXuint				a{ work.vertices[edge] }, b{ work.vertices[(edge + 1) % 3] }, neighbour{ work.neighbours[edge] };
+			QXworkFace&			other{ _work[neighbour] };
+			if (other.visibleStep == _step)
+				continue;
+
+			/* the neighbour has the edge from b to a */
+			QXuint shared{ other.vertices[0] == b ? 0u : other.vertices[1] == b ? 1u : 2u };
+			if (Orientation(_points[other.vertices[0]], _points[other.vertices[1]], _points[other.vertices[2]], point) > 0.)
+			{
+				other.visibleStep = _step;
+				_visible.push_back(neighbour);
+				_search.push_back({ neighbour, (shared + 1) % 3, 2 });
+			}
+			else
+				_horizon.push_back({ a, b, neighbour, shared });
+		}
+
+		/* a cone of faces from the horizon to the eye, face i joins the next one on its second edge */
+		_created.clear();
+		for (const QXhorizonEdge& edge : _horizon)
+		{
+			QXuint created{ AddFace(edge.a, edge.b, eye) };
+			_work[created].neighbours[0] = edge.outside;
+			_work[edge.outside].neighbours[edge.outsideEdge] = created;
+			_created.push_back(created);
+		}
+
+		QXuint createdCount{ (QXuint)_created.size() };
+		for (QXuint i = 0; i < createdCount; i++)
+		{
+			_work[_created[i]].neighbours[1] = _created[(i + 1) % createdCount];
+			_work[_created[i]].neighbours[2] = _created[(i + createdCount - 1) % createdCount];
+		}
+
+		/* points outside the visible faces move to a new face they are outside of, or are inside the hull */
+		for (QXuint visible : _visible)
+		{
+			QXworkFace& work{ _work[visible] };
+			for (QXuint outside = work.outside; outside != ~0u;)
+			{
+				QXuint next{ _next[outside] };
+				if (outside != eye)
+					AssignOutside(outside, _created.data(), createdCount);
+				outside = next;
+			}
+
+			work.outside = ~0u;
+			work.deleted = true;
+			_freeFaces.push_back(visible);
+		}
+	}
+
+	void QXconvexHull::Expand()
+	{
+		while (!_pending.empty())
+		{
+			QXuint face{ _pending.back() };
+			_pending.pop_back();
+
+			if (!_work[face].deleted && _work[face].outside != ~0u)
+				AddFurthest(face);
+		}
+	}
+
+	void QXconvexHull::Cull(const QXvec3* points, QXuint count, QXbool parallel)
+	{
+		_cullFaces.clear();
+		_cullPlanes.clear();
+		for (QXuint face = 0; face < (QXuint)_work.size(); face++)
+		{
+			if (_work[face].deleted)
+				continue;
+
+			QXvec3 normal{ _work[face].plane.GetNormal() };
+			_cullFaces.push_back(face);
+			_cullPlanes.insert(_cullPlanes.end(), { normal.x, normal.y, normal.z, _work[face].plane.GetDistance() });
+		}
+
+		QXuint faceCount{ (QXuint)_cullFaces.size() };
+		_culled.resize(count);
+
+		ParallelFor(count, parallel && count >= QX_HULL_PARALLEL_POINTS, [&](QXuint begin, QXuint end)
+		{
+			ForEachBlock(begin, end, [&](auto lanes, QXuint first)
+			{
+				using T = decltype(lanes);
+				constexpr QXuint width{ sizeof(T) / sizeof(QXfloat) };
+
+				T coordinates[3];
+				LoadPoints(points, first, coordinates);
+
+				/* the lanes still inside every face tested so far, most points of a random set stay until the last face */
+				QXuint inside{ (1u << width) - 1 };
+				std::fill(_culled.begin() + first, _culled.begin() + first + width, ~0u);
+				for (QXuint face = 0; face < faceCount && inside != 0; face++)
+				{
+					const QXfloat*	plane{ _cullPlanes.data() + 4 * face };
+					T				distance{ coordinates[0] * T(plane[0]) + coordinates[1] * T(plane[1]) + coordinates[2] * T(plane[2]) - T(plane[3]) };
+					QXuint			outside{ Mask(Less(T(_epsilon), distance)) & inside };
+
+					inside &= ~outside;
+					for (QXuint lane = 0; outside != 0; lane++, outside >>= 1)
+						if (outside & 1)
+							_culled[first + lane] = face;
+				}
+			});
+		});
+
+		/* a hull of v vertices has 2 v - 4 faces, the faces deleted by a step are only reused by the next one */
+		QXuint outsideCount{ (QXuint)std::count_if(_culled.begin(), _culled.end(), [](QXuint face) { return face != ~0u; }) };
+		_points.reserve(_points.size() + outsideCount);
+		_pointSources.reserve(_points.size() + outsideCount);
+		_next.reserve(_points.size() + outsideCount);
+		_work.reserve(2 * (_points.size() + outsideCount) + 64);
+
+		for (QXuint i = 0; i < count; i++)
+		{
+			if (_culled[i] == ~0u)
+				continue;
+
+			QXuint face{ _cullFaces[_culled[i]] };
+			QXuint point{ AddPoint(points, i) };
+			AddOutside(face, point, SignedDistance(_work[face].plane, _points[point]));
+		}
+	}
+
+	void QXconvexHull::Extract()
+	{
+		_vertexRemap.assign(_points.size(), ~0u);
+		_faceRemap.assign(_work.size(), ~0u);
+
+		for (QXuint face = 0; face < (QXuint)_work.size(); face++)
+		{
+			if (_work[face].deleted)
+				continue;
+
+			_faceRemap[face] = (QXuint)_faces.size();
+			_faces.emplace_back();
+			_planes.push_back(_work[face].plane);
+		}
+
+		for (QXuint face = 0; face < (QXuint)_work.size(); face++)
+		{
+			if (_work[face].deleted)
+				continue;
+
+			const QXworkFace&	work{ _work[face] };
+			QXhullFace&			hullFace{ _faces[_faceRemap[face]] };
+			for (QXuint i = 0; i < 3; i++)
+			{
+				QXuint& vertex{ _vertexRemap[work.vertices[i]] };
+				if (vertex == ~0u)
+				{
+					vertex = (QXuint)_vertices.size();
+					_vertices.push_back(_points[work.vertices[i]]);
+					_sources.push_back(_pointSources[work.vertices[i]]);
+				}
+
+				hullFace.vertices[i] = vertex;
+				hullFace.neighbours[i] = _faceRemap[work.neighbours[i]];
+			}
+		}
+	}
+
+	QXbool QXconvexHull::Build(const QXvec3* points, QXuint count, QXbool parallel)
+	{
+		_vertices.clear();
+		_sources.clear();
+		_faces.clear();
+		_planes.clear();
+		_points.clear();
+		_pointSources.clear();
+		_next.clear();
+		_work.clear();
+		_freeFaces.clear();
+		_pending.clear();
+
+		if (count < 4)
+			return false;
+
+		/* tolerance from the size of the set, so a hull does not depend on its scale */
+		QXhullExtremes	extremes{ FindExtremes(points, count, parallel) };
+		QXfloat		scale{ 0.f };
+		for (QXuint axis = 0; axis < 3; axis++)
+			scale += std::max(std::abs(extremes.high[axis]), std::abs(extremes.low[axis]));
+		_epsilon = QX_HULL_EPSILON * scale;
+
+		QXuint seeds[26];
+		std::copy(extremes.highIndex, extremes.highIndex + 13, seeds);
+		std::copy(extremes.lowIndex, extremes.lowIndex + 13, seeds + 13);
+		std::sort(seeds, seeds + 26);
+		QXuint* seedEnd{ std::unique(seeds, seeds + 26) };
+		for (QXuint* seed = seeds; seed != seedEnd; seed++)
+			AddPoint(points, *seed);
+
+		if (!BuildTetrahedron(points, count))
+			return false;
+
+		/* hull of the extreme points, then the points outside it */
+		Expand();
+		Cull(points, count, parallel);
+		Expand();
+		Extract();
+
+		return true;
+	}
+
+	#pragma endregion Functions
+}
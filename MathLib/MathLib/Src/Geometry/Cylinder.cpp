@@ -3,17 +3,20 @@
 namespace Math::Geometry
 {
 	#pragma region Constructors
-	QXcylinder::QXcylinder(const QXsegment& segment, const QXfloat& radius) noexcept:
+	template<typename T>
+	QXcylindert<T>::QXcylindert(const QXsegmentt<T>& segment, const T& radius) noexcept:
 		_segment(segment),
 		_radius{radius}
 	{}
 
-	QXcylinder::QXcylinder(const QXcylinder& cylinder) noexcept:
+	template<typename T>
+	QXcylindert<T>::QXcylindert(const QXcylindert<T>& cylinder) noexcept:
 		_segment(cylinder._segment),
 		_radius{cylinder._radius}
 	{}
 
-	QXcylinder::QXcylinder(QXcylinder&& cylinder) noexcept:
+	template<typename T>
+	QXcylindert<T>::QXcylindert(QXcylindert<T>&& cylinder) noexcept:
 		_segment(std::move(cylinder._segment)),
 		_radius{std::move(cylinder._radius)}
 	{}
@@ -24,7 +27,8 @@ namespace Math::Geometry
 
 	#pragma region Operators
 
-	QXcylinder& QXcylinder::operator=(const QXcylinder& cylinder) noexcept
+	template<typename T>
+	QXcylindert<T>& QXcylindert<T>::operator=(const QXcylindert<T>& cylinder) noexcept
 	{
 		_segment = cylinder._segment;
 		_radius = cylinder._radius;
@@ -32,7 +36,8 @@ namespace Math::Geometry
 		return *this;
 	}
 
-	QXcylinder& QXcylinder::operator=(QXcylinder&& cylinder) noexcept
+	template<typename T>
+	QXcylindert<T>& QXcylindert<T>::operator=(QXcylindert<T>&& cylinder) noexcept
 	{
 		_segment = std::move(cylinder._segment);
 		_radius = std::move(cylinder._radius);
@@ -46,4 +51,7 @@ namespace Math::Geometry
 	#pragma endregion Statics Functions
 
 	#pragma endregion Functions
+
+	template class QXcylindert<QXfloat>;
+	template class QXcylindert<QXdouble>;
 }
@@ -0,0 +1,167 @@
+#include "Distance.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <utility>
+
+#include "Maths.hpp"
+
+namespace Math::Geometry
+{
+	#pragma region Static Functions
+
+	/* ratio in [0, 1] of the point of a segment closest to a point, from the offset of the point to the start */
+	static QXfloat ClosestRatio(const QXvec3& axis, QXfloat sqrLength, const QXvec3& offset) noexcept
+	{
+		if (sqrLength <= FLT_MIN)
+			return 0.f;
+
+		return Clamp(0.f, 1.f, offset.Dot(axis) / sqrLength);
+	}
+
+	/* closest point of a box centered on the origin, in its axes */
+	static QXvec3 ClampToBox(const QXvec3& point, const QXvec3& halfSizes) noexcept
+	{
+		return { std::max(-halfSizes.x, std::min(halfSizes.x, point.x)), std::max(-halfSizes.y, std::min(halfSizes.y, point.y)),
+				std::max(-halfSizes.z, std::min(halfSizes.z, point.z)) };
+	}
+
+	#pragma endregion Static Functions
+
+	#pragma region Functions
+
+	QXfloat SqrDistance(const QXsegment& segment, const QXvec3& point, QXfloat* along) noexcept
+	{
+		QXvec3	axis{ segment.GetSegmentAB() };
+		QXfloat	ratio{ ClosestRatio(axis, axis.Dot(axis), point - segment.GetPointA()) };
+		QXvec3	offset{ point - segment.GetPoint(ratio) };
+
+		if (along != nullptr)
+			*along = ratio;
+
+		return offset.Dot(offset);
+	}
+
+	QXfloat SqrDistance(const QXsegment& first, const QXsegment& second, QXfloat* alongFirst, QXfloat* alongSecond) noexcept
+	{
+		QXvec3	axisFirst{ first.GetSegmentAB() }, axisSecond{ second.GetSegmentAB() };
+		QXvec3	offset{ first.GetPointA() - second.GetPointA() };
+		QXfloat	sqrFirst{ axisFirst.Dot(axisFirst) }, sqrSecond{ axisSecond.Dot(axisSecond) };
+		QXfloat	s{ 0.f }, t{ 0.f };
+
+		if (sqrFirst <= FLT_MIN)
+			t = ClosestRatio(axisSecond, sqrSecond, offset);
+		else if (sqrSecond <= FLT_MIN)
+			s = ClosestRatio(axisFirst, sqrFirst, -offset);
+		else
+		{
+			QXfloat cross{ axisFirst.Dot(axisSecond) };
+			QXfloat denominator{ sqrFirst * sqrSecond - cross * cross };
+			QXfloat c{ axisFirst.Dot(offset) }, f{ axisSecond.Dot(offset) };
+
+			if (denominator > QX_SEGMENT_PARALLEL_EPSILON * sqrFirst * sqrSecond)
+				s = Clamp(0.f, 1.f, (cross * f - c * sqrSecond) / denominator);
+			else
+			{
+				/* parallel: middle of the part of the first segment facing the second */
+				QXfloat start{ ClosestRatio(axisFirst, sqrFirst, -offset) };
+				QXfloat end{ ClosestRatio(axisFirst, sqrFirst, second.GetPointB() - first.GetPointA()) };
+				s = 0.5f * (start + end);
+			}
+
+			/* closest point of the second segment to the point of the first, then back if it was clamped */
+			t = (cross * s + f) / sqrSecond;
+			if (t < 0.f)
+			{
+				t = 0.f;
+				s = Clamp(0.f, 1.f, -c / sqrFirst);
+			}
+			else if (t > 1.f)
+			{
+				t = 1.f;
+				s = Clamp(0.f, 1.f, (cross - c) / sqrFirst);
+			}
+		}
+
+		if (alongFirst != nullptr)
+			*alongFirst = s;
+		if (alongSecond != nullptr)
+			*alongSecond = t;
+
+		QXvec3 gap{ first.GetPoint(s) - second.GetPoint(t) };
+		return gap.Dot(gap);
+	}
+
+	QXfloat SqrDistance(const QXsegment& segment, const QXorientedBox& box, QXfloat* along, QXvec3* closest) noexcept
+	{
+		const QXref3&	ref{ box.GetRef() };
+		QXvec3			halfSizes{ box.GetHalfSizes() };
+		QXvec3			offset{ segment.GetPointA() - ref.o }, axis{ segment.GetSegmentAB() };
+		QXvec3			start{ offset.Dot(ref.i), offset.Dot(ref.j), offset.Dot(ref.k) };
+		QXvec3			direction{ axis.Dot(ref.i), axis.Dot(ref.j), axis.Dot(ref.k) };
+
+		/* ratios where the segment crosses a face plane, sorted */
+		QXfloat	cuts[8]{ 0.f, 1.f };
+		QXuint	cutCount{ 2 };
+		for (QXuint i = 0; i < 3; i++)
+		{
+			if (direction.e[i] == 0.f)
+				continue;
+
+			for (QXfloat side : { -halfSizes.e[i], halfSizes.e[i] })
+			{
+				QXfloat ratio{ (side - start.e[i]) / direction.e[i] };
+				if (ratio > 0.f && ratio < 1.f)
+					cuts[cutCount++] = ratio;
+			}
+		}
+
+		for (QXuint i = 1; i < cutCount; i++)
+			for (QXuint j = i; j > 0 && cuts[j] < cuts[j - 1]; j--)
+				std::swap(cuts[j], cuts[j - 1]);
+
+		QXfloat bestRatio{ 0.f }, best{ FLT_MAX };
+		for (QXuint piece = 0; piece + 1 < cutCount; piece++)
+		{
+			QXfloat low{ cuts[piece] }, high{ cuts[piece + 1] }, middle{ 0.5f * (low + high) };
+
+			/* on this piece each coordinate stays below, inside or above the box: sum of (start + direction t - side)^2 */
+			QXfloat a{ 0.f }, b{ 0.f };
+			for (QXuint i = 0; i < 3; i++)
+			{
+				QXfloat coordinate{ start.e[i] + direction.e[i] * middle };
+				if (std::abs(coordinate) <= halfSizes.e[i])
+					continue;
+
+				QXfloat side{ coordinate > 0.f ? halfSizes.e[i] : -halfSizes.e[i] };
+				a += direction.e[i] * direction.e[i];
+				b += direction.e[i] * (start.e[i] - side);
+			}
+
+			QXfloat ratio{ a > 0.f ? Clamp(low, high, -b / a) : low };
+			QXvec3	point{ start + direction * ratio };
+			QXvec3	outside{ point - ClampToBox(point, halfSizes) };
+			QXfloat	sqrDistance{ outside.Dot(outside) };
+
+			if (sqrDistance < best)
+			{
+				best = sqrDistance;
+				bestRatio = ratio;
+			}
+		}
+
+		if (along != nullptr)
+			*along = bestRatio;
+
+		if (closest != nullptr)
+		{
+			QXvec3 local{ ClampToBox(start + direction * bestRatio, halfSizes) };
+			*closest = ref.o + ref.i * local.x + ref.j * local.y + ref.k * local.z;
+		}
+
+		return best;
+	}
+
+	#pragma endregion Functions
+}
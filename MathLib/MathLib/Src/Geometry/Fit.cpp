@@ -0,0 +1,489 @@
+#include "Fit.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <mutex>
+#include <random>
+#include <vector>
+
+#include "Decomposition.h"
+#include "Parallel.h"
+#include "Simd.h"
+
+namespace Math::Geometry
+{
+	#pragma region Static Functions
+
+	static_assert(sizeof(QXvec3) == 3 * sizeof(QXfloat), "points are read as packed floats");
+
+	/* fold the chunks of points on their threads, then merge them in the order of the points so the result does not depend on the threads */
+	template<typename R, typename F, typename M>
+	static R ReducePoints(QXuint count, QXbool parallel, F fold, M merge)
+	{
+		std::vector<std::pair<QXuint, R>>	partials;
+		std::mutex							mutex;
+
+		ParallelFor(count, parallel && count >= QX_FIT_PARALLEL_POINTS, [&](QXuint begin, QXuint end)
+		{
+			R partial{ fold(begin, end) };
+
+			std::lock_guard<std::mutex> lock(mutex);
+			partials.emplace_back(begin, partial);
+		});
+
+		std::sort(partials.begin(), partials.end(), [](const std::pair<QXuint, R>& a, const std::pair<QXuint, R>& b) { return a.first < b.first; });
+
+		R result{ partials[0].second };
+		for (QXuint i = 1; i < (QXuint)partials.size(); i++)
+			merge(result, partials[i].second);
+
+		return result;
+	}
+
+	struct QXextents
+	{
+		QXfloat	min[3]{ FLT_MAX, FLT_MAX, FLT_MAX };
+		QXfloat	max[3]{ -FLT_MAX, -FLT_MAX, -FLT_MAX };
+	};
+
+	/* min and max of the first points that fill whole lanes: 3 loads cover as many points as lanes, float j holding coordinate j % 3 */
+	template<typename T>
+	static QXuint ExtentLanes(const QXfloat* coordinates, QXuint count, QXextents& extents) noexcept
+	{
+		constexpr QXuint	width{ sizeof(T) / sizeof(QXfloat) };
+		QXuint				blocks{ count / width };
+		if (blocks == 0)
+			return 0;
+
+		T low[3]{ T(FLT_MAX), T(FLT_MAX), T(FLT_MAX) }, high[3]{ T(-FLT_MAX), T(-FLT_MAX), T(-FLT_MAX) };
+		for (QXuint block = 0; block < blocks; block++)
+			for (QXuint k = 0; k < 3; k++)
+			{
+				T value{ Load<T>(coordinates + (3 * block + k) * width) };
+				low[k] = Min(low[k], value);
+				high[k] = Max(high[k], value);
+			}
+
+		QXfloat lows[3 * width], highs[3 * width];
+		for (QXuint k = 0; k < 3; k++)
+		{
+			Store(lows + k * width, low[k]);
+			Store(highs + k * width, high[k]);
+		}
+
+		for (QXuint j = 0; j < 3 * width; j++)
+		{
+			extents.min[j % 3] = std::min(extents.min[j % 3], lows[j]);
+			extents.max[j % 3] = std::max(extents.max[j % 3], highs[j]);
+		}
+
+		return blocks * width;
+	}
+
+	static QXextents Extents(const QXvec3* points, QXuint begin, QXuint end) noexcept
+	{
+		QXextents		extents;
+		const QXfloat*	coordinates{ &points[begin].x };
+		QXuint			count{ end - begin }, done{ 0 };
+
+#if defined(QX_SIMD_AVX)
+		done += ExtentLanes<QXlane8>(coordinates, count, extents);
+#endif
+#if defined(QX_SIMD_SSE)
+		done += ExtentLanes<QXlane4>(coordinates + 3 * done, count - done, extents);
+#endif
+		ExtentLanes<QXfloat>(coordinates + 3 * done, count - done, extents);
+
+		return extents;
+	}
+
+	static void MergeExtents(QXextents& extents, const QXextents& other) noexcept
+	{
+		for (QXuint k = 0; k < 3; k++)
+		{
+			extents.min[k] = std::min(extents.min[k], other.min[k]);
+			extents.max[k] = std::max(extents.max[k], other.max[k]);
+		}
+	}
+
+	/* smallest radius around a center holding every point, rounded up */
+	static QXfloat FitRadius(const QXvec3* points, QXuint count, const QXvec3& center, QXbool parallel)
+	{
+		QXfloat sqrRadius{ ReducePoints<QXfloat>(count, parallel, [&](QXuint begin, QXuint end)
+		{
+			QXfloat farthest{ 0.f };
+			for (QXuint i = begin; i < end; i++)
+			{
+				QXvec3 offset{ points[i] - center };
+				farthest = std::max(farthest, offset.Dot(offset));
+			}
+
+			return farthest;
+		}, [](QXfloat& a, QXfloat b) { a = std::max(a, b); }) };
+
+		return std::nextafter(std::sqrt(sqrRadius), FLT_MAX);
+	}
+
+	struct QXgrowingSphere
+	{
+		QXvec3	center;
+		QXfloat	radius;
+	};
+
+	/* grow a sphere just enough to hold a point, its opposite side stays in place */
+	static void Grow(QXgrowingSphere& sphere, const QXvec3& point) noexcept
+	{
+		QXvec3	offset{ point - sphere.center };
+		QXfloat	sqrDistance{ offset.Dot(offset) };
+		if (sqrDistance <= sphere.radius * sphere.radius)
+			return;
+
+		QXfloat distance{ std::sqrt(sqrDistance) };
+		QXfloat grown{ 0.5f * (sphere.radius + distance) };
+
+		sphere.center += offset * ((grown - sphere.radius) / distance);
+		sphere.radius = grown;
+	}
+
+	/* sphere of the Welzl search, in double so that the spheres through 3 and 4 points stay accurate */
+	struct QXball
+	{
+		QXdvec3		center;
+		QXdouble	sqrRadius;
+	};
+
+	static QXdvec3 Widen(const QXvec3& point) noexcept
+	{
+		return QXdvec3(point.x, point.y, point.z);
+	}
+
+	static QXbool Outside(const QXball& ball, const QXvec3& point) noexcept
+	{
+		QXdvec3 offset{ Widen(point) - ball.center };
+		return offset.Dot(offset) > ball.sqrRadius * (1.0 + QX_FIT_SPHERE_EPSILON);
+	}
+
+	static QXball Ball(const QXvec3& a, const QXvec3& b) noexcept
+	{
+		QXdvec3 center{ (Widen(a) + Widen(b)) * 0.5 }, offset{ Widen(a) - center };
+		return { center, offset.Dot(offset) };
+	}
+
+	/* smallest sphere through three points: on their circumcircle, or across the farthest two when they are aligned */
+	static QXball Ball(const QXvec3& a, const QXvec3& b, const QXvec3& c) noexcept
+	{
+		QXdvec3		ab{ Widen(b) - Widen(a) }, ac{ Widen(c) - Widen(a) }, normal{ ab.Cross(ac) };
+		QXdouble	sqrNormal{ normal.Dot(normal) };
+
+		if (sqrNormal <= DBL_EPSILON * ab.Dot(ab) * ac.Dot(ac))
+		{
+			QXball first{ Ball(a, b) }, second{ Ball(a, c) }, third{ Ball(b, c) };
+			QXball& largest{ first.sqrRadius > second.sqrRadius ? first : second };
+			return largest.sqrRadius > third.sqrRadius ? largest : third;
+		}
+
+		QXdvec3 offset{ (normal.Cross(ab) * ac.Dot(ac) + ac.Cross(normal) * ab.Dot(ab)) * (0.5 / sqrNormal) };
+		return { Widen(a) + offset, offset.Dot(offset) };
+	}
+
+	/* sphere through four points, or the smallest sphere through three of them holding the fourth when they are coplanar */
+	static QXball Ball(const QXvec3& a, const QXvec3& b, const QXvec3& c, const QXvec3& d) noexcept
+	{
+		QXdvec3		ab{ Widen(b) - Widen(a) }, ac{ Widen(c) - Widen(a) }, ad{ Widen(d) - Widen(a) };
+		QXdouble	determinant{ ab.Dot(ac.Cross(ad)) };
+
+		if (determinant * determinant <= DBL_EPSILON * ab.Dot(ab) * ac.Dot(ac) * ad.Dot(ad))
+		{
+			const QXvec3*	corners[4]{ &a, &b, &c, &d };
+			QXball			smallestHolding{ QXdvec3(0.0), DBL_MAX }, largest{ QXdvec3(0.0), -1.0 };
+
+			for (QXuint skipped = 0; skipped < 4; skipped++)
+			{
+				const QXvec3* kept[3];
+				for (QXuint i = 0, k = 0; i < 4; i++)
+					if (i != skipped)
+						kept[k++] = corners[i];
+
+				QXball ball{ Ball(*kept[0], *kept[1], *kept[2]) };
+				if (!Outside(ball, *corners[skipped]) && ball.sqrRadius < smallestHolding.sqrRadius)
+					smallestHolding = ball;
+				if (ball.sqrRadius > largest.sqrRadius)
+					largest = ball;
+			}
+
+			return smallestHolding.sqrRadius < DBL_MAX ? smallestHolding : largest;
+		}
+
+		/* 2 x.ab = |ab|^2, 2 x.ac = |ac|^2, 2 x.ad = |ad|^2 */
+		QXdvec3 offset{ (ac.Cross(ad) * ab.Dot(ab) + ad.Cross(ab) * ac.Dot(ac) + ab.Cross(ac) * ad.Dot(ad)) * (0.5 / determinant) };
+		return { Widen(a) + offset, offset.Dot(offset) };
+	}
+
+	/* minimal sphere of a few points, incremental in a shuffled order: each point outside restarts with it on the boundary */
+	static QXball MinimalBall(std::vector<QXvec3>& points, std::mt19937& random) noexcept
+	{
+		std::shuffle(points.begin(), points.end(), random);
+
+		const QXvec3*	p{ points.data() };
+		QXuint			count{ (QXuint)points.size() };
+		QXball			ball{ Widen(p[0]), 0.0 };
+
+		for (QXuint i = 1; i < count; i++)
+		{
+			if (!Outside(ball, p[i]))
+				continue;
+
+			ball = { Widen(p[i]), 0.0 };
+			for (QXuint j = 0; j < i; j++)
+			{
+				if (!Outside(ball, p[j]))
+					continue;
+
+				ball = Ball(p[i], p[j]);
+				for (QXuint k = 0; k < j; k++)
+				{
+					if (!Outside(ball, p[k]))
+						continue;
+
+					ball = Ball(p[i], p[j], p[k]);
+					for (QXuint l = 0; l < k; l++)
+						if (Outside(ball, p[l]))
+							ball = Ball(p[i], p[j], p[k], p[l]);
+				}
+			}
+		}
+
+		return ball;
+	}
+
+	/* sums of the offsets of the points to a reference and of their products xx, xy, xz, yy, yz, zz */
+	struct QXmoments
+	{
+		QXdouble	sums[3]{ 0.0, 0.0, 0.0 };
+		QXdouble	products[6]{ 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
+	};
+
+	/* sum of the products of the half sizes, the surface of the box over 8 */
+	static QXfloat Surface(const QXvec3& halfSizes) noexcept
+	{
+		return halfSizes.x * halfSizes.y + halfSizes.y * halfSizes.z + halfSizes.z * halfSizes.x;
+	}
+
+	#pragma endregion Static Functions
+
+	#pragma region Functions
+	QXbox FitBox(const QXvec3* points, QXuint count, QXbool parallel)
+	{
+		if (count == 0)
+			return QXbox(QXvec3(0.f), 0.f, 0.f, 0.f);
+
+		QXextents extents{ ReducePoints<QXextents>(count, parallel, [&](QXuint begin, QXuint end) { return Extents(points, begin, end); }, MergeExtents) };
+		QXvec3 min(extents.min[0], extents.min[1], extents.min[2]), max(extents.max[0], extents.max[1], extents.max[2]);
+
+		return QXbox((min + max) * 0.5f, (max - min) * 0.5f);
+	}
+
+	QXsphere FitSphereRitter(const QXvec3* points, QXuint count, QXbool parallel)
+	{
+		if (count == 0)
+			return QXsphere(QXvec3(0.f), 0.f);
+
+		/* indices of the points with the smallest and biggest coordinate on each axis */
+		struct QXextremes
+		{
+			QXuint	min[3]{ 0, 0, 0 };
+			QXuint	max[3]{ 0, 0, 0 };
+		};
+
+		QXextremes extremes{ ReducePoints<QXextremes>(count, parallel, [&](QXuint begin, QXuint end)
+		{
+			QXextremes chunk;
+			for (QXuint k = 0; k < 3; k++)
+				chunk.min[k] = chunk.max[k] = begin;
+
+			for (QXuint i = begin + 1; i < end; i++)
+				for (QXuint k = 0; k < 3; k++)
+				{
+					if (points[i][k] < points[chunk.min[k]][k])
+						chunk.min[k] = i;
+					if (points[i][k] > points[chunk.max[k]][k])
+						chunk.max[k] = i;
+				}
+
+			return chunk;
+		}, [&](QXextremes& a, const QXextremes& b)
+		{
+			for (QXuint k = 0; k < 3; k++)
+			{
+				if (points[b.min[k]][k] < points[a.min[k]][k])
+					a.min[k] = b.min[k];
+				if (points[b.max[k]][k] > points[a.max[k]][k])
+					a.max[k] = b.max[k];
+			}
+		}) };
+
+		/* start across the farthest pair */
+		QXuint	axis{ 0 };
+		QXfloat	widest{ -1.f };
+		for (QXuint k = 0; k < 3; k++)
+		{
+			QXvec3	span{ points[extremes.max[k]] - points[extremes.min[k]] };
+			QXfloat	sqrLength{ span.Dot(span) };
+			if (sqrLength > widest)
+			{
+				widest = sqrLength;
+				axis = k;
+			}
+		}
+
+		QXgrowingSphere start{ (points[extremes.min[axis]] + points[extremes.max[axis]]) * 0.5f, 0.5f * std::sqrt(widest) };
+
+		QXgrowingSphere sphere{ ReducePoints<QXgrowingSphere>(count, parallel, [&](QXuint begin, QXuint end)
+		{
+			QXgrowingSphere chunk{ start };
+			for (QXuint i = begin; i < end; i++)
+				Grow(chunk, points[i]);
+
+			return chunk;
+		}, [](QXgrowingSphere& a, const QXgrowingSphere& b)
+		{
+			/* smallest sphere holding both */
+			QXvec3	offset{ b.center - a.center };
+			QXfloat	distance{ offset.Length() };
+			if (distance + b.radius <= a.radius)
+				return;
+			if (distance + a.radius <= b.radius)
+			{
+				a = b;
+				return;
+			}
+
+			QXfloat grown{ 0.5f * (distance + a.radius + b.radius) };
+			a.center += offset * ((grown - a.radius) / distance);
+			a.radius = grown;
+		}) };
+
+		return QXsphere(sphere.center, FitRadius(points, count, sphere.center, parallel));
+	}
+
+	QXsphere FitSphereWelzl(const QXvec3* points, QXuint count, QXbool parallel)
+	{
+		if (count == 0)
+			return QXsphere(QXvec3(0.f), 0.f);
+
+		std::mt19937		random(count);
+		std::vector<QXvec3>	support;
+		if (count <= QX_FIT_WELZL_SAMPLE)
+			support.assign(points, points + count);
+		else
+			for (QXuint i = 0; i < QX_FIT_WELZL_SAMPLE; i++)
+				support.push_back(points[random() % count]);
+
+		/* the sphere of the sample leaves few points out, they join the sample until none is left */
+		QXball ball;
+		for (;;)
+		{
+			ball = MinimalBall(support, random);
+
+			std::vector<QXvec3> outside{ ReducePoints<std::vector<QXvec3>>(count, parallel, [&](QXuint begin, QXuint end)
+			{
+				std::vector<QXvec3> chunk;
+				for (QXuint i = begin; i < end; i++)
+					if (Outside(ball, points[i]))
+						chunk.push_back(points[i]);
+
+				return chunk;
+			}, [](std::vector<QXvec3>& a, const std::vector<QXvec3>& b) { a.insert(a.end(), b.begin(), b.end()); }) };
+
+			if (outside.empty())
+				break;
+
+			support.insert(support.end(), outside.begin(), outside.end());
+		}
+
+		QXvec3 center((QXfloat)ball.center.x, (QXfloat)ball.center.y, (QXfloat)ball.center.z);
+		return QXsphere(center, FitRadius(points, count, center, parallel));
+	}
+
+	QXorientedBox FitOrientedBox(const QXvec3* points, QXuint count, QXbool parallel)
+	{
+		if (count == 0)
+			return QXorientedBox(QXref3(), QXvec3(0.f));
+
+		/* offsets to the first point keep the sums small */
+		QXvec3		reference{ points[0] };
+		QXmoments	moments{ ReducePoints<QXmoments>(count, parallel, [&](QXuint begin, QXuint end)
+		{
+			QXmoments chunk;
+			for (QXuint i = begin; i < end; i++)
+			{
+				QXvec3		offset{ points[i] - reference };
+				QXdouble	x{ offset.x }, y{ offset.y }, z{ offset.z };
+
+				chunk.sums[0] += x;
+				chunk.sums[1] += y;
+				chunk.sums[2] += z;
+				chunk.products[0] += x * x;
+				chunk.products[1] += x * y;
+				chunk.products[2] += x * z;
+				chunk.products[3] += y * y;
+				chunk.products[4] += y * z;
+				chunk.products[5] += z * z;
+			}
+
+			return chunk;
+		}, [](QXmoments& a, const QXmoments& b)
+		{
+			for (QXuint k = 0; k < 3; k++)
+				a.sums[k] += b.sums[k];
+			for (QXuint k = 0; k < 6; k++)
+				a.products[k] += b.products[k];
+		}) };
+
+		QXdouble	mean[3]{ moments.sums[0] / count, moments.sums[1] / count, moments.sums[2] / count };
+		QXmat4		covariance{ QXmat4::Identity() };
+		for (QXuint row = 0, k = 0; row < 3; row++)
+			for (QXuint column = row; column < 3; column++, k++)
+				covariance[row][column] = covariance[column][row] = (QXfloat)(moments.products[k] / count - mean[row] * mean[column]);
+
+		QXmat4 eigenVectors;
+		EigenSymmetric3(covariance, eigenVectors);
+
+		QXvec3 axes[3];
+		for (QXuint k = 0; k < 3; k++)
+			axes[k] = QXvec3(eigenVectors[0][k], eigenVectors[1][k], eigenVectors[2][k]);
+
+		/* extents along the principal axes, compared to the axis aligned box */
+		QXextents projections{ ReducePoints<QXextents>(count, parallel, [&](QXuint begin, QXuint end)
+		{
+			QXextents chunk;
+			for (QXuint i = begin; i < end; i++)
+			{
+				QXvec3 offset{ points[i] - reference };
+				for (QXuint k = 0; k < 3; k++)
+				{
+					QXfloat along{ offset.Dot(axes[k]) };
+					chunk.min[k] = std::min(chunk.min[k], along);
+					chunk.max[k] = std::max(chunk.max[k], along);
+				}
+			}
+
+			return chunk;
+		}, MergeExtents) };
+
+		QXvec3 halfSizes, center{ reference };
+		for (QXuint k = 0; k < 3; k++)
+		{
+			halfSizes[k] = 0.5f * (projections.max[k] - projections.min[k]);
+			center += axes[k] * (0.5f * (projections.min[k] + projections.max[k]));
+		}
+
+		QXbox aligned{ FitBox(points, count, parallel) };
+		if (Surface(aligned.GetHalfSizes()) <= Surface(halfSizes))
+			return QXorientedBox(QXref3(aligned.GetPosition()), aligned.GetHalfSizes());
+
+		return QXorientedBox(QXref3(center, axes[0], axes[1], axes[2]), halfSizes);
+	}
+	#pragma endregion Functions
+}
@@ -0,0 +1,564 @@
+#include "Gjk.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+namespace Math::Geometry
+{
+	#pragma region Support Functions
+	QXvec3 Support(const QXsphere& sphere, const QXvec3& direction) noexcept
+	{
+		QXfloat length{ direction.Length() };
+		if (length <= FLT_MIN)
+			return sphere.GetPosition() + QXvec3(sphere.GetRadius(), 0.f, 0.f);
+
+		return sphere.GetPosition() + direction * (sphere.GetRadius() / length);
+	}
+
+	QXvec3 Support(const QXbox& box, const QXvec3& direction) noexcept
+	{
+		QXvec3 halfSizes{ box.GetHalfSizes() };
+
+		return box.GetPosition() + QXvec3(direction.x >= 0.f ? halfSizes.x : -halfSizes.x, direction.y >= 0.f ? halfSizes.y : -halfSizes.y,
+											direction.z >= 0.f ? halfSizes.z : -halfSizes.z);
+	}
+
+	QXvec3 Support(const QXorientedBox& box, const QXvec3& direction) noexcept
+	{
+		const QXref3&	ref{ box.GetRef() };
+		QXvec3			halfSizes{ box.GetHalfSizes() };
+
+		return ref.o + ref.i * (direction.Dot(ref.i) >= 0.f ? halfSizes.x : -halfSizes.x) +
+			ref.j * (direction.Dot(ref.j) >= 0.f ? halfSizes.y : -halfSizes.y) + ref.k * (direction.Dot(ref.k) >= 0.f ? halfSizes.z : -halfSizes.z);
+	}
+
+	QXvec3 Support(const QXcylinder& cylinder, const QXvec3& direction) noexcept
+	{
+		QXsegment	segment{ cylinder.GetSegment() };
+		QXvec3		axis{ segment.GetSegmentAB() };
+		QXfloat		along{ direction.Dot(axis) };
+		QXvec3		cap{ along >= 0.f ? segment.GetPointB() : segment.GetPointA() };
+
+		/* farthest point of the cap disc: the direction without its axis part */
+		QXvec3	radial{ direction - axis * (along / axis.Dot(axis)) };
+		QXfloat	length{ radial.Length() };
+		if (length <= FLT_MIN)
+			return cap;
+
+		return cap + radial * (cylinder.GetRadius() / length);
+	}
+
+	QXvec3 Support(const QXcapsule& capsule, const QXvec3& direction) noexcept
+	{
+		QXvec3	end{ Support(capsule.GetSegment(), direction) };
+		QXfloat	length{ direction.Length() };
+		if (length <= FLT_MIN)
+			return end + QXvec3(capsule.GetRadius(), 0.f, 0.f);
+
+		return end + direction * (capsule.GetRadius() / length);
+	}
+
+	QXvec3 Support(const QXsegment& segment, const QXvec3& direction) noexcept
+	{
+		return direction.Dot(segment.GetSegmentAB()) >= 0.f ? segment.GetPointB() : segment.GetPointA();
+	}
+
+	QXvec3 Support(const QXquad& quad, const QXvec3& direction) noexcept
+	{
+		const QXref3&	ref{ quad.GetRef() };
+		QXvec2			halfSizes{ quad.GetHalfSizes() };
+
+		return ref.o + ref.i * (direction.Dot(ref.i) >= 0.f ? halfSizes.x : -halfSizes.x) +
+			ref.j * (direction.Dot(ref.j) >= 0.f ? halfSizes.y : -halfSizes.y);
+	}
+	#pragma endregion Support Functions
+
+	#pragma region Static Functions
+
+	static QXvec3	Center(const QXsphere& sphere) noexcept { return sphere.GetPosition(); }
+	static QXvec3	Center(const QXbox& box) noexcept { return box.GetPosition(); }
+	static QXvec3	Center(const QXorientedBox& box) noexcept { return box.GetRef().o; }
+	static QXvec3	Center(const QXcylinder& cylinder) noexcept { return cylinder.GetSegment().GetPoint(0.5f); }
+	static QXvec3	Center(const QXcapsule& capsule) noexcept { return capsule.GetSegment().GetPoint(0.5f); }
+	static QXvec3	Center(const QXsegment& segment) noexcept { return segment.GetPoint(0.5f); }
+	static QXvec3	Center(const QXquad& quad) noexcept { return quad.GetRef().o; }
+
+	/* point of the Minkowski difference A - B with the points of A and B it comes from */
+	struct QXvertex
+	{
+		QXvec3	w;
+		QXvec3	a;
+		QXvec3	b;
+		QXvec3	direction;
+	};
+
+	static QXvertex	SupportVertex(const QXconvex& a, const QXconvex& b, const QXvec3& direction) noexcept
+	{
+		QXvertex vertex;
+		vertex.a = a.Support(direction);
+		vertex.b = b.Support(-direction);
+		vertex.w = vertex.a - vertex.b;
+		vertex.direction = direction;
+
+		return vertex;
+	}
+
+	/* closest point to the origin of triangle abc (Ericson, Real-Time Collision Detection 5.1.5), weights of a, b, c */
+	static void	TriangleWeights(const QXvec3& a, const QXvec3& b, const QXvec3& c, QXfloat* weights) noexcept
+	{
+		QXvec3	ab{ b - a }, ac{ c - a };
+		QXfloat	d1{ -ab.Dot(a) }, d2{ -ac.Dot(a) };
+
+		weights[0] = weights[1] = weights[2] = 0.f;
+
+		if (d1 <= 0.f && d2 <= 0.f)
+		{
+			weights[0] = 1.f;
+			return;
+		}
+
+		QXfloat d3{ -ab.Dot(b) }, d4{ -ac.Dot(b) };
+		if (d3 >= 0.f && d4 <= d3)
+		{
+			weights[1] = 1.f;
+			return;
+		}
+
+		QXfloat vc{ d1 * d4 - d3 * d2 };
+		if (vc <= 0.f && d1 >= 0.f && d3 <= 0.f)
+		{
+			weights[1] = d1 / (d1 - d3);
+			weights[0] = 1.f - weights[1];
+			return;
+		}
+
+		QXfloat d5{ -ab.Dot(c) }, d6{ -ac.Dot(c) };
+		if (d6 >= 0.f && d5 <= d6)
+		{
+			weights[2] = 1.f;
+			return;
+		}
+
+		QXfloat vb{ d5 * d2 - d1 * d6 };
+		if (vb <= 0.f && d2 >= 0.f && d6 <= 0.f)
+		{
+			weights[2] = d2 / (d2 - d6);
+			weights[0] = 1.f - weights[2];
+			return;
+		}
+
+		QXfloat va{ d3 * d6 - d5 * d4 };
+		if (va <= 0.f && d4 - d3 >= 0.f && d5 - d6 >= 0.f)
+		{
+			weights[2] = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+			weights[1] = 1.f - weights[2];
+			return;
+		}
+
+		QXfloat inverse{ 1.f / (va + vb + vc) };
+		weights[1] = vb * inverse;
+		weights[2] = vc * inverse;
+		weights[0] = 1.f - weights[1] - weights[2];
+	}
+
+	/* closest point of the simplex to the origin, the simplex keeps only the vertices with a non zero weight */
+	static QXvec3	ReduceSimplex(QXvertex* vertices, QXuint& count, QXfloat* weights) noexcept
+	{
+		QXfloat all[4]{ 0.f, 0.f, 0.f, 0.f };
+
+		if (count == 1)
+			all[0] = 1.f;
+		else if (count == 2)
+		{
+			QXvec3	ab{ vertices[1].w - vertices[0].w };
+			QXfloat	t{ ab.Dot(ab) > FLT_MIN ? -vertices[0].w.Dot(ab) / ab.Dot(ab) : 0.f };
+
+			t = t < 0.f ? 0.f : (t > 1.f ? 1.f : t);
+			all[0] = 1.f - t;
+			all[1] = t;
+		}
+		else if (count == 3)
+			TriangleWeights(vertices[0].w, vertices[1].w, vertices[2].w, all);
+		else
+		{
+			static constexpr QXuint faces[4][4]{ { 0, 1, 2, 3 }, { 0, 2, 3, 1 }, { 0, 3, 1, 2 }, { 1, 3, 2, 0 } };
+			QXfloat best{ FLT_MAX };
+			QXbool	inside{ true };
+
+			for (const QXuint* face : faces)
+			{
+				const QXvec3& a{ vertices[face[0]].w };
+				QXvec3	normal{ (vertices[face[1]].w - a).Cross(vertices[face[2]].w - a) };
+				QXfloat	originSide{ -normal.Dot(a) };
+				QXfloat	oppositeSide{ normal.Dot(vertices[face[3]].w - a) };
+
+				/* a flat tetrahedron has every face tested */
+				if (originSide * oppositeSide > 0.f && fabsf(oppositeSide) > FLT_EPSILON * normal.Length())
+					continue;
+
+				inside = false;
+
+				QXfloat faceWeights[3];
+				TriangleWeights(a, vertices[face[1]].w, vertices[face[2]].w, faceWeights);
+
+				QXvec3 closest{ a * faceWeights[0] + vertices[face[1]].w * faceWeights[1] + vertices[face[2]].w * faceWeights[2] };
+				if (closest.Dot(closest) < best)
+				{
+					best = closest.Dot(closest);
+					all[0] = all[1] = all[2] = all[3] = 0.f;
+					for (QXuint i = 0; i < 3; i++)
+						all[face[i]] = faceWeights[i];
+				}
+			}
+
+			if (inside)
+			{
+				weights[0] = weights[1] = weights[2] = weights[3] = 0.25f;
+				return QXvec3(0.f);
+			}
+		}
+
+		QXuint	kept{ 0 };
+		QXvec3	closest(0.f);
+		for (QXuint i = 0; i < count; i++)
+		{
+			if (all[i] <= 0.f)
+				continue;
+
+			closest += vertices[i].w * all[i];
+			weights[kept] = all[i];
+			vertices[kept++] = vertices[i];
+		}
+		count = kept;
+
+		return closest;
+	}
+
+	/* points of A and B at the weights of the simplex vertices */
+	static void	Witness(const QXvertex* vertices, const QXfloat* weights, QXuint count, QXgjkResult& result) noexcept
+	{
+		result.pointA = QXvec3(0.f);
+		result.pointB = QXvec3(0.f);
+
+		for (QXuint i = 0; i < count; i++)
+		{
+			result.pointA += vertices[i].a * weights[i];
+			result.pointB += vertices[i].b * weights[i];
+		}
+	}
+
+	static QXbool	Gjk(const QXconvex& a, const QXconvex& b, QXgjkResult& result, QXgjkSimplex* cache,
+						QXvertex* vertices, QXuint& count) noexcept
+	{
+		QXfloat weights[4]{ 1.f, 0.f, 0.f, 0.f };
+		QXvec3	closest;
+
+		count = 0;
+		if (cache != nullptr)
+			for (QXuint i = 0; i < cache->count; i++)
+				vertices[count++] = SupportVertex(a, b, cache->directions[i]);
+
+		if (count > 0)
+			closest = ReduceSimplex(vertices, count, weights);
+		else
+		{
+			closest = a.GetCenter() - b.GetCenter();
+			if (closest.Dot(closest) <= FLT_MIN)
+				closest = QXvec3(1.f, 0.f, 0.f);
+		}
+
+		result = QXgjkResult();
+
+		for (result.iterations = 0; result.iterations < QX_GJK_MAX_ITERATIONS; result.iterations++)
+		{
+			QXfloat sqrDistance{ closest.Dot(closest) };
+
+			/* the origin is in the simplex, relative to the size of its vertices */
+			QXfloat scale{ 0.f };
+			for (QXuint i = 0; i < count; i++)
+				scale = std::max(scale, vertices[i].w.Dot(vertices[i].w));
+
+			if (count == 4 || (count > 0 && sqrDistance <= QX_GJK_TOLERANCE * QX_GJK_TOLERANCE * scale))
+			{
+				result.overlap = true;
+				break;
+			}
+
+			QXvertex vertex{ SupportVertex(a, b, -closest) };
+
+			/* no progress: closest is the distance up to the tolerance */
+			QXbool duplicate{ false };
+			for (QXuint i = 0; i < count; i++)
+				duplicate |= (vertices[i].w - vertex.w).Dot(vertices[i].w - vertex.w) <= QX_GJK_TOLERANCE * QX_GJK_TOLERANCE * scale;
+
+			if (count > 0 && (duplicate || sqrDistance - closest.Dot(vertex.w) <= QX_GJK_TOLERANCE * sqrDistance))
+				break;
+
+			vertices[count++] = vertex;
+			closest = ReduceSimplex(vertices, count, weights);
+		}
+
+		if (!result.overlap)
+		{
+			result.distance = closest.Length();
+			result.normal = closest * (-1.f / result.distance);
+			Witness(vertices, weights, count, result);
+		}
+
+		if (cache != nullptr)
+		{
+			cache->count = count;
+			for (QXuint i = 0; i < count; i++)
+				cache->directions[i] = vertices[i].direction;
+		}
+
+		return result.overlap;
+	}
+
+	/* grow a simplex around the origin to a tetrahedron, false when the difference is flat */
+	static QXbool	BlowUpSimplex(const QXconvex& a, const QXconvex& b, QXvertex* vertices, QXuint& count) noexcept
+	{
+		static const QXvec3 axes[6]{ QXvec3(1.f, 0.f, 0.f), QXvec3(-1.f, 0.f, 0.f), QXvec3(0.f, 1.f, 0.f), QXvec3(0.f, -1.f, 0.f),
+									QXvec3(0.f, 0.f, 1.f), QXvec3(0.f, 0.f, -1.f) };
+
+		if (count == 0)
+			vertices[count++] = SupportVertex(a, b, axes[0]);
+
+		if (count == 1)
+		{
+			for (const QXvec3& axis : axes)
+			{
+				QXvertex vertex{ SupportVertex(a, b, axis) };
+				if ((vertex.w - vertices[0].w).SqrLength() > FLT_EPSILON)
+				{
+					vertices[count++] = vertex;
+					break;
+				}
+			}
+		}
+
+		if (count == 2)
+		{
+			QXvec3 line{ vertices[1].w - vertices[0].w };
+			QXvec3 side{ line.Cross(fabsf(line.x) < fabsf(line.y) ? axes[0] : axes[2]) };
+			QXvec3 directions[4]{ side, -side, line.Cross(side), -line.Cross(side) };
+
+			for (const QXvec3& direction : directions)
+			{
+				QXvertex vertex{ SupportVertex(a, b, direction) };
+				if ((vertex.w - vertices[0].w).Cross(line).SqrLength() > FLT_EPSILON * line.SqrLength())
+				{
+					vertices[count++] = vertex;
+					break;
+				}
+			}
+		}
+
+		if (count == 3)
+		{
+			QXvec3 normal{ (vertices[1].w - vertices[0].w).Cross(vertices[2].w - vertices[0].w) };
+			QXvec3 directions[2]{ normal, -normal };
+
+			for (const QXvec3& direction : directions)
+			{
+				QXvertex vertex{ SupportVertex(a, b, direction) };
+				if (fabsf(normal.Dot(vertex.w - vertices[0].w)) > FLT_EPSILON * normal.Length())
+				{
+					vertices[count++] = vertex;
+					break;
+				}
+			}
+		}
+
+		return count == 4;
+	}
+
+	struct QXepaFace
+	{
+		QXuint	vertices[3];
+		QXvec3	normal;
+		QXfloat	distance;
+		QXbool	alive;
+	};
+
+	static void	AddFace(const QXvertex* vertices, QXepaFace* faces, QXuint& faceCount, QXuint i, QXuint j, QXuint k) noexcept
+	{
+		QXepaFace&	face{ faces[faceCount++] };
+		QXvec3		normal{ (vertices[j].w - vertices[i].w).Cross(vertices[k].w - vertices[i].w) };
+		QXfloat		length{ normal.Length() };
+
+		face.vertices[0] = i;
+		face.vertices[1] = j;
+		face.vertices[2] = k;
+		face.normal = length > FLT_MIN ? normal / length : QXvec3(0.f);
+		face.distance = length > FLT_MIN ? face.normal.Dot(vertices[i].w) : FLT_MAX;
+		face.alive = true;
+	}
+
+	static void	Epa(const QXconvex& a, const QXconvex& b, QXvertex* simplex, QXuint simplexCount, QXgjkResult& result) noexcept
+	{
+		static constexpr QXuint maxFaces{ 2 * QX_EPA_MAX_VERTICES };
+
+		QXvertex	vertices[QX_EPA_MAX_VERTICES];
+		QXepaFace	faces[maxFaces];
+		QXuint		edges[3 * maxFaces][2];
+		QXuint		vertexCount{ simplexCount }, faceCount{ 0 };
+
+		for (QXuint i = 0; i < simplexCount; i++)
+			vertices[i] = simplex[i];
+
+		if (!BlowUpSimplex(a, b, vertices, vertexCount))
+		{
+			/* touching with no volume of contact */
+			QXvec3	offset{ b.GetCenter() - a.GetCenter() };
+			QXfloat	length{ offset.Length() };
+
+			/* concentric shapes have no direction between them, any unit normal is valid */
+			result.depth = 0.f;
+			result.normal = length > FLT_MIN ? offset / length : QXvec3(1.f, 0.f, 0.f);
+			result.pointA = result.pointB = vertices[0].a;
+			return;
+		}
+
+		/* faces wound so their normals point away from the opposite vertex */
+		static constexpr QXuint tetrahedron[4][4]{ { 0, 1, 2, 3 }, { 0, 3, 1, 2 }, { 0, 2, 3, 1 }, { 1, 3, 2, 0 } };
+		for (const QXuint* face : tetrahedron)
+		{
+			QXvec3 normal{ (vertices[face[1]].w - vertices[face[0]].w).Cross(vertices[face[2]].w - vertices[face[0]].w) };
+
+			if (normal.Dot(vertices[face[3]].w - vertices[face[0]].w) > 0.f)
+				AddFace(vertices, faces, faceCount, face[0], face[2], face[1]);
+			else
+				AddFace(vertices, faces, faceCount, face[0], face[1], face[2]);
+		}
+
+		QXepaFace* closest{ nullptr };
+		for (result.iterations = 0; result.iterations < QX_EPA_MAX_ITERATIONS; result.iterations++)
+		{
+			closest = nullptr;
+			for (QXuint f = 0; f < faceCount; f++)
+				if (faces[f].alive && (closest == nullptr || faces[f].distance < closest->distance))
+					closest = &faces[f];
+
+			QXvertex vertex{ SupportVertex(a, b, closest->normal) };
+			if (vertex.w.Dot(closest->normal) - closest->distance <= QX_EPA_TOLERANCE || vertexCount == QX_EPA_MAX_VERTICES)
+				break;
+
+			/* remove the faces seen from the new vertex, their border (the horizon) is joined to it */
+			QXuint edgeCount{ 0 };
+			for (QXuint f = 0; f < faceCount; f++)
+			{
+				QXepaFace& face{ faces[f] };
+				if (!face.alive || face.normal.Dot(vertex.w - vertices[face.vertices[0]].w) <= 0.f)
+					continue;
+
+				face.alive = false;
+				for (QXuint e = 0; e < 3; e++)
+				{
+					QXuint from{ face.vertices[e] }, to{ face.vertices[(e + 1) % 3] };
+					QXbool shared{ false };
+
+					for (QXuint h = 0; h < edgeCount; h++)
+					{
+						if (edges[h][0] == to && edges[h][1] == from)
+						{
+							edges[h][0] = edges[edgeCount - 1][0];
+							edges[h][1] = edges[edgeCount - 1][1];
+							edgeCount--;
+							shared = true;
+							break;
+						}
+					}
+
+					if (!shared)
+					{
+						edges[edgeCount][0] = from;
+						edges[edgeCount][1] = to;
+						edgeCount++;
+					}
+				}
+			}
+
+			if (faceCount + edgeCount > maxFaces)
+				break;
+
+			vertices[vertexCount] = vertex;
+			for (QXuint h = 0; h < edgeCount; h++)
+				AddFace(vertices, faces, faceCount, edges[h][0], edges[h][1], vertexCount);
+			vertexCount++;
+
+			/* reuse the slots of the removed faces */
+			QXuint alive{ 0 };
+			for (QXuint f = 0; f < faceCount; f++)
+				if (faces[f].alive)
+					faces[alive++] = faces[f];
+			faceCount = alive;
+		}
+
+		/* deepest points: the projection of the origin on the closest face, in weights of its vertices */
+		const QXvertex& v0{ vertices[closest->vertices[0]] };
+		const QXvertex& v1{ vertices[closest->vertices[1]] };
+		const QXvertex& v2{ vertices[closest->vertices[2]] };
+
+		QXvec3	projection{ closest->normal * closest->distance };
+		QXvec3	e0{ v1.w - v0.w }, e1{ v2.w - v0.w }, e2{ projection - v0.w };
+		QXfloat	d00{ e0.Dot(e0) }, d01{ e0.Dot(e1) }, d11{ e1.Dot(e1) }, d20{ e2.Dot(e0) }, d21{ e2.Dot(e1) };
+		QXfloat	denominator{ d00 * d11 - d01 * d01 };
+		QXfloat	u{ 1.f }, v{ 0.f }, w{ 0.f };
+
+		if (denominator > FLT_MIN)
+		{
+			v = (d11 * d20 - d01 * d21) / denominator;
+			w = (d00 * d21 - d01 * d20) / denominator;
+			u = 1.f - v - w;
+		}
+
+		result.depth = closest->distance;
+		result.normal = closest->normal;
+		result.pointA = v0.a * u + v1.a * v + v2.a * w;
+		result.pointB = v0.b * u + v1.b * v + v2.b * w;
+	}
+
+	#pragma endregion Static Functions
+
+	#pragma region Constructors/Destructor
+	template<typename Shape>
+	QXconvex::QXconvex(const Shape& shape) noexcept :
+		_shape{ &shape },
+		_support{ [](const void* pointer, const QXvec3& direction) noexcept { return Geometry::Support(*(const Shape*)pointer, direction); } },
+		_center{ Center(shape) }
+	{}
+
+	template QXconvex::QXconvex(const QXsphere&) noexcept;
+	template QXconvex::QXconvex(const QXbox&) noexcept;
+	template QXconvex::QXconvex(const QXorientedBox&) noexcept;
+	template QXconvex::QXconvex(const QXcylinder&) noexcept;
+	template QXconvex::QXconvex(const QXcapsule&) noexcept;
+	template QXconvex::QXconvex(const QXsegment&) noexcept;
+	template QXconvex::QXconvex(const QXquad&) noexcept;
+	#pragma endregion Constructors/Destructor
+
+	#pragma region Functions
+	QXbool GjkDistance(const QXconvex& a, const QXconvex& b, QXgjkResult& result, QXgjkSimplex* cache) noexcept
+	{
+		QXvertex	vertices[4];
+		QXuint		count;
+
+		return Gjk(a, b, result, cache, vertices, count);
+	}
+
+	QXbool GjkPenetration(const QXconvex& a, const QXconvex& b, QXgjkResult& result, QXgjkSimplex* cache) noexcept
+	{
+		QXvertex	vertices[4];
+		QXuint		count;
+
+		if (!Gjk(a, b, result, cache, vertices, count))
+			return false;
+
+		Epa(a, b, vertices, count, result);
+
+		return true;
+	}
+	#pragma endregion Functions
+}
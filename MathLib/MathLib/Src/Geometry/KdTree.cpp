@@ -0,0 +1,249 @@
+#include "KdTree.h"
+
+#include <algorithm>
+#include <cfloat>
+
+#include "Parallel.h"
+
+namespace Math::Geometry
+{
+	#pragma region Static Functions
+
+	static constexpr QXuint	noPoint{ ~0u };
+	/* 2^6 = 64 subtrees are built in parallel */
+	static constexpr QXuint	parallelDepth{ 6 };
+
+	#pragma endregion Static Functions
+
+	#pragma region Attributes
+	/* k closest points found so far, sorted closest first */
+	struct QXkdTree::QXneighbours
+	{
+		QXuint		k;
+		QXuint		count;
+		QXuint*		indices;
+		QXfloat*	sqrDistances;
+
+		inline QXfloat	Worst() const noexcept { return count < k ? FLT_MAX : sqrDistances[k - 1]; }
+
+		void	Insert(QXuint index, QXfloat sqrDistance) noexcept
+		{
+			QXuint slot{ count < k ? count++ : k - 1 };
+			for (; slot > 0 && sqrDistances[slot - 1] > sqrDistance; slot--)
+			{
+				sqrDistances[slot] = sqrDistances[slot - 1];
+				indices[slot] = indices[slot - 1];
+			}
+
+			sqrDistances[slot] = sqrDistance;
+			indices[slot] = index;
+		}
+	};
+
+	struct QXkdTree::QXbuildTask
+	{
+		QXuint	begin;
+		QXuint	end;
+		QXvec3	min;
+		QXvec3	max;
+	};
+	#pragma endregion Attributes
+
+	#pragma region Functions
+	void QXkdTree::BuildRange(QXuint begin, QXuint end, QXvec3 min, QXvec3 max, QXuint depth, std::vector<QXbuildTask>* tasks)
+	{
+		while (end - begin > QX_KDTREE_LEAF_SIZE)
+		{
+			if (tasks != nullptr && depth == parallelDepth)
+			{
+				tasks->push_back({ begin, end, min, max });
+				return;
+			}
+
+			QXvec3	size{ max - min };
+			QXuint	axis{ size.x >= size.y && size.x >= size.z ? 0u : (size.y >= size.z ? 1u : 2u) };
+			QXuint	middle{ begin + (end - begin) / 2 };
+
+			std::nth_element(_entries.begin() + begin, _entries.begin() + middle, _entries.begin() + end,
+				[axis](const QXentry& a, const QXentry& b) { return a.point.e[axis] < b.point.e[axis]; });
+
+			_axes[middle] = (uint8_t)axis;
+
+			QXvec3 leftMax{ max }, rightMin{ min };
+			leftMax.e[axis] = _entries[middle].point.e[axis];
+			rightMin.e[axis] = _entries[middle].point.e[axis];
+
+			BuildRange(begin, middle, min, leftMax, depth + 1, tasks);
+
+			begin = middle + 1;
+			min = rightMin;
+			depth++;
+		}
+	}
+
+	void QXkdTree::SearchNearest(QXuint begin, QXuint end, const QXvec3& query, QXneighbours& neighbours) const
+	{
+		while (end - begin > QX_KDTREE_LEAF_SIZE)
+		{
+			QXuint			middle{ begin + (end - begin) / 2 };
+			const QXentry&	node{ _entries[middle] };
+			QXfloat			offset{ query.e[_axes[middle]] - node.point.e[_axes[middle]] };
+			QXvec3			delta{ node.point - query };
+			QXfloat			sqrDistance{ delta.Dot(delta) };
+
+			if (sqrDistance < neighbours.Worst())
+				neighbours.Insert(node.index, sqrDistance);
+
+			/* near side first, the far side only if the splitting plane is closer than the worst neighbour */
+			if (offset < 0.f)
+			{
+				SearchNearest(begin, middle, query, neighbours);
+				if (offset * offset >= neighbours.Worst())
+					return;
+				begin = middle + 1;
+			}
+			else
+			{
+				SearchNearest(middle + 1, end, query, neighbours);
+				if (offset * offset >= neighbours.Worst())
+					return;
+				end = middle;
+			}
+		}
+
+		for (QXuint i = begin; i < end; i++)
+		{
+			QXvec3	delta{ _entries[i].point - query };
+			QXfloat	sqrDistance{ delta.Dot(delta) };
+
+			if (sqrDistance < neighbours.Worst())
+				neighbours.Insert(_entries[i].index, sqrDistance);
+		}
+	}
+
+	void QXkdTree::SearchRadius(QXuint begin, QXuint end, const QXvec3& center, QXfloat sqrRadius, std::vector<QXuint>& result) const
+	{
+		while (end - begin > QX_KDTREE_LEAF_SIZE)
+		{
+			QXuint			middle{ begin + (end - begin) / 2 };
+			const QXentry&	node{ _entries[middle] };
+			QXfloat			offset{ center.e[_axes[middle]] - node.point.e[_axes[middle]] };
+			QXvec3			delta{ node.point - center };
+
+			if (delta.Dot(delta) <= sqrRadius)
+				result.push_back(node.index);
+
+			if (offset * offset > sqrRadius)
+			{
+				if (offset < 0.f)
+					end = middle;
+				else
+					begin = middle + 1;
+				continue;
+			}
+
+			SearchRadius(begin, middle, center, sqrRadius, result);
+			begin = middle + 1;
+		}
+
+		for (QXuint i = begin; i < end; i++)
+		{
+			QXvec3 delta{ _entries[i].point - center };
+			if (delta.Dot(delta) <= sqrRadius)
+				result.push_back(_entries[i].index);
+		}
+	}
+	#pragma endregion Functions
+
+	#pragma region Methods
+	void QXkdTree::Build(const QXvec3* points, QXuint count, QXbool parallel)
+	{
+		_entries.resize(count);
+		_axes.assign(count, 0);
+
+		if (count == 0)
+			return;
+
+		QXvec3 min{ points[0] }, max{ points[0] };
+		for (QXuint i = 0; i < count; i++)
+		{
+			_entries[i] = { points[i], i };
+			for (QXuint axis = 0; axis < 3; axis++)
+			{
+				min.e[axis] = std::min(min.e[axis], points[i].e[axis]);
+				max.e[axis] = std::max(max.e[axis], points[i].e[axis]);
+			}
+		}
+
+		if (!parallel)
+		{
+			BuildRange(0, count, min, max, 0, nullptr);
+			return;
+		}
+
+		/* subtrees below the top levels are disjoint ranges */
+		std::vector<QXbuildTask> tasks;
+		BuildRange(0, count, min, max, 0, &tasks);
+
+		ParallelFor((QXuint)tasks.size(), true, [&](QXuint begin, QXuint end)
+		{
+			for (QXuint t = begin; t < end; t++)
+				BuildRange(tasks[t].begin, tasks[t].end, tasks[t].min, tasks[t].max, parallelDepth, nullptr);
+		});
+	}
+
+	QXuint QXkdTree::Nearest(const QXvec3& query, QXfloat* sqrDistance) const
+	{
+		QXuint		index{ noPoint };
+		QXfloat		distance{ FLT_MAX };
+		QXneighbours neighbours{ 1, 0, &index, &distance };
+
+		SearchNearest(0, Count(), query, neighbours);
+
+		if (sqrDistance != nullptr)
+			*sqrDistance = distance;
+
+		return index;
+	}
+
+	void QXkdTree::KNearest(const QXvec3& query, QXuint k, std::vector<QXuint>& result, std::vector<QXfloat>* sqrDistances) const
+	{
+		k = std::min(k, Count());
+
+		std::vector<QXfloat> distances(k);
+		result.resize(k);
+
+		if (k == 0)
+			return;
+
+		QXneighbours neighbours{ k, 0, result.data(), distances.data() };
+		SearchNearest(0, Count(), query, neighbours);
+
+		if (sqrDistances != nullptr)
+			sqrDistances->swap(distances);
+	}
+
+	void QXkdTree::KNearest(const QXvec3* queries, QXuint count, QXuint k, QXuint* result, QXbool parallel) const
+	{
+		ParallelFor(count, parallel, [&](QXuint begin, QXuint end)
+		{
+			std::vector<QXfloat> distances(k);
+
+			for (QXuint q = begin; q < end; q++)
+			{
+				QXuint* indices{ result + (size_t)q * k };
+				std::fill(indices, indices + k, noPoint);
+
+				QXneighbours neighbours{ k, 0, indices, distances.data() };
+				if (k > 0)
+					SearchNearest(0, Count(), queries[q], neighbours);
+			}
+		});
+	}
+
+	void QXkdTree::QueryRadius(const QXvec3& center, QXfloat radius, std::vector<QXuint>& result) const
+	{
+		SearchRadius(0, Count(), center, radius * radius, result);
+	}
+	#pragma endregion Methods
+}
@@ -0,0 +1,265 @@
+#include "Mesh.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "Parallel.h"
+#include "Simd.h"
+
+namespace Math::Geometry
+{
+	#pragma region Static Functions
+
+	/* corners of as many triangles as lanes from first, coordinate k of corner v in corners[3 * v + k] */
+	template<typename T>
+	static void LoadTriangles(const QXmeshView& mesh, QXuint first, T corners[9]) noexcept
+	{
+		constexpr QXuint	width{ sizeof(T) / sizeof(QXfloat) };
+		alignas(32) QXfloat	buffer[9][width];
+
+		for (QXuint lane = 0; lane < width; lane++)
+			for (QXuint v = 0; v < 3; v++)
+			{
+				const QXvec3& position{ mesh.positions[mesh.indices[3 * (first + lane) + v]] };
+				for (QXuint k = 0; k < 3; k++)
+					buffer[3 * v + k][lane] = position.e[k];
+			}
+
+		for (QXuint i = 0; i < 9; i++)
+			corners[i] = Load<T>(buffer[i]);
+	}
+
+	/* (b - a) x (c - a) of as many triangles as lanes from first, its length is twice their area */
+	template<typename T>
+	static void FaceCross(const QXmeshView& mesh, QXuint first, T cross[3]) noexcept
+	{
+		T corners[9];
+		LoadTriangles(mesh, first, corners);
+
+		T ab[3]{ corners[3] - corners[0], corners[4] - corners[1], corners[5] - corners[2] };
+		T ac[3]{ corners[6] - corners[0], corners[7] - corners[1], corners[8] - corners[2] };
+
+		cross[0] = ab[1] * ac[2] - ab[2] * ac[1];
+		cross[1] = ab[2] * ac[0] - ab[0] * ac[2];
+		cross[2] = ab[0] * ac[1] - ab[1] * ac[0];
+	}
+
+	/* call block(lanes, first) on whole lanes of triangles, the widest first, then on the remaining ones one by one */
+	template<typename F>
+	static void ForEachLane(QXuint begin, QXuint end, F block)
+	{
+		QXuint i{ begin };
+#if defined(QX_SIMD_AVX)
+		for (; i + 8 <= end; i += 8)
+			block(QXlane8(), i);
+#endif
+#if defined(QX_SIMD_SSE)
+		for (; i + 4 <= end; i += 4)
+			block(QXlane4(), i);
+#endif
+		for (; i < end; i++)
+			block(QXfloat(), i);
+	}
+
+	template<typename T>
+	static T Dot3(const T a[3], const T b[3]) noexcept
+	{
+		return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+	}
+
+	/* squared distance from a point to the edge from a to a + edge */
+	template<typename T>
+	static T EdgeSqrDistance(const T toPoint[3], const T edge[3]) noexcept
+	{
+		T ratio{ Min(T(1.f), Max(T(0.f), Dot3(toPoint, edge) / Max(Dot3(edge, edge), T(FLT_MIN)))) };
+		T gap[3]{ toPoint[0] - edge[0] * ratio, toPoint[1] - edge[1] * ratio, toPoint[2] - edge[2] * ratio };
+
+		return Dot3(gap, gap);
+	}
+
+	/* squared distance from a point to as many triangles as lanes from first: the plane when it projects inside, else the nearest edge */
+	template<typename T>
+	static T TriangleSqrDistance(const QXmeshView& mesh, QXuint first, const QXvec3& point) noexcept
+	{
+		T corners[9];
+		LoadTriangles(mesh, first, corners);
+
+		T edges[3][3], toPoint[3][3];
+		for (QXuint v = 0; v < 3; v++)
+		{
+			QXuint next{ (v + 1) % 3 };
+			for (QXuint k = 0; k < 3; k++)
+			{
+				edges[v][k] = corners[3 * next + k] - corners[3 * v + k];
+				toPoint[v][k] = T(point.e[k]) - corners[3 * v + k];
+			}
+		}
+
+		T normal[3]{ edges[2][1] * edges[0][2] - edges[2][2] * edges[0][1], edges[2][2] * edges[0][0] - edges[2][0] * edges[0][2],
+					edges[2][0] * edges[0][1] - edges[2][1] * edges[0][0] };
+		T sqrNormal{ Dot3(normal, normal) };
+
+		/* edges[2] runs from c to a so normal is (a - c) x (b - a), the front normal; inside when left of every edge */
+		auto inside{ Less(T(0.f), sqrNormal) };
+		for (QXuint v = 0; v < 3; v++)
+		{
+			T side[3]{ edges[v][1] * toPoint[v][2] - edges[v][2] * toPoint[v][1], edges[v][2] * toPoint[v][0] - edges[v][0] * toPoint[v][2],
+						edges[v][0] * toPoint[v][1] - edges[v][1] * toPoint[v][0] };
+			inside = And(inside, LessEqual(T(0.f), Dot3(side, normal)));
+		}
+
+		T height{ Dot3(toPoint[0], normal) };
+		T plane{ height * height / Max(sqrNormal, T(FLT_MIN)) };
+		T edge{ Min(EdgeSqrDistance(toPoint[0], edges[0]), Min(EdgeSqrDistance(toPoint[1], edges[1]), EdgeSqrDistance(toPoint[2], edges[2]))) };
+
+		return Select(inside, plane, edge);
+	}
+
+	#pragma endregion Static Functions
+
+	#pragma region Functions
+
+	void FaceNormals(const QXmeshView& mesh, QXvec3* normals, QXfloat* areas, QXbool parallel)
+	{
+		ParallelFor(mesh.triangleCount, parallel && mesh.triangleCount >= QX_MESH_PARALLEL_TRIANGLES, [&](QXuint begin, QXuint end)
+		{
+			ForEachLane(begin, end, [&](auto lanes, QXuint first)
+			{
+				using T = decltype(lanes);
+				constexpr QXuint width{ sizeof(T) / sizeof(QXfloat) };
+
+				T cross[3];
+				FaceCross(mesh, first, cross);
+
+				T length{ Sqrt(Dot3(cross, cross)) };
+				T inverse{ Select(Less(T(0.f), length), T(1.f) / length, T(0.f)) };
+
+				alignas(32) QXfloat normal[3][width], area[width];
+				for (QXuint k = 0; k < 3; k++)
+					Store(normal[k], cross[k] * inverse);
+				Store(area, length * T(0.5f));
+
+				for (QXuint lane = 0; lane < width; lane++)
+				{
+					if (normals != nullptr)
+						normals[first + lane] = { normal[0][lane], normal[1][lane], normal[2][lane] };
+					if (areas != nullptr)
+						areas[first + lane] = area[lane];
+				}
+			});
+		});
+	}
+
+	void VertexNormals(const QXmeshView& mesh, QXvec3* normals, QXbool parallel)
+	{
+		std::fill(normals, normals + mesh.vertexCount, QXvec3(0.f, 0.f, 0.f));
+
+		std::vector<std::pair<QXuint, std::vector<QXvec3>>>	partials;
+		std::mutex											mutex;
+		QXbool												split{ parallel && mesh.triangleCount >= QX_MESH_PARALLEL_TRIANGLES };
+
+		ParallelFor(mesh.triangleCount, split, [&](QXuint begin, QXuint end)
+		{
+			/* the first chunk sums into normals, the others into their own buffer, so no vertex is written by two threads */
+			std::vector<QXvec3>	buffer;
+			QXvec3*				sums{ normals };
+			if (begin > 0)
+			{
+				buffer.resize(mesh.vertexCount, QXvec3(0.f, 0.f, 0.f));
+				sums = buffer.data();
+			}
+
+			ForEachLane(begin, end, [&](auto lanes, QXuint first)
+			{
+				using T = decltype(lanes);
+				constexpr QXuint width{ sizeof(T) / sizeof(QXfloat) };
+
+				T cross[3];
+				FaceCross(mesh, first, cross);
+
+				alignas(32) QXfloat weighted[3][width];
+				for (QXuint k = 0; k < 3; k++)
+					Store(weighted[k], cross[k]);
+
+				for (QXuint lane = 0; lane < width; lane++)
+				{
+					QXvec3			face{ weighted[0][lane], weighted[1][lane], weighted[2][lane] };
+					const QXuint*	corners{ mesh.indices + 3 * (first + lane) };
+					sums[corners[0]] += face;
+					sums[corners[1]] += face;
+					sums[corners[2]] += face;
+				}
+			});
+
+			if (begin > 0)
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				partials.emplace_back(begin, std::move(buffer));
+			}
+		});
+
+		std::sort(partials.begin(), partials.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+		ParallelFor(mesh.vertexCount, split, [&](QXuint begin, QXuint end)
+		{
+			for (QXuint i = begin; i < end; i++)
+			{
+				for (const auto& partial : partials)
+					normals[i] += partial.second[i];
+				normals[i].Normalize();
+			}
+		});
+	}
+
+	QXvec3 ClosestPoint(const QXmeshView& mesh, const QXvec3& point, QXuint* triangle, QXbool parallel)
+	{
+		QXfloat		best{ FLT_MAX };
+		QXuint		nearest{ mesh.triangleCount };
+		std::mutex	mutex;
+
+		ParallelFor(mesh.triangleCount, parallel && mesh.triangleCount >= QX_MESH_PARALLEL_TRIANGLES, [&](QXuint begin, QXuint end)
+		{
+			QXfloat	chunkBest{ FLT_MAX };
+			QXuint	chunkNearest{ mesh.triangleCount };
+
+			ForEachLane(begin, end, [&](auto lanes, QXuint first)
+			{
+				using T = decltype(lanes);
+				constexpr QXuint width{ sizeof(T) / sizeof(QXfloat) };
+
+				T sqrDistance{ TriangleSqrDistance<T>(mesh, first, point) };
+				if (Mask(Less(sqrDistance, T(chunkBest))) == 0)
+					return;
+
+				alignas(32) QXfloat distances[width];
+				Store(distances, sqrDistance);
+				for (QXuint lane = 0; lane < width; lane++)
+					if (distances[lane] < chunkBest)
+					{
+						chunkBest = distances[lane];
+						chunkNearest = first + lane;
+					}
+			});
+
+			std::lock_guard<std::mutex> lock(mutex);
+			if (chunkBest < best || (chunkBest == best && chunkNearest < nearest))
+			{
+				best = chunkBest;
+				nearest = chunkNearest;
+			}
+		});
+
+		if (triangle != nullptr)
+			*triangle = nearest;
+
+		if (nearest >= mesh.triangleCount)
+			return point;
+
+		return mesh.GetTriangle(nearest).GetClosestPoint(point);
+	}
+
+	#pragma endregion Functions
+}
@@ -0,0 +1,484 @@
+#include "Octree.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Parallel.h"
+
+namespace Math::Geometry
+{
+	#pragma region Static Functions
+
+	static constexpr QXuint	noItem{ ~0u };
+	/* subtrees of this level are built in parallel, 64 of them */
+	static constexpr QXuint	splitLevel{ 2 };
+
+	/* spread the 21 low bits of x to every third bit */
+	static QXuint64	SpreadBits(QXuint64 x) noexcept
+	{
+		x &= 0x1fffff;
+		x = (x | x << 32) & 0x1f00000000ffffull;
+		x = (x | x << 16) & 0x1f0000ff0000ffull;
+		x = (x | x << 8) & 0x100f00f00f00f00full;
+		x = (x | x << 4) & 0x10c30c30c30c30c3ull;
+		x = (x | x << 2) & 0x1249249249249249ull;
+
+		return x;
+	}
+
+	static QXbool	BoxOverlap(const QXvec3& center, const QXvec3& halfSizes, const QXvec3& itemCenter, const QXvec3& itemHalfSizes) noexcept
+	{
+		for (QXuint axis = 0; axis < 3; axis++)
+			if (fabsf(center.e[axis] - itemCenter.e[axis]) > halfSizes.e[axis] + itemHalfSizes.e[axis])
+				return false;
+
+		return true;
+	}
+
+	static QXbool	SphereOverlap(const QXvec3& center, QXfloat radius, const QXvec3& itemCenter, const QXvec3& itemHalfSizes) noexcept
+	{
+		QXfloat sqrDistance{ 0.f };
+		for (QXuint axis = 0; axis < 3; axis++)
+		{
+			QXfloat outside{ std::max(fabsf(center.e[axis] - itemCenter.e[axis]) - itemHalfSizes.e[axis], 0.f) };
+			sqrDistance += outside * outside;
+		}
+
+		return sqrDistance <= radius * radius;
+	}
+
+	static QXbool	FrustumOverlap(const QXplane* planes, QXuint planeCount, const QXvec3& itemCenter, const QXvec3& itemHalfSizes) noexcept
+	{
+		for (QXuint i = 0; i < planeCount; i++)
+		{
+			QXvec3	normal{ planes[i].GetNormal() };
+			QXfloat	reach{ fabsf(normal.x) * itemHalfSizes.x + fabsf(normal.y) * itemHalfSizes.y + fabsf(normal.z) * itemHalfSizes.z };
+
+			if (normal.Dot(itemCenter) + reach < planes[i].GetDistance())
+				return false;
+		}
+
+		return true;
+	}
+
+	/* slab test clipped to [0, 1] along the segment */
+	static QXbool	SegmentOverlap(const QXvec3& a, const QXvec3& ab, const QXvec3& itemCenter, const QXvec3& itemHalfSizes) noexcept
+	{
+		QXfloat enter{ 0.f }, exit{ 1.f };
+
+		for (QXuint axis = 0; axis < 3; axis++)
+		{
+			QXfloat min{ itemCenter.e[axis] - itemHalfSizes.e[axis] }, max{ itemCenter.e[axis] + itemHalfSizes.e[axis] };
+
+			if (ab.e[axis] == 0.f)
+			{
+				if (a.e[axis] < min || a.e[axis] > max)
+					return false;
+				continue;
+			}
+
+			QXfloat inverse{ 1.f / ab.e[axis] };
+			QXfloat t0{ (min - a.e[axis]) * inverse }, t1{ (max - a.e[axis]) * inverse };
+
+			enter = std::max(enter, std::min(t0, t1));
+			exit = std::min(exit, std::max(t0, t1));
+			if (enter > exit)
+				return false;
+		}
+
+		return true;
+	}
+
+	#pragma endregion Static Functions
+
+	#pragma region Constructors/Destructor
+	QXlooseOctree::QXlooseOctree(const QXbox& bounds, QXuint maxDepth) :
+		_center{ bounds.GetPosition() },
+		_halfSize{ std::max(bounds.GetHalfSizes().x, std::max(bounds.GetHalfSizes().y, bounds.GetHalfSizes().z)) },
+		_maxDepth{ std::min(maxDepth, (QXuint)QX_OCTREE_MAX_DEPTH) }
+	{
+		_nodes.push_back({ _center, _halfSize, {}, noItem });
+	}
+	#pragma endregion Constructors/Destructor
+
+	#pragma region Functions
+	QXlooseOctree::QXnode QXlooseOctree::ChildNode(const QXnode& parent, QXuint digit) noexcept
+	{
+		QXfloat halfSize{ parent.halfSize * 0.5f };
+		QXvec3	center{ parent.center + QXvec3(digit & 1 ? halfSize : -halfSize, digit & 2 ? halfSize : -halfSize,
+												digit & 4 ? halfSize : -halfSize) };
+
+		return { center, halfSize, {}, noItem };
+	}
+
+	QXuint QXlooseOctree::Depth(const QXvec3& center, const QXvec3& halfSizes) const noexcept
+	{
+		for (QXuint axis = 0; axis < 3; axis++)
+			if (fabsf(center.e[axis] - _center.e[axis]) > _halfSize)
+				return 0;
+
+		QXfloat extent{ std::max(halfSizes.x, std::max(halfSizes.y, halfSizes.z)) };
+		QXfloat halfSize{ _halfSize };
+		QXuint	depth{ 0 };
+
+		while (depth < _maxDepth && halfSize * 0.5f >= extent)
+		{
+			halfSize *= 0.5f;
+			depth++;
+		}
+
+		return depth;
+	}
+
+	QXuint64 QXlooseOctree::Morton(const QXvec3& center, QXuint depth) const noexcept
+	{
+		QXint	cellCount{ 1 << depth };
+		QXfloat	inverseCellSize{ (QXfloat)cellCount / (2.f * _halfSize) };
+		QXuint64 morton{ 0 };
+
+		/* x is the low bit of each level, as in the child index */
+		for (QXuint axis = 0; axis < 3; axis++)
+		{
+			QXint cell{ (QXint)floorf((center.e[axis] - _center.e[axis] + _halfSize) * inverseCellSize) };
+			morton |= SpreadBits((QXuint64)std::clamp(cell, 0, cellCount - 1)) << axis;
+		}
+
+		return morton;
+	}
+
+	QXuint QXlooseOctree::Descend(std::vector<QXnode>& nodes, QXuint node, QXuint level, QXuint64 morton, QXuint depth) const
+	{
+		for (; level < depth; level++)
+		{
+			QXuint digit{ (QXuint)(morton >> 3 * (depth - level - 1)) & 7 };
+
+			if (nodes[node].children[digit] == 0)
+			{
+				QXnode child{ ChildNode(nodes[node], digit) };
+
+				nodes[node].children[digit] = (QXuint)nodes.size();
+				nodes.push_back(child);
+			}
+
+			node = nodes[node].children[digit];
+		}
+
+		return node;
+	}
+
+	void QXlooseOctree::Link(QXnode& node, QXuint nodeIndex, QXuint item) noexcept
+	{
+		_items[item].node = nodeIndex;
+		_items[item].previous = noItem;
+		_items[item].next = node.firstItem;
+
+		if (node.firstItem != noItem)
+			_items[node.firstItem].previous = item;
+		node.firstItem = item;
+	}
+
+	void QXlooseOctree::Build(std::vector<QXitem>& items, QXbool parallel)
+	{
+		QXuint count{ (QXuint)items.size() };
+		QXuint bucketCount{ 1u << 3 * splitLevel };
+
+		/* sort key: Morton code of the cell scaled to the deepest level, then depth, parents before children */
+		std::vector<std::pair<QXuint64, QXuint>>	keys(count);
+		std::vector<QXuint>							buckets(count);
+
+		ParallelFor(count, parallel, [&](QXuint begin, QXuint end)
+		{
+			for (QXuint i = begin; i < end; i++)
+			{
+				QXuint		depth{ Depth(items[i].center, items[i].halfSizes) };
+				QXuint64	morton{ Morton(items[i].center, depth) };
+
+				keys[i] = { morton << (3 * (QX_OCTREE_MAX_DEPTH - depth) + 5) | depth, i };
+				buckets[i] = depth < splitLevel ? bucketCount : (QXuint)(morton >> 3 * (depth - splitLevel));
+			}
+		});
+
+		/* counting sort on the level 2 subtree, items above it go last, then each subtree is sorted on its own */
+		std::vector<QXuint> bucketStart(bucketCount + 2, 0);
+		for (QXuint i = 0; i < count; i++)
+			bucketStart[buckets[i] + 1]++;
+		for (QXuint b = 0; b <= bucketCount; b++)
+			bucketStart[b + 1] += bucketStart[b];
+
+		std::vector<std::pair<QXuint64, QXuint>> sorted(count);
+		{
+			std::vector<QXuint> next(bucketStart.begin(), bucketStart.end() - 1);
+			for (QXuint i = 0; i < count; i++)
+				sorted[next[buckets[i]]++] = keys[i];
+		}
+
+		_nodes.assign(1, { _center, _halfSize, {}, noItem });
+		_items.resize(count);
+		_slots.assign(count, noItem);
+		_freeHandles.clear();
+		_freeItems.clear();
+
+		ParallelFor(bucketCount + 1, parallel, [&](QXuint begin, QXuint end)
+		{
+			for (QXuint b = begin; b < end; b++)
+			{
+				std::sort(sorted.begin() + bucketStart[b], sorted.begin() + bucketStart[b + 1]);
+
+				for (QXuint k = bucketStart[b]; k < bucketStart[b + 1]; k++)
+				{
+					_items[k] = items[sorted[k].second];
+					_slots[_items[k].handle] = k;
+				}
+			}
+		});
+
+		/* lists are filled backward to stay in memory order, items sharing a key share a node */
+		auto fill = [&](std::vector<QXnode>& nodes, QXuint level, QXuint begin, QXuint end)
+		{
+			QXuint64	lastKey{ ~0ull };
+			QXuint		node{ 0 };
+
+			for (QXuint k = end; k-- > begin;)
+			{
+				QXuint64 key{ sorted[k].first };
+				if (key != lastKey)
+				{
+					QXuint depth{ (QXuint)(key & 31) };
+					node = Descend(nodes, 0, level, key >> (3 * (QX_OCTREE_MAX_DEPTH - depth) + 5), depth);
+					lastKey = key;
+				}
+
+				Link(nodes[node], node, k);
+			}
+		};
+
+		/* items above the split level and the level 1 nodes are made first */
+		fill(_nodes, 0, bucketStart[bucketCount], count);
+
+		std::vector<QXuint> parents(bucketCount, 0);
+		for (QXuint b = 0; b < bucketCount; b++)
+			if (bucketStart[b] != bucketStart[b + 1])
+				parents[b] = Descend(_nodes, 0, 0, b >> 3, 1);
+
+		std::vector<std::vector<QXnode>> subtrees(bucketCount);
+		ParallelFor(bucketCount, parallel, [&](QXuint begin, QXuint end)
+		{
+			for (QXuint b = begin; b < end; b++)
+			{
+				if (bucketStart[b] == bucketStart[b + 1])
+					continue;
+
+				/* local node 0 is the level 2 node of the subtree */
+				subtrees[b].push_back(ChildNode(_nodes[parents[b]], b & 7));
+				fill(subtrees[b], splitLevel, bucketStart[b], bucketStart[b + 1]);
+			}
+		});
+
+		for (QXuint b = 0; b < bucketCount; b++)
+		{
+			if (subtrees[b].empty())
+				continue;
+
+			QXuint offset{ (QXuint)_nodes.size() };
+			_nodes[parents[b]].children[b & 7] = offset;
+
+			for (QXnode& node : subtrees[b])
+			{
+				for (QXuint& child : node.children)
+					if (child != 0)
+						child += offset;
+				_nodes.push_back(node);
+			}
+
+			for (QXuint k = bucketStart[b]; k < bucketStart[b + 1]; k++)
+				_items[k].node += offset;
+		}
+	}
+
+	QXuint QXlooseOctree::Insert(const QXvec3& center, const QXvec3& halfSizes)
+	{
+		QXuint handle;
+		if (_freeHandles.empty())
+		{
+			handle = (QXuint)_slots.size();
+			_slots.push_back(noItem);
+		}
+		else
+		{
+			handle = _freeHandles.back();
+			_freeHandles.pop_back();
+		}
+
+		QXuint item;
+		if (_freeItems.empty())
+		{
+			item = (QXuint)_items.size();
+			_items.emplace_back();
+		}
+		else
+		{
+			item = _freeItems.back();
+			_freeItems.pop_back();
+		}
+
+		_items[item].center = center;
+		_items[item].halfSizes = halfSizes;
+		_items[item].handle = handle;
+		_slots[handle] = item;
+
+		QXuint depth{ Depth(center, halfSizes) };
+		QXuint node{ Descend(_nodes, 0, 0, Morton(center, depth), depth) };
+		Link(_nodes[node], node, item);
+
+		return handle;
+	}
+
+	template<typename NodeTest, typename ItemTest>
+	void QXlooseOctree::Query(NodeTest nodeTest, ItemTest itemTest, std::vector<QXuint>& result) const
+	{
+		/* the root is not tested, it holds the items outside the bounds */
+		std::vector<QXuint> stack(1, 0);
+
+		while (!stack.empty())
+		{
+			const QXnode& node{ _nodes[stack.back()] };
+			stack.pop_back();
+
+			for (QXuint item = node.firstItem; item != noItem; item = _items[item].next)
+				if (itemTest(_items[item].center, _items[item].halfSizes))
+					result.push_back(_items[item].handle);
+
+			for (QXuint child : node.children)
+			{
+				if (child == 0)
+					continue;
+
+				QXfloat looseHalfSize{ _nodes[child].halfSize * QX_OCTREE_LOOSENESS };
+				if (nodeTest(_nodes[child].center, QXvec3(looseHalfSize, looseHalfSize, looseHalfSize)))
+					stack.push_back(child);
+			}
+		}
+	}
+	#pragma endregion Functions
+
+	#pragma region Methods
+	void QXlooseOctree::Build(const QXvec3* points, QXuint count, QXbool parallel)
+	{
+		std::vector<QXitem> items(count);
+		for (QXuint i = 0; i < count; i++)
+			items[i] = { points[i], QXvec3(0.f), i, ~0u, ~0u, ~0u };
+
+		Build(items, parallel);
+	}
+
+	void QXlooseOctree::Build(const QXsphere* spheres, QXuint count, QXbool parallel)
+	{
+		std::vector<QXitem> items(count);
+		for (QXuint i = 0; i < count; i++)
+		{
+			QXfloat radius{ spheres[i].GetRadius() };
+			items[i] = { spheres[i].GetPosition(), QXvec3(radius, radius, radius), i, ~0u, ~0u, ~0u };
+		}
+
+		Build(items, parallel);
+	}
+
+	void QXlooseOctree::Build(const QXbox* boxes, QXuint count, QXbool parallel)
+	{
+		std::vector<QXitem> items(count);
+		for (QXuint i = 0; i < count; i++)
+			items[i] = { boxes[i].GetPosition(), boxes[i].GetHalfSizes(), i, ~0u, ~0u, ~0u };
+
+		Build(items, parallel);
+	}
+
+	QXuint QXlooseOctree::Insert(const QXvec3& point)
+	{
+		return Insert(point, QXvec3(0.f));
+	}
+
+	QXuint QXlooseOctree::Insert(const QXsphere& sphere)
+	{
+		QXfloat radius{ sphere.GetRadius() };
+
+		return Insert(sphere.GetPosition(), QXvec3(radius, radius, radius));
+	}
+
+	QXuint QXlooseOctree::Insert(const QXbox& box)
+	{
+		return Insert(box.GetPosition(), box.GetHalfSizes());
+	}
+
+	QXbool QXlooseOctree::Remove(QXuint handle)
+	{
+		if (handle >= _slots.size() || _slots[handle] == noItem)
+			return false;
+
+		QXuint	item{ _slots[handle] };
+		QXitem&	removed{ _items[item] };
+
+		if (removed.previous != noItem)
+			_items[removed.previous].next = removed.next;
+		else
+			_nodes[removed.node].firstItem = removed.next;
+
+		if (removed.next != noItem)
+			_items[removed.next].previous = removed.previous;
+
+		_slots[handle] = noItem;
+		_freeHandles.push_back(handle);
+		_freeItems.push_back(item);
+
+		return true;
+	}
+
+	void QXlooseOctree::QueryBox(const QXbox& box, std::vector<QXuint>& result) const
+	{
+		QXvec3 center{ box.GetPosition() }, halfSizes{ box.GetHalfSizes() };
+		auto test = [&](const QXvec3& itemCenter, const QXvec3& itemHalfSizes)
+		{
+			return BoxOverlap(center, halfSizes, itemCenter, itemHalfSizes);
+		};
+
+		Query(test, test, result);
+	}
+
+	void QXlooseOctree::QuerySphere(const QXsphere& sphere, std::vector<QXuint>& result) const
+	{
+		QXvec3	center{ sphere.GetPosition() };
+		QXfloat	radius{ sphere.GetRadius() };
+		auto test = [&](const QXvec3& itemCenter, const QXvec3& itemHalfSizes)
+		{
+			return SphereOverlap(center, radius, itemCenter, itemHalfSizes);
+		};
+
+		Query(test, test, result);
+	}
+
+	void QXlooseOctree::QueryFrustum(const QXplane* planes, QXuint planeCount, std::vector<QXuint>& result) const
+	{
+		auto test = [&](const QXvec3& itemCenter, const QXvec3& itemHalfSizes)
+		{
+			return FrustumOverlap(planes, planeCount, itemCenter, itemHalfSizes);
+		};
+
+		Query(test, test, result);
+	}
+
+	void QXlooseOctree::QuerySegment(const QXsegment& segment, std::vector<QXuint>& result) const
+	{
+		QXvec3 a{ segment.GetPointA() }, ab{ segment.GetSegmentAB() };
+		auto test = [&](const QXvec3& itemCenter, const QXvec3& itemHalfSizes)
+		{
+			return SegmentOverlap(a, ab, itemCenter, itemHalfSizes);
+		};
+
+		Query(test, test, result);
+	}
+
+	QXuint QXlooseOctree::Count() const noexcept
+	{
+		return (QXuint)(_slots.size() - _freeHandles.size());
+	}
+	#pragma endregion Methods
+}
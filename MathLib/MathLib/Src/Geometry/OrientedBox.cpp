@@ -7,22 +7,26 @@
 
 namespace Math::Geometry
 {
-	QXorientedBox::QXorientedBox(const QXref3& ref, const QXvec3& halfSizes) noexcept:
+	template<typename T>
+	QXorientedBoxt<T>::QXorientedBoxt(const QXref3t<T>& ref, const QXvec3t<T>& halfSizes) noexcept:
 		_ref {ref},
 		_halfSizes {halfSizes}
 	{}
 
-	QXorientedBox::QXorientedBox(const QXorientedBox& box, const QXfloat& offsetExtention) noexcept :
+	template<typename T>
+	QXorientedBoxt<T>::QXorientedBoxt(const QXorientedBoxt<T>& box, const T& offsetExtention) noexcept :
 		_ref {box._ref},
-		_halfSizes {box._halfSizes + QXvec3(offsetExtention)}
+		_halfSizes {box._halfSizes + QXvec3t<T>(offsetExtention)}
 	{}
 
-	QXorientedBox::QXorientedBox(QXorientedBox&& box) noexcept :
+	template<typename T>
+	QXorientedBoxt<T>::QXorientedBoxt(QXorientedBoxt<T>&& box) noexcept :
 		_ref(std::move(box._ref)),
 		_halfSizes(std::move(box._halfSizes))
 	{}
 
-	QXorientedBox&	QXorientedBox::operator=(const QXorientedBox& box) noexcept
+	template<typename T>
+	QXorientedBoxt<T>&	QXorientedBoxt<T>::operator=(const QXorientedBoxt<T>& box) noexcept
 	{
 		_ref = box._ref;
 		_halfSizes = box._halfSizes;
@@ -30,7 +34,8 @@ namespace Math::Geometry
 		return *this;
 	}
 
-	QXorientedBox&	QXorientedBox::operator=(QXorientedBox&& box) noexcept
+	template<typename T>
+	QXorientedBoxt<T>&	QXorientedBoxt<T>::operator=(QXorientedBoxt<T>&& box) noexcept
 	{
 		_ref = std::move(box._ref);
 		_halfSizes = std::move(box._halfSizes);
@@ -38,11 +43,13 @@ namespace Math::Geometry
 		return *this;
 	}
 
-	QXfloat max(const QXfloat& f1, const QXfloat& f2) { return f1 > f2 ? f1 : f2;}
+	template<typename T>
+	T max(const T& f1, const T& f2) { return f1 > f2 ? f1 : f2;}
 
-	QXbox QXorientedBox::GetAABB() const noexcept
+	template<typename T>
+	QXboxt<T> QXorientedBoxt<T>::GetAABB() const noexcept
 	{
-		QXvec3 verticesLocal[8]
+		QXvec3t<T> verticesLocal[8]
 		{
 			{ _ref.o + _ref.i * _halfSizes.x - _ref.j * _halfSizes.y - _ref.k * _halfSizes.z },
 			{ _ref.o + _ref.i * _halfSizes.x - _ref.j * _halfSizes.y + _ref.k * _halfSizes.z },
@@ -54,14 +61,14 @@ namespace Math::Geometry
 			{ _ref.o - _ref.i * _halfSizes.x + _ref.j * _halfSizes.y - _ref.k * _halfSizes.z }
 		};
 
-		std::vector<QXvec3> vertices_global;
+		std::vector<QXvec3t<T>> vertices_global;
 
 		for (int i = 0; i < 8; i++)
 		{
 			vertices_global.push_back(verticesLocal[i].LocalToWorld(_ref));
 		}
 
-		float xmin = -FLT_MAX, ymin = -FLT_MAX, zmin = -FLT_MAX, xmax = FLT_MAX, ymax = FLT_MAX, zmax = FLT_MAX;
+		T xmin = -FLT_MAX, ymin = -FLT_MAX, zmin = -FLT_MAX, xmax = FLT_MAX, ymax = FLT_MAX, zmax = FLT_MAX;
 		for (int i = 0; i < 8; i++)
 		{
 			if (vertices_global[i].x > xmax)
@@ -80,16 +87,17 @@ namespace Math::Geometry
 				zmin = vertices_global[i].z;
 		}
 
-		return QXbox(_ref.o, QXvec3((xmax - xmin) * 0.5f, (ymax - ymin) * 0.5f, (zmax - zmin) * 0.5f));
+		return QXboxt<T>(_ref.o, QXvec3t<T>((xmax - xmin) * 0.5f, (ymax - ymin) * 0.5f, (zmax - zmin) * 0.5f));
 	}
 
-	QXvec3* QXorientedBox::GetPoints() const noexcept
+	template<typename T>
+	QXvec3t<T>* QXorientedBoxt<T>::GetPoints() const noexcept
 	{
-		QXvec3* array = new QXvec3[8];
+		QXvec3t<T>* array = new QXvec3t<T>[8];
 
-		QXvec3 vx(_ref.i * _halfSizes.x);
-		QXvec3 vy(_ref.j * _halfSizes.y);
-		QXvec3 vz(_ref.k * _halfSizes.z);
+		QXvec3t<T> vx(_ref.i * _halfSizes.x);
+		QXvec3t<T> vy(_ref.j * _halfSizes.y);
+		QXvec3t<T> vz(_ref.k * _halfSizes.z);
 
 		array[0] = _ref.o + vx + vy + vz;
 		array[1] = _ref.o + vx + vy - vz;
@@ -103,82 +111,82 @@ namespace Math::Geometry
 		return array;
 	}
 
-	QXplane QXorientedBox::GetTopPlane() const noexcept
+	template<typename T>
+	QXplanet<T> QXorientedBoxt<T>::GetTopPlane() const noexcept
 	{
-		return QXplane(_ref.j, _ref.o + _ref.j * _halfSizes.y);
+		return QXplanet<T>(_ref.j, _ref.o + _ref.j * _halfSizes.y);
 	}
 
-	QXplane QXorientedBox::GetBottomPlane() const noexcept
+	template<typename T>
+	QXplanet<T> QXorientedBoxt<T>::GetBottomPlane() const noexcept
 	{
-		return QXplane(_ref.j * (-1), _ref.o - _ref.j * _halfSizes.y);
+		return QXplanet<T>(_ref.j * (-1), _ref.o - _ref.j * _halfSizes.y);
 	}
 
-	QXplane QXorientedBox::GetFrontPlane() const noexcept
+	template<typename T>
+	QXplanet<T> QXorientedBoxt<T>::GetFrontPlane() const noexcept
 	{
-		return QXplane(_ref.k, _ref.o + _ref.k * _halfSizes.z);
+		return QXplanet<T>(_ref.k, _ref.o + _ref.k * _halfSizes.z);
 	}
 
-	QXplane QXorientedBox::GetBackPlane() const noexcept
+	template<typename T>
+	QXplanet<T> QXorientedBoxt<T>::GetBackPlane() const noexcept
 	{
-		return QXplane(_ref.k * (-1), _ref.o - _ref.k * _halfSizes.z);
+		return QXplanet<T>(_ref.k * (-1), _ref.o - _ref.k * _halfSizes.z);
 	}
 
-	QXplane QXorientedBox::GetRightPlane() const noexcept
+	template<typename T>
+	QXplanet<T> QXorientedBoxt<T>::GetRightPlane() const noexcept
 	{
-		return QXplane(_ref.i, _ref.o + _ref.i * _halfSizes.x);
+		return QXplanet<T>(_ref.i, _ref.o + _ref.i * _halfSizes.x);
 	}
 
-	QXplane QXorientedBox::GetLeftPlane() const noexcept
+	template<typename T>
+	QXplanet<T> QXorientedBoxt<T>::GetLeftPlane() const noexcept
 	{
-		return QXplane(_ref.i * (-1), _ref.o - _ref.i * _halfSizes.x);
+		return QXplanet<T>(_ref.i * (-1), _ref.o - _ref.i * _halfSizes.x);
 	}
 
-	QXint QXorientedBox::GetNumberPlaneGoodSide(const QXvec3& point) const noexcept
+	template<typename T>
+	QXint QXorientedBoxt<T>::GetNumberPlaneGoodSide(const QXvec3t<T>& point) const noexcept
 	{
-		QXint counter{ 0 };
-
-		if (GetTopPlane().GetSide(point))
-			counter++;
-		if (GetBottomPlane().GetSide(point))
-			counter++;
-		if (GetFrontPlane().GetSide(point))
-			counter++;
-		if (GetBackPlane().GetSide(point))
-			counter++;
-		if (GetRightPlane().GetSide(point))
-			counter++;
-		if (GetLeftPlane().GetSide(point))
-			counter++;
-
-		return counter;
+		/* same test as the six face planes, in the box axes so no plane is built */
+		QXvec3t<T>	offset{ point - _ref.o };
+		T			x{ offset.Dot(_ref.i) }, y{ offset.Dot(_ref.j) }, z{ offset.Dot(_ref.k) };
+
+		return (x > _halfSizes.x) + (-x > _halfSizes.x) + (y > _halfSizes.y) + (-y > _halfSizes.y) + (z > _halfSizes.z) + (-z > _halfSizes.z);
 	}
 
-	QXsegment* QXorientedBox::GetSegmentsWithThisPoint(const QXvec3& point) const noexcept
+	template<typename T>
+	QXsegmentt<T>* QXorientedBoxt<T>::GetSegmentsWithThisPoint(const QXvec3t<T>& point) const noexcept
 	{
-		QXsegment* array = new QXsegment[3];
+		QXsegmentt<T>* array = new QXsegmentt<T>[3];
 
-		QXvec3 localPoint;
+		QXvec3t<T> localPoint;
 
 		localPoint.x = (point - _ref.o).Dot(_ref.i);
 		localPoint.y = (point - _ref.o).Dot(_ref.j);
 		localPoint.z = (point - _ref.o).Dot(_ref.k);
 
-		QXvec3 p1(_ref.o + _ref.i * localPoint.x
+		QXvec3t<T> p1(_ref.o + _ref.i * localPoint.x
 			+ _ref.j * localPoint.y
 			- _ref.k * localPoint.z);
 
-		QXvec3 p2(_ref.o + _ref.i * localPoint.x
+		QXvec3t<T> p2(_ref.o + _ref.i * localPoint.x
 			- _ref.j * localPoint.y
 			+ _ref.k * localPoint.z);
 
-		QXvec3 p3(_ref.o - _ref.i * localPoint.x
+		QXvec3t<T> p3(_ref.o - _ref.i * localPoint.x
 								 + _ref.j * localPoint.y
 								 + _ref.k * localPoint.z);
 
-		array[0] = QXsegment(point, p1);
-		array[1] = QXsegment(point, p2);
-		array[2] = QXsegment(point, p3);
+		array[0] = QXsegmentt<T>(point, p1);
+		array[1] = QXsegmentt<T>(point, p2);
+		array[2] = QXsegmentt<T>(point, p3);
 
 		return array;
 	}
-}
\ No newline at end of file
+
+	template class QXorientedBoxt<QXfloat>;
+	template class QXorientedBoxt<QXdouble>;
+}
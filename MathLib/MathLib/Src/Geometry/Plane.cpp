@@ -3,36 +3,42 @@
 
 namespace Math::Geometry
 {
-	QXplane::QXplane():
+	template<typename T>
+	QXplanet<T>::QXplanet():
 		_normal(0, 1, 0),
 		_d{0}
 	{}
 
-	QXplane::QXplane(const QXplane& plane):
+	template<typename T>
+	QXplanet<T>::QXplanet(const QXplanet<T>& plane):
 		_normal(plane._normal),
 		_d{plane._d}
 	{}
 
-	QXplane::QXplane(QXplane&& plane):
+	template<typename T>
+	QXplanet<T>::QXplanet(QXplanet<T>&& plane):
 		_normal(std::move(plane._normal)),
 		_d{std::move(plane._d)}
 	{}
 
-	QXplane::QXplane(const QXvec3& normal, const QXfloat& d)
+	template<typename T>
+	QXplanet<T>::QXplanet(const QXvec3t<T>& normal, const T& d)
 	{
 		_normal = normal.Normalized();
 		_d = d / normal.Length();
 	}
 
-	QXplane::QXplane(const QXvec3& p1, const QXvec3& p2, const QXvec3& p3)
+	template<typename T>
+	QXplanet<T>::QXplanet(const QXvec3t<T>& p1, const QXvec3t<T>& p2, const QXvec3t<T>& p3)
 	{
-		QXvec3 v1(p2 - p1);
-		QXvec3 v2(p3 - p1);
+		QXvec3t<T> v1(p2 - p1);
+		QXvec3t<T> v2(p3 - p1);
 		_normal = v1.Cross(v2).Normalized();
 		_d = p3.Dot(_normal);
 	}
 
-	QXplane::QXplane(const QXvec3& normal, const QXvec3& p)
+	template<typename T>
+	QXplanet<T>::QXplanet(const QXvec3t<T>& normal, const QXvec3t<T>& p)
 	{
 		_normal = normal.Normalized();
 		_d = p.Dot(_normal);
@@ -41,36 +47,41 @@ namespace Math::Geometry
 
 
 
-	float QXplane::GetDistanceToPoint(const QXvec3& p) const
+	template<typename T>
+	T QXplanet<T>::GetDistanceToPoint(const QXvec3t<T>& p) const
 	{
 		return abs(p.Dot(_normal) - _d) / _normal.Length();
 	}
 
-	QXvec3 QXplane::GetClosestPointOnPlane(const QXvec3& p) const
+	template<typename T>
+	QXvec3t<T> QXplanet<T>::GetClosestPointOnPlane(const QXvec3t<T>& p) const
 	{
-		QXfloat	distance{GetDistanceToPoint(p)};
+		T	distance{GetDistanceToPoint(p)};
 
 		return p + _normal * -distance;
 	}
 
-	bool QXplane::GetSide(const QXvec3& p) const
+	template<typename T>
+	bool QXplanet<T>::GetSide(const QXvec3t<T>& p) const
 	{
 		return (p.Dot(_normal) > _d);
 	}
 
-	bool QXplane::SameSide(const QXvec3& p1, const QXvec3& p2) const
+	template<typename T>
+	bool QXplanet<T>::SameSide(const QXvec3t<T>& p1, const QXvec3t<T>& p2) const
 	{
 		return (GetSide(p1) == GetSide(p2));
 	}
 
 
-	QXvec3 QXplane::PlanesIntersection(const QXplane& plane1, const QXplane& plane2,
-									const QXplane& plane3)
+	template<typename T>
+	QXvec3t<T> QXplanet<T>::PlanesIntersection(const QXplanet<T>& plane1, const QXplanet<T>& plane2,
+									const QXplanet<T>& plane3)
 	{
-		QXmat	matA(plane1._normal, plane2._normal, plane3._normal);
+		QXmat	matA(QXvec3(plane1._normal), QXvec3(plane2._normal), QXvec3(plane3._normal));
 
 		if (matA.Determinant() == 0)
-			return QXvec3(0);
+			return QXvec3t<T>(0);
 
 		QXmat	matB(3, 1);
 
@@ -82,14 +93,18 @@ namespace Math::Geometry
 
 		matX = matA.Inverse() * matB;
 
-		return QXvec3(matX[0][0], matX[1][0], matX[2][0]);
+		return QXvec3t<T>(matX[0][0], matX[1][0], matX[2][0]);
 	}
 
-	QXplane& QXplane::operator=(const QXplane& plane)
+	template<typename T>
+	QXplanet<T>& QXplanet<T>::operator=(const QXplanet<T>& plane)
 	{
 		_normal = plane._normal;
 		_d = plane._d;
 
 		return *this;
 	}
+
+	template class QXplanet<QXfloat>;
+	template class QXplanet<QXdouble>;
 }
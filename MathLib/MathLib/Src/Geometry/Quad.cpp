@@ -4,23 +4,27 @@ namespace Math::Geometry
 {
 	#pragma region Constructors
 
-	QXquad::QXquad(const QXvec3& position, const QXvec3& i, const QXvec3& j, const QXvec3& k,
-			const QXfloat& x, const QXfloat& y) noexcept :
-		_ref {QXref3(position, i, j, k)},
-		_halfSizes {QXvec2(x, y)}
+	template<typename T>
+	QXquadt<T>::QXquadt(const QXvec3t<T>& position, const QXvec3t<T>& i, const QXvec3t<T>& j, const QXvec3t<T>& k,
+			const T& x, const T& y) noexcept :
+		_ref {QXref3t<T>(position, i, j, k)},
+		_halfSizes {QXvec2t<T>(x, y)}
 	{}
 
-	QXquad::QXquad(const QXref3& ref, const QXvec2& halfSizes) noexcept :
+	template<typename T>
+	QXquadt<T>::QXquadt(const QXref3t<T>& ref, const QXvec2t<T>& halfSizes) noexcept :
 		_ref {ref},
 		_halfSizes {halfSizes}
 	{}
 
-	QXquad::QXquad(const QXquad& quad) noexcept :
+	template<typename T>
+	QXquadt<T>::QXquadt(const QXquadt<T>& quad) noexcept :
 		_ref {quad._ref},
 		_halfSizes {quad._halfSizes}
 	{}
 
-	QXquad::QXquad(QXquad&& quad) noexcept:
+	template<typename T>
+	QXquadt<T>::QXquadt(QXquadt<T>&& quad) noexcept:
 		_ref {std::move(quad._ref)},
 		_halfSizes {std::move(quad._halfSizes)}
 	{}
@@ -31,7 +35,8 @@ namespace Math::Geometry
 
 	#pragma region Operators
 
-	QXquad& QXquad::operator=(const QXquad& quad) noexcept
+	template<typename T>
+	QXquadt<T>& QXquadt<T>::operator=(const QXquadt<T>& quad) noexcept
 	{
 		_ref = quad._ref;
 		_halfSizes = quad._halfSizes;
@@ -39,7 +44,8 @@ namespace Math::Geometry
 		return *this;
 	}
 
-	QXquad& QXquad::operator=(QXquad&& quad) noexcept
+	template<typename T>
+	QXquadt<T>& QXquadt<T>::operator=(QXquadt<T>&& quad) noexcept
 	{
 		_ref = std::move(quad._ref);
 		_halfSizes = std::move(quad._halfSizes);
@@ -48,4 +54,7 @@ namespace Math::Geometry
 	}
 	#pragma endregion Operators
 	#pragma endregion Functions
+
+	template class QXquadt<QXfloat>;
+	template class QXquadt<QXdouble>;
 }
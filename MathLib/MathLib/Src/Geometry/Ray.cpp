@@ -0,0 +1,506 @@
+#include "Ray.h"
+
+#include "Simd.h"
+
+namespace Math::Geometry
+{
+	#pragma region Static Functions
+
+	/* a group of rays on one lane type, with the nearest hit of each */
+	template<typename T>
+	struct QXlaneRays
+	{
+		T	origin[3];
+		T	direction[3];
+		T	inverse[3];
+		T	distance;
+		T	normal[3];
+	};
+
+	template<typename T, QXuint N>
+	static QXlaneRays<T> LoadRays(const QXrayPacket<N>& packet, QXuint lane) noexcept
+	{
+		return { { Load<T>(packet.originX + lane), Load<T>(packet.originY + lane), Load<T>(packet.originZ + lane) },
+				{ Load<T>(packet.directionX + lane), Load<T>(packet.directionY + lane), Load<T>(packet.directionZ + lane) },
+				{ Load<T>(packet.inverseX + lane), Load<T>(packet.inverseY + lane), Load<T>(packet.inverseZ + lane) },
+				Load<T>(packet.distance + lane),
+				{ Load<T>(packet.normalX + lane), Load<T>(packet.normalY + lane), Load<T>(packet.normalZ + lane) } };
+	}
+
+	template<typename T, QXuint N>
+	static void StoreHits(QXrayPacket<N>& packet, QXuint lane, const QXlaneRays<T>& rays) noexcept
+	{
+		Store(packet.distance + lane, rays.distance);
+		Store(packet.normalX + lane, rays.normal[0]);
+		Store(packet.normalY + lane, rays.normal[1]);
+		Store(packet.normalZ + lane, rays.normal[2]);
+	}
+
+	static QXlaneRays<QXfloat> LoadRay(const QXray& ray, const QXrayHit& hit) noexcept
+	{
+		return { { ray.origin.x, ray.origin.y, ray.origin.z }, { ray.direction.x, ray.direction.y, ray.direction.z },
+				{ 1.f / ray.direction.x, 1.f / ray.direction.y, 1.f / ray.direction.z }, hit.distance,
+				{ hit.normal.x, hit.normal.y, hit.normal.z } };
+	}
+
+	static QXbool StoreHit(const QXlaneRays<QXfloat>& rays, QXbool closer, QXrayHit& hit) noexcept
+	{
+		if (!closer)
+			return false;
+
+		hit = { rays.distance, QXvec3(rays.normal[0], rays.normal[1], rays.normal[2]), 0 };
+		return true;
+	}
+
+	/* keep the new hits of the lanes where they are closer */
+	template<typename T, typename M>
+	static void Update(QXlaneRays<T>& rays, M closer, T distance, T normalX, T normalY, T normalZ) noexcept
+	{
+		rays.distance = Select(closer, distance, rays.distance);
+		rays.normal[0] = Select(closer, normalX, rays.normal[0]);
+		rays.normal[1] = Select(closer, normalY, rays.normal[1]);
+		rays.normal[2] = Select(closer, normalZ, rays.normal[2]);
+	}
+
+	/* entry and exit distances of the rays through the slabs of a box */
+	template<typename T>
+	static void Slabs(const QXlaneRays<T>& rays, const QXvec3& min, const QXvec3& max, T (&nearT)[3], T (&farT)[3], T& entry, T& exit) noexcept
+	{
+		for (QXuint axis = 0; axis < 3; axis++)
+		{
+			T low{ (T(min.e[axis]) - rays.origin[axis]) * rays.inverse[axis] };
+			T high{ (T(max.e[axis]) - rays.origin[axis]) * rays.inverse[axis] };
+
+			nearT[axis] = Min(low, high);
+			farT[axis] = Max(low, high);
+		}
+
+		entry = Max(nearT[0], Max(nearT[1], nearT[2]));
+		exit = Min(farT[0], Min(farT[1], farT[2]));
+	}
+
+	template<typename T>
+	static auto HitBox(QXlaneRays<T>& rays, const QXbox& box) noexcept
+	{
+		QXvec3	position{ box.GetPosition() }, halfSizes{ box.GetHalfSizes() };
+		T		nearT[3], farT[3], entry, exit;
+		Slabs(rays, position - halfSizes, position + halfSizes, nearT, farT, entry, exit);
+
+		/* rays starting inside hit where they leave */
+		auto	entering{ LessEqual(T(0.f), entry) };
+		T		distance{ Select(entering, entry, exit) };
+		auto	closer{ And(LessEqual(entry, exit), And(LessEqual(T(0.f), distance), Less(distance, rays.distance))) };
+
+		/* the normal is along the slab crossed last when entering, first when leaving */
+		T normal[3];
+		for (QXuint axis = 0; axis < 3; axis++)
+		{
+			T sign{ Select(Less(rays.direction[axis], T(0.f)), T(-1.f), T(1.f)) };
+			normal[axis] = Select(entering, Select(LessEqual(entry, nearT[axis]), -sign, T(0.f)),
+				Select(LessEqual(farT[axis], exit), sign, T(0.f)));
+		}
+
+		Update(rays, closer, distance, normal[0], normal[1], normal[2]);
+		return closer;
+	}
+
+	template<typename T>
+	static auto HitSphere(QXlaneRays<T>& rays, const QXsphere& sphere) noexcept
+	{
+		QXvec3	center{ sphere.GetPosition() };
+		QXfloat	radius{ sphere.GetRadius() };
+		T		offset[3]{ rays.origin[0] - T(center.x), rays.origin[1] - T(center.y), rays.origin[2] - T(center.z) };
+
+		/* a t^2 + 2 b t + c = 0 */
+		T a{ rays.direction[0] * rays.direction[0] + rays.direction[1] * rays.direction[1] + rays.direction[2] * rays.direction[2] };
+		T b{ offset[0] * rays.direction[0] + offset[1] * rays.direction[1] + offset[2] * rays.direction[2] };
+		T c{ offset[0] * offset[0] + offset[1] * offset[1] + offset[2] * offset[2] - T(radius * radius) };
+		T discriminant{ b * b - a * c };
+		T root{ Sqrt(Max(discriminant, T(0.f))) };
+		T first{ (-b - root) / a };
+
+		/* rays starting inside hit where they leave */
+		T		distance{ Select(LessEqual(T(0.f), first), first, (root - b) / a) };
+		auto	closer{ And(LessEqual(T(0.f), discriminant), And(LessEqual(T(0.f), distance), Less(distance, rays.distance))) };
+		T		inverseRadius{ 1.f / radius };
+
+		Update(rays, closer, distance, (offset[0] + rays.direction[0] * distance) * inverseRadius,
+			(offset[1] + rays.direction[1] * distance) * inverseRadius, (offset[2] + rays.direction[2] * distance) * inverseRadius);
+		return closer;
+	}
+
+	template<typename T>
+	static auto HitPlane(QXlaneRays<T>& rays, const QXplane& plane) noexcept
+	{
+		QXvec3	normal{ plane.GetNormal() };
+		T		along{ rays.direction[0] * T(normal.x) + rays.direction[1] * T(normal.y) + rays.direction[2] * T(normal.z) };
+		T		height{ rays.origin[0] * T(normal.x) + rays.origin[1] * T(normal.y) + rays.origin[2] * T(normal.z) };
+
+		/* rays parallel to the plane get an infinite or NaN distance, which is never closer */
+		T		distance{ (T(plane.GetDistance()) - height) / along };
+		auto	closer{ And(LessEqual(T(0.f), distance), Less(distance, rays.distance)) };
+
+		Update(rays, closer, distance, T(normal.x), T(normal.y), T(normal.z));
+		return closer;
+	}
+
+	template<typename T>
+	static auto HitTriangle(QXlaneRays<T>& rays, const QXvec3& a, const QXvec3& b, const QXvec3& c) noexcept
+	{
+		QXvec3	edge1{ b - a }, edge2{ c - a };
+		QXvec3	normal{ edge1.Cross(edge2).Normalized() };
+
+		/* p = direction x edge2, q = s x edge1 */
+		T p[3]{ rays.direction[1] * T(edge2.z) - rays.direction[2] * T(edge2.y), rays.direction[2] * T(edge2.x) - rays.direction[0] * T(edge2.z),
+				rays.direction[0] * T(edge2.y) - rays.direction[1] * T(edge2.x) };
+		T determinant{ T(edge1.x) * p[0] + T(edge1.y) * p[1] + T(edge1.z) * p[2] };
+		T inverse{ T(1.f) / determinant };
+		T s[3]{ rays.origin[0] - T(a.x), rays.origin[1] - T(a.y), rays.origin[2] - T(a.z) };
+		T u{ (s[0] * p[0] + s[1] * p[1] + s[2] * p[2]) * inverse };
+		T q[3]{ s[1] * T(edge1.z) - s[2] * T(edge1.y), s[2] * T(edge1.x) - s[0] * T(edge1.z), s[0] * T(edge1.y) - s[1] * T(edge1.x) };
+		T v{ (rays.direction[0] * q[0] + rays.direction[1] * q[1] + rays.direction[2] * q[2]) * inverse };
+		T distance{ (T(edge2.x) * q[0] + T(edge2.y) * q[1] + T(edge2.z) * q[2]) * inverse };
+
+		auto inside{ And(And(LessEqual(T(0.f), u), LessEqual(T(0.f), v)), LessEqual(u + v, T(1.f))) };
+		auto closer{ And(And(LessEqual(T(QX_RAY_TRIANGLE_EPSILON), Max(determinant, -determinant)), inside),
+			And(LessEqual(T(0.f), distance), Less(distance, rays.distance))) };
+
+		Update(rays, closer, distance, T(normal.x), T(normal.y), T(normal.z));
+		return closer;
+	}
+
+	/* entry and exit distances of the rays through a sphere, FLT_MAX and -FLT_MAX when they miss it */
+	template<typename T>
+	static void SphereInterval(const QXlaneRays<T>& rays, const QXvec3& center, QXfloat radius, T& entry, T& exit) noexcept
+	{
+		T offset[3]{ rays.origin[0] - T(center.x), rays.origin[1] - T(center.y), rays.origin[2] - T(center.z) };
+
+		/* a t^2 + 2 b t + c = 0 */
+		T a{ rays.direction[0] * rays.direction[0] + rays.direction[1] * rays.direction[1] + rays.direction[2] * rays.direction[2] };
+		T b{ offset[0] * rays.direction[0] + offset[1] * rays.direction[1] + offset[2] * rays.direction[2] };
+		T c{ offset[0] * offset[0] + offset[1] * offset[1] + offset[2] * offset[2] - T(radius * radius) };
+		T discriminant{ b * b - a * c };
+		T root{ Sqrt(Max(discriminant, T(0.f))) };
+
+		auto crossing{ LessEqual(T(0.f), discriminant) };
+		entry = Select(crossing, (-b - root) / a, T(FLT_MAX));
+		exit = Select(crossing, (root - b) / a, T(-FLT_MAX));
+	}
+
+	/* entry and exit distances of the rays through the infinite cylinder around a segment, and through the slab between
+	   the planes orthogonal to it at its ends, FLT_MAX and -FLT_MAX when they miss them */
+	template<typename T>
+	static void CylinderIntervals(const QXlaneRays<T>& rays, const QXsegment& segment, QXfloat radius, T& sideEntry, T& sideExit,
+								T& slabEntry, T& slabExit) noexcept
+	{
+		QXvec3	start{ segment.GetPointA() }, axis{ segment.GetSegmentAB() };
+		QXfloat	length{ axis.Dot(axis) };
+		T		offset[3]{ rays.origin[0] - T(start.x), rays.origin[1] - T(start.y), rays.origin[2] - T(start.z) };
+
+		T alongOffset{ offset[0] * T(axis.x) + offset[1] * T(axis.y) + offset[2] * T(axis.z) };
+		T alongDirection{ rays.direction[0] * T(axis.x) + rays.direction[1] * T(axis.y) + rays.direction[2] * T(axis.z) };
+		T squaredDirection{ rays.direction[0] * rays.direction[0] + rays.direction[1] * rays.direction[1] + rays.direction[2] * rays.direction[2] };
+
+		/* a t^2 + 2 b t + c = 0 on the squared distance to the axis, times the squared length of the axis */
+		T a{ T(length) * squaredDirection - alongDirection * alongDirection };
+		T b{ T(length) * (offset[0] * rays.direction[0] + offset[1] * rays.direction[1] + offset[2] * rays.direction[2]) -
+			alongOffset * alongDirection };
+		T c{ T(length) * (offset[0] * offset[0] + offset[1] * offset[1] + offset[2] * offset[2] - T(radius * radius)) -
+			alongOffset * alongOffset };
+		T discriminant{ b * b - a * c };
+		T root{ Sqrt(Max(discriminant, T(0.f))) };
+
+		/* rays parallel to the axis stay inside or outside */
+		auto parallel{ LessEqual(a, T(QX_RAY_AXIS_EPSILON * length) * squaredDirection) };
+		auto inside{ LessEqual(c, T(0.f)) };
+		auto crossing{ LessEqual(T(0.f), discriminant) };
+		sideEntry = Select(parallel, Select(inside, T(-FLT_MAX), T(FLT_MAX)), Select(crossing, (-b - root) / a, T(FLT_MAX)));
+		sideExit = Select(parallel, Select(inside, T(FLT_MAX), T(-FLT_MAX)), Select(crossing, (root - b) / a, T(-FLT_MAX)));
+
+		/* rays orthogonal to the axis stay between the planes or outside */
+		T		low{ -alongOffset / alongDirection }, high{ (T(length) - alongOffset) / alongDirection };
+		auto	orthogonal{ LessEqual(Abs(alongDirection), T(0.f)) };
+		auto	between{ And(LessEqual(T(0.f), alongOffset), LessEqual(alongOffset, T(length))) };
+		slabEntry = Select(orthogonal, Select(between, T(-FLT_MAX), T(FLT_MAX)), Min(low, high));
+		slabExit = Select(orthogonal, Select(between, T(FLT_MAX), T(-FLT_MAX)), Max(low, high));
+	}
+
+	template<typename T>
+	static auto HitCylinder(QXlaneRays<T>& rays, const QXcylinder& cylinder) noexcept
+	{
+		QXsegment	segment{ cylinder.GetSegment() };
+		QXvec3		start{ segment.GetPointA() }, axis{ segment.GetSegmentAB() };
+		QXfloat		length{ axis.Dot(axis) }, radius{ cylinder.GetRadius() };
+
+		if (length <= FLT_MIN)
+			return Less(T(0.f), T(0.f));
+
+		T sideEntry, sideExit, slabEntry, slabExit;
+		CylinderIntervals(rays, segment, radius, sideEntry, sideExit, slabEntry, slabExit);
+
+		/* rays starting inside hit where they leave */
+		T		entry{ Max(sideEntry, slabEntry) }, exit{ Min(sideExit, slabExit) };
+		auto	entering{ LessEqual(T(0.f), entry) };
+		T		distance{ Select(entering, entry, exit) };
+		auto	closer{ And(LessEqual(entry, exit), And(LessEqual(T(0.f), distance), Less(distance, rays.distance))) };
+
+		/* on a cap when the slab is crossed last when entering, first when leaving */
+		auto	cap{ Or(And(entering, LessEqual(sideEntry, slabEntry)), AndNot(LessEqual(slabExit, sideExit), entering)) };
+		T		alongDirection{ rays.direction[0] * T(axis.x) + rays.direction[1] * T(axis.y) + rays.direction[2] * T(axis.z) };
+		T		capSign{ Select(Less(alongDirection, T(0.f)), T(-1.f), T(1.f)) };
+		capSign = Select(entering, -capSign, capSign) * T(1.f / sqrtf(length));
+
+		/* elsewhere away from the axis */
+		T point[3];
+		for (QXuint i = 0; i < 3; i++)
+			point[i] = rays.origin[i] + rays.direction[i] * distance - T(start.e[i]);
+
+		T ratio{ (point[0] * T(axis.x) + point[1] * T(axis.y) + point[2] * T(axis.z)) * T(1.f / length) };
+		T inverseRadius{ 1.f / radius };
+		T normal[3];
+		for (QXuint i = 0; i < 3; i++)
+			normal[i] = Select(cap, capSign * T(axis.e[i]), (point[i] - T(axis.e[i]) * ratio) * inverseRadius);
+
+		Update(rays, closer, distance, normal[0], normal[1], normal[2]);
+		return closer;
+	}
+
+	template<typename T>
+	static auto HitCapsule(QXlaneRays<T>& rays, const QXcapsule& capsule) noexcept
+	{
+		const QXsegment&	segment{ capsule.GetSegment() };
+		QXvec3				start{ segment.GetPointA() }, axis{ segment.GetSegmentAB() };
+		QXfloat				length{ axis.Dot(axis) }, radius{ capsule.GetRadius() }, inverseLength{ 0.f };
+
+		T entry, exit;
+		SphereInterval(rays, start, radius, entry, exit);
+
+		/* union of the three pieces, a capsule with a null axis is a sphere */
+		if (length > FLT_MIN)
+		{
+			inverseLength = 1.f / length;
+
+			T endEntry, endExit, sideEntry, sideExit, slabEntry, slabExit;
+			SphereInterval(rays, segment.GetPointB(), radius, endEntry, endExit);
+			CylinderIntervals(rays, segment, radius, sideEntry, sideExit, slabEntry, slabExit);
+
+			T		middleEntry{ Max(sideEntry, slabEntry) }, middleExit{ Min(sideExit, slabExit) };
+			auto	crossing{ LessEqual(middleEntry, middleExit) };
+			entry = Min(entry, Min(endEntry, Select(crossing, middleEntry, T(FLT_MAX))));
+			exit = Max(exit, Max(endExit, Select(crossing, middleExit, T(-FLT_MAX))));
+		}
+
+		/* rays starting inside hit where they leave */
+		auto	entering{ LessEqual(T(0.f), entry) };
+		T		distance{ Select(entering, entry, exit) };
+		auto	closer{ And(LessEqual(entry, exit), And(LessEqual(T(0.f), distance), Less(distance, rays.distance))) };
+
+		/* the normal points away from the closest point of the segment */
+		T point[3];
+		for (QXuint i = 0; i < 3; i++)
+			point[i] = rays.origin[i] + rays.direction[i] * distance - T(start.e[i]);
+
+		T ratio{ Min(Max((point[0] * T(axis.x) + point[1] * T(axis.y) + point[2] * T(axis.z)) * T(inverseLength), T(0.f)), T(1.f)) };
+		T inverseRadius{ 1.f / radius };
+
+		Update(rays, closer, distance, (point[0] - T(axis.x) * ratio) * inverseRadius, (point[1] - T(axis.y) * ratio) * inverseRadius,
+			(point[2] - T(axis.z) * ratio) * inverseRadius);
+		return closer;
+	}
+
+	/* run a kernel on each group of lanes of a packet, on the widest lanes available, and record the shape index of new hits */
+	template<QXuint N, typename F>
+	static void CastPacket(QXrayPacket<N>& packet, F cast) noexcept
+	{
+		auto castLanes = [&](auto lanes, QXuint lane)
+		{
+			QXlaneRays<decltype(lanes)> rays{ LoadRays<decltype(lanes)>(packet, lane) };
+
+			cast(rays, [&](auto closer, QXuint shape)
+			{
+				for (QXuint bits = Mask(closer), l = lane; bits != 0; bits >>= 1, l++)
+					if (bits & 1)
+						packet.index[l] = shape;
+			});
+
+			StoreHits(packet, lane, rays);
+		};
+
+		QXuint lane{ 0 };
+#if defined(QX_SIMD_AVX)
+		for (; lane + 8 <= N; lane += 8)
+			castLanes(QXlane8(), lane);
+#endif
+#if defined(QX_SIMD_SSE)
+		for (; lane + 4 <= N; lane += 4)
+			castLanes(QXlane4(), lane);
+#endif
+		for (; lane < N; lane++)
+			castLanes(QXfloat(), lane);
+	}
+
+	#pragma endregion Static Functions
+
+	#pragma region Functions
+	QXbool Raycast(const QXray& ray, const QXbox& box, QXrayHit& hit) noexcept
+	{
+		QXlaneRays<QXfloat> rays{ LoadRay(ray, hit) };
+		return StoreHit(rays, HitBox(rays, box), hit);
+	}
+
+	QXbool Raycast(const QXray& ray, const QXsphere& sphere, QXrayHit& hit) noexcept
+	{
+		QXlaneRays<QXfloat> rays{ LoadRay(ray, hit) };
+		return StoreHit(rays, HitSphere(rays, sphere), hit);
+	}
+
+	QXbool Raycast(const QXray& ray, const QXplane& plane, QXrayHit& hit) noexcept
+	{
+		QXlaneRays<QXfloat> rays{ LoadRay(ray, hit) };
+		return StoreHit(rays, HitPlane(rays, plane), hit);
+	}
+
+	QXbool Raycast(const QXray& ray, const QXvec3& a, const QXvec3& b, const QXvec3& c, QXrayHit& hit) noexcept
+	{
+		QXlaneRays<QXfloat> rays{ LoadRay(ray, hit) };
+		return StoreHit(rays, HitTriangle(rays, a, b, c), hit);
+	}
+
+	QXbool Raycast(const QXray& ray, const QXcylinder& cylinder, QXrayHit& hit) noexcept
+	{
+		QXlaneRays<QXfloat> rays{ LoadRay(ray, hit) };
+		return StoreHit(rays, HitCylinder(rays, cylinder), hit);
+	}
+
+	QXbool Raycast(const QXray& ray, const QXcapsule& capsule, QXrayHit& hit) noexcept
+	{
+		QXlaneRays<QXfloat> rays{ LoadRay(ray, hit) };
+		return StoreHit(rays, HitCapsule(rays, capsule), hit);
+	}
+
+	template<QXuint N>
+	void Raycast(QXrayPacket<N>& packet, const QXbox* boxes, QXuint count) noexcept
+	{
+		CastPacket(packet, [&](auto& rays, auto record)
+		{
+			for (QXuint i = 0; i < count; i++)
+				record(HitBox(rays, boxes[i]), i);
+		});
+	}
+
+	template<QXuint N>
+	void Raycast(QXrayPacket<N>& packet, const QXsphere* spheres, QXuint count) noexcept
+	{
+		CastPacket(packet, [&](auto& rays, auto record)
+		{
+			for (QXuint i = 0; i < count; i++)
+				record(HitSphere(rays, spheres[i]), i);
+		});
+	}
+
+	template<QXuint N>
+	void Raycast(QXrayPacket<N>& packet, const QXplane* planes, QXuint count) noexcept
+	{
+		CastPacket(packet, [&](auto& rays, auto record)
+		{
+			for (QXuint i = 0; i < count; i++)
+				record(HitPlane(rays, planes[i]), i);
+		});
+	}
+
+	template<QXuint N>
+	void Raycast(QXrayPacket<N>& packet, const QXvec3* vertices, const QXuint* indices, QXuint count) noexcept
+	{
+		CastPacket(packet, [&](auto& rays, auto record)
+		{
+			for (QXuint i = 0; i < count; i++)
+				record(HitTriangle(rays, vertices[indices[3 * i]], vertices[indices[3 * i + 1]], vertices[indices[3 * i + 2]]), i);
+		});
+	}
+
+	template<QXuint N>
+	void Raycast(QXrayPacket<N>& packet, const QXcylinder* cylinders, QXuint count) noexcept
+	{
+		CastPacket(packet, [&](auto& rays, auto record)
+		{
+			for (QXuint i = 0; i < count; i++)
+				record(HitCylinder(rays, cylinders[i]), i);
+		});
+	}
+
+	template<QXuint N>
+	void Raycast(QXrayPacket<N>& packet, const QXcapsule* capsules, QXuint count) noexcept
+	{
+		CastPacket(packet, [&](auto& rays, auto record)
+		{
+			for (QXuint i = 0; i < count; i++)
+				record(HitCapsule(rays, capsules[i]), i);
+		});
+	}
+
+	template<QXuint N>
+	QXuint IntersectBounds(const QXrayPacket<N>& packet, const QXbox& bounds, QXfloat* entry) noexcept
+	{
+		QXvec3	position{ bounds.GetPosition() }, halfSizes{ bounds.GetHalfSizes() };
+		QXvec3	min{ position - halfSizes }, max{ position + halfSizes };
+		QXuint	mask{ 0 };
+		QXfloat	entries[N];
+
+		auto testLanes = [&](auto lanes, QXuint lane)
+		{
+			using T = decltype(lanes);
+
+			QXlaneRays<T>	rays{ LoadRays<T>(packet, lane) };
+			T				nearT[3], farT[3], enter, exit;
+			Slabs(rays, min, max, nearT, farT, enter, exit);
+
+			mask |= Mask(And(LessEqual(enter, exit), And(LessEqual(T(0.f), exit), Less(enter, rays.distance)))) << lane;
+			Store(entries + lane, Max(enter, T(0.f)));
+		};
+
+		QXuint lane{ 0 };
+#if defined(QX_SIMD_AVX)
+		for (; lane + 8 <= N; lane += 8)
+			testLanes(QXlane8(), lane);
+#endif
+#if defined(QX_SIMD_SSE)
+		for (; lane + 4 <= N; lane += 4)
+			testLanes(QXlane4(), lane);
+#endif
+		for (; lane < N; lane++)
+			testLanes(QXfloat(), lane);
+
+		if (entry != nullptr)
+		{
+			*entry = FLT_MAX;
+			for (QXuint l = 0; l < N; l++)
+				if (mask >> l & 1)
+					*entry = Min(*entry, entries[l]);
+		}
+
+		return mask;
+	}
+
+	template void	Raycast(QXrayPacket4&, const QXbox*, QXuint) noexcept;
+	template void	Raycast(QXrayPacket8&, const QXbox*, QXuint) noexcept;
+	template void	Raycast(QXrayPacket16&, const QXbox*, QXuint) noexcept;
+	template void	Raycast(QXrayPacket4&, const QXsphere*, QXuint) noexcept;
+	template void	Raycast(QXrayPacket8&, const QXsphere*, QXuint) noexcept;
+	template void	Raycast(QXrayPacket16&, const QXsphere*, QXuint) noexcept;
+	template void	Raycast(QXrayPacket4&, const QXplane*, QXuint) noexcept;
+	template void	Raycast(QXrayPacket8&, const QXplane*, QXuint) noexcept;
+	template void	Raycast(QXrayPacket16&, const QXplane*, QXuint) noexcept;
+	template void	Raycast(QXrayPacket4&, const QXvec3*, const QXuint*, QXuint) noexcept;
+	template void	Raycast(QXrayPacket8&, const QXvec3*, const QXuint*, QXuint) noexcept;
+	template void	Raycast(QXrayPacket16&, const QXvec3*, const QXuint*, QXuint) noexcept;
+	template void	Raycast(QXrayPacket4&, const QXcylinder*, QXuint) noexcept;
+	template void	Raycast(QXrayPacket8&, const QXcylinder*, QXuint) noexcept;
+	template void	Raycast(QXrayPacket16&, const QXcylinder*, QXuint) noexcept;
+	template void	Raycast(QXrayPacket4&, const QXcapsule*, QXuint) noexcept;
+	template void	Raycast(QXrayPacket8&, const QXcapsule*, QXuint) noexcept;
+	template void	Raycast(QXrayPacket16&, const QXcapsule*, QXuint) noexcept;
+	template QXuint	IntersectBounds(const QXrayPacket4&, const QXbox&, QXfloat*) noexcept;
+	template QXuint	IntersectBounds(const QXrayPacket8&, const QXbox&, QXfloat*) noexcept;
+	template QXuint	IntersectBounds(const QXrayPacket16&, const QXbox&, QXfloat*) noexcept;
+	#pragma endregion Functions
+}
@@ -2,26 +2,33 @@
 
 namespace Math::Geometry
 {
-	QXsegment::QXsegment(const QXvec3& a, const QXvec3& b) :
+	template<typename T>
+	QXsegmentt<T>::QXsegmentt(const QXvec3t<T>& a, const QXvec3t<T>& b) :
 		_a{ a },
 		_b{ b }
 	{}
 
-	QXsegment::QXsegment(const QXsegment& seg):
+	template<typename T>
+	QXsegmentt<T>::QXsegmentt(const QXsegmentt<T>& seg):
 		_a{ seg._a },
 		_b{ seg._b }
 	{}
 
-	QXsegment::QXsegment(QXsegment&& seg) noexcept:
+	template<typename T>
+	QXsegmentt<T>::QXsegmentt(QXsegmentt<T>&& seg) noexcept:
 		_a{ std::move(seg._a) },
 		_b{ std::move(seg._b) }
 	{}
 
-	QXsegment& QXsegment::operator=(const QXsegment& seg)
+	template<typename T>
+	QXsegmentt<T>& QXsegmentt<T>::operator=(const QXsegmentt<T>& seg)
 	{
 		_a = seg._a;
 		_b = seg._b;
 
 		return *this;
 	}
+
+	template class QXsegmentt<QXfloat>;
+	template class QXsegmentt<QXdouble>;
 }
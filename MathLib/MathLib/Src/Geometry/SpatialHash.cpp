@@ -0,0 +1,209 @@
+#include "SpatialHash.h"
+
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+
+#include "Hash.h"
+#include "Parallel.h"
+
+namespace Math::Geometry
+{
+	#pragma region Constructors/Destructor
+	QXspatialHashGrid::QXspatialHashGrid(QXfloat cellSize) :
+		_cellSize{ cellSize },
+		_inverseCellSize{ 1.f / cellSize },
+		_maxRadius{ 0.f },
+		_bucketMask{ QX_SPATIAL_HASH_MIN_BUCKETS - 1 },
+		_bucketStart(QX_SPATIAL_HASH_MIN_BUCKETS + 1, 0)
+	{}
+	#pragma endregion Constructors/Destructor
+
+	#pragma region Static Functions
+	/* cell of a coordinate, clamped so the cast cannot overflow, NaN goes to the lowest cell */
+	static QXint Cell(QXfloat coordinate) noexcept
+	{
+		constexpr QXfloat limit{ 1073741824.f };
+
+		QXfloat cell{ floorf(coordinate) };
+		if (!(cell > -limit))
+			return -(QXint)limit;
+		if (cell > limit)
+			return (QXint)limit;
+
+		return (QXint)cell;
+	}
+	#pragma endregion Static Functions
+
+	#pragma region Methods
+	QXuint QXspatialHashGrid::Bucket(QXint x, QXint y, QXint z) const noexcept
+	{
+		/* odd 64 bits constants spread the cell coordinates before the mix, so near cells land in far buckets */
+		QXuint64 h{ (QXuint64)(QXuint)x * 0x9e3779b97f4a7c15ull + (QXuint64)(QXuint)y * 0xc2b2ae3d27d4eb4full +
+					(QXuint64)(QXuint)z * 0x165667b19e3779f9ull };
+
+		return (QXuint)HashMix(h) & _bucketMask;
+	}
+
+	void QXspatialHashGrid::Build(const QXvec3* positions, const QXfloat* radii, QXuint count, QXbool parallel)
+	{
+		QXuint bucketCount{ QX_SPATIAL_HASH_MIN_BUCKETS };
+		while (bucketCount < 2 * count)
+			bucketCount *= 2;
+		_bucketMask = bucketCount - 1;
+
+		std::vector<QXuint> bucketOf(count);
+		ParallelFor(count, parallel, [&](QXuint begin, QXuint end)
+		{
+			for (QXuint i = begin; i < end; i++)
+				bucketOf[i] = Bucket(Cell(positions[i].x * _inverseCellSize), Cell(positions[i].y * _inverseCellSize),
+									Cell(positions[i].z * _inverseCellSize));
+		});
+
+		/* counting sort: count, exclusive scan, scatter (each start moves to its end), shift back */
+		_bucketStart.assign(bucketCount + 1, 0);
+		for (QXuint i = 0; i < count; i++)
+			_bucketStart[bucketOf[i]]++;
+
+		QXuint sum{ 0 };
+		for (QXuint b = 0; b <= bucketCount; b++)
+		{
+			QXuint bucketSize{ _bucketStart[b] };
+			_bucketStart[b] = sum;
+			sum += bucketSize;
+		}
+
+		_indices.resize(count);
+		for (QXuint i = 0; i < count; i++)
+			_indices[_bucketStart[bucketOf[i]]++] = i;
+
+		for (QXuint b = bucketCount; b > 0; b--)
+			_bucketStart[b] = _bucketStart[b - 1];
+		_bucketStart[0] = 0;
+
+		_positions.resize(count);
+		_radii.resize(radii != nullptr ? count : 0);
+		ParallelFor(count, parallel, [&](QXuint begin, QXuint end)
+		{
+			for (QXuint k = begin; k < end; k++)
+			{
+				_positions[k] = positions[_indices[k]];
+				if (radii != nullptr)
+					_radii[k] = radii[_indices[k]];
+			}
+		});
+
+		_maxRadius = _radii.empty() ? 0.f : *std::max_element(_radii.begin(), _radii.end());
+	}
+
+	void QXspatialHashGrid::Build(const QXvec3* points, QXuint count, QXbool parallel)
+	{
+		Build(points, nullptr, count, parallel);
+	}
+
+	void QXspatialHashGrid::Build(const QXsphere* spheres, QXuint count, QXbool parallel)
+	{
+		std::vector<QXvec3>		positions(count);
+		std::vector<QXfloat>	radii(count);
+
+		for (QXuint i = 0; i < count; i++)
+		{
+			positions[i] = spheres[i].GetPosition();
+			radii[i] = spheres[i].GetRadius();
+		}
+
+		Build(positions.data(), radii.data(), count, parallel);
+	}
+
+	void QXspatialHashGrid::FindBuckets(const QXvec3& center, QXfloat extent, std::vector<QXuint>& buckets) const
+	{
+		buckets.clear();
+
+		QXint minX{ Cell((center.x - extent) * _inverseCellSize) }, maxX{ Cell((center.x + extent) * _inverseCellSize) };
+		QXint minY{ Cell((center.y - extent) * _inverseCellSize) }, maxY{ Cell((center.y + extent) * _inverseCellSize) };
+		QXint minZ{ Cell((center.z - extent) * _inverseCellSize) }, maxZ{ Cell((center.z + extent) * _inverseCellSize) };
+
+		/* more cells than buckets: every bucket is visited, the items are filtered on their distance anyway */
+		QXuint		bucketCount{ _bucketMask + 1 };
+		QXdouble	cellCount{ ((QXdouble)maxX - minX + 1.) * ((QXdouble)maxY - minY + 1.) * ((QXdouble)maxZ - minZ + 1.) };
+		if (cellCount >= bucketCount)
+		{
+			buckets.resize(bucketCount);
+			for (QXuint b = 0; b < bucketCount; b++)
+				buckets[b] = b;
+			return;
+		}
+
+		for (QXint x = minX; x <= maxX; x++)
+			for (QXint y = minY; y <= maxY; y++)
+				for (QXint z = minZ; z <= maxZ; z++)
+					buckets.push_back(Bucket(x, y, z));
+
+		/* two cells can share a bucket, its items must be visited once */
+		std::sort(buckets.begin(), buckets.end());
+		buckets.erase(std::unique(buckets.begin(), buckets.end()), buckets.end());
+	}
+
+	void QXspatialHashGrid::QueryRadius(const QXvec3& center, QXfloat radius, std::vector<QXuint>& result) const
+	{
+		std::vector<QXuint> buckets;
+		FindBuckets(center, radius + _maxRadius, buckets);
+
+		for (QXuint bucket : buckets)
+		{
+			for (QXuint k = _bucketStart[bucket]; k < _bucketStart[bucket + 1]; k++)
+			{
+				QXfloat reach{ _radii.empty() ? radius : radius + _radii[k] };
+				QXvec3	delta{ _positions[k] - center };
+
+				if (delta.Dot(delta) <= reach * reach)
+					result.push_back(_indices[k]);
+			}
+		}
+	}
+
+	void QXspatialHashGrid::FindPairs(QXfloat distance, std::vector<std::pair<QXuint, QXuint>>& pairs, QXbool parallel) const
+	{
+		std::mutex mutex;
+
+		ParallelFor(Count(), parallel, [&](QXuint begin, QXuint end)
+		{
+			std::vector<QXuint>						buckets;
+			std::vector<std::pair<QXuint, QXuint>>	found;
+
+			for (QXuint k = begin; k < end; k++)
+			{
+				QXfloat radius{ _radii.empty() ? 0.f : _radii[k] };
+				FindBuckets(_positions[k], distance + radius + _maxRadius, buckets);
+
+				for (QXuint bucket : buckets)
+				{
+					/* pairs are kept from the item sorted first only */
+					for (QXuint m = std::max(_bucketStart[bucket], k + 1); m < _bucketStart[bucket + 1]; m++)
+					{
+						QXfloat reach{ _radii.empty() ? distance : distance + radius + _radii[m] };
+						QXvec3	delta{ _positions[m] - _positions[k] };
+
+						if (delta.Dot(delta) <= reach * reach)
+							found.emplace_back(std::min(_indices[k], _indices[m]), std::max(_indices[k], _indices[m]));
+					}
+				}
+			}
+
+			std::lock_guard<std::mutex> lock(mutex);
+			pairs.insert(pairs.end(), found.begin(), found.end());
+		});
+	}
+
+	QXuint QXspatialHashGrid::Count() const noexcept
+	{
+		return (QXuint)_indices.size();
+	}
+
+	void QXspatialHashGrid::SetCellSize(QXfloat cellSize) noexcept
+	{
+		_cellSize = cellSize;
+		_inverseCellSize = 1.f / cellSize;
+	}
+	#pragma endregion Methods
+}
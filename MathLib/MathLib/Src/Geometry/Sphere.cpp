@@ -2,26 +2,33 @@
 
 namespace Math::Geometry
 {
-	QXsphere::QXsphere(const QXvec3& position, const QXfloat& radius):
+	template<typename T>
+	QXspheret<T>::QXspheret(const QXvec3t<T>& position, const T& radius):
 		_position{position},
 		_radius{radius}
 	{}
 
-	QXsphere::QXsphere(const QXsphere& sphere):
+	template<typename T>
+	QXspheret<T>::QXspheret(const QXspheret<T>& sphere):
 		_position{sphere._position},
 		_radius{sphere._radius}
 	{}
 
-	QXsphere::QXsphere(QXsphere&& sphere):
+	template<typename T>
+	QXspheret<T>::QXspheret(QXspheret<T>&& sphere):
 		_position{std::move(sphere._position)},
 		_radius{std::move(sphere._radius)}
 	{}
 
-	QXsphere& QXsphere::operator=(const QXsphere& sphere)
+	template<typename T>
+	QXspheret<T>& QXspheret<T>::operator=(const QXspheret<T>& sphere)
 	{
 		_position = sphere._position;
 		_radius = sphere._radius;
 
 		return *this;
 	}
+
+	template class QXspheret<QXfloat>;
+	template class QXspheret<QXdouble>;
 }
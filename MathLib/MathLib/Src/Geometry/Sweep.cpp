@@ -0,0 +1,404 @@
+#include "Sweep.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Gjk.h"
+#include "Maths.hpp"
+#include "Parallel.h"
+
+namespace Math::Geometry
+{
+	#pragma region Static Functions
+
+	/* time in [0, 1] where |x + v t|^2 = r^2 is entered, from a t^2 + b t + c = 0, a > 0 */
+	static QXbool EnteringRoot(QXfloat a, QXfloat b, QXfloat c, QXfloat& time) noexcept
+	{
+		QXfloat root{ QuadraticSolver(a, b, c) };
+
+		/* the smallest root in range is an exit when the shapes overlap before the motion */
+		if (root < 0.f || root > 1.f || 2.f * a * root + b >= 0.f)
+			return false;
+
+		time = root;
+		return true;
+	}
+
+	/* replace the hit when the contact is earlier */
+	static QXbool Keep(QXfloat time, const QXvec3& normal, const QXvec3& point, QXsweepHit& hit) noexcept
+	{
+		if (time >= hit.time)
+			return false;
+
+		hit = { time, normal, point, 0 };
+		return true;
+	}
+
+	/* sphere against the capsule around segment [a, b], without the start overlap */
+	static QXbool SweepCapsule(const QXvec3& center, const QXvec3& motion, QXfloat radius, const QXvec3& a, const QXvec3& b,
+								QXsweepHit& hit) noexcept
+	{
+		QXvec3	axis{ b - a }, offset{ center - a };
+		QXfloat	sqrLength{ axis.Dot(axis) };
+		QXbool	found{ false };
+		QXfloat	time{ 0.f };
+
+		/* side of the capsule: the infinite cylinder, then the contact must project inside the segment */
+		if (sqrLength > 0.f)
+		{
+			QXvec3	radial{ offset - axis * (offset.Dot(axis) / sqrLength) };
+			QXvec3	radialMotion{ motion - axis * (motion.Dot(axis) / sqrLength) };
+			QXfloat	speed{ radialMotion.Dot(radialMotion) };
+
+			if (speed > 0.f && EnteringRoot(speed, 2.f * radial.Dot(radialMotion), radial.Dot(radial) - radius * radius, time))
+			{
+				QXvec3	position{ center + motion * time };
+				QXfloat	along{ (position - a).Dot(axis) / sqrLength };
+
+				if (along >= 0.f && along <= 1.f)
+				{
+					QXvec3 closest{ a + axis * along };
+					found |= Keep(time, (position - closest).Normalized(), closest, hit);
+				}
+			}
+		}
+
+		/* caps: spheres around both ends */
+		QXfloat speed{ motion.Dot(motion) };
+		for (const QXvec3& end : { a, b })
+		{
+			QXvec3 toCenter{ center - end };
+			if (speed > 0.f && EnteringRoot(speed, 2.f * toCenter.Dot(motion), toCenter.Dot(toCenter) - radius * radius, time))
+				found |= Keep(time, (toCenter + motion * time).Normalized(), end, hit);
+		}
+
+		return found;
+	}
+
+	/* sphere against a box centered at the origin of its axes: faces pushed out by the radius, then capsules around the edges */
+	static QXbool SweepLocalBox(const QXvec3& center, const QXvec3& motion, QXfloat radius, const QXvec3& halfSizes, QXsweepHit& hit) noexcept
+	{
+		/* already touching: closest point of the box */
+		QXvec3 closest{ Clamp(-halfSizes.x, halfSizes.x, center.x), Clamp(-halfSizes.y, halfSizes.y, center.y),
+						Clamp(-halfSizes.z, halfSizes.z, center.z) };
+		QXvec3 outside{ center - closest };
+		if (outside.Dot(outside) <= radius * radius)
+		{
+			QXvec3 normal;
+			if (outside.Dot(outside) > 0.f)
+				normal = outside.Normalized();
+			else
+			{
+				/* center inside: the face it is closest to */
+				QXuint axis{ 0 };
+				for (QXuint i = 1; i < 3; i++)
+					if (halfSizes.e[i] - std::abs(center.e[i]) < halfSizes.e[axis] - std::abs(center.e[axis]))
+						axis = i;
+				normal.e[axis] = center.e[axis] >= 0.f ? 1.f : -1.f;
+			}
+
+			return Keep(0.f, normal, closest, hit);
+		}
+
+		/* cheap reject: the motion misses the box inflated by the radius, or enters it after the previous hit */
+		QXfloat enter{ 0.f }, leave{ std::min(1.f, hit.time) };
+		for (QXuint axis = 0; axis < 3; axis++)
+		{
+			QXfloat extent{ halfSizes.e[axis] + radius };
+			if (motion.e[axis] == 0.f)
+			{
+				if (std::abs(center.e[axis]) > extent)
+					return false;
+				continue;
+			}
+
+			QXfloat inverse{ 1.f / motion.e[axis] };
+			QXfloat low{ (-extent - center.e[axis]) * inverse }, high{ (extent - center.e[axis]) * inverse };
+			enter = std::max(enter, std::min(low, high));
+			leave = std::min(leave, std::max(low, high));
+		}
+		if (enter > leave)
+			return false;
+
+		QXbool found{ false };
+		for (QXuint axis = 0; axis < 3; axis++)
+		{
+			if (motion.e[axis] == 0.f)
+				continue;
+
+			/* the face turned towards the start */
+			QXfloat side{ motion.e[axis] < 0.f ? 1.f : -1.f };
+			QXfloat time{ (side * (halfSizes.e[axis] + radius) - center.e[axis]) / motion.e[axis] };
+			if (time < 0.f || time > 1.f)
+				continue;
+
+			QXvec3	position{ center + motion * time };
+			QXuint	u{ (axis + 1) % 3 }, v{ (axis + 2) % 3 };
+			if (std::abs(position.e[u]) <= halfSizes.e[u] && std::abs(position.e[v]) <= halfSizes.e[v])
+			{
+				QXvec3 normal;
+				normal.e[axis] = side;
+				found |= Keep(time, normal, position - normal * radius, hit);
+			}
+		}
+
+		/* edges along each axis, a flat side has its edges only once */
+		for (QXuint axis = 0; axis < 3; axis++)
+		{
+			QXuint u{ (axis + 1) % 3 }, v{ (axis + 2) % 3 };
+			for (QXfloat signU : { -1.f, 1.f })
+			{
+				if (signU < 0.f && halfSizes.e[u] == 0.f)
+					continue;
+
+				for (QXfloat signV : { -1.f, 1.f })
+				{
+					if (signV < 0.f && halfSizes.e[v] == 0.f)
+						continue;
+
+					QXvec3 a, b;
+					a.e[axis] = -halfSizes.e[axis];
+					b.e[axis] = halfSizes.e[axis];
+					a.e[u] = b.e[u] = signU * halfSizes.e[u];
+					a.e[v] = b.e[v] = signV * halfSizes.e[v];
+
+					found |= SweepCapsule(center, motion, radius, a, b, hit);
+				}
+			}
+		}
+
+		return found;
+	}
+
+	/* sweep in the axes of a box, then bring the hit back to world space */
+	static QXbool SweepOrientedBox(const QXsphere& sphere, const QXvec3& motion, const QXref3& ref, const QXvec3& halfSizes, QXsweepHit& hit) noexcept
+	{
+		QXvec3 offset{ sphere.GetPosition() - ref.o };
+		QXvec3 center{ offset.Dot(ref.i), offset.Dot(ref.j), offset.Dot(ref.k) };
+		QXvec3 localMotion{ motion.Dot(ref.i), motion.Dot(ref.j), motion.Dot(ref.k) };
+
+		QXsweepHit local{ hit };
+		if (!SweepLocalBox(center, localMotion, sphere.GetRadius(), halfSizes, local))
+			return false;
+
+		hit = { local.time, ref.i * local.normal.x + ref.j * local.normal.y + ref.k * local.normal.z,
+				ref.o + ref.i * local.point.x + ref.j * local.point.y + ref.k * local.point.z, 0 };
+		return true;
+	}
+
+	/* rotate a vector by an axis times angle (Rodrigues) */
+	static QXvec3 Rotate(const QXvec3& vector, const QXvec3& rotation) noexcept
+	{
+		QXfloat angle{ rotation.Length() };
+		if (angle <= FLT_MIN)
+			return vector;
+
+		QXvec3	axis{ rotation / angle };
+		QXfloat	cosine{ cosf(angle) }, sine{ sinf(angle) };
+
+		return vector * cosine + axis.Cross(vector) * sine + axis * (axis.Dot(vector) * (1.f - cosine));
+	}
+
+	static QXorientedBox MoveBox(const QXorientedBox& box, const QXvec3& motion, const QXvec3& rotation, QXfloat time) noexcept
+	{
+		QXref3	ref{ box.GetRef() };
+		QXvec3	turn{ rotation * time };
+
+		return QXorientedBox(QXref3(ref.o + motion * time, Rotate(ref.i, turn), Rotate(ref.j, turn), Rotate(ref.k, turn)), box.GetHalfSizes());
+	}
+
+	#pragma endregion Static Functions
+
+	#pragma region Functions
+	QXbool SweepSphere(const QXsphere& sphere, const QXvec3& motion, const QXsphere& obstacle, QXsweepHit& hit) noexcept
+	{
+		QXvec3	offset{ sphere.GetPosition() - obstacle.GetPosition() };
+		QXfloat	radius{ sphere.GetRadius() + obstacle.GetRadius() };
+		QXfloat	time{ 0.f };
+
+		if (offset.Dot(offset) > radius * radius)
+		{
+			QXfloat speed{ motion.Dot(motion) };
+			if (speed <= 0.f || !EnteringRoot(speed, 2.f * offset.Dot(motion), offset.Dot(offset) - radius * radius, time))
+				return false;
+		}
+
+		QXvec3 normal{ offset + motion * time };
+		normal = normal.Dot(normal) > 0.f ? normal.Normalized() : QXvec3(0.f, 1.f, 0.f);
+
+		return Keep(time, normal, obstacle.GetPosition() + normal * obstacle.GetRadius(), hit);
+	}
+
+	QXbool SweepSphere(const QXsphere& sphere, const QXvec3& motion, const QXplane& plane, QXsweepHit& hit) noexcept
+	{
+		QXvec3	normal{ plane.GetNormal() };
+		QXvec3	center{ sphere.GetPosition() };
+		QXfloat	radius{ sphere.GetRadius() };
+		QXfloat	height{ normal.Dot(center) - plane.GetDistance() };
+		QXfloat	side{ height >= 0.f ? 1.f : -1.f };
+
+		if (height * side <= radius)
+			return Keep(0.f, normal * side, center - normal * height, hit);
+
+		QXfloat approach{ normal.Dot(motion) * side };
+		if (approach >= 0.f)
+			return false;
+
+		QXfloat time{ (radius - height * side) / approach };
+		if (time > 1.f)
+			return false;
+
+		return Keep(time, normal * side, center + motion * time - normal * (radius * side), hit);
+	}
+
+	QXbool SweepSphere(const QXsphere& sphere, const QXvec3& motion, const QXbox& box, QXsweepHit& hit) noexcept
+	{
+		return SweepOrientedBox(sphere, motion, QXref3(box.GetPosition()), box.GetHalfSizes(), hit);
+	}
+
+	QXbool SweepSphere(const QXsphere& sphere, const QXvec3& motion, const QXorientedBox& box, QXsweepHit& hit) noexcept
+	{
+		return SweepOrientedBox(sphere, motion, box.GetRef(), box.GetHalfSizes(), hit);
+	}
+
+	QXbool SweepSphere(const QXsphere& sphere, const QXvec3& motion, const QXquad& quad, QXsweepHit& hit) noexcept
+	{
+		QXvec2 halfSizes{ quad.GetHalfSizes() };
+		return SweepOrientedBox(sphere, motion, quad.GetRef(), QXvec3(halfSizes.x, halfSizes.y, 0.f), hit);
+	}
+
+	QXbool SweepSphere(const QXsphere& sphere, const QXvec3& motion, const QXsegment& segment, QXsweepHit& hit) noexcept
+	{
+		QXvec3	center{ sphere.GetPosition() }, a{ segment.GetPointA() }, axis{ segment.GetSegmentAB() };
+		QXfloat	radius{ sphere.GetRadius() };
+		QXfloat	sqrLength{ axis.Dot(axis) };
+		QXvec3	closest{ sqrLength > 0.f ? a + axis * Clamp(0.f, 1.f, (center - a).Dot(axis) / sqrLength) : a };
+		QXvec3	outside{ center - closest };
+
+		if (outside.Dot(outside) <= radius * radius)
+			return Keep(0.f, outside.Dot(outside) > 0.f ? outside.Normalized() : QXvec3(0.f, 1.f, 0.f), closest, hit);
+
+		return SweepCapsule(center, motion, radius, a, segment.GetPointB(), hit);
+	}
+
+	QXbool SweepBoxes(const QXbox& a, const QXvec3& motionA, const QXbox& b, const QXvec3& motionB, QXsweepHit& hit) noexcept
+	{
+		/* b stays, a moves by the relative motion */
+		QXvec3	motion{ motionA - motionB };
+		QXvec3	minA{ a.GetPosition() - a.GetHalfSizes() }, maxA{ a.GetPosition() + a.GetHalfSizes() };
+		QXvec3	minB{ b.GetPosition() - b.GetHalfSizes() }, maxB{ b.GetPosition() + b.GetHalfSizes() };
+		QXfloat	entry{ -FLT_MAX }, exit{ FLT_MAX };
+		QXuint	entryAxis{ 0 };
+
+		for (QXuint axis = 0; axis < 3; axis++)
+		{
+			if (motion.e[axis] == 0.f)
+			{
+				if (maxA.e[axis] < minB.e[axis] || maxB.e[axis] < minA.e[axis])
+					return false;
+				continue;
+			}
+
+			QXfloat first{ (minB.e[axis] - maxA.e[axis]) / motion.e[axis] };
+			QXfloat second{ (maxB.e[axis] - minA.e[axis]) / motion.e[axis] };
+			if (std::fmin(first, second) > entry)
+			{
+				entry = std::fmin(first, second);
+				entryAxis = axis;
+			}
+			exit = std::fmin(exit, std::fmax(first, second));
+		}
+
+		if (entry > exit || entry > 1.f || exit < 0.f)
+			return false;
+
+		/* overlapping at the start: the normal is along the least overlap */
+		if (entry < 0.f)
+		{
+			QXfloat least{ FLT_MAX };
+			for (QXuint axis = 0; axis < 3; axis++)
+			{
+				QXfloat overlap{ std::fmin(maxA.e[axis] - minB.e[axis], maxB.e[axis] - minA.e[axis]) };
+				if (overlap < least)
+				{
+					least = overlap;
+					entryAxis = axis;
+				}
+			}
+		}
+
+		QXfloat time{ std::fmax(entry, 0.f) };
+		QXvec3	normal;
+		QXvec3	offset{ a.GetPosition() + motion * time - b.GetPosition() };
+		normal.e[entryAxis] = offset.e[entryAxis] >= 0.f ? 1.f : -1.f;
+
+		/* middle of the touching region */
+		QXvec3 point;
+		for (QXuint axis = 0; axis < 3; axis++)
+			point.e[axis] = 0.5f * (std::fmax(minA.e[axis] + motion.e[axis] * time, minB.e[axis]) + std::fmin(maxA.e[axis] + motion.e[axis] * time, maxB.e[axis]));
+
+		return Keep(time, normal, point + motionB * time, hit);
+	}
+
+	QXbool TimeOfImpact(const QXorientedBox& a, const QXvec3& motionA, const QXvec3& rotationA, const QXorientedBox& b, const QXvec3& motionB,
+						const QXvec3& rotationB, QXsweepHit& hit) noexcept
+	{
+		/* no point of a box moves faster than its center plus angular speed times half diagonal */
+		QXfloat			spin{ rotationA.Length() * a.GetHalfSizes().Length() + rotationB.Length() * b.GetHalfSizes().Length() };
+		QXvec3			motion{ motionA - motionB };
+		QXgjkSimplex	cache;
+		QXgjkResult		result;
+		QXfloat			time{ 0.f };
+
+		for (QXuint iteration = 0; iteration < QX_TOI_MAX_ITERATIONS; iteration++)
+		{
+			QXorientedBox movedA{ MoveBox(a, motionA, rotationA, time) };
+			QXorientedBox movedB{ MoveBox(b, motionB, rotationB, time) };
+
+			if (GjkDistance(movedA, movedB, result, &cache))
+			{
+				GjkPenetration(movedA, movedB, result);
+				break;
+			}
+
+			if (result.distance <= QX_TOI_TOLERANCE)
+				break;
+
+			QXfloat speed{ motion.Dot(result.normal) + spin };
+			if (speed <= 0.f)
+				return false;
+
+			time += result.distance / speed;
+			if (time > 1.f || time >= hit.time)
+				return false;
+		}
+
+		/* out of iterations the boxes are still closing in, the contact is reported where they are */
+		return Keep(time, -result.normal, (result.pointA + result.pointB) * 0.5f, hit);
+	}
+
+	void SweepSpheres(const QXsphere* spheres, const QXvec3* motions, QXuint count, const QXbox* boxes, QXuint boxCount,
+					QXsweepHit* hits, QXbool parallel)
+	{
+		ParallelFor(count, parallel, [&](QXuint begin, QXuint end)
+		{
+			for (QXuint i = begin; i < end; i++)
+				for (QXuint j = 0; j < boxCount; j++)
+					if (SweepSphere(spheres[i], motions[i], boxes[j], hits[i]))
+						hits[i].index = j;
+		});
+	}
+
+	void SweepSpheres(const QXsphere* spheres, const QXvec3* motions, QXuint count, const QXplane* planes, QXuint planeCount,
+					QXsweepHit* hits, QXbool parallel)
+	{
+		ParallelFor(count, parallel, [&](QXuint begin, QXuint end)
+		{
+			for (QXuint i = begin; i < end; i++)
+				for (QXuint j = 0; j < planeCount; j++)
+					if (SweepSphere(spheres[i], motions[i], planes[j], hits[i]))
+						hits[i].index = j;
+		});
+	}
+	#pragma endregion Functions
+}
@@ -0,0 +1,340 @@
+#include "SweepAndPrune.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <mutex>
+#include <numeric>
+
+#include "Parallel.h"
+#include "Simd.h"
+
+namespace Math::Geometry
+{
+	#pragma region Static Functions
+
+	static QXuint64	PairKey(QXuint a, QXuint b) noexcept
+	{
+		return a < b ? (QXuint64)a << 32 | b : (QXuint64)b << 32 | a;
+	}
+
+	static std::pair<QXuint, QXuint>	KeyPair(QXuint64 key) noexcept
+	{
+		return { (QXuint)(key >> 32), (QXuint)key };
+	}
+
+	#pragma endregion Static Functions
+
+	#pragma region Functions
+	QXbool QXsweepAndPrune::Overlap(QXuint a, QXuint b) const noexcept
+	{
+		const QXbody& first{ _bodies[a] };
+		const QXbody& second{ _bodies[b] };
+
+		if (!first.alive || !second.alive)
+			return false;
+
+		for (QXuint axis = 0; axis < 3; axis++)
+			if (first.max[axis] < second.min[axis] || second.max[axis] < first.min[axis])
+				return false;
+
+		return true;
+	}
+
+	void QXsweepAndPrune::AddPair(QXuint a, QXuint b)
+	{
+		if (!_pairs.insert(PairKey(a, b)).second)
+			return;
+
+		_bodies[a].pairCount++;
+		_bodies[b].pairCount++;
+		_added.push_back(KeyPair(PairKey(a, b)));
+	}
+
+	void QXsweepAndPrune::RemovePair(QXuint a, QXuint b)
+	{
+		/* most crossings are between bodies without any pair, the counts skip the hash lookup */
+		if (_bodies[a].pairCount == 0 || _bodies[b].pairCount == 0 || _pairs.erase(PairKey(a, b)) == 0)
+			return;
+
+		_bodies[a].pairCount--;
+		_bodies[b].pairCount--;
+		_removed.push_back(KeyPair(PairKey(a, b)));
+	}
+
+	void QXsweepAndPrune::SortAxis(QXuint axis)
+	{
+		std::vector<QXendpoint>& endpoints{ _endpoints[axis] };
+
+		for (QXendpoint& endpoint : endpoints)
+		{
+			const QXbody& body{ _bodies[endpoint.data >> 1] };
+			endpoint.value = endpoint.data & 1 ? body.max[axis] : body.min[axis];
+		}
+
+		/* on equal values min endpoints go first so touching boxes overlap */
+		for (size_t i = 1; i < endpoints.size(); i++)
+		{
+			QXendpoint	moving{ endpoints[i] };
+			size_t		j{ i };
+
+			for (; j > 0; j--)
+			{
+				const QXendpoint& previous{ endpoints[j - 1] };
+				if (previous.value < moving.value || (previous.value == moving.value && (previous.data & 1) <= (moving.data & 1)))
+					break;
+
+				QXbool	movingMax{ (moving.data & 1) != 0 };
+				QXbool	previousMax{ (previous.data & 1) != 0 };
+				QXuint	a{ moving.data >> 1 }, b{ previous.data >> 1 };
+
+				/* values are final: a min passing a max may start an overlap, a max passing a min separates on this axis */
+				if (!movingMax && previousMax)
+				{
+					if (Overlap(a, b))
+						AddPair(a, b);
+				}
+				else if (movingMax && !previousMax)
+					RemovePair(a, b);
+
+				endpoints[j] = previous;
+			}
+
+			endpoints[j] = moving;
+		}
+	}
+	void QXsweepAndPrune::Rebuild()
+	{
+		for (QXuint axis = 0; axis < 3; axis++)
+		{
+			for (QXendpoint& endpoint : _endpoints[axis])
+			{
+				const QXbody& body{ _bodies[endpoint.data >> 1] };
+				endpoint.value = endpoint.data & 1 ? body.max[axis] : body.min[axis];
+			}
+
+			std::sort(_endpoints[axis].begin(), _endpoints[axis].end(), [](const QXendpoint& a, const QXendpoint& b)
+			{
+				return a.value < b.value || (a.value == b.value && (a.data & 1) < (b.data & 1));
+			});
+		}
+
+		/* sweep on x: each min is tested against the bodies opened before it and not closed yet */
+		std::unordered_set<QXuint64>	pairs;
+		std::vector<QXuint>				open;
+		std::vector<QXuint>				openSlot(_bodies.size());
+
+		for (const QXendpoint& endpoint : _endpoints[0])
+		{
+			QXuint body{ endpoint.data >> 1 };
+
+			if (endpoint.data & 1)
+			{
+				open[openSlot[body]] = open.back();
+				openSlot[open.back()] = openSlot[body];
+				open.pop_back();
+				continue;
+			}
+
+			for (QXuint other : open)
+				if (Overlap(body, other))
+					pairs.insert(PairKey(body, other));
+
+			openSlot[body] = (QXuint)open.size();
+			open.push_back(body);
+		}
+
+		for (QXuint64 key : _pairs)
+			if (pairs.count(key) == 0)
+				_removed.push_back(KeyPair(key));
+
+		for (QXuint64 key : pairs)
+			if (_pairs.count(key) == 0)
+				_added.push_back(KeyPair(key));
+
+		_pairs.swap(pairs);
+
+		for (QXbody& body : _bodies)
+			body.pairCount = 0;
+
+		for (QXuint64 key : _pairs)
+		{
+			_bodies[key >> 32].pairCount++;
+			_bodies[(QXuint)key].pairCount++;
+		}
+	}
+	#pragma endregion Functions
+
+	#pragma region Methods
+	QXuint QXsweepAndPrune::AddBody(const QXbox& box)
+	{
+		QXuint handle;
+		if (_freeHandles.empty())
+		{
+			handle = (QXuint)_bodies.size();
+			_bodies.emplace_back();
+		}
+		else
+		{
+			handle = _freeHandles.back();
+			_freeHandles.pop_back();
+		}
+
+		_bodies[handle].alive = true;
+		_bodies[handle].pairCount = 0;
+		_pendingAdditions++;
+		SetBody(handle, box);
+
+		/* appended endpoints are sorted in place by the next Update, which reports their pairs */
+		for (QXuint axis = 0; axis < 3; axis++)
+		{
+			_endpoints[axis].push_back({ _bodies[handle].min[axis], handle << 1 });
+			_endpoints[axis].push_back({ _bodies[handle].max[axis], handle << 1 | 1 });
+		}
+
+		return handle;
+	}
+
+	void QXsweepAndPrune::RemoveBody(QXuint handle)
+	{
+		if (handle >= _bodies.size() || !_bodies[handle].alive)
+			return;
+
+		_bodies[handle].alive = false;
+		_pendingRemovals.push_back(handle);
+	}
+
+	void QXsweepAndPrune::SetBody(QXuint handle, const QXbox& box)
+	{
+		QXbody& body{ _bodies[handle] };
+		QXvec3	min{ box.GetPosition() - box.GetHalfSizes() };
+		QXvec3	max{ box.GetPosition() + box.GetHalfSizes() };
+
+		for (QXuint axis = 0; axis < 3; axis++)
+		{
+			body.min[axis] = min.e[axis];
+			body.max[axis] = max.e[axis];
+		}
+	}
+
+	void QXsweepAndPrune::Update()
+	{
+		_added.clear();
+		_removed.clear();
+
+		/* removed bodies go past every other endpoint, the sort then reports their pairs removed */
+		for (QXuint handle : _pendingRemovals)
+		{
+			for (QXuint axis = 0; axis < 3; axis++)
+			{
+				_bodies[handle].min[axis] = FLT_MAX;
+				_bodies[handle].max[axis] = FLT_MAX;
+			}
+		}
+
+		if (_pendingAdditions > QX_SAP_REBUILD_ADDITIONS)
+			Rebuild();
+		else
+			for (QXuint axis = 0; axis < 3; axis++)
+				SortAxis(axis);
+
+		_pendingAdditions = 0;
+
+		if (_pendingRemovals.empty())
+			return;
+
+		for (QXuint axis = 0; axis < 3; axis++)
+		{
+			_endpoints[axis].erase(std::remove_if(_endpoints[axis].begin(), _endpoints[axis].end(),
+				[this](const QXendpoint& endpoint) { return !_bodies[endpoint.data >> 1].alive; }), _endpoints[axis].end());
+		}
+
+		_freeHandles.insert(_freeHandles.end(), _pendingRemovals.begin(), _pendingRemovals.end());
+		_pendingRemovals.clear();
+	}
+
+	void QXsweepAndPrune::GetPairs(std::vector<std::pair<QXuint, QXuint>>& pairs) const
+	{
+		pairs.reserve(pairs.size() + _pairs.size());
+		for (QXuint64 key : _pairs)
+			pairs.push_back(KeyPair(key));
+	}
+
+	QXuint QXsweepAndPrune::PairCount() const noexcept
+	{
+		return (QXuint)_pairs.size();
+	}
+	#pragma endregion Methods
+
+	#pragma region Statics Functions
+	void QXsweepAndPrune::BoxPruning(const QXbox* boxes, QXuint count, std::vector<std::pair<QXuint, QXuint>>& pairs, QXbool parallel)
+	{
+		std::vector<QXuint> order(count);
+		std::iota(order.begin(), order.end(), 0);
+
+		std::vector<QXfloat> minX(count);
+		for (QXuint i = 0; i < count; i++)
+			minX[i] = boxes[i].GetPosition().x - boxes[i].GetHalfSizes().x;
+
+		std::sort(order.begin(), order.end(), [&minX](QXuint a, QXuint b) { return minX[a] < minX[b]; });
+
+		/* sorted SoA copy, padded with 3 boxes starting at +inf so the last loads are full and fail the test */
+		QXuint					padded{ count + 3 };
+		std::vector<QXfloat>	sortedMinX(padded, FLT_MAX), maxX(padded, -FLT_MAX);
+		std::vector<QXfloat>	minY(padded, FLT_MAX), maxY(padded, -FLT_MAX), minZ(padded, FLT_MAX), maxZ(padded, -FLT_MAX);
+
+		for (QXuint k = 0; k < count; k++)
+		{
+			QXvec3 min{ boxes[order[k]].GetPosition() - boxes[order[k]].GetHalfSizes() };
+			QXvec3 max{ boxes[order[k]].GetPosition() + boxes[order[k]].GetHalfSizes() };
+
+			sortedMinX[k] = min.x;
+			maxX[k] = max.x;
+			minY[k] = min.y;
+			maxY[k] = max.y;
+			minZ[k] = min.z;
+			maxZ[k] = max.z;
+		}
+
+		std::mutex mutex;
+
+		ParallelFor(count, parallel, [&](QXuint begin, QXuint end)
+		{
+			std::vector<std::pair<QXuint, QXuint>> found;
+
+			for (QXuint k = begin; k < end; k++)
+			{
+				QXuint j{ k + 1 };
+
+#ifdef QX_SIMD_SSE
+				__m128 kMaxX{ _mm_set1_ps(maxX[k]) };
+				__m128 kMinY{ _mm_set1_ps(minY[k]) }, kMaxY{ _mm_set1_ps(maxY[k]) };
+				__m128 kMinZ{ _mm_set1_ps(minZ[k]) }, kMaxZ{ _mm_set1_ps(maxZ[k]) };
+
+				for (; j < count && sortedMinX[j] <= maxX[k]; j += 4)
+				{
+					__m128 mask{ _mm_cmple_ps(_mm_loadu_ps(&sortedMinX[j]), kMaxX) };
+					mask = _mm_and_ps(mask, _mm_cmple_ps(_mm_loadu_ps(&minY[j]), kMaxY));
+					mask = _mm_and_ps(mask, _mm_cmpge_ps(_mm_loadu_ps(&maxY[j]), kMinY));
+					mask = _mm_and_ps(mask, _mm_cmple_ps(_mm_loadu_ps(&minZ[j]), kMaxZ));
+					mask = _mm_and_ps(mask, _mm_cmpge_ps(_mm_loadu_ps(&maxZ[j]), kMinZ));
+
+					QXint bits{ _mm_movemask_ps(mask) };
+					for (QXuint lane = 0; bits != 0; lane++, bits >>= 1)
+						if (bits & 1)
+							found.emplace_back(std::min(order[k], order[j + lane]), std::max(order[k], order[j + lane]));
+				}
+#else
+				for (; j < count && sortedMinX[j] <= maxX[k]; j++)
+				{
+					if (minY[j] <= maxY[k] && maxY[j] >= minY[k] && minZ[j] <= maxZ[k] && maxZ[j] >= minZ[k])
+						found.emplace_back(std::min(order[k], order[j]), std::max(order[k], order[j]));
+				}
+#endif
+			}
+
+			std::lock_guard<std::mutex> lock(mutex);
+			pairs.insert(pairs.end(), found.begin(), found.end());
+		});
+	}
+	#pragma endregion Statics Functions
+}
@@ -0,0 +1,143 @@
+#include "Triangle.h"
+
+#include <utility>
+
+namespace Math::Geometry
+{
+	#pragma region Constructors
+	template<typename T>
+	QXtrianglet<T>::QXtrianglet(const QXvec3t<T>& a, const QXvec3t<T>& b, const QXvec3t<T>& c) noexcept:
+		_a{a},
+		_b{b},
+		_c{c}
+	{}
+
+	template<typename T>
+	QXtrianglet<T>::QXtrianglet(const QXtrianglet<T>& triangle) noexcept:
+		_a{triangle._a},
+		_b{triangle._b},
+		_c{triangle._c}
+	{}
+
+	template<typename T>
+	QXtrianglet<T>::QXtrianglet(QXtrianglet<T>&& triangle) noexcept:
+		_a{std::move(triangle._a)},
+		_b{std::move(triangle._b)},
+		_c{std::move(triangle._c)}
+	{}
+
+	#pragma endregion Constructors
+
+	#pragma region Functions
+
+	template<typename T>
+	QXvec3t<T> QXtrianglet<T>::GetNormal() const noexcept
+	{
+		return (_b - _a).Cross(_c - _a).Normalized();
+	}
+
+	template<typename T>
+	T QXtrianglet<T>::GetArea() const noexcept
+	{
+		return (_b - _a).Cross(_c - _a).Length() / 2;
+	}
+
+	template<typename T>
+	QXvec3t<T> QXtrianglet<T>::GetPoint(const QXvec3t<T>& barycentric) const noexcept
+	{
+		return _a * barycentric.x + _b * barycentric.y + _c * barycentric.z;
+	}
+
+	template<typename T>
+	QXvec3t<T> QXtrianglet<T>::GetClosestPoint(const QXvec3t<T>& p, QXvec3t<T>* barycentric) const noexcept
+	{
+		QXvec3t<T>	ab{ _b - _a }, ac{ _c - _a }, ap{ p - _a };
+		QXvec3t<T>	weights;
+
+		/* d1 to d6 are the projections of the point on the edges from each vertex, their signs give its Voronoi region */
+		T d1{ ab.Dot(ap) }, d2{ ac.Dot(ap) };
+		QXvec3t<T>	bp{ p - _b };
+		T d3{ ab.Dot(bp) }, d4{ ac.Dot(bp) };
+		QXvec3t<T>	cp{ p - _c };
+		T d5{ ab.Dot(cp) }, d6{ ac.Dot(cp) };
+		T va{ d3 * d6 - d5 * d4 }, vb{ d5 * d2 - d1 * d6 }, vc{ d1 * d4 - d3 * d2 };
+
+		if (d1 <= 0 && d2 <= 0)
+			weights = { 1, 0, 0 };
+		else if (d3 >= 0 && d4 <= d3)
+			weights = { 0, 1, 0 };
+		else if (d6 >= 0 && d5 <= d6)
+			weights = { 0, 0, 1 };
+		else if (vc <= 0 && d1 >= 0 && d3 <= 0)
+		{
+			T v{ d1 / (d1 - d3) };
+			weights = { 1 - v, v, 0 };
+		}
+		else if (vb <= 0 && d2 >= 0 && d6 <= 0)
+		{
+			T w{ d2 / (d2 - d6) };
+			weights = { 1 - w, 0, w };
+		}
+		else if (va <= 0 && d4 - d3 >= 0 && d5 - d6 >= 0)
+		{
+			T w{ (d4 - d3) / ((d4 - d3) + (d5 - d6)) };
+			weights = { 0, 1 - w, w };
+		}
+		else
+		{
+			T denominator{ 1 / (va + vb + vc) };
+			T v{ vb * denominator }, w{ vc * denominator };
+			weights = { 1 - v - w, v, w };
+		}
+
+		if (barycentric != nullptr)
+			*barycentric = weights;
+
+		return GetPoint(weights);
+	}
+
+	template<typename T>
+	QXbool QXtrianglet<T>::IsInside(const QXvec3t<T>& p) const noexcept
+	{
+		QXvec3t<T>	normal{ (_b - _a).Cross(_c - _a) };
+		T			sqrLength{ normal.Dot(normal) };
+		if (sqrLength == 0)
+			return false;
+
+		/* twice the signed areas of the sub triangles facing each vertex, all on the normal side when inside */
+		T u{ (_c - _b).Cross(p - _b).Dot(normal) };
+		T v{ (_a - _c).Cross(p - _c).Dot(normal) };
+		T w{ (_b - _a).Cross(p - _a).Dot(normal) };
+
+		return u >= 0 && v >= 0 && w >= 0;
+	}
+
+	#pragma region Operators
+
+	template<typename T>
+	QXtrianglet<T>& QXtrianglet<T>::operator=(const QXtrianglet<T>& triangle) noexcept
+	{
+		_a = triangle._a;
+		_b = triangle._b;
+		_c = triangle._c;
+
+		return *this;
+	}
+
+	template<typename T>
+	QXtrianglet<T>& QXtrianglet<T>::operator=(QXtrianglet<T>&& triangle) noexcept
+	{
+		_a = std::move(triangle._a);
+		_b = std::move(triangle._b);
+		_c = std::move(triangle._c);
+
+		return *this;
+	}
+
+	#pragma endregion Operators
+
+	#pragma endregion Functions
+
+	template class QXtrianglet<QXfloat>;
+	template class QXtrianglet<QXdouble>;
+}
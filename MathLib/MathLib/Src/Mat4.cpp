@@ -1,74 +1,170 @@
 #include <math.h>
 
 #include "Mat4.h"
-#include "Mat.h"
+#include "Simd.h"
 
 #include "MathDefines.h"
+#include "Trigonometry.h"
 
 namespace Math
 {
-	#pragma region Constructor
-	QXmat4::QXmat4()
+	#pragma region Static Functions
+
+	template<typename T>
+	static inline void	TransformPoint(const T* m, const QXvec3t<T>& point, QXvec3t<T>& result) noexcept
 	{
-		for (QXint i = 0; i < 16; i++)
-		{
-			array[i] = 0;
-		}
+		result = QXvec3t<T>(m[0] * point.x + m[1] * point.y + m[2] * point.z + m[3],
+							m[4] * point.x + m[5] * point.y + m[6] * point.z + m[7],
+							m[8] * point.x + m[9] * point.y + m[10] * point.z + m[11]);
+	}
+
+	/* one line of the matrix, c holds its 4 coefficients broadcasted, on 4 float (SSE) or 4 double (AVX) lanes */
+	template<typename L>
+	static inline L	TransformRow(const L* c, L x, L y, L z) noexcept
+	{
+		return (c[0] * x + c[1] * y) + (c[2] * z + c[3]);
 	}
 
-	QXmat4::QXmat4(const QXmat4& mat)
+	/* 4 points are loaded as 3 registers (x0 y0 z0 x1) (y1 z1 x2 y2) (z2 x3 y3 z3), transposed to x, y, z
+	 * registers, transformed and transposed back */
+	static void	TransformPointsImpl(const QXfloat* m, const QXvec3* points, QXvec3* result, QXuint count) noexcept
 	{
-		for (QXint i = 0; i < 16; i++)
+		QXuint i{ 0 };
+
+#ifdef QX_SIMD_SSE
+		QXlane4 coefs[12];
+		for (QXuint k = 0; k < 12; k++)
+			coefs[k] = m[k];
+
+		for (; i + 4 <= count; i += 4)
 		{
-			array[i] = mat.array[i];
+			const QXfloat* in{ &points[i].x };
+			__m128 a{ _mm_loadu_ps(in) }, b{ _mm_loadu_ps(in + 4) }, c{ _mm_loadu_ps(in + 8) };
+
+			__m128 x{ _mm_shuffle_ps(a, _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0)) };
+			__m128 y{ _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)), _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0)) };
+			__m128 z{ _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)), _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0)) };
+
+			__m128 res0{ TransformRow<QXlane4>(coefs, x, y, z).v };
+			__m128 res1{ TransformRow<QXlane4>(coefs + 4, x, y, z).v };
+			__m128 res2{ TransformRow<QXlane4>(coefs + 8, x, y, z).v };
+
+			QXfloat* out{ &result[i].x };
+			_mm_storeu_ps(out, _mm_shuffle_ps(_mm_shuffle_ps(res0, res1, _MM_SHUFFLE(0, 0, 0, 0)),
+												_mm_shuffle_ps(res2, res0, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0)));
+			_mm_storeu_ps(out + 4, _mm_shuffle_ps(_mm_shuffle_ps(res1, res2, _MM_SHUFFLE(1, 1, 1, 1)),
+												_mm_shuffle_ps(res0, res1, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0)));
+			_mm_storeu_ps(out + 8, _mm_shuffle_ps(_mm_shuffle_ps(res2, res0, _MM_SHUFFLE(3, 3, 2, 2)),
+												_mm_shuffle_ps(res1, res2, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0)));
 		}
+#endif
+
+		for (; i < count; i++)
+			TransformPoint(m, points[i], result[i]);
 	}
-	#pragma endregion Constructor
 
-	#pragma region Functions
-	QXmat4 QXmat4::Inverse() const
+	static void	TransformPointsImpl(const QXdouble* m, const QXdvec3* points, QXdvec3* result, QXuint count) noexcept
 	{
-		QXmat m(4, 4);
-
-		for (QXint i = 0; i < 4; i++)
-			for (QXint j = 0; j < 4; j++)
-				m[i][j] = (*this)[i][j];
+		QXuint i{ 0 };
 
-		m = m.Inverse();
-		QXmat4 invt;
+#ifdef QX_SIMD_AVX
+		QXdlane4 coefs[12];
+		for (QXuint k = 0; k < 12; k++)
+			coefs[k] = m[k];
 
-		for (QXint i = 0; i < 4; i++)
-			for (QXint j = 0; j < 4; j++)
-				invt[i][j] = m[i][j];
+		for (; i + 4 <= count; i += 4)
+		{
+			const QXdouble* in{ &points[i].x };
+			__m256d a{ _mm256_loadu_pd(in) }, b{ _mm256_loadu_pd(in + 4) }, c{ _mm256_loadu_pd(in + 8) };
+
+			/* (x0 y0 x2 y2) (z0 x1 z2 x3) (y1 z1 y3 z3) */
+			__m256d p{ _mm256_permute2f128_pd(a, b, 0x30) };
+			__m256d q{ _mm256_permute2f128_pd(a, c, 0x21) };
+			__m256d r{ _mm256_permute2f128_pd(b, c, 0x30) };
+
+			__m256d x{ _mm256_shuffle_pd(p, q, 0xA) };
+			__m256d y{ _mm256_shuffle_pd(p, r, 0x5) };
+			__m256d z{ _mm256_shuffle_pd(q, r, 0xA) };
+
+			__m256d res0{ TransformRow<QXdlane4>(coefs, x, y, z).v };
+			__m256d res1{ TransformRow<QXdlane4>(coefs + 4, x, y, z).v };
+			__m256d res2{ TransformRow<QXdlane4>(coefs + 8, x, y, z).v };
+
+			p = _mm256_shuffle_pd(res0, res1, 0x0);
+			q = _mm256_shuffle_pd(res2, res0, 0xA);
+			r = _mm256_shuffle_pd(res1, res2, 0xF);
+
+			QXdouble* out{ &result[i].x };
+			_mm256_storeu_pd(out, _mm256_permute2f128_pd(p, q, 0x20));
+			_mm256_storeu_pd(out + 4, _mm256_permute2f128_pd(r, p, 0x30));
+			_mm256_storeu_pd(out + 8, _mm256_permute2f128_pd(q, r, 0x31));
+		}
+#endif
 
-		return invt;
+		for (; i < count; i++)
+			TransformPoint(m, points[i], result[i]);
 	}
 
-	QXmat4	QXmat4::Transpose() const
-	{
-		QXmat4	res;
-		QXfloat	tmp;
+	#pragma endregion Static Functions
 
-	    for (QXint i = 0; i < 4; i++)
-	    {
-	        for (QXint j = 0; j < 4; j++)
-	        {
-	            tmp = array[i * 4 + j];
-	            res[j][i] = tmp;
-	        }
-	    }
+	#pragma region Functions
+	template<typename T>
+	QXmat4t<T> QXmat4t<T>::Inverse() const
+	{
+		/* cofactor expansion on 2x2 minors, computed in T so double matrices keep their precision */
+		const T* m = array;
+
+		T s0 = m[0] * m[5] - m[4] * m[1];
+		T s1 = m[0] * m[6] - m[4] * m[2];
+		T s2 = m[0] * m[7] - m[4] * m[3];
+		T s3 = m[1] * m[6] - m[5] * m[2];
+		T s4 = m[1] * m[7] - m[5] * m[3];
+		T s5 = m[2] * m[7] - m[6] * m[3];
+
+		T c5 = m[10] * m[15] - m[14] * m[11];
+		T c4 = m[9] * m[15] - m[13] * m[11];
+		T c3 = m[9] * m[14] - m[13] * m[10];
+		T c2 = m[8] * m[15] - m[12] * m[11];
+		T c1 = m[8] * m[14] - m[12] * m[10];
+		T c0 = m[8] * m[13] - m[12] * m[9];
+
+		T invDet = 1 / (s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0);
+		QXmat4t<T> invt;
+
+		invt.array[0] = (m[5] * c5 - m[6] * c4 + m[7] * c3) * invDet;
+		invt.array[1] = (-m[1] * c5 + m[2] * c4 - m[3] * c3) * invDet;
+		invt.array[2] = (m[13] * s5 - m[14] * s4 + m[15] * s3) * invDet;
+		invt.array[3] = (-m[9] * s5 + m[10] * s4 - m[11] * s3) * invDet;
+
+		invt.array[4] = (-m[4] * c5 + m[6] * c2 - m[7] * c1) * invDet;
+		invt.array[5] = (m[0] * c5 - m[2] * c2 + m[3] * c1) * invDet;
+		invt.array[6] = (-m[12] * s5 + m[14] * s2 - m[15] * s1) * invDet;
+		invt.array[7] = (m[8] * s5 - m[10] * s2 + m[11] * s1) * invDet;
+
+		invt.array[8] = (m[4] * c4 - m[5] * c2 + m[7] * c0) * invDet;
+		invt.array[9] = (-m[0] * c4 + m[1] * c2 - m[3] * c0) * invDet;
+		invt.array[10] = (m[12] * s4 - m[13] * s2 + m[15] * s0) * invDet;
+		invt.array[11] = (-m[8] * s4 + m[9] * s2 - m[11] * s0) * invDet;
+
+		invt.array[12] = (-m[4] * c3 + m[5] * c1 - m[6] * c0) * invDet;
+		invt.array[13] = (m[0] * c3 - m[1] * c1 + m[2] * c0) * invDet;
+		invt.array[14] = (-m[12] * s3 + m[13] * s1 - m[14] * s0) * invDet;
+		invt.array[15] = (m[8] * s3 - m[9] * s1 + m[10] * s0) * invDet;
 
-	    return res;
+		return invt;
 	}
 
-	QXstring	QXmat4::ToString() const
+	template<typename T>
+	QXstring	QXmat4t<T>::ToString() const
 	{
 		std::string	mat;
+		mat.reserve(256);
 		for (QXint i = 0; i < 4; i++)
 	    {
 	        for (QXint j = 0; j < 4; j++)
 	        {
-	            mat = mat + std::to_string(array[i * 4 + j]) + " ";
+	            mat += std::to_string(array[i * 4 + j]);
+	            mat += ' ';
 	        }
 	        mat += "\n\t  ";
 	    }
@@ -76,129 +172,27 @@ namespace Math
 		return mat;
 	}
 
-	#pragma region Operator Functions
-	QXfloat* QXmat4::operator[](QXint i)
-	{
-		return &array[i * 4];
-	}
-
-	const QXfloat* QXmat4::operator[](QXint i) const
-	{
-		return &array[i * 4];
-	}
-
-	QXmat4	QXmat4::operator+(const QXmat4& mat) const
-	{
-		QXmat4	res;
-
-		for (QXint i = 0; i < 16; i++)
-		{
-			res.array[i] = mat.array[i] + array[i];
-		}
-
-		return res;
-	}
-
-	QXmat4	QXmat4::operator*(const QXmat4& mat) const
-	{
-		QXmat4	res;
-		QXint	i, j, k;
-
-		for (i = 0; i < 4; i++)
-		{
-			for (j = 0; j < 4; j++)
-			{
-				for (k = 0; k < 4; k++)
-				{
-					res.array[i * 4 + j] += array[i * 4 + k] * mat.array[k * 4 + j];
-				}
-			}
-		}
-
-		return res;
-	}
-
-	QXmat4& QXmat4::operator*=(const QXmat4& mat)
+	template<typename T>
+	void	QXmat4t<T>::TransformPoints(const QXvec3t<T>* points, QXvec3t<T>* result, QXuint count) const noexcept
 	{
-		QXmat4	res;
-
-		for (QXint i = 0; i < 4; i++)
-		{
-			for (QXint j = 0; j < 4; j++)
-			{
-				for (QXint k = 0; k < 4; k++)
-				{
-					res[i][j] += (*this)[i][k] * mat[k][j];
-				}
-			}
-		}
-
-		(*this) = res;
-
-		return *this;
+		TransformPointsImpl(array, points, result, count);
 	}
 
-	QXvec3	QXmat4::operator*(const QXvec3& vec) const
-	{
-		return QXvec3(array[0] * vec.x + array[1] * vec.y + array[2] * vec.z + array[3],
-			array[4] * vec.x + array[5] * vec.y + array[6] * vec.z + array[7],
-			array[8] * vec.x + array[9] * vec.y + array[10] * vec.z + array[11]);
-	}
-
-	QXvec4	QXmat4::operator*(const QXvec4& vec) const
-	{
-		QXmat4  matVec;
-		matVec[0][0] = vec.x;
-		matVec[1][0] = vec.y;
-		matVec[2][0] = vec.z;
-		matVec[3][0] = vec.w;
-
-		QXmat4  res((*this) * matVec);
-
-		QXvec4 vecRes(res[0][0], res[1][0], res[2][0], res[3][0]);
-
-		return vecRes;
-	}
+	#pragma region Operator Functions
 	#pragma endregion Operator Functions
 
 	#pragma region Static Functions
-	QXmat4	QXmat4::CreateScaleMatrix(const QXvec3& scale)
-	{
-		QXmat4  scaleMatrix;
-
-	    scaleMatrix[0][0] = scale.x;
-	    scaleMatrix[1][1] = scale.y;
-	    scaleMatrix[2][2] = scale.z;
-	    scaleMatrix[3][3] = 1;
-
-	    return scaleMatrix;
-	}
-
-	QXmat4	QXmat4::CreateTranslationMatrix(const QXvec3& trans)
+	template<typename T>
+	QXmat4t<T>		QXmat4t<T>::CreateRotationMatrix(const QXvec3t<T>& axis, const T& angle)
 	{
-		QXmat4	transMatrix;
+		T s, c;
+		BuilderSinCos(angle, s, c);
+		T t = 1 - c;
+		T axisX = axis.x;
+		T axisY = axis.y;
+		T axisZ = axis.z;
 
-		transMatrix[0][0] = 1;
-		transMatrix[3][0] = trans.x;
-		transMatrix[1][1] = 1;
-		transMatrix[3][1] = trans.y;
-		transMatrix[2][2] = 1;
-		transMatrix[3][2] = trans.z;
-		transMatrix[3][3] = 1;
-
-		return transMatrix;
-	}
-
-	QXmat4		QXmat4::CreateRotationMatrix(const QXvec3& axis, const QXfloat& angle)
-	{
-		QXfloat c = cos(angle);
-		QXfloat s = sin(angle);
-		QXfloat t = 1 - c;
-		QXfloat axisX = axis.x;
-		QXfloat axisY = axis.y;
-		QXfloat axisZ = axis.z;
-
-		QXmat4	rotation;
+		QXmat4t<T>	rotation;
 
 		rotation[0][0] = axisX * axisX * t + c;
 		rotation[0][1] = axisX * axisY * t - axisZ * s;
@@ -223,12 +217,13 @@ namespace Math
 		return rotation;
 	}
 
-	QXmat4	QXmat4::CreateXRotationMatrix(const QXfloat angle)
+	template<typename T>
+	QXmat4t<T>	QXmat4t<T>::CreateXRotationMatrix(const T angle)
 	{
-		QXmat4	xRotation;
+		QXmat4t<T>	xRotation;
 
-		QXfloat   c = cos(angle);
-		QXfloat   s = sin(angle);
+		T   s, c;
+		BuilderSinCos(angle, s, c);
 
 		xRotation[0][0] = 1;
 		xRotation[1][1] = c;
@@ -240,12 +235,13 @@ namespace Math
 		return xRotation;
 	}
 
-	QXmat4	QXmat4::CreateYRotationMatrix(const QXfloat angle)
+	template<typename T>
+	QXmat4t<T>	QXmat4t<T>::CreateYRotationMatrix(const T angle)
 	{
-		QXmat4	yRotation;
+		QXmat4t<T>	yRotation;
 
-		QXfloat   c = cos(angle);
-		QXfloat   s = sin(angle);
+		T   s, c;
+		BuilderSinCos(angle, s, c);
 
 		yRotation[0][0] = c;
 		yRotation[0][2] = s;
@@ -257,12 +253,13 @@ namespace Math
 		return yRotation;
 	}
 
-	QXmat4	QXmat4::CreateZRotationMatrix(const QXfloat angle)
+	template<typename T>
+	QXmat4t<T>	QXmat4t<T>::CreateZRotationMatrix(const T angle)
 	{
-		QXmat4	zRotation;
+		QXmat4t<T>	zRotation;
 
-		QXfloat   c = cos(angle);
-		QXfloat   s = sin(angle);
+		T   s, c;
+		BuilderSinCos(angle, s, c);
 
 		zRotation[0][0] = c;
 		zRotation[0][1] = -s;
@@ -274,38 +271,41 @@ namespace Math
 		return zRotation;
 	}
 
-	QXmat4	QXmat4::CreateFixedAngleEulerRotationMatrix(const QXvec3& rotate)
+	template<typename T>
+	QXmat4t<T>	QXmat4t<T>::CreateFixedAngleEulerRotationMatrix(const QXvec3t<T>& rotate)
 	{
-		QXmat4	xRotation(QXmat4::CreateXRotationMatrix(rotate.x));
-		QXmat4	yRotation(QXmat4::CreateYRotationMatrix(rotate.y));
-		QXmat4	zRotation(QXmat4::CreateZRotationMatrix(rotate.z));
+		QXmat4t<T>	xRotation(QXmat4t<T>::CreateXRotationMatrix(rotate.x));
+		QXmat4t<T>	yRotation(QXmat4t<T>::CreateYRotationMatrix(rotate.y));
+		QXmat4t<T>	zRotation(QXmat4t<T>::CreateZRotationMatrix(rotate.z));
 
-		QXmat4	rotation(yRotation * xRotation * zRotation);
+		QXmat4t<T>	rotation(yRotation * xRotation * zRotation);
 
 		return rotation;
 	}
 
-	QXmat4	QXmat4::CreateTRSMatrix(const QXvec3& trans, const QXvec3& rotate, const QXvec3& scale)
+	template<typename T>
+	QXmat4t<T>	QXmat4t<T>::CreateTRSMatrix(const QXvec3t<T>& trans, const QXvec3t<T>& rotate, const QXvec3t<T>& scale)
 	{
-		QXmat4	transMatrix(QXmat4::CreateTranslationMatrix(trans));
-		QXmat4	rotateMatrix(QXmat4::CreateFixedAngleEulerRotationMatrix(rotate));
-		QXmat4	scaleMatrix(QXmat4::CreateScaleMatrix(scale));
+		QXmat4t<T>	transMatrix(QXmat4t<T>::CreateTranslationMatrix(trans));
+		QXmat4t<T>	rotateMatrix(QXmat4t<T>::CreateFixedAngleEulerRotationMatrix(rotate));
+		QXmat4t<T>	scaleMatrix(QXmat4t<T>::CreateScaleMatrix(scale));
 
-		QXmat4	TRS(scaleMatrix * rotateMatrix * transMatrix);
+		QXmat4t<T>	TRS(scaleMatrix * rotateMatrix * transMatrix);
 
 		return TRS;
 	}
 
-	QXmat4	QXmat4::CreateProjectionMatrix(QXint width, QXint height, QXfloat near,
-		QXfloat far, QXfloat fov)
+	template<typename T>
+	QXmat4t<T>	QXmat4t<T>::CreateProjectionMatrix(QXint width, QXint height, T near,
+		T far, T fov)
 	{
-		QXfloat top, right;
-		QXfloat a = (QXfloat)width / height;
+		T top, right;
+		T a = (T)width / height;
 
-		top = (QXfloat)(near * tanf(fov * 0.5 * Q_PI / 180.0f));
+		top = (T)(near * tan(fov * 0.5 * Q_PI / 180.0f));
 		right = top * a;
 
-		QXmat4 res;
+		QXmat4t<T> res;
 		res[0][0] = near / right;
 		res[1][1] = near / top;
 		res[2][2] = -(far + near) / (far - near);
@@ -315,14 +315,15 @@ namespace Math
 		return res;
 	}
 
-	QXmat4    QXmat4::CreateOrthographicProjectionMatrix(QXint width, QXint height, QXfloat near, QXfloat far)
+	template<typename T>
+	QXmat4t<T>    QXmat4t<T>::CreateOrthographicProjectionMatrix(QXint width, QXint height, T near, T far)
 	{
-		QXmat4 toReturn = QXmat4::Identity();
-		QXfloat top, bottom, left, right;
+		QXmat4t<T> toReturn = QXmat4t<T>::Identity();
+		T top, bottom, left, right;
 
-		top = (QXfloat)height / 2.f;
+		top = (T)height / 2.f;
 		bottom = -top;
-		right = (QXfloat)width / 2.f;
+		right = (T)width / 2.f;
 		left = -right;
 		toReturn[0][0] = 1 / right - left;
 		toReturn[1][1] = 2 / top - bottom;
@@ -334,11 +335,12 @@ namespace Math
 	}
 
 	// Custom implementation of the LookAt function
-	QXmat4	QXmat4::CreateLookAtMatrix(QXvec3 position, QXvec3 target, QXvec3 up)
+	template<typename T>
+	QXmat4t<T>	QXmat4t<T>::CreateLookAtMatrix(QXvec3t<T> position, QXvec3t<T> target, QXvec3t<T> up)
 	{
-		QXmat4	lookAt;
+		QXmat4t<T>	lookAt;
 
-		QXvec3	X, Y, Z;
+		QXvec3t<T>	X, Y, Z;
 
 		Z = position - target;
 		Z.Normalize();
@@ -370,17 +372,9 @@ namespace Math
 		return lookAt;
 	}
 
-	QXmat4	QXmat4::Identity()
-	{
-		QXmat4	identity;
-
-		identity[0][0] = 1;
-		identity[1][1] = 1;
-		identity[2][2] = 1;
-		identity[3][3] = 1;
-
-		return identity;
-	}
 	#pragma endregion Static Functions
 	#pragma endregion Functions
+
+	template struct QXmat4t<QXfloat>;
+	template struct QXmat4t<QXdouble>;
 }
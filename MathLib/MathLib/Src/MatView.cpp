@@ -0,0 +1,113 @@
+#include "MatView.h"
+
+#include <cmath>
+#include <utility>
+
+namespace Math
+{
+	#pragma region Functions
+	template<typename T>
+	QXmat QXmatViewt<T>::ToMat() const
+	{
+		QXmat mat(line, column);
+		Copy(*this, mat);
+
+		return mat;
+	}
+
+	template struct QXmatViewt<QXfloat>;
+	template struct QXmatViewt<const QXfloat>;
+
+	void Copy(const QXconstMatView& src, const QXmatView& dst) noexcept
+	{
+		for (QXint i = 0; i < src.line; i++)
+			for (QXint j = 0; j < src.column; j++)
+				dst(i, j) = src(i, j);
+	}
+
+	void Add(const QXconstMatView& a, const QXconstMatView& b, const QXmatView& result) noexcept
+	{
+		for (QXint i = 0; i < a.line; i++)
+			for (QXint j = 0; j < a.column; j++)
+				result(i, j) = a(i, j) + b(i, j);
+	}
+
+	void Scale(const QXconstMatView& a, QXfloat scale, const QXmatView& result) noexcept
+	{
+		for (QXint i = 0; i < a.line; i++)
+			for (QXint j = 0; j < a.column; j++)
+				result(i, j) = a(i, j) * scale;
+	}
+
+	void Multiply(const QXconstMatView& a, const QXconstMatView& b, const QXmatView& result) noexcept
+	{
+		/* i-k-j order walks b and result along their lines, contiguous for non transposed views */
+		for (QXint i = 0; i < a.line; i++)
+		{
+			for (QXint j = 0; j < b.column; j++)
+				result(i, j) = 0.f;
+
+			for (QXint k = 0; k < a.column; k++)
+			{
+				QXfloat aik{ a(i, k) };
+
+				for (QXint j = 0; j < b.column; j++)
+					result(i, j) += aik * b(k, j);
+			}
+		}
+	}
+
+	QXbool Solve(const QXmatView& a, const QXmatView& b) noexcept
+	{
+		const QXint size{ a.line };
+
+		for (QXint k = 0; k < size; k++)
+		{
+			QXint pivot{ k };
+			for (QXint i = k + 1; i < size; i++)
+				if (fabsf(a(i, k)) > fabsf(a(pivot, k)))
+					pivot = i;
+
+			if (a(pivot, k) == 0.f)
+				return false;
+
+			/* pivoting swaps the lines in place, a and b keep no permutation */
+			if (pivot != k)
+			{
+				for (QXint j = 0; j < size; j++)
+					std::swap(a(k, j), a(pivot, j));
+				for (QXint j = 0; j < b.column; j++)
+					std::swap(b(k, j), b(pivot, j));
+			}
+
+			QXfloat inverse{ 1.f / a(k, k) };
+			for (QXint i = k + 1; i < size; i++)
+			{
+				QXfloat factor{ a(i, k) * inverse };
+				a(i, k) = factor;
+
+				for (QXint j = k + 1; j < size; j++)
+					a(i, j) -= factor * a(k, j);
+				for (QXint j = 0; j < b.column; j++)
+					b(i, j) -= factor * b(k, j);
+			}
+		}
+
+		for (QXint i = size - 1; i >= 0; i--)
+		{
+			QXfloat inverse{ 1.f / a(i, i) };
+
+			for (QXint j = 0; j < b.column; j++)
+			{
+				QXfloat sum{ b(i, j) };
+				for (QXint k = i + 1; k < size; k++)
+					sum -= a(i, k) * b(k, j);
+
+				b(i, j) = sum * inverse;
+			}
+		}
+
+		return true;
+	}
+	#pragma endregion Functions
+}
@@ -0,0 +1,293 @@
+#include "Polynomial.h"
+
+#include "Parallel.h"
+#include "Simd.h"
+
+namespace Math
+{
+	#pragma region Static Functions
+
+	/* polynomials are written on a lane type with coefs by increasing power, missing roots are FLT_MAX */
+
+	/* value, slope and rounding error bound together */
+	template<QXuint Degree, typename T>
+	static T EvaluatePolynomial(const T* coefficients, T x, T& slope, T& error) noexcept
+	{
+		T value{ coefficients[Degree] }, absX{ Abs(x) }, magnitude{ Abs(coefficients[Degree]) };
+		slope = T(0.f);
+		for (QXuint k = Degree; k-- > 0;)
+		{
+			slope = slope * x + value;
+			value = value * x + coefficients[k];
+			magnitude = magnitude * absX + Abs(coefficients[k]);
+		}
+
+		error = magnitude * T(QX_POLYNOMIAL_EPSILON);
+		return value;
+	}
+
+	/* signs differ, without a product that could underflow */
+	template<typename T>
+	static auto OppositeSigns(T a, T b) noexcept
+	{
+		return Less(Select(Less(a, T(0.f)), -b, b), T(0.f));
+	}
+
+	template<QXuint Count, typename T>
+	static void SortRoots(T* roots) noexcept
+	{
+		for (QXuint pass = Count; pass-- > 1;)
+			for (QXuint i = 0; i < pass; i++)
+			{
+				T low{ Min(roots[i], roots[i + 1]) };
+				roots[i + 1] = Max(roots[i], roots[i + 1]);
+				roots[i] = low;
+			}
+	}
+
+	/* the brackets of all the intervals are searched together, the lanes set in active change sign on a bracket
+	   where the polynomial is monotonic: Newton steps, or the secant of the bracket when they leave it */
+	template<QXuint Degree, typename T, typename M>
+	static void SearchRoots(const T* coefficients, T* left, T* right, T* valueLeft, T* valueRight, const M* active, T* roots) noexcept
+	{
+		const M			everyLane{ LessEqual(T(0.f), T(0.f)) };
+		const QXuint	all{ Mask(everyLane) };
+
+		M keptLeft[Degree], done[Degree];
+		for (QXuint k = 0; k < Degree; k++)
+		{
+			keptLeft[k] = AndNot(everyLane, everyLane);
+			done[k] = AndNot(everyLane, active[k]);
+			roots[k] = left[k] + (right[k] - left[k]) * (valueLeft[k] / (valueLeft[k] - valueRight[k]));
+		}
+
+		for (QXuint i = 0; i < QX_POLYNOMIAL_MAX_ITERATIONS; i++)
+		{
+			QXuint finished{ all };
+			for (QXuint k = 0; k < Degree; k++)
+			{
+				if (Mask(done[k]) == all)
+					continue;
+
+				T x{ roots[k] }, slope, error, value{ EvaluatePolynomial<Degree>(coefficients, x, slope, error) };
+
+				/* keep the sign change inside the bracket */
+				M crossed{ OppositeSigns(valueLeft[k], value) };
+				right[k] = Select(crossed, x, right[k]);
+				valueRight[k] = Select(crossed, value, valueRight[k]);
+				left[k] = Select(crossed, left[k], x);
+				valueLeft[k] = Select(crossed, valueLeft[k], value);
+
+				/* Illinois: halve the value of an end kept twice, so the secant does not stall on it */
+				valueLeft[k] = Select(And(crossed, keptLeft[k]), valueLeft[k] * T(0.5f), valueLeft[k]);
+				valueRight[k] = Select(Or(crossed, keptLeft[k]), valueRight[k], valueRight[k] * T(0.5f));
+				keptLeft[k] = crossed;
+
+				T newton{ x - value / slope };
+				T secant{ left[k] + (right[k] - left[k]) * (valueLeft[k] / (valueLeft[k] - valueRight[k])) };
+				M inside{ And(Less(left[k], newton), Less(newton, right[k])) };
+				T next{ Select(inside, newton, secant) };
+
+				/* the value cannot get any closer to zero, or the step or bracket are below float precision */
+				T precision{ Abs(x) * T(FLT_EPSILON) };
+				M zero{ LessEqual(Abs(value), error) };
+				M converged{ Or(And(inside, LessEqual(Abs(newton - x), precision)), LessEqual(right[k] - left[k], precision)) };
+
+				roots[k] = Select(Or(done[k], zero), x, next);
+				done[k] = Or(done[k], Or(zero, converged));
+				finished &= Mask(done[k]);
+			}
+
+			if (finished == all)
+				break;
+		}
+	}
+
+	/* roots in [lower, upper] with lower <= upper */
+	template<QXuint Degree, typename T>
+	static void FindRoots(const T* coefficients, T lower, T upper, T* roots) noexcept
+	{
+		if constexpr (Degree == 2)
+		{
+			T a{ coefficients[2] }, b{ coefficients[1] }, c{ coefficients[0] };
+			T discriminant{ b * b - T(4.f) * a * c };
+
+			/* b and the square root have the same sign in q, the smaller root is c / q instead of a difference of close values */
+			T squareRoot{ Sqrt(Max(discriminant, T(0.f))) };
+			T q{ T(-0.5f) * (b + Select(Less(b, T(0.f)), -squareRoot, squareRoot)) };
+
+			auto touching{ LessEqual(Abs(discriminant), (b * b + Abs(T(4.f) * a * c)) * T(QX_POLYNOMIAL_EPSILON)) };
+			auto real{ Or(touching, LessEqual(T(0.f), discriminant)) };
+
+			roots[0] = Select(touching, -b / (T(2.f) * a), q / a);
+			roots[1] = Select(touching, T(FLT_MAX), c / q);
+
+			/* a null a or q gives an infinite or NaN root, outside of the interval */
+			for (QXuint k = 0; k < 2; k++)
+				roots[k] = Select(And(real, And(LessEqual(lower, roots[k]), LessEqual(roots[k], upper))), roots[k], T(FLT_MAX));
+
+			SortRoots<2>(roots);
+		}
+		else
+		{
+			using M = decltype(Less(lower, upper));
+
+			T derivative[Degree];
+			for (QXuint k = 0; k < Degree; k++)
+				derivative[k] = coefficients[k + 1] * T((QXfloat)(k + 1));
+
+			/* the polynomial is monotonic between two critical points: ends of the intervals */
+			T critical[Degree - 1];
+			FindRoots<Degree - 1>(derivative, lower, upper, critical);
+
+			T ends[Degree + 1], values[Degree + 1];
+			M zeros[Degree + 1];
+			for (QXuint k = 0; k <= Degree; k++)
+			{
+				ends[k] = k == 0 ? lower : k == Degree ? upper : Min(critical[k - 1], upper);
+
+				T slope, error;
+				values[k] = EvaluatePolynomial<Degree>(coefficients, ends[k], slope, error);
+				zeros[k] = LessEqual(Abs(values[k]), error);
+			}
+
+			/* one root per interval, the last candidate is lower itself */
+			T		candidates[Degree + 1];
+			T		left[Degree], right[Degree], valueLeft[Degree], valueRight[Degree];
+			M		crossing[Degree];
+			QXuint	searched{ 0 };
+
+			candidates[Degree] = Select(zeros[0], lower, T(FLT_MAX));
+			for (QXuint k = 0; k < Degree; k++)
+			{
+				left[k] = ends[k];
+				right[k] = ends[k + 1];
+				valueLeft[k] = values[k];
+				valueRight[k] = values[k + 1];
+				crossing[k] = AndNot(AndNot(OppositeSigns(values[k], values[k + 1]), zeros[k]), zeros[k + 1]);
+				searched |= Mask(crossing[k]);
+
+				/* a zero at a critical point is a double root, kept once */
+				candidates[k] = Select(And(zeros[k + 1], Less(ends[k], ends[k + 1])), ends[k + 1], T(FLT_MAX));
+			}
+
+			if (searched != 0)
+			{
+				T found[Degree];
+				SearchRoots<Degree>(coefficients, left, right, valueLeft, valueRight, crossing, found);
+
+				for (QXuint k = 0; k < Degree; k++)
+					candidates[k] = Select(crossing[k], found[k], candidates[k]);
+			}
+
+			SortRoots<Degree + 1>(candidates);
+			for (QXuint k = 0; k < Degree; k++)
+				roots[k] = candidates[k];
+		}
+	}
+
+	/* coefs by decreasing power, as in the public functions */
+	template<QXuint Degree, typename T>
+	static void SolveLanes(const T* coefficients, QXfloat lower, QXfloat upper, T* roots) noexcept
+	{
+		T increasing[Degree + 1];
+		for (QXuint k = 0; k <= Degree; k++)
+			increasing[k] = coefficients[Degree - k];
+
+		/* the closed form never evaluates the polynomial, and finds nothing for a null polynomial */
+		if constexpr (Degree == 2)
+		{
+			FindRoots<Degree>(increasing, T(lower), T(upper), roots);
+			return;
+		}
+
+		/* leading coef of the actual degree, null for the null polynomial */
+		T leading{ increasing[Degree] }, largest{ Abs(increasing[Degree]) };
+		for (QXuint k = Degree; k-- > 0;)
+		{
+			leading = Select(LessEqual(Abs(leading), T(0.f)), increasing[k], leading);
+			largest = Max(largest, Abs(increasing[k]));
+		}
+
+		/* Cauchy bound: every root is inside it, so the polynomial is never evaluated at infinity */
+		auto	solvable{ Less(T(0.f), Abs(leading)) };
+		T		bound{ Select(solvable, T(1.f) + largest / Abs(leading), T(1.f)) };
+		T		low{ Max(T(lower), -bound) };
+		T		high{ Max(low, Min(T(upper), bound)) };
+
+		FindRoots<Degree>(increasing, low, high, roots);
+
+		for (QXuint k = 0; k < Degree; k++)
+			roots[k] = Select(solvable, roots[k], T(FLT_MAX));
+	}
+
+	template<QXuint Degree>
+	static QXroots<Degree> SolveScalar(const QXfloat (&coefficients)[Degree + 1], QXfloat lower, QXfloat upper) noexcept
+	{
+		QXroots<Degree> result;
+		SolveLanes<Degree>(coefficients, lower, upper, result.values);
+
+		while (result.count < Degree && result.values[result.count] != FLT_MAX)
+			result.count++;
+
+		return result;
+	}
+
+	#pragma endregion Static Functions
+
+	#pragma region Functions
+
+	QXroots<2> SolveQuadratic(QXfloat a, QXfloat b, QXfloat c, QXfloat lower, QXfloat upper) noexcept
+	{
+		return SolveScalar<2>({ a, b, c }, lower, upper);
+	}
+
+	QXroots<3> SolveCubic(QXfloat a, QXfloat b, QXfloat c, QXfloat d, QXfloat lower, QXfloat upper) noexcept
+	{
+		return SolveScalar<3>({ a, b, c, d }, lower, upper);
+	}
+
+	QXroots<4> SolveQuartic(QXfloat a, QXfloat b, QXfloat c, QXfloat d, QXfloat e, QXfloat lower, QXfloat upper) noexcept
+	{
+		return SolveScalar<4>({ a, b, c, d, e }, lower, upper);
+	}
+
+	template<QXuint Degree>
+	void SolvePolynomials(const QXfloat* const* coefficients, QXuint count, QXfloat* const* roots, QXfloat lower, QXfloat upper, QXbool parallel)
+	{
+		ParallelFor(count, parallel, [&](QXuint begin, QXuint end)
+		{
+			auto solveLanes = [&](auto lanes, QXuint i)
+			{
+				using T = decltype(lanes);
+
+				T coefs[Degree + 1], laneRoots[Degree];
+				for (QXuint k = 0; k <= Degree; k++)
+					coefs[k] = Load<T>(coefficients[k] + i);
+
+				SolveLanes<Degree>(coefs, lower, upper, laneRoots);
+
+				for (QXuint k = 0; k < Degree; k++)
+					Store(roots[k] + i, laneRoots[k]);
+			};
+
+			QXuint i{ begin };
+#if defined(QX_SIMD_AVX)
+			for (; i + 8 <= end; i += 8)
+				solveLanes(QXlane8(), i);
+#endif
+#if defined(QX_SIMD_SSE)
+			for (; i + 4 <= end; i += 4)
+				solveLanes(QXlane4(), i);
+#endif
+			for (; i < end; i++)
+				solveLanes(QXfloat(), i);
+		});
+	}
+
+	template void	SolvePolynomials<2>(const QXfloat* const*, QXuint, QXfloat* const*, QXfloat, QXfloat, QXbool);
+	template void	SolvePolynomials<3>(const QXfloat* const*, QXuint, QXfloat* const*, QXfloat, QXfloat, QXbool);
+	template void	SolvePolynomials<4>(const QXfloat* const*, QXuint, QXfloat* const*, QXfloat, QXfloat, QXbool);
+
+	#pragma endregion Functions
+}
@@ -7,28 +7,32 @@ namespace Math
 
 #pragma region Constructors
 
-	QXref3::QXref3(const QXvec3& O, QXfloat AngleI, QXfloat AngleJ, QXfloat AngleK) noexcept :
+	template<typename T>
+	QXref3t<T>::QXref3t(const QXvec3t<T>& O, T AngleI, T AngleJ, T AngleK) noexcept :
 		o{ O },
-		i{ QXmat4::CreateFixedAngleEulerRotationMatrix(QXvec3(AngleI, AngleJ, AngleK)) * QXvec3::right },
-		j{ QXmat4::CreateFixedAngleEulerRotationMatrix(QXvec3(AngleI, AngleJ, AngleK)) * QXvec3::up },
-		k{ QXmat4::CreateFixedAngleEulerRotationMatrix(QXvec3(AngleI, AngleJ, AngleK)) * QXvec3::forward }
+		i{ QXmat4t<T>::CreateFixedAngleEulerRotationMatrix(QXvec3t<T>(AngleI, AngleJ, AngleK)) * QXvec3t<T>::right },
+		j{ QXmat4t<T>::CreateFixedAngleEulerRotationMatrix(QXvec3t<T>(AngleI, AngleJ, AngleK)) * QXvec3t<T>::up },
+		k{ QXmat4t<T>::CreateFixedAngleEulerRotationMatrix(QXvec3t<T>(AngleI, AngleJ, AngleK)) * QXvec3t<T>::forward }
 	{}
 
-	QXref3::QXref3(const QXvec3& O, const QXvec3& I, const QXvec3& J, const QXvec3& K) noexcept :
+	template<typename T>
+	QXref3t<T>::QXref3t(const QXvec3t<T>& O, const QXvec3t<T>& I, const QXvec3t<T>& J, const QXvec3t<T>& K) noexcept :
 		o {O},
 		i {I.Normalized()},
 		j {J.Normalized()},
 		k {K.Normalized()}        
   {}
 
-	QXref3::QXref3(const QXref3& ref) noexcept :
+	template<typename T>
+	QXref3t<T>::QXref3t(const QXref3t<T>& ref) noexcept :
   		o {ref.o},
 		i {ref.i},
 		j {ref.j},
 		k {ref.k}
 	{}
 
-	QXref3::QXref3(QXref3&& ref) noexcept :
+	template<typename T>
+	QXref3t<T>::QXref3t(QXref3t<T>&& ref) noexcept :
 		o {std::move(ref.o)},
 		i {std::move(ref.i)},
 		j {std::move(ref.j)},
@@ -39,7 +43,8 @@ namespace Math
 
   #pragma region Operators
 
-	QXref3&   QXref3::operator=(const QXref3& ref) noexcept
+	template<typename T>
+	QXref3t<T>&   QXref3t<T>::operator=(const QXref3t<T>& ref) noexcept
 	{
 		o = ref.o;
 		i = ref.i;
@@ -49,7 +54,8 @@ namespace Math
 		return *this;
 	}
 
-	QXref3& QXref3::operator=(QXref3&& ref) noexcept
+	template<typename T>
+	QXref3t<T>& QXref3t<T>::operator=(QXref3t<T>&& ref) noexcept
 	{
 		o = std::move(ref.o);
 		i = std::move(ref.i);
@@ -59,14 +65,16 @@ namespace Math
 		return *this;
 	}
 
-	QXbool QXref3::operator==(const QXref3& ref) const noexcept
+	template<typename T>
+	QXbool QXref3t<T>::operator==(const QXref3t<T>& ref) const noexcept
 	{
 		if (o == ref.o && i == ref.i && j == ref.j && k == ref.k)
 		return true;
 		return false;
 	}
 
-	QXref3& QXref3::operator*=(const QXmat4& m) noexcept
+	template<typename T>
+	QXref3t<T>& QXref3t<T>::operator*=(const QXmat4t<T>& m) noexcept
 	{
 		o = m * o;
 		i = m * i;
@@ -75,9 +83,10 @@ namespace Math
 		return *this;
 	}
 
-	QXref3 QXref3::operator*(const QXmat4& m) const noexcept
+	template<typename T>
+	QXref3t<T> QXref3t<T>::operator*(const QXmat4t<T>& m) const noexcept
 	{
-		QXref3 res{ *this };
+		QXref3t<T> res{ *this };
 		res.o = m * res.o;
 		res.i = m * res.i;
 		res.j = m * res.j;
@@ -85,7 +94,8 @@ namespace Math
 		return res;
 	}
 
-	QXbool QXref3::operator!=(const QXref3& ref) const noexcept
+	template<typename T>
+	QXbool QXref3t<T>::operator!=(const QXref3t<T>& ref) const noexcept
 	{
 		if (o != ref.o || i != ref.i || j != ref.j || k != ref.k)
 		return true;
@@ -96,9 +106,10 @@ namespace Math
 
 #pragma region Functions
 
-	QXref3 QXref3::GlobalToLocal(const QXref3& ref) const noexcept
+	template<typename T>
+	QXref3t<T> QXref3t<T>::GlobalToLocal(const QXref3t<T>& ref) const noexcept
 	{
-		QXmat4 m;
+		QXmat4t<T> m;
 
 		m[0][0] = ref.i.x;
 		m[0][1] = ref.j.x;
@@ -116,14 +127,15 @@ namespace Math
 
 		m = m.Inverse();
 
-		QXref3 res{ *this };
+		QXref3t<T> res{ *this };
 
 		return res*m;
 	}
 
-	QXref3 QXref3::LocalToGlobal(const QXref3& ref) const noexcept
+	template<typename T>
+	QXref3t<T> QXref3t<T>::LocalToGlobal(const QXref3t<T>& ref) const noexcept
 	{
-		QXmat4 m;
+		QXmat4t<T> m;
 
 		m[0][0] = ref.i.x;
 		m[0][1] = ref.j.x;
@@ -139,12 +151,13 @@ namespace Math
 		m[2][3] = ref.o.z;
 		m[3][3] = 1;
 
-		QXref3 res { *this };
+		QXref3t<T> res { *this };
 
 		return res * m;
 	}
 
-	QXref3& QXref3::Rotate(const QXquaternion& quat) noexcept
+	template<typename T>
+	QXref3t<T>& QXref3t<T>::Rotate(const QXquaterniont<T>& quat) noexcept
 	{
 		i = quat * i;
 		j = quat * j;
@@ -153,9 +166,10 @@ namespace Math
 		return *this;
 	}
 
-	QXref3 QXref3::Rotate(const QXquaternion& quat) const noexcept
+	template<typename T>
+	QXref3t<T> QXref3t<T>::Rotate(const QXquaterniont<T>& quat) const noexcept
 	{
-		QXref3 res{ *this };
+		QXref3t<T> res{ *this };
 
 		res.i = quat * res.i;
 		res.j = quat * res.j;
@@ -164,19 +178,24 @@ namespace Math
 		return res;
 	}
 
-	QXref3& QXref3::Translate(const QXvec3& value) noexcept
+	template<typename T>
+	QXref3t<T>& QXref3t<T>::Translate(const QXvec3t<T>& value) noexcept
 	{
 		o += value;
 
 		return *this;
 	}
 
-	QXref3 QXref3::Translate(const QXvec3& value) const noexcept
+	template<typename T>
+	QXref3t<T> QXref3t<T>::Translate(const QXvec3t<T>& value) const noexcept
 	{
-		QXref3 res{ *this };
+		QXref3t<T> res{ *this };
 		res.o += value;
 
 		return res;
 	}
   #pragma endregion
+
+	template struct QXref3t<QXfloat>;
+	template struct QXref3t<QXdouble>;
 }
@@ -0,0 +1,333 @@
+#include "Skinning.h"
+#include "Simd.h"
+
+#include <cmath>
+#include <float.h>
+
+namespace Math
+{
+	#pragma region Scalar Functions
+
+	static void	SkinLinearBlendVertex(const QXmat4* palette, const QXskinInput& input,
+									const QXskinOutput& output, QXuint i) noexcept
+	{
+		QXfloat m[12]{};
+
+		for (QXuint b = 0; b < QX_SKIN_MAX_INFLUENCES; b++)
+		{
+			QXfloat w{ input.boneWeights[b][i] };
+			if (w == 0.f)
+				continue;
+
+			const QXfloat* bone{ palette[input.boneIndices[b][i]].array };
+			for (QXuint e = 0; e < 12; e++)
+				m[e] += w * bone[e];
+		}
+
+		QXfloat px{ input.positionX[i] }, py{ input.positionY[i] }, pz{ input.positionZ[i] };
+
+		output.positionX[i] = m[0] * px + m[1] * py + m[2] * pz + m[3];
+		output.positionY[i] = m[4] * px + m[5] * py + m[6] * pz + m[7];
+		output.positionZ[i] = m[8] * px + m[9] * py + m[10] * pz + m[11];
+
+		if (input.normalX == nullptr || output.normalX == nullptr)
+			return;
+
+		QXfloat nx{ input.normalX[i] }, ny{ input.normalY[i] }, nz{ input.normalZ[i] };
+		QXfloat ox{ m[0] * nx + m[1] * ny + m[2] * nz };
+		QXfloat oy{ m[4] * nx + m[5] * ny + m[6] * nz };
+		QXfloat oz{ m[8] * nx + m[9] * ny + m[10] * nz };
+
+		/* blended matrices are not rigid anymore, normals have to be renormalized */
+		QXfloat sqrLen{ ox * ox + oy * oy + oz * oz };
+		QXfloat invLen{ 1.f / sqrtf(sqrLen > FLT_MIN ? sqrLen : FLT_MIN) };
+
+		output.normalX[i] = ox * invLen;
+		output.normalY[i] = oy * invLen;
+		output.normalZ[i] = oz * invLen;
+	}
+
+	static void	SkinDualQuaternionVertex(const QXdualQuaternion* palette, const QXskinInput& input,
+									const QXskinOutput& output, QXuint i) noexcept
+	{
+		QXfloat r[4]{}, d[4]{};
+		const QXquaternion& pivot{ palette[input.boneIndices[0][i]].real };
+
+		for (QXuint b = 0; b < QX_SKIN_MAX_INFLUENCES; b++)
+		{
+			QXfloat w{ input.boneWeights[b][i] };
+			if (w == 0.f)
+				continue;
+
+			const QXdualQuaternion& bone{ palette[input.boneIndices[b][i]] };
+
+			/* q and -q are the same rotation, blend in the hemisphere of the first bone */
+			if (bone.real.DotProductQuaternion(pivot) < 0.f)
+				w = -w;
+
+			r[0] += w * bone.real.w;
+			r[1] += w * bone.real.v.x;
+			r[2] += w * bone.real.v.y;
+			r[3] += w * bone.real.v.z;
+			d[0] += w * bone.dual.w;
+			d[1] += w * bone.dual.v.x;
+			d[2] += w * bone.dual.v.y;
+			d[3] += w * bone.dual.v.z;
+		}
+
+		QXfloat sqrLen{ r[0] * r[0] + r[1] * r[1] + r[2] * r[2] + r[3] * r[3] };
+		QXfloat invLen{ 1.f / sqrtf(sqrLen > FLT_MIN ? sqrLen : FLT_MIN) };
+
+		QXvec3	rv{ r[1] * invLen, r[2] * invLen, r[3] * invLen };
+		QXvec3	dv{ d[1] * invLen, d[2] * invLen, d[3] * invLen };
+		QXfloat	rw{ r[0] * invLen }, dw{ d[0] * invLen };
+
+		/* t = 2 * (rw * dv - dw * rv + rv x dv) */
+		QXvec3 t{ (dv * rw - rv * dw + rv.Cross(dv)) * 2.f };
+
+		QXvec3 p{ input.positionX[i], input.positionY[i], input.positionZ[i] };
+		p = p + rv.Cross(rv.Cross(p) + p * rw) * 2.f + t;
+
+		output.positionX[i] = p.x;
+		output.positionY[i] = p.y;
+		output.positionZ[i] = p.z;
+
+		if (input.normalX == nullptr || output.normalX == nullptr)
+			return;
+
+		QXvec3 n{ input.normalX[i], input.normalY[i], input.normalZ[i] };
+		n = n + rv.Cross(rv.Cross(n) + n * rw) * 2.f;
+
+		output.normalX[i] = n.x;
+		output.normalY[i] = n.y;
+		output.normalZ[i] = n.z;
+	}
+
+	#pragma endregion Scalar Functions
+
+#ifdef QX_SIMD_SSE
+	#pragma region SIMD Functions
+
+	static inline __m128	Madd(__m128 a, __m128 b, __m128 c) noexcept
+	{
+		return _mm_add_ps(_mm_mul_ps(a, b), c);
+	}
+
+	static inline __m128	InvLength(__m128 x, __m128 y, __m128 z, __m128 w) noexcept
+	{
+		__m128 sqrLen{ Madd(x, x, Madd(y, y, Madd(z, z, _mm_mul_ps(w, w)))) };
+
+		return _mm_div_ps(_mm_set1_ps(1.f), _mm_sqrt_ps(_mm_max_ps(sqrLen, _mm_set1_ps(FLT_MIN))));
+	}
+
+	static inline __m128	LoadQuaternion(const QXquaternion& q) noexcept
+	{
+		return _mm_setr_ps(q.w, q.v.x, q.v.y, q.v.z);
+	}
+
+	/* cross product a x b of 4 vectors at once */
+	static inline void		Cross(__m128 ax, __m128 ay, __m128 az, __m128 bx, __m128 by, __m128 bz,
+								__m128& rx, __m128& ry, __m128& rz) noexcept
+	{
+		rx = _mm_sub_ps(_mm_mul_ps(ay, bz), _mm_mul_ps(az, by));
+		ry = _mm_sub_ps(_mm_mul_ps(az, bx), _mm_mul_ps(ax, bz));
+		rz = _mm_sub_ps(_mm_mul_ps(ax, by), _mm_mul_ps(ay, bx));
+	}
+
+	/* v' = v + 2 * rv x (rv x v + rw * v) */
+	static inline void		Rotate(__m128 rw, __m128 rx, __m128 ry, __m128 rz,
+								__m128& x, __m128& y, __m128& z) noexcept
+	{
+		__m128 cx, cy, cz, tx, ty, tz;
+
+		Cross(rx, ry, rz, x, y, z, cx, cy, cz);
+		cx = Madd(x, rw, cx);
+		cy = Madd(y, rw, cy);
+		cz = Madd(z, rw, cz);
+		Cross(rx, ry, rz, cx, cy, cz, tx, ty, tz);
+
+		__m128 two{ _mm_set1_ps(2.f) };
+		x = Madd(tx, two, x);
+		y = Madd(ty, two, y);
+		z = Madd(tz, two, z);
+	}
+
+	static void	SkinLinearBlend4(const QXmat4* palette, const QXskinInput& input,
+								const QXskinOutput& output, QXuint i) noexcept
+	{
+		__m128 m[12];
+		for (QXuint e = 0; e < 12; e++)
+			m[e] = _mm_setzero_ps();
+
+		for (QXuint b = 0; b < QX_SKIN_MAX_INFLUENCES; b++)
+		{
+			__m128 w{ _mm_loadu_ps(input.boneWeights[b] + i) };
+			const QXuint* idx{ input.boneIndices[b] + i };
+
+			for (QXuint row = 0; row < 3; row++)
+			{
+				__m128 c0{ _mm_loadu_ps(palette[idx[0]].array + row * 4) };
+				__m128 c1{ _mm_loadu_ps(palette[idx[1]].array + row * 4) };
+				__m128 c2{ _mm_loadu_ps(palette[idx[2]].array + row * 4) };
+				__m128 c3{ _mm_loadu_ps(palette[idx[3]].array + row * 4) };
+
+				/* after transpose, cN holds element [row][N] of the 4 vertices' bones */
+				_MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+
+				m[row * 4 + 0] = Madd(w, c0, m[row * 4 + 0]);
+				m[row * 4 + 1] = Madd(w, c1, m[row * 4 + 1]);
+				m[row * 4 + 2] = Madd(w, c2, m[row * 4 + 2]);
+				m[row * 4 + 3] = Madd(w, c3, m[row * 4 + 3]);
+			}
+		}
+
+		__m128 px{ _mm_loadu_ps(input.positionX + i) };
+		__m128 py{ _mm_loadu_ps(input.positionY + i) };
+		__m128 pz{ _mm_loadu_ps(input.positionZ + i) };
+
+		_mm_storeu_ps(output.positionX + i, Madd(m[0], px, Madd(m[1], py, Madd(m[2], pz, m[3]))));
+		_mm_storeu_ps(output.positionY + i, Madd(m[4], px, Madd(m[5], py, Madd(m[6], pz, m[7]))));
+		_mm_storeu_ps(output.positionZ + i, Madd(m[8], px, Madd(m[9], py, Madd(m[10], pz, m[11]))));
+
+		if (input.normalX == nullptr || output.normalX == nullptr)
+			return;
+
+		__m128 nx{ _mm_loadu_ps(input.normalX + i) };
+		__m128 ny{ _mm_loadu_ps(input.normalY + i) };
+		__m128 nz{ _mm_loadu_ps(input.normalZ + i) };
+
+		__m128 ox{ Madd(m[0], nx, Madd(m[1], ny, _mm_mul_ps(m[2], nz))) };
+		__m128 oy{ Madd(m[4], nx, Madd(m[5], ny, _mm_mul_ps(m[6], nz))) };
+		__m128 oz{ Madd(m[8], nx, Madd(m[9], ny, _mm_mul_ps(m[10], nz))) };
+		__m128 invLen{ InvLength(ox, oy, oz, _mm_setzero_ps()) };
+
+		_mm_storeu_ps(output.normalX + i, _mm_mul_ps(ox, invLen));
+		_mm_storeu_ps(output.normalY + i, _mm_mul_ps(oy, invLen));
+		_mm_storeu_ps(output.normalZ + i, _mm_mul_ps(oz, invLen));
+	}
+
+	static void	SkinDualQuaternion4(const QXdualQuaternion* palette, const QXskinInput& input,
+									const QXskinOutput& output, QXuint i) noexcept
+	{
+		__m128 rw{ _mm_setzero_ps() }, rx{ rw }, ry{ rw }, rz{ rw };
+		__m128 dw{ rw }, dx{ rw }, dy{ rw }, dz{ rw };
+		__m128 pw, px, py, pz;
+		__m128 signMask{ _mm_set1_ps(-0.f) };
+
+		for (QXuint b = 0; b < QX_SKIN_MAX_INFLUENCES; b++)
+		{
+			__m128 w{ _mm_loadu_ps(input.boneWeights[b] + i) };
+			const QXuint* idx{ input.boneIndices[b] + i };
+
+			__m128 qw{ LoadQuaternion(palette[idx[0]].real) };
+			__m128 qx{ LoadQuaternion(palette[idx[1]].real) };
+			__m128 qy{ LoadQuaternion(palette[idx[2]].real) };
+			__m128 qz{ LoadQuaternion(palette[idx[3]].real) };
+			_MM_TRANSPOSE4_PS(qw, qx, qy, qz);
+
+			__m128 ew{ LoadQuaternion(palette[idx[0]].dual) };
+			__m128 ex{ LoadQuaternion(palette[idx[1]].dual) };
+			__m128 ey{ LoadQuaternion(palette[idx[2]].dual) };
+			__m128 ez{ LoadQuaternion(palette[idx[3]].dual) };
+			_MM_TRANSPOSE4_PS(ew, ex, ey, ez);
+
+			if (b == 0)
+			{
+				pw = qw;
+				px = qx;
+				py = qy;
+				pz = qz;
+			}
+			else
+			{
+				/* q and -q are the same rotation, blend in the hemisphere of the first bone */
+				__m128 dot{ Madd(qw, pw, Madd(qx, px, Madd(qy, py, _mm_mul_ps(qz, pz)))) };
+				__m128 negative{ _mm_cmplt_ps(dot, _mm_setzero_ps()) };
+				w = _mm_xor_ps(w, _mm_and_ps(negative, signMask));
+			}
+
+			rw = Madd(w, qw, rw);
+			rx = Madd(w, qx, rx);
+			ry = Madd(w, qy, ry);
+			rz = Madd(w, qz, rz);
+			dw = Madd(w, ew, dw);
+			dx = Madd(w, ex, dx);
+			dy = Madd(w, ey, dy);
+			dz = Madd(w, ez, dz);
+		}
+
+		__m128 invLen{ InvLength(rx, ry, rz, rw) };
+		rw = _mm_mul_ps(rw, invLen);
+		rx = _mm_mul_ps(rx, invLen);
+		ry = _mm_mul_ps(ry, invLen);
+		rz = _mm_mul_ps(rz, invLen);
+		dw = _mm_mul_ps(dw, invLen);
+		dx = _mm_mul_ps(dx, invLen);
+		dy = _mm_mul_ps(dy, invLen);
+		dz = _mm_mul_ps(dz, invLen);
+
+		/* t = 2 * (rw * dv - dw * rv + rv x dv) */
+		__m128 tx, ty, tz;
+		Cross(rx, ry, rz, dx, dy, dz, tx, ty, tz);
+		__m128 two{ _mm_set1_ps(2.f) };
+		tx = _mm_mul_ps(two, _mm_sub_ps(Madd(rw, dx, tx), _mm_mul_ps(dw, rx)));
+		ty = _mm_mul_ps(two, _mm_sub_ps(Madd(rw, dy, ty), _mm_mul_ps(dw, ry)));
+		tz = _mm_mul_ps(two, _mm_sub_ps(Madd(rw, dz, tz), _mm_mul_ps(dw, rz)));
+
+		__m128 x{ _mm_loadu_ps(input.positionX + i) };
+		__m128 y{ _mm_loadu_ps(input.positionY + i) };
+		__m128 z{ _mm_loadu_ps(input.positionZ + i) };
+		Rotate(rw, rx, ry, rz, x, y, z);
+
+		_mm_storeu_ps(output.positionX + i, _mm_add_ps(x, tx));
+		_mm_storeu_ps(output.positionY + i, _mm_add_ps(y, ty));
+		_mm_storeu_ps(output.positionZ + i, _mm_add_ps(z, tz));
+
+		if (input.normalX == nullptr || output.normalX == nullptr)
+			return;
+
+		x = _mm_loadu_ps(input.normalX + i);
+		y = _mm_loadu_ps(input.normalY + i);
+		z = _mm_loadu_ps(input.normalZ + i);
+		Rotate(rw, rx, ry, rz, x, y, z);
+
+		_mm_storeu_ps(output.normalX + i, x);
+		_mm_storeu_ps(output.normalY + i, y);
+		_mm_storeu_ps(output.normalZ + i, z);
+	}
+
+	#pragma endregion SIMD Functions
+#endif
+
+	#pragma region Functions
+
+	void	SkinLinearBlend(const QXmat4* palette, const QXskinInput& input,
+							const QXskinOutput& output, QXuint count) noexcept
+	{
+		QXuint i{ 0 };
+
+#ifdef QX_SIMD_SSE
+		for (; i + 4 <= count; i += 4)
+			SkinLinearBlend4(palette, input, output, i);
+#endif
+
+		for (; i < count; i++)
+			SkinLinearBlendVertex(palette, input, output, i);
+	}
+
+	void	SkinDualQuaternion(const QXdualQuaternion* palette, const QXskinInput& input,
+							const QXskinOutput& output, QXuint count) noexcept
+	{
+		QXuint i{ 0 };
+
+#ifdef QX_SIMD_SSE
+		for (; i + 4 <= count; i += 4)
+			SkinDualQuaternion4(palette, input, output, i);
+#endif
+
+		for (; i < count; i++)
+			SkinDualQuaternionVertex(palette, input, output, i);
+	}
+
+	#pragma endregion Functions
+}
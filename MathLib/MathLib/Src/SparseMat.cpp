@@ -0,0 +1,299 @@
+#include "SparseMat.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Parallel.h"
+
+namespace Math
+{
+	#pragma region Static Functions
+
+	static QXdouble	Dot(const std::vector<QXfloat>& a, const std::vector<QXfloat>& b) noexcept
+	{
+		QXdouble res{ 0.0 };
+
+		for (size_t i = 0; i < a.size(); i++)
+			res += (QXdouble)a[i] * b[i];
+
+		return res;
+	}
+
+	/* y = M * x on lines begin to end */
+	static void	MultiplyRows(const QXsparseMat& mat, const QXfloat* x, QXfloat* y, QXuint begin, QXuint end) noexcept
+	{
+		for (QXuint i = begin; i < end; i++)
+		{
+			QXfloat sum{ 0.f };
+
+			for (QXuint k = mat.rowStart[i]; k < mat.rowStart[i + 1]; k++)
+				sum += mat.values[k] * x[mat.columnIndices[k]];
+
+			y[i] = sum;
+		}
+	}
+
+	#pragma endregion Static Functions
+
+	#pragma region Constructor/Destructor
+	QXsparseMat::QXsparseMat(QXint ln, QXint col) :
+		line{ ln },
+		column{ col },
+		rowStart(ln + 1, 0)
+	{}
+
+	QXsparseMat::QXsparseMat(QXint ln, QXint col, const std::vector<QXtriplet>& triplets) :
+		line{ ln },
+		column{ col },
+		rowStart(ln + 1, 0)
+	{
+		/* counting sort by line, then sort and merge each line by column */
+		for (const QXtriplet& triplet : triplets)
+			rowStart[triplet.line + 1]++;
+
+		for (QXint i = 0; i < line; i++)
+			rowStart[i + 1] += rowStart[i];
+
+		std::vector<QXuint>		next(rowStart.begin(), rowStart.end() - 1);
+		std::vector<QXuint>		columns(triplets.size());
+		std::vector<QXfloat>	entries(triplets.size());
+
+		for (const QXtriplet& triplet : triplets)
+		{
+			QXuint idx{ next[triplet.line]++ };
+			columns[idx] = triplet.column;
+			entries[idx] = triplet.value;
+		}
+
+		columnIndices.reserve(triplets.size());
+		values.reserve(triplets.size());
+
+		std::vector<QXuint> order;
+		for (QXint i = 0; i < line; i++)
+		{
+			QXuint begin{ rowStart[i] }, end{ rowStart[i + 1] };
+
+			order.resize(end - begin);
+			for (QXuint k = begin; k < end; k++)
+				order[k - begin] = k;
+			std::sort(order.begin(), order.end(), [&](QXuint a, QXuint b) { return columns[a] < columns[b]; });
+
+			rowStart[i] = (QXuint)values.size();
+			for (QXuint k : order)
+			{
+				if (values.size() > rowStart[i] && columnIndices.back() == columns[k])
+					values.back() += entries[k];
+				else
+				{
+					columnIndices.push_back(columns[k]);
+					values.push_back(entries[k]);
+				}
+			}
+		}
+
+		rowStart[line] = (QXuint)values.size();
+	}
+
+	QXsparseMat::QXsparseMat(const QXmat& mat, QXfloat epsilon) :
+		line{ mat.line },
+		column{ mat.column },
+		rowStart(mat.line + 1, 0)
+	{
+		for (QXint i = 0; i < line; i++)
+		{
+			for (QXint j = 0; j < column; j++)
+			{
+				if (fabsf(mat[i][j]) > epsilon)
+				{
+					columnIndices.push_back(j);
+					values.push_back(mat[i][j]);
+				}
+			}
+
+			rowStart[i + 1] = (QXuint)values.size();
+		}
+	}
+	#pragma endregion Constructor/Destructor
+
+	#pragma region Functions
+	QXuint QXsparseMat::NonZeros() const noexcept
+	{
+		return (QXuint)values.size();
+	}
+
+	QXfloat QXsparseMat::Get(QXuint l, QXuint c) const noexcept
+	{
+		auto begin{ columnIndices.begin() + rowStart[l] };
+		auto end{ columnIndices.begin() + rowStart[l + 1] };
+		auto it{ std::lower_bound(begin, end, c) };
+
+		if (it == end || *it != c)
+			return 0.f;
+
+		return values[it - columnIndices.begin()];
+	}
+
+	void QXsparseMat::Multiply(const QXfloat* x, QXfloat* y) const
+	{
+		ParallelFor(line, NonZeros() >= QX_SPARSE_PARALLEL_NNZ, [&](QXuint begin, QXuint end)
+		{
+			MultiplyRows(*this, x, y, begin, end);
+		});
+	}
+
+	void QXsparseMat::MultiplyTranspose(const QXfloat* x, QXfloat* y) const
+	{
+		QXuint threadCount{ std::max(std::thread::hardware_concurrency(), 1u) };
+
+		if (NonZeros() < QX_SPARSE_PARALLEL_NNZ || threadCount < 2)
+		{
+			std::fill(y, y + column, 0.f);
+
+			for (QXint i = 0; i < line; i++)
+				for (QXuint k = rowStart[i]; k < rowStart[i + 1]; k++)
+					y[columnIndices[k]] += values[k] * x[i];
+
+			return;
+		}
+
+		/* lines scatter into the same columns, each thread accumulates in its own buffer */
+		std::vector<std::vector<QXfloat>>	partials(threadCount, std::vector<QXfloat>(column, 0.f));
+		QXuint								chunk{ (line + threadCount - 1) / threadCount };
+
+		ParallelFor(threadCount, true, [&](QXuint begin, QXuint end)
+		{
+			for (QXuint t = begin; t < end; t++)
+			{
+				QXuint last{ std::min((t + 1) * chunk, (QXuint)line) };
+
+				for (QXuint i = t * chunk; i < last; i++)
+					for (QXuint k = rowStart[i]; k < rowStart[i + 1]; k++)
+						partials[t][columnIndices[k]] += values[k] * x[i];
+			}
+		});
+
+		ParallelFor(column, true, [&](QXuint begin, QXuint end)
+		{
+			for (QXuint j = begin; j < end; j++)
+			{
+				QXfloat sum{ 0.f };
+
+				for (const std::vector<QXfloat>& partial : partials)
+					sum += partial[j];
+
+				y[j] = sum;
+			}
+		});
+	}
+
+	QXint QXsparseMat::SolveConjugateGradient(const QXfloat* b, QXfloat* x, QXint maxIterations, QXfloat tolerance) const
+	{
+		const QXuint			size{ (QXuint)line };
+		std::vector<QXfloat>	inverseDiagonal(size, 1.f);
+		std::vector<QXfloat>	r(size), z(size), p(size), mp(size);
+
+		for (QXuint i = 0; i < size; i++)
+		{
+			QXfloat diagonal{ Get(i, i) };
+			if (diagonal != 0.f)
+				inverseDiagonal[i] = 1.f / diagonal;
+		}
+
+		Multiply(x, mp.data());
+
+		QXdouble bNorm{ 0.0 };
+		for (QXuint i = 0; i < size; i++)
+		{
+			r[i] = b[i] - mp[i];
+			z[i] = r[i] * inverseDiagonal[i];
+			p[i] = z[i];
+			bNorm += (QXdouble)b[i] * b[i];
+		}
+
+		const QXdouble	threshold{ tolerance * tolerance * (bNorm > 0.0 ? bNorm : 1.0) };
+		QXdouble		rz{ Dot(r, z) };
+
+		if (Dot(r, r) <= threshold)
+			return 0;
+
+		/* one product per iteration is too short to pay for starting threads each time, it runs on the calling thread */
+		for (QXint iteration = 1; iteration <= maxIterations; iteration++)
+		{
+			MultiplyRows(*this, p.data(), mp.data(), 0, size);
+
+			QXdouble pmp{ Dot(p, mp) };
+			if (pmp <= 0.0)
+				return -1;
+
+			QXfloat alpha{ (QXfloat)(rz / pmp) };
+			for (QXuint i = 0; i < size; i++)
+			{
+				x[i] += alpha * p[i];
+				r[i] -= alpha * mp[i];
+				z[i] = r[i] * inverseDiagonal[i];
+			}
+
+			if (Dot(r, r) <= threshold)
+				return iteration;
+
+			QXdouble	rzNext{ Dot(r, z) };
+			QXfloat		beta{ (QXfloat)(rzNext / rz) };
+			rz = rzNext;
+
+			for (QXuint i = 0; i < size; i++)
+				p[i] = z[i] + beta * p[i];
+		}
+
+		return -1;
+	}
+
+	QXmat QXsparseMat::ToMat() const
+	{
+		QXmat mat(line, column);
+
+		for (QXint i = 0; i < line; i++)
+			for (QXuint k = rowStart[i]; k < rowStart[i + 1]; k++)
+				mat[i][columnIndices[k]] = values[k];
+
+		return mat;
+	}
+
+	QXsparseMat QXsparseMat::Transpose() const
+	{
+		QXsparseMat res(column, line);
+
+		res.columnIndices.resize(NonZeros());
+		res.values.resize(NonZeros());
+
+		for (QXuint c : columnIndices)
+			res.rowStart[c + 1]++;
+
+		for (QXint j = 0; j < column; j++)
+			res.rowStart[j + 1] += res.rowStart[j];
+
+		/* walking lines in order keeps the columns of the transpose sorted */
+		std::vector<QXuint> next(res.rowStart.begin(), res.rowStart.end() - 1);
+		for (QXint i = 0; i < line; i++)
+		{
+			for (QXuint k = rowStart[i]; k < rowStart[i + 1]; k++)
+			{
+				QXuint idx{ next[columnIndices[k]]++ };
+				res.columnIndices[idx] = i;
+				res.values[idx] = values[k];
+			}
+		}
+
+		return res;
+	}
+
+	#pragma region Operator Functions
+	std::vector<QXfloat> QXsparseMat::operator*(const std::vector<QXfloat>& x) const
+	{
+		std::vector<QXfloat> y(line);
+		Multiply(x.data(), y.data());
+
+		return y;
+	}
+	#pragma endregion Operator Functions
+	#pragma endregion Functions
+}
@@ -0,0 +1,133 @@
+#include "Trigonometry.h"
+#include "Simd.h"
+
+namespace Math
+{
+	/* pi / 2 split in three parts, the first two have few mantissa bits so quadrant * part is exact */
+	static constexpr QXfloat	PIO2_1{ 1.5703125f };
+	static constexpr QXfloat	PIO2_2{ 4.837512969970703125e-4f };
+	static constexpr QXfloat	PIO2_3{ 7.54978995489188216e-8f };
+	static constexpr QXfloat	TWO_OVER_PI{ 0.636619772367581343f };
+
+	/* minimax polynomials on [-pi / 4, pi / 4] */
+	static constexpr QXfloat	SIN_1{ -1.6666654611e-1f };
+	static constexpr QXfloat	SIN_2{ 8.3321608736e-3f };
+	static constexpr QXfloat	SIN_3{ -1.9515295891e-4f };
+	static constexpr QXfloat	COS_1{ 4.166664568298827e-2f };
+	static constexpr QXfloat	COS_2{ -1.388731625493765e-3f };
+	static constexpr QXfloat	COS_3{ 2.443315711809948e-5f };
+
+	#pragma region Static Functions
+
+	static void	SinCosReduced(QXfloat angle, QXfloat& sin, QXfloat& cos) noexcept
+	{
+#ifdef QX_SIMD_SSE
+		/* same rounding as the SIMD path */
+		QXint	quadrant{ _mm_cvtss_si32(_mm_set_ss(angle * TWO_OVER_PI)) };
+#else
+		QXint	quadrant{ (QXint)std::lrint(angle * TWO_OVER_PI) };
+#endif
+		QXfloat	q{ (QXfloat)quadrant };
+		QXfloat	x{ ((angle - q * PIO2_1) - q * PIO2_2) - q * PIO2_3 };
+		QXfloat	x2{ x * x };
+
+		QXfloat	s{ x + x * x2 * (SIN_1 + x2 * (SIN_2 + x2 * SIN_3)) };
+		QXfloat	c{ 1.f - 0.5f * x2 + x2 * x2 * (COS_1 + x2 * (COS_2 + x2 * COS_3)) };
+
+		switch (quadrant & 3)
+		{
+		case 0: sin = s;	cos = c;	break;
+		case 1: sin = c;	cos = -s;	break;
+		case 2: sin = -s;	cos = -c;	break;
+		default: sin = -c;	cos = s;	break;
+		}
+	}
+
+	#pragma endregion Static Functions
+
+	#pragma region Fast Trigonometry
+
+	void	SinCos(QXfloat angle, QXfloat& sin, QXfloat& cos) noexcept
+	{
+		if (fabsf(angle) > QX_FAST_SINCOS_RANGE)
+		{
+			sin = std::sin(angle);
+			cos = std::cos(angle);
+			return;
+		}
+
+		SinCosReduced(angle, sin, cos);
+	}
+
+	void	SinCos(const QXfloat* angles, QXfloat* sin, QXfloat* cos, QXuint count) noexcept
+	{
+		QXuint i{ 0 };
+
+#ifdef QX_SIMD_SSE
+		const __m128	absMask{ _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF)) };
+		const __m128	range{ _mm_set1_ps(QX_FAST_SINCOS_RANGE) };
+		const __m128i	one{ _mm_set1_epi32(1) };
+		const __m128i	two{ _mm_set1_epi32(2) };
+		const __m128i	zero{ _mm_setzero_si128() };
+
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128	angle{ _mm_loadu_ps(angles + i) };
+
+			__m128i	quadrant{ _mm_cvtps_epi32(_mm_mul_ps(angle, _mm_set1_ps(TWO_OVER_PI))) };
+			__m128	q{ _mm_cvtepi32_ps(quadrant) };
+			__m128	x{ _mm_sub_ps(angle, _mm_mul_ps(q, _mm_set1_ps(PIO2_1))) };
+			x = _mm_sub_ps(x, _mm_mul_ps(q, _mm_set1_ps(PIO2_2)));
+			x = _mm_sub_ps(x, _mm_mul_ps(q, _mm_set1_ps(PIO2_3)));
+			__m128	x2{ _mm_mul_ps(x, x) };
+
+			__m128	s{ _mm_add_ps(_mm_set1_ps(SIN_2), _mm_mul_ps(x2, _mm_set1_ps(SIN_3))) };
+			s = _mm_add_ps(_mm_set1_ps(SIN_1), _mm_mul_ps(x2, s));
+			s = _mm_add_ps(x, _mm_mul_ps(_mm_mul_ps(x, x2), s));
+
+			__m128	c{ _mm_add_ps(_mm_set1_ps(COS_2), _mm_mul_ps(x2, _mm_set1_ps(COS_3))) };
+			c = _mm_add_ps(_mm_set1_ps(COS_1), _mm_mul_ps(x2, c));
+			c = _mm_add_ps(_mm_sub_ps(_mm_set1_ps(1.f), _mm_mul_ps(_mm_set1_ps(0.5f), x2)),
+							_mm_mul_ps(_mm_mul_ps(x2, x2), c));
+
+			/* odd quadrants swap sin and cos, quadrants 2 and 3 negate sin, 1 and 2 negate cos */
+			__m128	swap{ _mm_castsi128_ps(_mm_cmpgt_epi32(_mm_and_si128(quadrant, one), zero)) };
+			__m128	resSin{ _mm_or_ps(_mm_and_ps(swap, c), _mm_andnot_ps(swap, s)) };
+			__m128	resCos{ _mm_or_ps(_mm_and_ps(swap, s), _mm_andnot_ps(swap, c)) };
+
+			__m128i	sinSign{ _mm_slli_epi32(_mm_and_si128(quadrant, two), 30) };
+			__m128i	cosSign{ _mm_slli_epi32(_mm_and_si128(_mm_add_epi32(quadrant, one), two), 30) };
+			resSin = _mm_xor_ps(resSin, _mm_castsi128_ps(sinSign));
+			resCos = _mm_xor_ps(resCos, _mm_castsi128_ps(cosSign));
+
+			_mm_storeu_ps(sin + i, resSin);
+			_mm_storeu_ps(cos + i, resCos);
+
+			/* rare angles out of range are fixed with libm */
+			if (_mm_movemask_ps(_mm_cmpgt_ps(_mm_and_ps(angle, absMask), range)))
+				for (QXuint j = i; j < i + 4; j++)
+					if (fabsf(angles[j]) > QX_FAST_SINCOS_RANGE)
+						SinCos(angles[j], sin[j], cos[j]);
+		}
+#endif
+
+		for (; i < count; i++)
+			SinCos(angles[i], sin[i], cos[i]);
+	}
+
+	QXfloat	FastSin(QXfloat angle) noexcept
+	{
+		QXfloat s, c;
+		SinCos(angle, s, c);
+		return s;
+	}
+
+	QXfloat	FastCos(QXfloat angle) noexcept
+	{
+		QXfloat s, c;
+		SinCos(angle, s, c);
+		return c;
+	}
+
+	#pragma endregion Fast Trigonometry
+}
@@ -4,210 +4,46 @@
 
 namespace Math
 {
-#pragma region Attributes
-
-	const QXvec4	QXvec4::zero {0.f, 0.f, 0.f, 0.f};
-	const QXvec4	QXvec4::up {0.f, 1.f, 0.f, 0.f};
-	const QXvec4	QXvec4::down {0.f, -1.f, 0.f, 0.f};
-	const QXvec4	QXvec4::left {-1.f, 0.f, 0.f, 0.f};
-	const QXvec4	QXvec4::right {1.f, 0.f, 0.f, 0.f};
-	const QXvec4	QXvec4::forward {0.0f, 0.0f, 1.0f, 0.f};
-	const QXvec4	QXvec4::backward {0.0f, 0.0f, -1.0f, 0.f};
-
-#pragma endregion
-
-#pragma region Constructors
-
-	QXvec4::QXvec4(const QXfloat& posX, const QXfloat& posY, const QXfloat& posZ, const QXfloat& posW) noexcept :
-		x (posX),
-		y (posY),
-		z (posZ),
-		w (posW)
-	{
-	}
-
-	QXvec4::QXvec4(const QXvec3& vec, QXfloat posW) noexcept :
-		x { vec.x },
-		y { vec.y },
-		z { vec.z },
-		w { posW }
-	{}
-
-	QXvec4::QXvec4(const QXvec4& vec)  noexcept :
-		x{ vec.x },
-		y{ vec.y },
-		z{ vec.z },
-		w{ vec.w }
-	{}
-
-	QXvec4::QXvec4(QXvec4&& vec)  noexcept :
-		x{ std::move(vec.x) },
-		y{ std::move(vec.y) },
-		z{ std::move(vec.z) },
-		w{ std::move(vec.w) }
-	{}
-
-#pragma endregion
-
 #pragma region Operators
 
-	QXvec4& QXvec4::operator=(const QXvec4& vect) noexcept
-	{
-		x = vect.x;
-		y = vect.y;
-	    z = vect.z;
-		w = vect.w;
-
-		return *this;
-	}
-
-	QXvec4&	QXvec4::operator=(QXvec4&& vec)  noexcept
-	{
-		x = std::move(vec.x);
-		y = std::move(vec.y);
-		z = std::move(vec.z);
-		w = std::move(vec.w);
-
-		return *this;
-	}
-
-	
-	QXvec4&	QXvec4::operator+=(const QXvec4& vect) noexcept
-	{
-		x += vect.x;
-		y += vect.y;
-	    z += vect.z;
-		w += vect.w;
-
-		return *this;
-	}
-
-	QXvec4	QXvec4::operator+(const QXvec4& vect) const noexcept
-	{
-		QXvec4	res;
-
-		res.x = x + vect.x;
-		res.y = y + vect.y;
-	    res.z = z + vect.z;
-		res.w = w + vect.w;
-
-		return res;
-	}
-
-	QXvec4&	QXvec4::operator-=(const QXvec4& vect) noexcept
-	{
-		x -= vect.x;
-		y -= vect.y;
-	    z -= vect.z;
-		w -= vect.w;
-
-		return *this;
-	}
-
-	QXvec4	QXvec4::operator-(const QXvec4& vect) const noexcept
-	{
-		QXvec4	res;
-
-		res.x = x - vect.x;
-		res.y = y - vect.y;
-	    res.z = z - vect.z;
-		res.w = w - vect.w;
-
-		return res;
-	}
-
-	QXvec4	QXvec4::operator-() const noexcept
-	{
-		QXvec4	res;
-
-		res.x = -x;
-		res.y = -y;
-		res.z = -z;
-		res.w = -w;
-
-		return res;
-	}
-
-	QXvec4&	QXvec4::operator*=(QXfloat nb) noexcept
-	{
-		x *= nb;
-		y *= nb;
-	    z *= nb;
-		w *= nb;
-
-		return *this;
-	}
-
-	QXvec4	QXvec4::operator*(QXfloat nb) const noexcept
-	{
-		QXvec4	res;
-
-		res.x = x * nb;
-		res.y = y * nb;
-	    res.z = z * nb;
-		res.w = w * nb;
-
-		return res;
-	}
-
-	QXvec4&	QXvec4::operator/=(QXfloat nb) noexcept
-	{
-		x /= nb;
-		y /= nb;
-	    z /= nb;
-		w /= nb;
-
-		return *this;
-	}
-
-	QXvec4	QXvec4::operator/(QXfloat nb) const noexcept
-	{
-		QXvec4	res;
-
-		res.x = x / nb;
-		res.y = y / nb;
-	    res.z = z / nb;
-		res.w = w / nb;
-
-		return res;
-	}
-
-	QXbool	QXvec4::operator==(const QXvec4& vect) const noexcept
+	template<typename T>
+	QXbool	QXvec4t<T>::operator==(const QXvec4t<T>& vect) const noexcept
 	{
 		return SqrLength() == vect.SqrLength();
 	}
 
-	QXbool	QXvec4::operator!=(const QXvec4& vect) const noexcept
+	template<typename T>
+	QXbool	QXvec4t<T>::operator!=(const QXvec4t<T>& vect) const noexcept
 	{
 		return SqrLength() != vect.SqrLength();
 	}
 
-	QXbool	QXvec4::operator<(const QXvec4& vect) const noexcept
+	template<typename T>
+	QXbool	QXvec4t<T>::operator<(const QXvec4t<T>& vect) const noexcept
 	{
 		return SqrLength() < vect.SqrLength();
 	}
 
-	QXbool	QXvec4::operator<=(const QXvec4& vect) const noexcept
+	template<typename T>
+	QXbool	QXvec4t<T>::operator<=(const QXvec4t<T>& vect) const noexcept
 	{
 		return SqrLength() <= vect.SqrLength();
 	}
 
-	QXbool	QXvec4::operator>(const QXvec4& vect) const noexcept
+	template<typename T>
+	QXbool	QXvec4t<T>::operator>(const QXvec4t<T>& vect) const noexcept
 	{
 		return SqrLength() > vect.SqrLength();
 	}
 
-	QXbool	QXvec4::operator>=(const QXvec4& vect) const noexcept
+	template<typename T>
+	QXbool	QXvec4t<T>::operator>=(const QXvec4t<T>& vect) const noexcept
 	{
 		return SqrLength() >= vect.SqrLength();
 	}
 
-	QXfloat& QXvec4::operator[](QXuint idx) noexcept
-	{
-		return e[idx];
-	}
-
-	const QXfloat QXvec4::operator[](QXuint idx) const noexcept
+	template<typename T>
+	T& QXvec4t<T>::operator[](QXuint idx) noexcept
 	{
 		return e[idx];
 	}
@@ -216,7 +52,8 @@ namespace Math
 
 #pragma region Functions
 
-	void 	QXvec4::Homogenize() noexcept
+	template<typename T>
+	void 	QXvec4t<T>::Homogenize() noexcept
 	{
 		if (w == 0)
 			return;
@@ -226,16 +63,18 @@ namespace Math
 		z /= w;
 	}
 
-	QXfloat	QXvec4::Length() const noexcept
+	template<typename T>
+	T	QXvec4t<T>::Length() const noexcept
 	{
 		return sqrt(x * x + y * y + z * z + w * w);
 	}
 
-	QXvec4	QXvec4::Normalize() const noexcept
+	template<typename T>
+	QXvec4t<T>	QXvec4t<T>::Normalize() const noexcept
 	{
-		QXvec4	res;
+		QXvec4t<T>	res;
 
-		QXfloat size{ Length() };
+		T size{ Length() };
 
 	    if (size == 0)
 	    	return res;
@@ -248,9 +87,10 @@ namespace Math
 		return res;
 	}
 
-	QXvec4&	QXvec4::Normalize() noexcept
+	template<typename T>
+	QXvec4t<T>&	QXvec4t<T>::Normalize() noexcept
 	{
-		QXfloat	size{ Length() };
+		T	size{ Length() };
 
 		if (size == 0)
 	    	return *this;
@@ -263,34 +103,8 @@ namespace Math
 		return *this;
 	}
 
-	QXvec4	QXvec4::Scale(QXfloat nb) const noexcept
-	{
-		QXvec4	res;
-
-		res.x = x * nb;
-		res.y = y * nb;
-	    res.z = z * nb;
-		res.w = w * nb;
-
-		return res;
-	}
-
-	QXvec4& QXvec4::Scale(QXfloat nb) noexcept
-	{
-		x = x * nb;
-		y = y * nb;
-	    z = z * nb;
-		w = w * nb;
-
-		return *this;
-	}
-
-	QXfloat	QXvec4::SqrLength() const noexcept
-	{
-		return x * x + y * y + z * z + w * w;
-	}
-
-	QXstring	QXvec4::ToString() const noexcept
+	template<typename T>
+	QXstring	QXvec4t<T>::ToString() const noexcept
 	{
 		QXstring vec = std::to_string(x) + ", " + std::to_string(y) + ", " +
 		std::to_string(z) + ", " + std::to_string(w) + "\n";
@@ -300,7 +114,8 @@ namespace Math
 
 #pragma endregion
 	
-	std::ostream&	operator<<(std::ostream& os, const QXvec4& vect) noexcept
+	template<typename T>
+	std::ostream&	operator<<(std::ostream& os, const QXvec4t<T>& vect) noexcept
 	{
 		os << vect.x << ", " << vect.y << ", " << vect.z <<
 								", " << vect.w << std::endl;
@@ -308,7 +123,8 @@ namespace Math
 		return os;
 	}
 
-	QXstring	operator+(std::string& str, const QXvec4& vect) noexcept
+	template<typename T>
+	QXstring	operator+(std::string& str, const QXvec4t<T>& vect) noexcept
 	{
 		QXstring	res = str + "x : " + std::to_string(vect.x) +
 		" , y : " + std::to_string(vect.y) + " , z : " + std::to_string(vect.z) +
@@ -316,4 +132,13 @@ namespace Math
 
 		return res;
 	}
+
+	template struct QXvec4t<QXfloat>;
+	template struct QXvec4t<QXdouble>;
+
+	template std::ostream&	operator<<(std::ostream& os, const QXvec4t<QXfloat>& vect) noexcept;
+	template QXstring		operator+(std::string& str, const QXvec4t<QXfloat>& vect) noexcept;
+
+	template std::ostream&	operator<<(std::ostream& os, const QXvec4t<QXdouble>& vect) noexcept;
+	template QXstring		operator+(std::string& str, const QXvec4t<QXdouble>& vect) noexcept;
 }
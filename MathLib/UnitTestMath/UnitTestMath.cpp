@@ -1,13 +1,72 @@
 #include "CppUnitTest.h"
 #include "Quaternion.h"
+#include "Skinning.h"
+#include "Vec2.h"
+#include "Compression.h"
+#include "Expression.h"
+#include "SparseMat.h"
+#include "Decomposition.h"
+#include "MatView.h"
+#include "BinaryFile.h"
+#include "Format.h"
+#include "SpatialHash.h"
+#include "SweepAndPrune.h"
+#include "Octree.h"
+#include "KdTree.h"
+#include "Gjk.h"
+#include "Contact.h"
+#include "Ray.h"
+#include "Sweep.h"
+#include "Polynomial.h"
+#include "Capsule.h"
+#include "Distance.h"
+#include "Fit.h"
+#include "Triangle.h"
+#include "Mesh.h"
+#include "ConvexHull.h"
 #include "Quaternion.cpp"
 #include "Vec3.cpp"
 #include "Vec4.cpp"
 #include "Mat.cpp"
 #include "Mat4.cpp"
+#include "Ref3.cpp"
+#include "DualQuaternion.cpp"
+#include "Skinning.cpp"
+#include "Compression.cpp"
+#include "Trigonometry.cpp"
+#include "SparseMat.cpp"
+#include "Decomposition.cpp"
+#include "MatView.cpp"
+#include "BinaryFile.cpp"
+#include "Format.cpp"
+#include "Sphere.cpp"
+#include "SpatialHash.cpp"
+#include "Box.cpp"
+#include "SweepAndPrune.cpp"
+#include "Plane.cpp"
+#include "Segment.cpp"
+#include "Octree.cpp"
+#include "KdTree.cpp"
+#include "OrientedBox.cpp"
+#include "Cylinder.cpp"
+#include "Quad.cpp"
+#include "Gjk.cpp"
+#include "Contact.cpp"
+#include "Ray.cpp"
+#include "Maths.cpp"
+#include "Sweep.cpp"
+#include "Polynomial.cpp"
+#include "Capsule.cpp"
+#include "Distance.cpp"
+#include "Fit.cpp"
+#include "Triangle.cpp"
+#include "Mesh.cpp"
+#include "ConvexHull.cpp"
 #include <glm/gtc/quaternion.hpp>
 #include <glm/gtx/quaternion.hpp>
 #include <glm/glm.hpp>
+#include <glm/gtx/dual_quaternion.hpp>
+#include <unordered_set>
 
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
@@ -686,5 +745,2316 @@ namespace UnitTestMath
 			TEST_QUATERNION
 		}*/
 		/* END Test Quaternion */
+
+		/* BEGIN Test DualQuaternion */
+		TEST_METHOD(transformPointDualQuaternion)
+		{
+			glm::quat grot = glm::angleAxis(0.7f, glm::normalize(glm::vec3(1, 2, 3)));
+			glm::dualquat gdq(grot, glm::vec3(4, -5, 6));
+			Math::QXdualQuaternion dq(Math::QXquaternion(grot.w, grot.x, grot.y, grot.z), Math::QXvec3(4, -5, 6));
+
+			glm::vec3 gres = gdq * glm::vec3(1, 2, 3);
+			Math::QXvec3 res = dq.TransformPoint({ 1, 2, 3 });
+
+			for (unsigned int i = 0; i < 3; i++)
+				Assert::AreEqual(gres[i], res[i], 0.001f);
+		}
+
+		TEST_METHOD(compositionDualQuaternion)
+		{
+			glm::quat grot1 = glm::angleAxis(0.7f, glm::normalize(glm::vec3(1, 2, 3)));
+			glm::quat grot2 = glm::angleAxis(-1.3f, glm::normalize(glm::vec3(0, 1, -1)));
+			glm::dualquat gdq = glm::dualquat(grot1, glm::vec3(4, -5, 6)) * glm::dualquat(grot2, glm::vec3(1, 0, 2));
+			Math::QXdualQuaternion dq = Math::QXdualQuaternion(Math::QXquaternion(grot1.w, grot1.x, grot1.y, grot1.z), Math::QXvec3(4, -5, 6))
+				* Math::QXdualQuaternion(Math::QXquaternion(grot2.w, grot2.x, grot2.y, grot2.z), Math::QXvec3(1, 0, 2));
+
+			glm::vec3 gres = gdq * glm::vec3(1, 2, 3);
+			Math::QXvec3 res = dq.TransformPoint({ 1, 2, 3 });
+
+			for (unsigned int i = 0; i < 3; i++)
+				Assert::AreEqual(gres[i], res[i], 0.001f);
+		}
+
+		TEST_METHOD(convertMat4ToDualQuaternion)
+		{
+			Math::QXmat4 mat4 = Math::QXmat4::CreateRotationMatrix(Math::QXvec3(1, 2, 3).Normalized(), 0.7f);
+			mat4[0][3] = 4;
+			mat4[1][3] = -5;
+			mat4[2][3] = 6;
+
+			Math::QXdualQuaternion dq = Math::QXdualQuaternion::ConvertMatToDualQuaternion(mat4);
+			Math::QXmat4 mat4res = dq.ConvertToMat();
+
+			for (unsigned int i = 0; i < 16; i++)
+				Assert::AreEqual(mat4.array[i], mat4res.array[i], 0.001f);
+
+			Math::QXvec3 vec3 = mat4 * Math::QXvec3(1, 2, 3);
+			Math::QXvec3 vec3Res = dq.TransformPoint({ 1, 2, 3 });
+			for (unsigned int i = 0; i < 3; i++)
+				Assert::AreEqual(vec3[i], vec3Res[i], 0.001f);
+		}
+		/* END Test DualQuaternion */
+
+		/* BEGIN Test Skinning */
+		TEST_METHOD(skinLinearBlend)
+		{
+			const unsigned int count = 7;
+			float px[count], py[count], pz[count], nx[count], ny[count], nz[count];
+			QXuint idx0[count], idx1[count], idx2[count], idx3[count];
+			float w0[count], w1[count], w2[count], w3[count];
+
+			Math::QXmat4 palette[2] = { Math::QXmat4::CreateRotationMatrix(Math::QXvec3(0, 1, 0), 0.5f),
+										Math::QXmat4::CreateRotationMatrix(Math::QXvec3(1, 0, 0), -1.2f) };
+			palette[0][0][3] = 1;
+			palette[1][2][3] = -2;
+
+			for (unsigned int i = 0; i < count; i++)
+			{
+				px[i] = (float)i; py[i] = 1.f - i; pz[i] = 0.5f * i;
+				nx[i] = 0; ny[i] = 1; nz[i] = 0;
+				idx0[i] = 0; idx1[i] = 1; idx2[i] = idx3[i] = 0;
+				w0[i] = i / (float)count; w1[i] = 1.f - w0[i]; w2[i] = w3[i] = 0.f;
+			}
+
+			Math::QXskinInput input{ px, py, pz, nx, ny, nz, { idx0, idx1, idx2, idx3 }, { w0, w1, w2, w3 } };
+			float opx[count], opy[count], opz[count], onx[count], ony[count], onz[count];
+			Math::QXskinOutput output{ opx, opy, opz, onx, ony, onz };
+
+			Math::SkinLinearBlend(palette, input, output, count);
+
+			for (unsigned int i = 0; i < count; i++)
+			{
+				Math::QXvec3 vec3Res = palette[0] * Math::QXvec3(px[i], py[i], pz[i]) * w0[i]
+									+ palette[1] * Math::QXvec3(px[i], py[i], pz[i]) * w1[i];
+				Assert::AreEqual(vec3Res.x, opx[i], 0.001f);
+				Assert::AreEqual(vec3Res.y, opy[i], 0.001f);
+				Assert::AreEqual(vec3Res.z, opz[i], 0.001f);
+				Assert::AreEqual(1.f, onx[i] * onx[i] + ony[i] * ony[i] + onz[i] * onz[i], 0.001f);
+			}
+		}
+
+		TEST_METHOD(skinDualQuaternion)
+		{
+			const unsigned int count = 7;
+			float px[count], py[count], pz[count], nx[count], ny[count], nz[count];
+			QXuint idx0[count], idx1[count], idx2[count], idx3[count];
+			float w0[count], w1[count], w2[count], w3[count];
+
+			glm::quat grot1 = glm::angleAxis(0.5f, glm::vec3(0, 1, 0));
+			glm::quat grot2 = -glm::angleAxis(-1.2f, glm::vec3(1, 0, 0));
+			Math::QXdualQuaternion palette[2] = {
+				Math::QXdualQuaternion(Math::QXquaternion(grot1.w, grot1.x, grot1.y, grot1.z), Math::QXvec3(1, 0, 0)),
+				Math::QXdualQuaternion(Math::QXquaternion(grot2.w, grot2.x, grot2.y, grot2.z), Math::QXvec3(0, 0, -2)) };
+			glm::dualquat gpalette[2] = { glm::dualquat(grot1, glm::vec3(1, 0, 0)), glm::dualquat(grot2, glm::vec3(0, 0, -2)) };
+
+			for (unsigned int i = 0; i < count; i++)
+			{
+				px[i] = (float)i; py[i] = 1.f - i; pz[i] = 0.5f * i;
+				nx[i] = 0; ny[i] = 1; nz[i] = 0;
+				idx0[i] = 0; idx1[i] = 1; idx2[i] = idx3[i] = 0;
+				w0[i] = i / (float)count; w1[i] = 1.f - w0[i]; w2[i] = w3[i] = 0.f;
+			}
+
+			Math::QXskinInput input{ px, py, pz, nx, ny, nz, { idx0, idx1, idx2, idx3 }, { w0, w1, w2, w3 } };
+			float opx[count], opy[count], opz[count], onx[count], ony[count], onz[count];
+			Math::QXskinOutput output{ opx, opy, opz, onx, ony, onz };
+
+			Math::SkinDualQuaternion(palette, input, output, count);
+
+			for (unsigned int i = 0; i < count; i++)
+			{
+				/* second bone is in the opposite hemisphere, its weight is negated */
+				glm::dualquat gdq = glm::normalize(gpalette[0] * w0[i] + gpalette[1] * -w1[i]);
+				glm::vec3 gres = gdq * glm::vec3(px[i], py[i], pz[i]);
+				glm::vec3 gnormal = gdq.real * glm::vec3(0, 1, 0);
+
+				Assert::AreEqual(gres.x, opx[i], 0.001f);
+				Assert::AreEqual(gres.y, opy[i], 0.001f);
+				Assert::AreEqual(gres.z, opz[i], 0.001f);
+				Assert::AreEqual(gnormal.x, onx[i], 0.001f);
+				Assert::AreEqual(gnormal.y, ony[i], 0.001f);
+				Assert::AreEqual(gnormal.z, onz[i], 0.001f);
+			}
+		}
+		/* END Test Skinning */
+
+		/* BEGIN Test Compression */
+		TEST_METHOD(packQuaternion32)
+		{
+			const unsigned int count = 7;
+			Math::QXquaternion quats[count], res[count];
+			QXuint packed[count];
+
+			for (unsigned int i = 0; i < count; i++)
+			{
+				glm::quat rot = glm::angleAxis(0.9f * i - 2.f, glm::normalize(glm::vec3(1.f - i, 0.5f * i, 2.f)));
+				quats[i] = Math::QXquaternion(rot.w, rot.x, rot.y, rot.z);
+			}
+
+			Math::Compression::PackQuaternion32(quats, packed, count);
+			Math::Compression::UnpackQuaternion32(packed, res, count);
+
+			for (unsigned int i = 0; i < count; i++)
+			{
+				Assert::AreEqual(Math::Compression::PackQuaternion32(quats[i]), packed[i]);
+
+				float sign = quats[i].w * res[i].w + quats[i].v.Dot(res[i].v) < 0 ? -1.f : 1.f;
+				for (unsigned int j = 0; j < 4; j++)
+					Assert::AreEqual(quats[i].e[j], sign * res[i].e[j], 0.002f);
+			}
+		}
+
+		TEST_METHOD(packQuaternion48)
+		{
+			const unsigned int count = 7;
+			Math::QXquaternion quats[count], res[count];
+			Math::Compression::QXpackedQuaternion48 packed[count];
+
+			for (unsigned int i = 0; i < count; i++)
+			{
+				glm::quat rot = glm::angleAxis(0.9f * i - 2.f, glm::normalize(glm::vec3(1.f - i, 0.5f * i, 2.f)));
+				quats[i] = Math::QXquaternion(rot.w, rot.x, rot.y, rot.z);
+			}
+
+			Math::Compression::PackQuaternion48(quats, packed, count);
+			Math::Compression::UnpackQuaternion48(packed, res, count);
+
+			for (unsigned int i = 0; i < count; i++)
+			{
+				float sign = quats[i].w * res[i].w + quats[i].v.Dot(res[i].v) < 0 ? -1.f : 1.f;
+				for (unsigned int j = 0; j < 4; j++)
+					Assert::AreEqual(quats[i].e[j], sign * res[i].e[j], 0.0001f);
+			}
+		}
+
+		TEST_METHOD(packUnitVector)
+		{
+			const unsigned int count = 7;
+			Math::QXvec3 vecs[count], res[count];
+			QXuint packed[count];
+
+			for (unsigned int i = 0; i < count; i++)
+				vecs[i] = Math::QXvec3(1.f - i, 0.3f * i - 0.5f, i % 2 ? -1.f : 1.f).Normalize();
+
+			Math::Compression::PackUnitVector(vecs, packed, count);
+			Math::Compression::UnpackUnitVector(packed, res, count);
+
+			for (unsigned int i = 0; i < count; i++)
+			{
+				Assert::AreEqual(Math::Compression::PackUnitVector(vecs[i]), packed[i]);
+				Assert::AreEqual(vecs[i].x, res[i].x, 0.0001f);
+				Assert::AreEqual(vecs[i].y, res[i].y, 0.0001f);
+				Assert::AreEqual(vecs[i].z, res[i].z, 0.0001f);
+			}
+		}
+
+		TEST_METHOD(halfFloat)
+		{
+			Assert::AreEqual(1.5f, Math::Compression::HalfToFloat(Math::Compression::FloatToHalf(1.5f)));
+			Assert::AreEqual(-65504.f, Math::Compression::HalfToFloat(Math::Compression::FloatToHalf(-65504.f)));
+			Assert::AreEqual(0x3C00u, (QXuint)Math::Compression::FloatToHalf(1.f));
+			Assert::AreEqual(0x7C00u, (QXuint)Math::Compression::FloatToHalf(100000.f));
+
+			const unsigned int count = 7;
+			Math::QXvec3 vecs[count], res[count];
+			Math::Compression::QXpackedVec3 packed[count];
+
+			for (unsigned int i = 0; i < count; i++)
+				vecs[i] = Math::QXvec3(1.f - i * 3.7f, 0.01f * i, 100.f * i);
+
+			Math::Compression::PackHalfVec3(vecs, packed, count);
+			Math::Compression::UnpackHalfVec3(packed, res, count);
+
+			for (unsigned int i = 0; i < count; i++)
+			{
+				Math::QXvec3 single = Math::Compression::UnpackHalfVec3(Math::Compression::PackHalfVec3(vecs[i]));
+				Assert::AreEqual(single.x, res[i].x);
+				Assert::AreEqual(single.y, res[i].y);
+				Assert::AreEqual(single.z, res[i].z);
+				Assert::AreEqual(vecs[i].x, res[i].x, fabsf(vecs[i].x) / 2048.f);
+				Assert::AreEqual(vecs[i].y, res[i].y, fabsf(vecs[i].y) / 2048.f);
+				Assert::AreEqual(vecs[i].z, res[i].z, fabsf(vecs[i].z) / 2048.f);
+			}
+		}
+
+		TEST_METHOD(packPosition)
+		{
+			const unsigned int count = 7;
+			Math::QXvec3 min(-10.f, 0.f, -1.f), max(10.f, 5.f, 1.f);
+			Math::QXvec3 vecs[count], res[count];
+			Math::Compression::QXpackedVec3 packed[count];
+
+			for (unsigned int i = 0; i < count; i++)
+				vecs[i] = Math::QXvec3(3.3f * i - 10.f, 0.7f * i, 0.25f * i - 0.8f);
+
+			Math::Compression::PackPosition(vecs, packed, count, min, max);
+			Math::Compression::UnpackPosition(packed, res, count, min, max);
+
+			for (unsigned int i = 0; i < count; i++)
+			{
+				Math::Compression::QXpackedVec3 single = Math::Compression::PackPosition(vecs[i], min, max);
+				Assert::AreEqual((QXuint)single.x, (QXuint)packed[i].x);
+				Assert::AreEqual((QXuint)single.y, (QXuint)packed[i].y);
+				Assert::AreEqual((QXuint)single.z, (QXuint)packed[i].z);
+				Assert::AreEqual(vecs[i].x, res[i].x, 0.0002f);
+				Assert::AreEqual(vecs[i].y, res[i].y, 0.0001f);
+				Assert::AreEqual(vecs[i].z, res[i].z, 0.0001f);
+			}
+		}
+		/* END Test Compression */
+
+		/* BEGIN Test Trigonometry */
+		TEST_METHOD(sinCos)
+		{
+			for (float angle = -200.f; angle <= 200.f; angle += 0.37f)
+			{
+				float s, c;
+				Math::SinCos(angle, s, c);
+				Assert::AreEqual(sinf(angle), s, 0.000001f);
+				Assert::AreEqual(cosf(angle), c, 0.000001f);
+			}
+
+			float s, c;
+			Math::SinCos(10000.f, s, c);
+			Assert::AreEqual(sinf(10000.f), s, 0.000001f);
+			Assert::AreEqual(cosf(10000.f), c, 0.000001f);
+		}
+
+		TEST_METHOD(sinCosArray)
+		{
+			const unsigned int count = 7;
+			float angles[count] = { -3.f, -1.2f, 0.f, 0.7f, 2.5f, 300.f, 6.2f };
+			float s[count], c[count];
+
+			Math::SinCos(angles, s, c, count);
+
+			for (unsigned int i = 0; i < count; i++)
+			{
+				Assert::AreEqual(Math::FastSin(angles[i]), s[i], 0.000001f);
+				Assert::AreEqual(Math::FastCos(angles[i]), c[i], 0.000001f);
+			}
+		}
+
+		TEST_METHOD(fastMathBuilders)
+		{
+			/* QX_FAST_MATH swaps std::sin/std::cos on float for SinCos in the rotation builders, the two paths and the
+			 * builders under either policy stay within 2 ULP of 1.f (2.4e-7) of each other and of the double result */
+			const float tolerance = 2.4e-7f;
+			for (float angle = -8.f; angle <= 8.f; angle += 0.013f)
+			{
+				float fastSin, fastCos;
+				Math::SinCos(angle, fastSin, fastCos);
+				Assert::AreEqual(std::sin(angle), fastSin, tolerance);
+				Assert::AreEqual(std::cos(angle), fastCos, tolerance);
+
+				Math::QXmat4 rotation = Math::QXmat4::CreateXRotationMatrix(angle);
+				Assert::AreEqual(sin((double)angle), (double)rotation[2][1], (double)tolerance);
+				Assert::AreEqual(cos((double)angle), (double)rotation[1][1], (double)tolerance);
+			}
+		}
+		/* END Test Trigonometry */
+
+		/* BEGIN Test Constexpr */
+		TEST_METHOD(constexprVector)
+		{
+			constexpr Math::QXvec3 vec3(1.f, 2.f, 3.f);
+			constexpr Math::QXvec3 cross{ vec3.Cross(Math::QXvec3::up) };
+			constexpr Math::QXvec3 sum{ (vec3 + Math::QXvec3::forward * 2.f - Math::QXvec3::right) / 2.f };
+			constexpr Math::QXvec3 lerp{ Math::QXvec3::Lerp(Math::QXvec3::zero, vec3, 0.5f) };
+			constexpr Math::QXvec4 vec4{ Math::QXvec4(vec3, 1.f) * 2.f + Math::QXvec4::up };
+			constexpr Math::QXvec2 vec2{ Math::QXvec2(3.f, 4.f) - Math::QXvec2::left };
+
+			static_assert(cross.x == -3.f && cross.y == 0.f && cross.z == 1.f, "QXvec3 Cross");
+			static_assert(vec3.Dot(vec3) == 14.f && vec3.SqrLength() == 14.f, "QXvec3 Dot");
+			static_assert(sum[0] == 0.f && sum[1] == 1.f && sum[2] == 2.5f, "QXvec3 operators");
+			static_assert(lerp.x == 0.5f && lerp.y == 1.f && lerp.z == 1.5f, "QXvec3 Lerp");
+			static_assert(vec4.x == 2.f && vec4.y == 5.f && vec4.z == 6.f && vec4[3] == 2.f, "QXvec4 operators");
+			static_assert(vec2.Dot(Math::QXvec2::up) == 4.f && vec2.Cross(Math::QXvec2::right) == -4.f, "QXvec2 operators");
+
+			Math::QXvec3 scaled{ vec3 };
+			scaled *= 2.f;
+			Assert::AreEqual(2.f, scaled.x);
+			Assert::AreEqual(6.f, scaled.z);
+		}
+
+		TEST_METHOD(constexprQuaternion)
+		{
+			constexpr Math::QXquaternion q1(0.5f, 0.5f, 0.5f, 0.5f);
+			constexpr Math::QXquaternion q2(0.f, 1.f, 0.f, 0.f);
+			constexpr Math::QXquaternion mult{ q1 * q2 };
+			constexpr Math::QXquaternion conj{ q1.ConjugateQuaternion() };
+			constexpr Math::QXmat4 mat{ q1.ConvertQuaternionToMat() };
+			constexpr Math::QXquaternion sum{ q1 + q2 - q1 };
+
+			static_assert(mult.w == -0.5f && mult.v.x == 0.5f && mult.v.y == 0.5f && mult.v.z == -0.5f, "QXquaternion product");
+			static_assert(q1.DotProductQuaternion(conj) == -0.5f, "QXquaternion Dot");
+			static_assert(sum[1] == 1.f && sum[0] == 0.f, "QXquaternion operators");
+			static_assert(mat[0][0] == 0.f && mat[0][2] == 1.f && mat[1][0] == 1.f && mat[2][1] == 1.f, "QXquaternion to QXmat4");
+
+			glm::quat gq1(0.5f, 0.5f, 0.5f, 0.5f);
+			glm::quat gres{ gq1 * glm::quat(0.f, 1.f, 0.f, 0.f) };
+			Assert::AreEqual(gres.w, mult.w);
+			Assert::AreEqual(gres.x, mult.v.x);
+			Assert::AreEqual(gres.y, mult.v.y);
+			Assert::AreEqual(gres.z, mult.v.z);
+		}
+
+		TEST_METHOD(constexprMatrix4)
+		{
+			constexpr Math::QXmat4 identity{ Math::QXmat4::Identity() };
+			constexpr Math::QXmat4 scale{ Math::QXmat4::CreateScaleMatrix(Math::QXvec3(2.f, 3.f, 4.f)) };
+			constexpr Math::QXmat4 trans{ Math::QXmat4::CreateTranslationMatrix(Math::QXvec3(1.f, 2.f, 3.f)) };
+			constexpr Math::QXmat4 mult{ scale * identity * trans.Transpose() };
+			constexpr Math::QXvec3 point{ mult * Math::QXvec3(1.f, 1.f, 1.f) };
+			constexpr Math::QXvec4 vec{ scale * Math::QXvec4(1.f, 1.f, 1.f, 1.f) };
+
+			static_assert(identity[0][0] == 1.f && identity[0][1] == 0.f && identity[3][3] == 1.f, "QXmat4 Identity");
+			static_assert(trans[3][0] == 1.f && trans[3][1] == 2.f && trans[3][2] == 3.f, "QXmat4 translation");
+			static_assert(point.x == 4.f && point.y == 9.f && point.z == 16.f, "QXmat4 product");
+			static_assert(vec.x == 2.f && vec.y == 3.f && vec.z == 4.f && vec.w == 1.f, "QXmat4 QXvec4 product");
+
+			glm::mat4 gmult{ glm::scale(glm::mat4(1.f), glm::vec3(2.f, 3.f, 4.f)) };
+			Assert::AreEqual(gmult[1][1], mult[1][1]);
+			Assert::AreEqual(gmult[2][2], mult[2][2]);
+		}
+		/* END Test Constexpr */
+
+		/* BEGIN Test Expression */
+		TEST_METHOD(expressionVector)
+		{
+			using namespace Math::Expression;
+
+			Math::QXvec3 o(1.f, 2.f, 3.f), i(1.f, 0.f, 0.f), j(0.f, 0.5f, 0.5f), k(0.f, -1.f, 1.f);
+			Math::QXvec3 halfSizes(2.f, 3.f, 4.f);
+
+			Math::QXvec3 eager{ o + i * halfSizes.x - j * halfSizes.y - k * halfSizes.z };
+			Math::QXvec3 lazy{ Eval<Math::QXvec3>(Lazy(o) + Lazy(i) * halfSizes.x - Lazy(j) * halfSizes.y - Lazy(k) * halfSizes.z) };
+
+			Assert::AreEqual(eager.x, lazy.x);
+			Assert::AreEqual(eager.y, lazy.y);
+			Assert::AreEqual(eager.z, lazy.z);
+
+			Math::QXmat4 m{ Math::QXmat4::CreateRotationMatrix(Math::QXvec3(0.f, 1.f, 0.f), 0.7f) };
+			Math::QXvec4 v(1.f, 2.f, 3.f, 1.f);
+			Math::QXvec4 eager4{ m * v + v * 2.f };
+			Math::QXvec4 lazy4{ Eval<Math::QXvec4>(Lazy(m) * Lazy(v) + 2.f * Lazy(v)) };
+
+			Assert::AreEqual(eager4.x, lazy4.x, 0.0001f);
+			Assert::AreEqual(eager4.y, lazy4.y, 0.0001f);
+			Assert::AreEqual(eager4.z, lazy4.z, 0.0001f);
+			Assert::AreEqual(eager4.w, lazy4.w, 0.0001f);
+		}
+
+		TEST_METHOD(expressionMatrix)
+		{
+			using namespace Math::Expression;
+
+			Math::QXmat a(3, 4), b(3, 2), c(2, 4);
+			for (int i = 0; i < 12; i++)
+				a.array[i] = i * 0.5f - 2.f;
+			for (int i = 0; i < 6; i++)
+			{
+				b.array[i] = (float)i;
+				c.array[i] = 1.f - i;
+			}
+			c.array[6] = 3.f;
+			c.array[7] = -2.f;
+
+			Math::QXmat eager{ a + (b * c) * 0.5f };
+			Math::QXmat lazy{ Eval<Math::QXmat>(Lazy(a) + Lazy(b) * Lazy(c) * 0.5f) };
+
+			Assert::AreEqual(eager.line, lazy.line);
+			Assert::AreEqual(eager.column, lazy.column);
+			for (int i = 0; i < 12; i++)
+				Assert::AreEqual(eager.array[i], lazy.array[i]);
+
+			/* same size destination keeps its buffer */
+			float* buffer{ lazy.array };
+			Assign(lazy, Lazy(lazy) - Lazy(a) * 2.f);
+			Assert::IsTrue(buffer == lazy.array);
+			for (int i = 0; i < 12; i++)
+				Assert::AreEqual(eager.array[i] - a.array[i] * 2.f, lazy.array[i]);
+
+			Math::QXmat4 m4{ Math::QXmat4::CreateScaleMatrix(Math::QXvec3(1.f, 2.f, 3.f)) };
+			Math::QXmat4 sum{ Eval<Math::QXmat4>(Lazy(m4) * Lazy(m4) - Lazy(m4)) };
+			Assert::AreEqual(0.f, sum[0][0]);
+			Assert::AreEqual(2.f, sum[1][1]);
+			Assert::AreEqual(6.f, sum[2][2]);
+		}
+		/* END Test Expression */
+
+		/* BEGIN Test SparseMat */
+		TEST_METHOD(sparseMatBuild)
+		{
+			std::vector<Math::QXtriplet> triplets{ { 2, 1, 3.f }, { 0, 3, 1.f }, { 0, 0, 2.f }, { 2, 1, -1.f }, { 1, 2, 5.f } };
+			Math::QXsparseMat sparse(3, 4, triplets);
+
+			Assert::AreEqual(4u, sparse.NonZeros());
+			Assert::AreEqual(2.f, sparse.Get(2, 1));
+			Assert::AreEqual(0.f, sparse.Get(1, 1));
+
+			Math::QXmat dense{ sparse.ToMat() };
+			Math::QXsparseMat back(dense);
+			Assert::AreEqual(sparse.NonZeros(), back.NonZeros());
+			for (int i = 0; i < 3; i++)
+				for (int j = 0; j < 4; j++)
+					Assert::AreEqual(dense[i][j], back.Get(i, j));
+
+			Math::QXsparseMat transpose{ sparse.Transpose() };
+			Assert::AreEqual(4, transpose.line);
+			Assert::AreEqual(5.f, transpose.Get(2, 1));
+			Assert::AreEqual(1.f, transpose.Get(3, 0));
+		}
+
+		TEST_METHOD(sparseMatMultiply)
+		{
+			Math::QXmat dense(5, 4);
+			for (int i = 0; i < 5; i++)
+				for (int j = 0; j < 4; j++)
+					dense[i][j] = (i + j) % 3 == 0 ? (float)(i - j) : 0.f;
+
+			Math::QXsparseMat sparse(dense);
+			Math::QXmat x(4, 1), xT(1, 5);
+			std::vector<float> xv{ 1.f, -2.f, 0.5f, 3.f }, xTv{ 1.f, 2.f, 3.f, 4.f, 5.f }, yT(4);
+			for (int j = 0; j < 4; j++)
+				x[j][0] = xv[j];
+			for (int i = 0; i < 5; i++)
+				xT[0][i] = xTv[i];
+
+			Math::QXmat ref(dense * x);
+			std::vector<float> y{ sparse * xv };
+			for (int i = 0; i < 5; i++)
+				Assert::AreEqual(ref[i][0], y[i]);
+
+			Math::QXmat refT(xT * dense);
+			sparse.MultiplyTranspose(xTv.data(), yT.data());
+			for (int j = 0; j < 4; j++)
+				Assert::AreEqual(refT[0][j], yT[j]);
+		}
+
+		TEST_METHOD(sparseMatConjugateGradient)
+		{
+			/* 1D Laplacian, big enough to use the threaded products */
+			const unsigned int size = 40000;
+			std::vector<Math::QXtriplet> triplets;
+			for (unsigned int i = 0; i < size; i++)
+			{
+				triplets.push_back({ i, i, 2.5f });
+				if (i > 0)
+					triplets.push_back({ i, i - 1, -1.f });
+				if (i + 1 < size)
+					triplets.push_back({ i, i + 1, -1.f });
+			}
+
+			Math::QXsparseMat sparse(size, size, triplets);
+			std::vector<float> solution(size), b(size), x(size, 0.f);
+			for (unsigned int i = 0; i < size; i++)
+				solution[i] = sinf(i * 0.01f);
+			sparse.Multiply(solution.data(), b.data());
+
+			Assert::IsTrue(sparse.SolveConjugateGradient(b.data(), x.data(), 200, 1e-6f) > 0);
+			for (unsigned int i = 0; i < size; i += 997)
+				Assert::AreEqual(solution[i], x[i], 0.0001f);
+
+			std::vector<float> y(size), yT(size);
+			sparse.Multiply(x.data(), y.data());
+			sparse.MultiplyTranspose(x.data(), yT.data());
+			for (unsigned int i = 0; i < size; i += 997)
+				Assert::AreEqual(y[i], yT[i], 0.0001f);
+		}
+		/* END Test SparseMat */
+
+		/* BEGIN Test Decomposition */
+		TEST_METHOD(decompositionLDLT)
+		{
+			const int size = 6;
+			Math::QXmat a(size, size), ldlt(size, size);
+			for (int i = 0; i < size; i++)
+				for (int j = 0; j < size; j++)
+					a[i][j] = i == j ? 10.f + i : 1.f / (1 + i + j);
+			ldlt = a;
+
+			Assert::IsTrue(Math::DecomposeLDLT(ldlt));
+
+			float solution[size]{ 1.f, -2.f, 0.5f, 3.f, -1.f, 4.f }, b[size]{};
+			for (int i = 0; i < size; i++)
+				for (int j = 0; j < size; j++)
+					b[i] += a[i][j] * solution[j];
+
+			Math::SolveLDLT(ldlt, b);
+			for (int i = 0; i < size; i++)
+				Assert::AreEqual(solution[i], b[i], 0.00001f);
+
+			Math::QXmat4 a3{ Math::QXmat4::Identity() };
+			float values[3][3]{ { 4.f, 1.f, -2.f }, { 1.f, 5.f, 0.5f }, { -2.f, 0.5f, 6.f } };
+			for (int i = 0; i < 3; i++)
+				for (int j = 0; j < 3; j++)
+					a3[i][j] = values[i][j];
+
+			Math::QXvec3 x{ 1.f, 2.f, -3.f };
+			Math::QXvec3 b3{ a3 * x };
+			Assert::IsTrue(Math::DecomposeLDLT3(a3));
+			Math::QXvec3 res{ Math::SolveLDLT3(a3, b3) };
+			for (int i = 0; i < 3; i++)
+				Assert::AreEqual(x[i], res[i], 0.00001f);
+		}
+
+		TEST_METHOD(decompositionQR)
+		{
+			/* line fit y = 2x - 1 through points with symmetric noise */
+			const int count = 8;
+			Math::QXmat a(count, 2);
+			float tau[2], b[count], x[2];
+			for (int i = 0; i < count; i++)
+			{
+				a[i][0] = (float)i;
+				a[i][1] = 1.f;
+				b[i] = 2.f * i - 1.f + (i % 2 == 0 ? 0.1f : -0.1f);
+			}
+
+			Math::DecomposeQR(a, tau);
+			Assert::IsTrue(Math::SolveLeastSquares(a, tau, b, x));
+
+			glm::mat2 normal{ 0.f };
+			glm::vec2 rhs{ 0.f };
+			for (int i = 0; i < count; i++)
+			{
+				glm::vec2 row{ (float)i, 1.f };
+				normal += glm::outerProduct(row, row);
+				rhs += row * (2.f * i - 1.f + (i % 2 == 0 ? 0.1f : -0.1f));
+			}
+			glm::vec2 ref{ glm::inverse(normal) * rhs };
+			Assert::AreEqual(ref.x, x[0], 0.0001f);
+			Assert::AreEqual(ref.y, x[1], 0.0001f);
+
+			Math::QXmat4 m{ Math::QXmat4::Identity() }, q, r;
+			float values[3][3]{ { 1.f, 2.f, 0.f }, { -1.f, 1.f, 3.f }, { 2.f, 0.f, 1.f } };
+			for (int i = 0; i < 3; i++)
+				for (int j = 0; j < 3; j++)
+					m[i][j] = values[i][j];
+
+			Math::DecomposeQR3(m, q, r);
+			Math::QXmat4 qr{ q * r };
+			for (int i = 0; i < 4; i++)
+				for (int j = 0; j < 4; j++)
+					Assert::AreEqual(m[i][j], qr[i][j], 0.00001f);
+			Assert::AreEqual(0.f, r[1][0]);
+			Assert::AreEqual(0.f, r[2][0]);
+			Assert::AreEqual(0.f, r[2][1]);
+		}
+
+		TEST_METHOD(decompositionEigen)
+		{
+			const int size = 7;
+			Math::QXmat a(size, size), v(size, size);
+			float eigenValues[size];
+			for (int i = 0; i < size; i++)
+				for (int j = 0; j < size; j++)
+					a[i][j] = i == j ? (float)(i + 1) : 0.5f / (1 + abs(i - j));
+			v = a;
+
+			Assert::IsTrue(Math::EigenSymmetric(v, eigenValues));
+			for (int k = 0; k < size; k++)
+			{
+				if (k > 0)
+					Assert::IsTrue(eigenValues[k] <= eigenValues[k - 1]);
+
+				for (int i = 0; i < size; i++)
+				{
+					float av{ 0.f };
+					for (int j = 0; j < size; j++)
+						av += a[i][j] * v[j][k];
+					Assert::AreEqual(eigenValues[k] * v[i][k], av, 0.0001f);
+				}
+			}
+
+			Math::QXmat4 m[13], vectors[13];
+			Math::QXvec3 values[13];
+			for (int n = 0; n < 13; n++)
+			{
+				glm::mat3 g{ glm::mat3(glm::vec3(2.f + n, 0.3f * n, -1.f), glm::vec3(0.3f * n, 1.f, 0.5f), glm::vec3(-1.f, 0.5f, 3.f - n)) };
+				m[n] = Math::QXmat4::Identity();
+				for (int i = 0; i < 3; i++)
+					for (int j = 0; j < 3; j++)
+						m[n][i][j] = g[j][i];
+			}
+
+			Math::EigenSymmetric3(m, values, vectors, 13);
+			for (int n = 0; n < 13; n++)
+			{
+				Assert::IsTrue(values[n].x >= values[n].y && values[n].y >= values[n].z);
+
+				Math::QXmat4 diagonal{ vectors[n].Transpose() * m[n] * vectors[n] };
+				for (int i = 0; i < 3; i++)
+					for (int j = 0; j < 3; j++)
+						Assert::AreEqual(i == j ? values[n][i] : 0.f, diagonal[i][j], 0.0001f);
+
+				glm::mat3 rotation;
+				for (int i = 0; i < 3; i++)
+					for (int j = 0; j < 3; j++)
+						rotation[j][i] = vectors[n][i][j];
+				Assert::AreEqual(1.f, glm::determinant(rotation), 0.0001f);
+
+				Math::QXmat4 single;
+				Math::QXvec3 singleValues{ Math::EigenSymmetric3(m[n], single) };
+				for (int i = 0; i < 3; i++)
+					Assert::AreEqual(singleValues[i], values[n][i], 0.0001f);
+			}
+		}
+		/* END Test Decomposition */
+
+		/* BEGIN Test SVD */
+		TEST_METHOD(svd3)
+		{
+			/* reference built in double: a = u * diag(sigma) * transpose(v), one reflection and one rank deficient matrix */
+			const int count = 13;
+			Math::QXmat4 m[count], u[count], v[count];
+			Math::QXvec3 sigma[count];
+			glm::dvec3 refSigma[count];
+			glm::dmat3 ref[count];
+			for (int n = 0; n < count; n++)
+			{
+				glm::dmat3 ru{ glm::mat3_cast(glm::angleAxis(0.3 + n, glm::normalize(glm::dvec3(1.0, n - 4.0, 2.0)))) };
+				glm::dmat3 rv{ glm::mat3_cast(glm::angleAxis(1.7 - n * 0.4, glm::normalize(glm::dvec3(n % 3 - 1.0, 0.5, 1.0)))) };
+				refSigma[n] = glm::dvec3(3.0 + n, 1.5 + n * 0.1, n == 5 ? -0.25 : (n == 7 ? 0.0 : 0.5));
+				ref[n] = ru * glm::dmat3(glm::dvec3(refSigma[n].x, 0.0, 0.0), glm::dvec3(0.0, refSigma[n].y, 0.0), glm::dvec3(0.0, 0.0, refSigma[n].z)) * glm::transpose(rv);
+
+				m[n] = Math::QXmat4::Identity();
+				for (int i = 0; i < 3; i++)
+					for (int j = 0; j < 3; j++)
+						m[n][i][j] = (float)ref[n][j][i];
+			}
+
+			Math::SVD3(m, u, sigma, v, count);
+			for (int n = 0; n < count; n++)
+			{
+				for (int i = 0; i < 3; i++)
+					Assert::AreEqual(refSigma[n][i], (double)sigma[n][i], 0.00001 * refSigma[n].x);
+
+				for (int i = 0; i < 3; i++)
+				{
+					for (int j = 0; j < 3; j++)
+					{
+						double rebuilt{ 0.0 };
+						for (int k = 0; k < 3; k++)
+							rebuilt += (double)u[n][i][k] * sigma[n][k] * v[n][j][k];
+						Assert::AreEqual(ref[n][j][i], rebuilt, 0.00001 * refSigma[n].x);
+					}
+				}
+
+				glm::mat3 gu, gv;
+				for (int i = 0; i < 3; i++)
+					for (int j = 0; j < 3; j++)
+					{
+						gu[j][i] = u[n][i][j];
+						gv[j][i] = v[n][i][j];
+					}
+				Assert::AreEqual(1.f, glm::determinant(gu), 0.00001f);
+				Assert::AreEqual(1.f, glm::determinant(gv), 0.00001f);
+			}
+
+			Math::QXmat4 single[2];
+			Math::QXvec3 singleSigma;
+			Math::SVD3(m[3], single[0], singleSigma, single[1]);
+			for (int i = 0; i < 3; i++)
+				Assert::AreEqual(sigma[3][i], singleSigma[i]);
+		}
+
+		TEST_METHOD(polar3)
+		{
+			const int count = 9;
+			Math::QXmat4 m[count];
+			Math::QXquaternion rotations[count];
+			glm::dquat ref[count];
+			for (int n = 0; n < count; n++)
+			{
+				/* a = r * s with s symmetric positive definite */
+				ref[n] = glm::angleAxis(0.2 + n * 0.6, glm::normalize(glm::dvec3(n - 3.0, 1.0, 0.5)));
+				glm::dmat3 rs{ glm::mat3_cast(glm::angleAxis(n * 0.9, glm::normalize(glm::dvec3(0.0, 1.0, n + 1.0)))) };
+				glm::dmat3 s{ rs * glm::dmat3(glm::dvec3(2.0 + n, 0.0, 0.0), glm::dvec3(0.0, 1.0, 0.0), glm::dvec3(0.0, 0.0, 0.3)) * glm::transpose(rs) };
+				glm::dmat3 a{ glm::mat3_cast(ref[n]) * s };
+
+				m[n] = Math::QXmat4::Identity();
+				for (int i = 0; i < 3; i++)
+					for (int j = 0; j < 3; j++)
+						m[n][i][j] = (float)a[j][i];
+			}
+
+			Math::Polar3(m, rotations, count);
+			for (int n = 0; n < count; n++)
+			{
+				double sign{ glm::dot(ref[n], glm::dquat(rotations[n].w, rotations[n].v.x, rotations[n].v.y, rotations[n].v.z)) < 0.0 ? -1.0 : 1.0 };
+				Assert::AreEqual(ref[n].w, sign * rotations[n].w, 0.00001);
+				Assert::AreEqual(ref[n].x, sign * rotations[n].v.x, 0.00001);
+				Assert::AreEqual(ref[n].y, sign * rotations[n].v.y, 0.00001);
+				Assert::AreEqual(ref[n].z, sign * rotations[n].v.z, 0.00001);
+			}
+
+			Math::QXmat4 stretch;
+			Math::QXquaternion rotation{ Math::Polar3(m[4], &stretch) };
+			Math::QXmat4 rebuilt{ rotation.ConvertQuaternionToMat() * stretch };
+			for (int i = 0; i < 3; i++)
+			{
+				for (int j = 0; j < 3; j++)
+				{
+					Assert::AreEqual(stretch[i][j], stretch[j][i], 0.00001f);
+					Assert::AreEqual(m[4][i][j], rebuilt[i][j], 0.0001f);
+				}
+			}
+		}
+		/* END Test SVD */
+
+		/* BEGIN Test Double */
+		TEST_METHOD(inverseDMat4)
+		{
+			Math::QXdmat4 mat4;
+			glm::dmat4 gmat4;
+
+			for (unsigned int i = 0; i < 16; i++)
+			{
+				mat4.array[i] = (i % 5 == 0 ? 4.0 : 0.0) + (double)((i * 7) % 11) / 10.0;
+				gmat4[i / 4][i % 4] = mat4.array[i];
+			}
+
+			Math::QXdmat4 mat4inv = mat4.Inverse();
+			glm::dmat4 gmat4inv = glm::inverse(gmat4);
+			for (unsigned int i = 0; i < 16; i++)
+				Assert::AreEqual(mat4inv.array[i], gmat4inv[i / 4][i % 4], 1e-12);
+		}
+
+		TEST_METHOD(largeWorldDVec3)
+		{
+			/* 1 cm offset 10 000 km away from the origin, float rounds it away */
+			Math::QXdvec3 position(1e7, 0.0, 0.0);
+			Math::QXdmat4 translation = Math::QXdmat4::Identity();
+			translation.array[3] = 0.01;
+			glm::dvec3 gposition(1e7, 0.0, 0.0);
+
+			Math::QXdvec3 res = translation * position - position;
+			glm::dvec3 gres = (gposition + glm::dvec3(0.01, 0.0, 0.0)) - gposition;
+
+			Assert::AreEqual(res.x, gres.x, 1e-9);
+
+			Math::QXvec3 fposition(position);
+			Math::QXvec3 fres = Math::QXmat4(translation) * fposition - fposition;
+			Assert::AreEqual(fres.x, 0.f);
+		}
+
+		TEST_METHOD(quaternionDouble)
+		{
+			Math::QXdquaternion quat(0.5, Math::QXdvec3(0.1, 0.2, 0.3));
+			glm::dquat gquat(0.5, 0.1, 0.2, 0.3);
+
+			Math::QXdquaternion res = quat * quat;
+			glm::dquat gres = gquat * gquat;
+
+			Assert::AreEqual(res.w, gres.w, 1e-12);
+			Assert::AreEqual(res.v.x, gres.x, 1e-12);
+			Assert::AreEqual(res.v.y, gres.y, 1e-12);
+			Assert::AreEqual(res.v.z, gres.z, 1e-12);
+
+			Math::QXquaternion fquat(quat);
+			Assert::AreEqual(fquat.v.z, 0.3f, 1e-7f);
+		}
+
+		TEST_METHOD(transformPoints)
+		{
+			Math::QXdmat4 mat4 = Math::QXdmat4::CreateTRSMatrix(Math::QXdvec3(1e6, -2.0, 3.0),
+																Math::QXdvec3(0.3, 1.2, -0.7), Math::QXdvec3(2.0, 1.0, 0.5));
+			Math::QXmat4 fmat4(mat4);
+			Math::QXdvec3 points[7];
+			Math::QXvec3 fpoints[7];
+
+			for (unsigned int i = 0; i < 7; i++)
+			{
+				points[i] = Math::QXdvec3(i * 1.5, 10.0 - i, i * i * 0.25);
+				fpoints[i] = Math::QXvec3(points[i]);
+			}
+
+			Math::QXdvec3 res[8];
+			res[7] = Math::QXdvec3(42.0, 42.0, 42.0);
+			mat4.TransformPoints(points, res, 7);
+			fmat4.TransformPoints(fpoints, fpoints, 7);
+
+			for (unsigned int i = 0; i < 7; i++)
+			{
+				Math::QXdvec3 expected = mat4 * points[i];
+				for (unsigned int k = 0; k < 3; k++)
+				{
+					Assert::AreEqual(res[i][k], expected[k], 1e-9);
+					Assert::AreEqual((double)fpoints[i][k], expected[k], 0.5);
+				}
+			}
+			Assert::AreEqual(res[7].x, 42.0);
+		}
+
+		TEST_METHOD(convertShapes)
+		{
+			Math::Geometry::QXdcapsule capsule(Math::Geometry::QXdsegment(Math::QXdvec3(1e7, 0.0, 0.0), Math::QXdvec3(1e7, 2.0, 0.0)), 0.25);
+			Math::Geometry::QXcapsule fcapsule(capsule);
+			Assert::AreEqual(fcapsule.GetSegment().GetPointB().y, 2.f);
+			Assert::AreEqual(fcapsule.GetRadius(), 0.25f);
+
+			Math::Geometry::QXdorientedBox box(Math::QXdref3(Math::QXdvec3(0.5, 0.0, 0.0)), Math::QXdvec3(1.0, 2.0, 3.0));
+			Math::Geometry::QXorientedBox fbox(box);
+			Assert::AreEqual(fbox.GetRef().o.x, 0.5f);
+			Assert::AreEqual(fbox.GetRef().k.z, 1.f);
+			Assert::AreEqual(fbox.GetHalfSizes().z, 3.f);
+
+			Math::Geometry::QXtriangle triangle(Math::QXvec3(0.f, 0.f, 0.f), Math::QXvec3(1.f, 0.f, 0.f), Math::QXvec3(0.f, 1.f, 0.f));
+			Math::Geometry::QXdtriangle dtriangle(triangle);
+			Assert::AreEqual(dtriangle.GetArea(), 0.5, 1e-12);
+		}
+		/* END Test Double */
+
+		/* BEGIN Test MatView */
+		TEST_METHOD(matViewBlock)
+		{
+			Math::QXmat mat(4, 5);
+			for (int i = 0; i < 20; i++)
+				mat.array[i] = (float)i;
+
+			Math::QXmatView view(mat);
+			Math::QXmatView block = view.Block(1, 2, 3, 2);
+			Math::QXmat blockMat = block.ToMat();
+
+			Assert::AreEqual(blockMat.line, 3);
+			Assert::AreEqual(blockMat.column, 2);
+			for (int i = 0; i < 3; i++)
+				for (int j = 0; j < 2; j++)
+					Assert::AreEqual(blockMat[i][j], mat[i + 1][j + 2], 0.f);
+
+			/* writing through the view changes the matrix */
+			block(0, 0) = -1.f;
+			Assert::AreEqual(mat[1][2], -1.f, 0.f);
+
+			Math::QXmat transposed = view.Transposed().ToMat();
+			Math::QXmat reference = mat.Transpose();
+			for (int i = 0; i < 20; i++)
+				Assert::AreEqual(transposed.array[i], reference.array[i], 0.f);
+
+			Assert::AreEqual(view.Column(3)(2, 0), mat[2][3], 0.f);
+			Assert::AreEqual(view.Line(2)(0, 4), mat[2][4], 0.f);
+		}
+
+		TEST_METHOD(matViewMultiply)
+		{
+			/* 3x3 matrix inside a padded external buffer of 4 floats per line */
+			float buffer[12] = { 2, 1, 0, 99,
+								 1, 3, 1, 99,
+								 0, 1, 4, 99 };
+			Math::QXmatView a(buffer, 3, 3, 4);
+			Math::QXmat b(3, 2);
+			for (int i = 0; i < 6; i++)
+				b.array[i] = (float)(i + 1);
+
+			Math::QXmat dense = a.ToMat();
+			Math::QXmat reference = dense.Transpose() * b;
+			Math::QXmat result(3, 2);
+			Math::Multiply(a.Transposed(), b, result);
+
+			for (int i = 0; i < 6; i++)
+				Assert::AreEqual(result.array[i], reference.array[i], 1e-5f);
+
+			Math::Add(result, reference, result);
+			for (int i = 0; i < 6; i++)
+				Assert::AreEqual(result.array[i], 2.f * reference.array[i], 1e-5f);
+
+			/* solve in place on a copy of the block, x = b */
+			Math::QXmat rhs = dense * b;
+			bool solved = Math::Solve(a, rhs);
+			Assert::IsTrue(solved);
+			for (int i = 0; i < 6; i++)
+				Assert::AreEqual(rhs.array[i], b.array[i], 1e-5f);
+			Assert::AreEqual(buffer[3], 99.f, 0.f);
+		}
+		/* END Test MatView */
+
+		/* BEGIN Test BinaryFile */
+		TEST_METHOD(binaryFileRoundTrip)
+		{
+			const char* path = "UnitTestBinaryFile.qxb";
+
+			Math::QXvec3 points[5];
+			for (int i = 0; i < 5; i++)
+				points[i] = Math::QXvec3((float)i, i * 2.f, i * -3.f);
+
+			Math::QXmat4 transforms[2] = { Math::QXmat4::Identity(), Math::QXmat4::CreateScaleMatrix(Math::QXvec3(2.f, 3.f, 4.f)) };
+			Math::QXmat mat(3, 2);
+			for (int i = 0; i < 6; i++)
+				mat.array[i] = i * 0.5f;
+
+			{
+				Math::QXbinaryWriter writer;
+				Assert::IsTrue(writer.Open(path));
+
+				/* streamed in two parts */
+				writer.BeginArray<Math::QXvec3>("points");
+				writer.Append(points, 2);
+				writer.Append(points + 2, 3);
+				writer.EndArray();
+
+				writer.WriteArray(transforms, 2, "transforms");
+				writer.WriteArray<Math::QXvec4>(nullptr, 0, "empty");
+				writer.WriteMat(Math::QXconstMatView(mat).Transposed(), "mat");
+				Assert::IsTrue(writer.Close());
+			}
+
+			{
+				Math::QXbinaryReader reader;
+				Assert::IsTrue(reader.Open(path));
+				Assert::AreEqual(reader.ArrayCount(), 4u);
+
+				Math::QXspan<Math::QXvec3> readPoints = reader.Get<Math::QXvec3>(reader.Find("points"));
+				Assert::AreEqual((int)readPoints.count, 5);
+				Assert::AreEqual((int)((uintptr_t)readPoints.data % QX_BINARY_ALIGNMENT), 0);
+				for (int i = 0; i < 5; i++)
+					Assert::IsTrue(readPoints[i] == points[i]);
+
+				Math::QXspan<Math::QXmat4> readTransforms = reader.Get<Math::QXmat4>(1);
+				Assert::AreEqual((int)readTransforms.count, 2);
+				for (int i = 0; i < 16; i++)
+					Assert::AreEqual(readTransforms[1].array[i], transforms[1].array[i], 0.f);
+
+				/* wrong element type gives an empty span */
+				Assert::IsTrue(reader.Get<Math::QXdvec3>(0).empty());
+				Assert::IsTrue(reader.Get<Math::QXvec4>(reader.Find("empty")).empty());
+				Assert::AreEqual(reader.Find("missing"), -1);
+
+				Math::QXconstMatView readMat = reader.GetMat(3);
+				Assert::AreEqual(readMat.line, 2);
+				Assert::AreEqual(readMat.column, 3);
+				for (int i = 0; i < 2; i++)
+					for (int j = 0; j < 3; j++)
+						Assert::AreEqual(readMat(i, j), mat[j][i], 0.f);
+			}
+
+			std::remove(path);
+			Math::QXbinaryReader reader;
+			Assert::IsFalse(reader.Open(path));
+		}
+		/* END Test BinaryFile */
+
+		/* BEGIN Test Format */
+		TEST_METHOD(formatParse)
+		{
+			char buffer[512];
+			Math::QXvec3 vec(1.f, 2.5f, -0.1f);
+
+			std::to_chars_result res = Math::Format(buffer, buffer + 512, vec);
+			Assert::IsTrue(res.ec == std::errc());
+			Assert::AreEqual(std::string(buffer, res.ptr), std::string("1,2.5,-0.1"));
+
+			/* buffer too small */
+			Assert::IsTrue(Math::Format(buffer, buffer + 4, vec).ec == std::errc::value_too_large);
+
+			Math::QXvec3 parsed;
+			const char* text = " 3 ;\t-4.25; 1e3";
+			Assert::IsTrue(Math::Parse(text, text + strlen(text), parsed, ';').ec == std::errc());
+			Assert::IsTrue(parsed == Math::QXvec3(3.f, -4.25f, 1000.f));
+
+			text = "1,2";
+			Assert::IsTrue(Math::Parse(text, text + strlen(text), parsed).ec == std::errc::invalid_argument);
+
+			/* runs of blanks around a blank separator */
+			text = "1  2\t 3";
+			Assert::IsTrue(Math::Parse(text, text + strlen(text), parsed, ' ').ec == std::errc());
+			Assert::IsTrue(parsed == Math::QXvec3(1.f, 2.f, 3.f));
+			text = "1\t\t2 \t3";
+			Assert::IsTrue(Math::Parse(text, text + strlen(text), parsed, '\t').ec == std::errc());
+			Assert::IsTrue(parsed == Math::QXvec3(1.f, 2.f, 3.f));
+			text = "1 2 3";
+			Assert::IsTrue(Math::Parse(text, text + strlen(text), parsed, '\t').ec == std::errc::invalid_argument);
+
+			/* shortest form reads back to the same value */
+			Math::QXdquaternion quat(0.1, Math::QXdvec3(1.0 / 3.0, -2e-300, 7.0));
+			Math::QXdquaternion quatParsed;
+			res = Math::Format(buffer, buffer + 512, quat, ' ');
+			Assert::IsTrue(Math::Parse(buffer, res.ptr, quatParsed, ' ').ec == std::errc());
+			Assert::AreEqual(quatParsed.w, quat.w, 0.0);
+			Assert::AreEqual(quatParsed.v.x, quat.v.x, 0.0);
+			Assert::AreEqual(quatParsed.v.y, quat.v.y, 0.0);
+
+			Math::QXmat4 mat = Math::QXmat4::CreateXRotationMatrix(0.3f);
+			Math::QXmat4 matParsed;
+			res = Math::Format(buffer, buffer + 512, mat);
+			Assert::IsTrue(Math::Parse(buffer, res.ptr, matParsed).ec == std::errc());
+			for (int i = 0; i < 16; i++)
+				Assert::AreEqual(matParsed.array[i], mat.array[i], 0.f);
+		}
+
+		TEST_METHOD(formatParseArray)
+		{
+			std::vector<Math::QXvec4> points;
+			for (int i = 0; i < 100; i++)
+				points.push_back(Math::QXvec4(i * 0.1f, -i * 1e-7f, i * 1e7f, 1.f / (i + 1)));
+
+			std::string text = Math::FormatArray(points.data(), points.size());
+			std::vector<Math::QXvec4> parsed;
+			std::from_chars_result res = Math::ParseArray(text.data(), text.data() + text.size(), parsed);
+
+			Assert::IsTrue(res.ec == std::errc());
+			Assert::AreEqual(parsed.size(), points.size());
+			for (size_t i = 0; i < points.size(); i++)
+				for (int k = 0; k < 4; k++)
+					Assert::AreEqual(parsed[i][k], points[i][k], 0.f);
+
+			std::string broken = "1,2,3,4\r\n\r\n5,6,x,8\n";
+			parsed.clear();
+			res = Math::ParseArray(broken.data(), broken.data() + broken.size(), parsed);
+			Assert::IsTrue(res.ec == std::errc::invalid_argument);
+			Assert::AreEqual(parsed.size(), (size_t)1);
+		}
+		/* END Test Format */
+
+		/* BEGIN Test SpatialHash */
+		TEST_METHOD(hashVec3)
+		{
+			std::hash<Math::QXvec3> hasher;
+
+			/* permutations and sign flips used to collide with the sum of the component hashes */
+			Assert::AreNotEqual(hasher(Math::QXvec3(1.f, 2.f, 3.f)), hasher(Math::QXvec3(3.f, 2.f, 1.f)));
+			Assert::AreNotEqual(hasher(Math::QXvec3(1.f, 2.f, 3.f)), hasher(Math::QXvec3(2.f, 1.f, 3.f)));
+			Assert::AreEqual(hasher(Math::QXvec3(0.f, 1.f, 2.f)), hasher(Math::QXvec3(-0.f, 1.f, 2.f)));
+
+			std::unordered_set<size_t> hashes;
+			for (int x = 0; x < 20; x++)
+				for (int y = 0; y < 20; y++)
+					for (int z = 0; z < 20; z++)
+						hashes.insert(hasher(Math::QXvec3((float)x, (float)y, (float)z)));
+			Assert::AreEqual(hashes.size(), (size_t)8000);
+		}
+
+		TEST_METHOD(spatialHashGrid)
+		{
+			std::vector<Math::QXvec3> points;
+			std::vector<Math::Geometry::QXsphere> spheres;
+			for (unsigned int i = 0; i < 500; i++)
+			{
+				Math::QXvec3 p((float)((i * 7919) % 1000) * 0.01f, (float)((i * 104729) % 1000) * 0.01f, (float)((i * 1299709) % 1000) * 0.01f);
+				points.push_back(p);
+				spheres.push_back(Math::Geometry::QXsphere(p, 0.05f + (i % 7) * 0.05f));
+			}
+
+			Math::Geometry::QXspatialHashGrid grid(0.5f);
+			std::vector<QXuint> found;
+			grid.QueryRadius(Math::QXvec3(0.f, 0.f, 0.f), 1.f, found);
+			Assert::IsTrue(found.empty());
+
+			grid.Build(points.data(), (QXuint)points.size());
+			Math::QXvec3 center(5.f, 5.f, 5.f);
+			grid.QueryRadius(center, 1.3f, found);
+			size_t expected = 0;
+			for (const Math::QXvec3& p : points)
+				expected += (p - center).Dot(p - center) <= 1.3f * 1.3f;
+			Assert::AreEqual(found.size(), expected);
+
+			/* a radius covering more cells than buckets, or too large for the cell coordinates */
+			found.clear();
+			grid.QueryRadius(center, 50.f, found);
+			Assert::AreEqual(found.size(), points.size());
+			found.clear();
+			grid.QueryRadius(center, 1e30f, found);
+			Assert::AreEqual(found.size(), points.size());
+
+			std::vector<std::pair<QXuint, QXuint>> pairs;
+			grid.FindPairs(0.5f, pairs);
+			size_t expectedPairs = 0;
+			for (size_t i = 0; i < points.size(); i++)
+				for (size_t j = i + 1; j < points.size(); j++)
+					expectedPairs += (points[i] - points[j]).Dot(points[i] - points[j]) <= 0.25f;
+			Assert::AreEqual(pairs.size(), expectedPairs);
+
+			/* spheres, overlapping pairs, parallel build and search */
+			grid.Build(spheres.data(), (QXuint)spheres.size(), true);
+			pairs.clear();
+			grid.FindPairs(0.f, pairs, true);
+			expectedPairs = 0;
+			for (size_t i = 0; i < spheres.size(); i++)
+				for (size_t j = i + 1; j < spheres.size(); j++)
+				{
+					Math::QXvec3 delta = spheres[i].GetPosition() - spheres[j].GetPosition();
+					float reach = spheres[i].GetRadius() + spheres[j].GetRadius();
+					expectedPairs += delta.Dot(delta) <= reach * reach;
+				}
+			Assert::AreEqual(pairs.size(), expectedPairs);
+			for (const std::pair<QXuint, QXuint>& pair : pairs)
+				Assert::IsTrue(pair.first < pair.second);
+		}
+		/* END Test SpatialHash */
+
+		/* BEGIN Test SweepAndPrune */
+		static std::vector<std::pair<QXuint, QXuint>> BruteForcePairs(const std::vector<Math::Geometry::QXbox>& boxes)
+		{
+			std::vector<std::pair<QXuint, QXuint>> pairs;
+			for (QXuint i = 0; i < boxes.size(); i++)
+				for (QXuint j = i + 1; j < boxes.size(); j++)
+				{
+					Math::QXvec3 delta = boxes[i].GetPosition() - boxes[j].GetPosition();
+					Math::QXvec3 reach = boxes[i].GetHalfSizes() + boxes[j].GetHalfSizes();
+					if (fabsf(delta.x) <= reach.x && fabsf(delta.y) <= reach.y && fabsf(delta.z) <= reach.z)
+						pairs.emplace_back(i, j);
+				}
+			return pairs;
+		}
+
+		TEST_METHOD(sweepAndPruneIncremental)
+		{
+			std::vector<Math::Geometry::QXbox> boxes;
+			for (QXuint i = 0; i < 300; i++)
+				boxes.push_back(Math::Geometry::QXbox(Math::QXvec3((float)((i * 7919) % 1000) * 0.01f, (float)((i * 104729) % 1000) * 0.01f,
+					(float)((i * 1299709) % 1000) * 0.01f), 0.2f + (i % 5) * 0.1f, 0.3f, 0.25f));
+
+			Math::Geometry::QXsweepAndPrune sap;
+			for (const Math::Geometry::QXbox& box : boxes)
+				sap.AddBody(box);
+			sap.Update();
+
+			std::vector<std::pair<QXuint, QXuint>> expected = BruteForcePairs(boxes);
+			Assert::AreEqual((size_t)sap.PairCount(), expected.size());
+			Assert::AreEqual(sap.GetAddedPairs().size(), expected.size());
+
+			/* move every box a little for a few frames, the pair set follows the brute force one */
+			for (QXuint frame = 1; frame <= 5; frame++)
+			{
+				for (QXuint i = 0; i < boxes.size(); i++)
+				{
+					float step = (float)(((i + frame) * 37) % 21 - 10) * 0.02f;
+					boxes[i] = Math::Geometry::QXbox(boxes[i].GetPosition() + Math::QXvec3(step, -step, 0.5f * step), boxes[i].GetHalfSizes());
+					sap.SetBody(i, boxes[i]);
+				}
+				sap.Update();
+
+				std::vector<std::pair<QXuint, QXuint>> pairs;
+				sap.GetPairs(pairs);
+				std::sort(pairs.begin(), pairs.end());
+				expected = BruteForcePairs(boxes);
+				Assert::IsTrue(pairs == expected);
+			}
+
+			/* a removed body loses its pairs, its handle is reused */
+			std::vector<std::pair<QXuint, QXuint>> pairs;
+			sap.GetPairs(pairs);
+			QXuint removed = pairs[0].first;
+			size_t removedPairs = 0;
+			for (const std::pair<QXuint, QXuint>& pair : pairs)
+				removedPairs += pair.first == removed || pair.second == removed;
+
+			sap.RemoveBody(removed);
+			sap.Update();
+			Assert::AreEqual(sap.GetRemovedPairs().size(), removedPairs);
+			Assert::AreEqual((size_t)sap.PairCount(), pairs.size() - removedPairs);
+			Assert::AreEqual(sap.AddBody(boxes[removed]), removed);
+			sap.Update();
+			Assert::AreEqual((size_t)sap.PairCount(), pairs.size());
+		}
+
+		TEST_METHOD(boxPruning)
+		{
+			std::vector<Math::Geometry::QXbox> boxes;
+			for (QXuint i = 0; i < 1000; i++)
+				boxes.push_back(Math::Geometry::QXbox(Math::QXvec3((float)((i * 7919) % 1000) * 0.02f, (float)((i * 104729) % 1000) * 0.02f,
+					(float)((i * 1299709) % 1000) * 0.02f), 0.5f, 0.2f + (i % 3) * 0.3f, 0.6f));
+			std::vector<std::pair<QXuint, QXuint>> expected = BruteForcePairs(boxes);
+
+			for (bool parallel : { false, true })
+			{
+				std::vector<std::pair<QXuint, QXuint>> pairs;
+				Math::Geometry::QXsweepAndPrune::BoxPruning(boxes.data(), (QXuint)boxes.size(), pairs, parallel);
+				std::sort(pairs.begin(), pairs.end());
+				Assert::IsTrue(pairs == expected);
+			}
+		}
+		/* END Test SweepAndPrune */
+
+		/* BEGIN Test Octree */
+		static bool OctreeMatches(std::vector<QXuint> found, std::vector<QXuint> expected)
+		{
+			std::sort(found.begin(), found.end());
+			std::sort(expected.begin(), expected.end());
+			return found == expected;
+		}
+
+		TEST_METHOD(looseOctreeQueries)
+		{
+			/* boxes of many sizes, a few centered outside the bounds */
+			std::vector<Math::Geometry::QXbox> boxes;
+			for (QXuint i = 0; i < 2000; i++)
+				boxes.push_back(Math::Geometry::QXbox(Math::QXvec3((float)((i * 7919) % 1000) * 0.022f - 1.f, (float)((i * 104729) % 1000) * 0.02f,
+					(float)((i * 1299709) % 1000) * 0.02f), 0.01f + (i % 11) * 0.15f, 0.05f, 0.01f + (i % 3) * 0.4f));
+
+			for (bool parallel : { false, true })
+			{
+				Math::Geometry::QXlooseOctree tree(Math::Geometry::QXbox(Math::QXvec3(10.f, 10.f, 10.f), 10.f, 10.f, 10.f), 6);
+				tree.Build(boxes.data(), (QXuint)boxes.size(), parallel);
+				Assert::AreEqual(tree.Count(), (QXuint)boxes.size());
+
+				Math::Geometry::QXbox query(Math::QXvec3(7.f, 9.f, 11.f), 2.f, 1.f, 3.f);
+				std::vector<QXuint> found, expected;
+				tree.QueryBox(query, found);
+				for (QXuint i = 0; i < boxes.size(); i++)
+				{
+					Math::QXvec3 delta = boxes[i].GetPosition() - query.GetPosition();
+					Math::QXvec3 reach = boxes[i].GetHalfSizes() + query.GetHalfSizes();
+					if (fabsf(delta.x) <= reach.x && fabsf(delta.y) <= reach.y && fabsf(delta.z) <= reach.z)
+						expected.push_back(i);
+				}
+				Assert::IsTrue(OctreeMatches(found, expected));
+
+				/* segment along x, every box crossing the line y = 10, z = 10 */
+				found.clear();
+				expected.clear();
+				tree.QuerySegment(Math::Geometry::QXsegment(Math::QXvec3(-5.f, 10.f, 10.f), Math::QXvec3(30.f, 10.f, 10.f)), found);
+				for (QXuint i = 0; i < boxes.size(); i++)
+				{
+					Math::QXvec3 delta = boxes[i].GetPosition() - Math::QXvec3(10.f, 10.f, 10.f);
+					if (fabsf(delta.y) <= boxes[i].GetHalfSizes().y && fabsf(delta.z) <= boxes[i].GetHalfSizes().z)
+						expected.push_back(i);
+				}
+				Assert::IsTrue(OctreeMatches(found, expected));
+
+				/* frustum reduced to the slab 5 <= x <= 8 */
+				Math::Geometry::QXplane planes[2] = { Math::Geometry::QXplane(Math::QXvec3(1.f, 0.f, 0.f), 5.f),
+														Math::Geometry::QXplane(Math::QXvec3(-1.f, 0.f, 0.f), -8.f) };
+				found.clear();
+				expected.clear();
+				tree.QueryFrustum(planes, 2, found);
+				for (QXuint i = 0; i < boxes.size(); i++)
+					if (boxes[i].GetPosition().x + boxes[i].GetHalfSizes().x >= 5.f && boxes[i].GetPosition().x - boxes[i].GetHalfSizes().x <= 8.f)
+						expected.push_back(i);
+				Assert::IsTrue(OctreeMatches(found, expected));
+			}
+		}
+
+		TEST_METHOD(looseOctreeInsertRemove)
+		{
+			Math::Geometry::QXlooseOctree tree(Math::Geometry::QXbox(Math::QXvec3(0.f), 8.f, 8.f, 8.f));
+			std::vector<Math::QXvec3> points;
+			for (QXuint i = 0; i < 500; i++)
+			{
+				points.push_back(Math::QXvec3((float)((i * 7919) % 1000) * 0.016f - 8.f, (float)((i * 104729) % 1000) * 0.016f - 8.f,
+					(float)((i * 1299709) % 1000) * 0.016f - 8.f));
+				Assert::AreEqual(tree.Insert(points.back()), i);
+			}
+			QXuint sphereHandle = tree.Insert(Math::Geometry::QXsphere(Math::QXvec3(1.f, 1.f, 1.f), 0.5f));
+
+			/* remove every other point, the sphere query only sees the kept ones */
+			for (QXuint i = 0; i < 500; i += 2)
+				Assert::IsTrue(tree.Remove(i));
+			Assert::IsFalse(tree.Remove(0));
+			Assert::AreEqual(tree.Count(), 251u);
+
+			Math::Geometry::QXsphere query(Math::QXvec3(0.5f, 0.f, 0.5f), 3.f);
+			std::vector<QXuint> found, expected;
+			tree.QuerySphere(query, found);
+			for (QXuint i = 1; i < 500; i += 2)
+				if ((points[i] - query.GetPosition()).Dot(points[i] - query.GetPosition()) <= 9.f)
+					expected.push_back(i);
+			expected.push_back(sphereHandle);
+			Assert::IsTrue(OctreeMatches(found, expected));
+
+			/* freed handles are reused */
+			Assert::AreEqual(tree.Insert(points[0]), 498u);
+		}
+		/* END Test Octree */
+
+		/* BEGIN Test KdTree */
+		TEST_METHOD(kdTreeNearest)
+		{
+			std::vector<Math::QXvec3> points;
+			for (QXuint i = 0; i < 1000; i++)
+				points.push_back(Math::QXvec3((float)((i * 7919) % 1000) * 0.01f, (float)((i * 104729) % 1000) * 0.003f,
+					(float)((i * 1299709) % 1000) * 0.02f));
+
+			for (bool parallel : { false, true })
+			{
+				Math::Geometry::QXkdTree tree;
+				tree.Build(points.data(), (QXuint)points.size(), parallel);
+				Assert::AreEqual(tree.Count(), (QXuint)points.size());
+
+				for (QXuint q = 0; q < 20; q++)
+				{
+					Math::QXvec3 query((float)q * 0.6f - 1.f, (float)(q % 4) * 0.9f, (float)(q % 7) * 3.f);
+
+					std::vector<std::pair<float, QXuint>> sorted;
+					for (QXuint i = 0; i < points.size(); i++)
+						sorted.emplace_back((points[i] - query).Dot(points[i] - query), i);
+					std::sort(sorted.begin(), sorted.end());
+
+					float sqrDistance = 0.f;
+					Assert::AreEqual(tree.Nearest(query, &sqrDistance), sorted[0].second);
+					Assert::AreEqual(sqrDistance, sorted[0].first, 1e-6f);
+
+					std::vector<QXuint> found;
+					std::vector<float> distances;
+					tree.KNearest(query, 10, found, &distances);
+					Assert::AreEqual(found.size(), (size_t)10);
+					for (QXuint n = 0; n < 10; n++)
+						Assert::AreEqual(distances[n], sorted[n].first, 1e-6f);
+
+					found.clear();
+					tree.QueryRadius(query, 1.f, found);
+					size_t inside = 0;
+					while (inside < sorted.size() && sorted[inside].first <= 1.f)
+						inside++;
+					Assert::AreEqual(found.size(), inside);
+				}
+			}
+		}
+
+		TEST_METHOD(kdTreeBatch)
+		{
+			std::vector<Math::QXvec3> points;
+			for (QXuint i = 0; i < 1000; i++)
+				points.push_back(Math::QXvec3((float)((i * 7919) % 1000), (float)((i * 104729) % 1000), (float)((i * 1299709) % 1000)));
+
+			Math::Geometry::QXkdTree tree;
+			tree.Build(points.data(), (QXuint)points.size());
+
+			/* each point is its own nearest neighbour, a k larger than the tree pads with ~0u */
+			std::vector<QXuint> result(points.size() * 3);
+			tree.KNearest(points.data(), (QXuint)points.size(), 3, result.data());
+			for (QXuint i = 0; i < points.size(); i++)
+				Assert::AreEqual(result[i * 3], i);
+
+			Math::Geometry::QXkdTree small;
+			small.Build(points.data(), 2);
+			small.KNearest(points.data(), 1, 3, result.data(), false);
+			Assert::AreEqual(result[0], 0u);
+			Assert::AreEqual(result[1], 1u);
+			Assert::AreEqual(result[2], ~0u);
+		}
+		/* END Test KdTree */
+
+		/* BEGIN Test Gjk */
+		TEST_METHOD(gjkDistance)
+		{
+			using namespace Math::Geometry;
+			QXgjkResult result;
+
+			QXsphere sphereA(Math::QXvec3(0.f, 0.f, 0.f), 1.f), sphereB(Math::QXvec3(3.f, 4.f, 0.f), 2.f);
+			Assert::IsFalse(GjkDistance(sphereA, sphereB, result));
+			Assert::AreEqual(result.distance, 2.f, 1e-3f);
+			Assert::AreEqual(result.pointA.x, 0.6f, 1e-3f);
+			Assert::AreEqual(result.pointB.y, 4.f - 1.6f, 1e-3f);
+
+			/* box against a segment passing above it, then against a segment crossing it */
+			QXbox box(Math::QXvec3(0.f, 0.f, 0.f), 1.f, 2.f, 3.f);
+			QXsegment above(Math::QXvec3(-5.f, 2.5f, 0.f), Math::QXvec3(5.f, 2.5f, 1.f));
+			Assert::IsFalse(GjkDistance(box, above, result));
+			Assert::AreEqual(result.distance, 0.5f, 1e-4f);
+			Assert::AreEqual(result.normal.y, 1.f, 1e-4f);
+			QXsegment across(Math::QXvec3(-5.f, 1.f, 0.f), Math::QXvec3(5.f, -1.f, 1.f));
+			Assert::IsTrue(GjkDistance(box, across, result));
+
+			/* rotated box against a cylinder and a quad */
+			QXorientedBox rotated(Math::QXref3(Math::QXvec3(0.f, 0.f, 0.f), Math::QXvec3(0.70710678f, 0.70710678f, 0.f),
+				Math::QXvec3(-0.70710678f, 0.70710678f, 0.f), Math::QXvec3(0.f, 0.f, 1.f)), Math::QXvec3(1.f, 1.f, 1.f));
+			QXcylinder cylinder(QXsegment(Math::QXvec3(3.f, -2.f, 0.f), Math::QXvec3(3.f, 2.f, 0.f)), 0.5f);
+			Assert::IsFalse(GjkDistance(rotated, cylinder, result));
+			Assert::AreEqual(result.distance, 2.5f - 1.41421356f, 1e-3f);
+			QXquad quad(Math::QXvec3(0.f, 0.f, 1.5f));
+			Assert::IsFalse(GjkDistance(rotated, quad, result));
+			Assert::AreEqual(result.distance, 0.5f, 1e-4f);
+		}
+
+		TEST_METHOD(gjkPenetration)
+		{
+			using namespace Math::Geometry;
+			QXgjkResult result;
+
+			QXsphere sphereA(Math::QXvec3(0.f, 0.f, 0.f), 1.f), sphereB(Math::QXvec3(1.5f, 0.f, 0.f), 1.f);
+			Assert::IsTrue(GjkPenetration(sphereA, sphereB, result));
+			Assert::AreEqual(result.depth, 0.5f, 1e-2f);
+			Assert::AreEqual(result.normal.x, 1.f, 1e-2f);
+
+			/* boxes overlapping by 0.25 along y, the smallest axis of overlap */
+			QXbox boxA(Math::QXvec3(0.f, 0.f, 0.f), 1.f, 1.f, 1.f), boxB(Math::QXvec3(0.5f, 1.75f, -0.2f), 1.f, 1.f, 1.f);
+			Assert::IsTrue(GjkPenetration(boxA, boxB, result));
+			Assert::AreEqual(result.depth, 0.25f, 1e-3f);
+			Assert::AreEqual(result.normal.y, 1.f, 1e-3f);
+
+			/* moving B by the normal times the depth separates the shapes */
+			QXbox moved(boxB.GetPosition() + result.normal * (result.depth + 1e-3f), boxB.GetHalfSizes());
+			Assert::IsFalse(GjkDistance(boxA, moved, result));
+
+			/* warm start: the cached simplex of the previous frame gives the same answer in fewer iterations */
+			QXgjkSimplex cache;
+			QXsphere far(Math::QXvec3(10.f, 3.f, -2.f), 1.f);
+			QXorientedBox obb(Math::QXref3(), Math::QXvec3(1.f, 2.f, 0.5f));
+			GjkDistance(obb, far, result, &cache);
+			QXuint cold = result.iterations;
+			float distance = result.distance;
+			QXsphere moved2(Math::QXvec3(10.01f, 3.f, -2.f), 1.f);
+			GjkDistance(obb, moved2, result, &cache);
+			Assert::AreEqual(result.distance, distance + 0.01f, 2e-3f);
+			Assert::IsTrue(result.iterations < cold);
+
+			/* crossing segments with the same center touch with no volume, the normal still has unit length */
+			QXsegment segmentA(Math::QXvec3(-1.f, 0.f, 0.f), Math::QXvec3(1.f, 0.f, 0.f));
+			QXsegment segmentB(Math::QXvec3(0.f, -1.f, 0.f), Math::QXvec3(0.f, 1.f, 0.f));
+			Assert::IsTrue(GjkPenetration(segmentA, segmentB, result));
+			Assert::AreEqual(result.depth, 0.f);
+			Assert::AreEqual(result.normal.Length(), 1.f, 1e-6f);
+		}
+		/* END Test Gjk */
+		/* BEGIN Test Contact */
+		TEST_METHOD(contactBoxes)
+		{
+			using namespace Math::Geometry;
+			const QXfloat s{ 0.70710678f };
+			QXcontactManifold manifold;
+
+			/* small box resting on a face: the 4 corners of its bottom face */
+			QXorientedBox ground(Math::QXref3(), Math::QXvec3(1.f, 1.f, 1.f));
+			QXorientedBox box(Math::QXref3(Math::QXvec3(0.f, 1.45f, 0.f)), Math::QXvec3(0.5f, 0.5f, 0.5f));
+			Assert::IsTrue(CollideBoxes(ground, box, manifold));
+			Assert::AreEqual(manifold.count, 4u);
+			Assert::AreEqual(manifold.normal.y, 1.f, 1e-5f);
+			for (QXuint i = 0; i < manifold.count; i++)
+			{
+				Assert::AreEqual(manifold.points[i].depth, 0.05f, 1e-5f);
+				Assert::AreEqual(manifold.points[i].position.y, 0.975f, 1e-5f);
+				manifold.points[i].impulse = (QXfloat)i + 1.f;
+			}
+
+			/* same features next frame: the impulses follow the points */
+			QXuint firstId{ manifold.points[0].id };
+			box.SetRef().o.x = 0.01f;
+			Assert::IsTrue(CollideBoxes(ground, box, manifold));
+			for (QXuint i = 0; i < manifold.count; i++)
+				if (manifold.points[i].id == firstId)
+					Assert::AreEqual(manifold.points[i].impulse, 1.f);
+
+			/* separated, then rejected on the cached axis */
+			box.SetRef().o.y = 3.f;
+			Assert::IsFalse(CollideBoxes(ground, box, manifold));
+			Assert::AreEqual(manifold.axis, 1u);
+			Assert::IsFalse(CollideBoxes(ground, box, manifold));
+			Assert::AreEqual(manifold.count, 0u);
+
+			/* same size box turned by 45 degrees: an octagon reduced to 4 points */
+			QXorientedBox turned(Math::QXref3(Math::QXvec3(0.f, 1.9f, 0.f), Math::QXvec3(s, 0.f, s), Math::QXvec3(0.f, 1.f, 0.f),
+				Math::QXvec3(-s, 0.f, s)), Math::QXvec3(1.f, 1.f, 1.f));
+			Assert::IsTrue(CollideBoxes(ground, turned, manifold));
+			Assert::AreEqual(manifold.count, 4u);
+			Assert::AreEqual(manifold.points[0].depth, 0.1f, 1e-5f);
+
+			/* two edges crossing: one point between them */
+			QXorientedBox edgeUp(Math::QXref3(Math::QXvec3(0.f, 0.f, 0.f), Math::QXvec3(1.f, 0.f, 0.f), Math::QXvec3(0.f, s, s),
+				Math::QXvec3(0.f, -s, s)), Math::QXvec3(1.f, 1.f, 1.f));
+			QXorientedBox edgeDown(Math::QXref3(Math::QXvec3(0.f, 2.f * 1.41421356f - 0.1f, 0.f), Math::QXvec3(s, s, 0.f),
+				Math::QXvec3(-s, s, 0.f), Math::QXvec3(0.f, 0.f, 1.f)), Math::QXvec3(1.f, 1.f, 1.f));
+			QXcontactManifold edges;
+			Assert::IsTrue(CollideBoxes(edgeUp, edgeDown, edges));
+			Assert::AreEqual(edges.count, 1u);
+			Assert::AreEqual(edges.normal.y, 1.f, 1e-4f);
+			Assert::AreEqual(edges.points[0].depth, 0.1f, 1e-4f);
+			Assert::AreEqual(edges.points[0].position.y, 1.41421356f - 0.05f, 1e-4f);
+			Assert::AreEqual(edges.points[0].position.x, 0.f, 1e-4f);
+			Assert::AreEqual(edges.points[0].position.z, 0.f, 1e-4f);
+		}
+
+		TEST_METHOD(contactBoxPlane)
+		{
+			using namespace Math::Geometry;
+			QXcontactManifold manifold;
+			QXplane floor(Math::QXvec3(0.f, 1.f, 0.f), 0.f);
+
+			QXorientedBox box(Math::QXref3(Math::QXvec3(0.f, 0.9f, 0.f)), Math::QXvec3(1.f, 1.f, 1.f));
+			Assert::IsTrue(CollideBoxPlane(box, floor, manifold));
+			Assert::AreEqual(manifold.count, 4u);
+			Assert::AreEqual(manifold.normal.y, -1.f);
+			Assert::AreEqual(manifold.points[0].depth, 0.1f, 1e-5f);
+
+			/* sunk box: 8 corners reduced to the 4 spanning a face */
+			box.SetRef().o.y = -5.f;
+			Assert::IsTrue(CollideBoxPlane(box, floor, manifold));
+			Assert::AreEqual(manifold.count, 4u);
+
+			box.SetRef().o.y = 1.5f;
+			Assert::IsFalse(CollideBoxPlane(box, floor, manifold));
+			Assert::AreEqual(manifold.count, 0u);
+
+			/* corners outside count the face planes they are in front of */
+			Assert::AreEqual(box.GetNumberPlaneGoodSide(Math::QXvec3(0.f, 1.5f, 0.f)), 0);
+			Assert::AreEqual(box.GetNumberPlaneGoodSide(Math::QXvec3(2.f, 1.5f, 0.f)), 1);
+			Assert::AreEqual(box.GetNumberPlaneGoodSide(Math::QXvec3(2.f, -1.f, -3.f)), 3);
+		}
+		/* END Test Contact */
+
+		/* BEGIN Test Ray */
+		TEST_METHOD(rayPrimitives)
+		{
+			using namespace Math::Geometry;
+
+			QXbox box(Math::QXvec3(0.f, 0.f, 0.f), 1.f, 2.f, 3.f);
+			QXrayHit hit;
+			Assert::IsTrue(Raycast(QXray(Math::QXvec3(-5.f, 0.5f, 0.f), Math::QXvec3(2.f, 0.f, 0.f)), box, hit));
+			Assert::AreEqual(hit.distance, 2.f, 1e-6f);
+			Assert::AreEqual(hit.normal.x, -1.f);
+			Assert::AreEqual(hit.index, 0u);
+
+			/* from inside: the exit point, with its outward normal */
+			QXrayHit inside;
+			Assert::IsTrue(Raycast(QXray(Math::QXvec3(0.f, 0.f, 0.f), Math::QXvec3(0.f, 0.f, -1.f)), box, inside));
+			Assert::AreEqual(inside.distance, 3.f, 1e-6f);
+			Assert::AreEqual(inside.normal.z, -1.f);
+
+			/* a segment is a ray limited to distance 1 */
+			QXrayHit limited;
+			limited.distance = 1.f;
+			Assert::IsFalse(Raycast(QXray(QXsegment(Math::QXvec3(-5.f, 0.f, 0.f), Math::QXvec3(-3.f, 0.f, 0.f))), box, limited));
+			Assert::IsFalse(Raycast(QXray(Math::QXvec3(-5.f, 3.f, 0.f), Math::QXvec3(1.f, 0.f, 0.f)), box, limited));
+
+			QXrayHit sphereHit;
+			Assert::IsTrue(Raycast(QXray(Math::QXvec3(0.f, 0.f, -10.f), Math::QXvec3(0.f, 0.f, 1.f)), QXsphere(Math::QXvec3(0.f, 0.f, 0.f), 2.f), sphereHit));
+			Assert::AreEqual(sphereHit.distance, 8.f, 1e-5f);
+			Assert::AreEqual(sphereHit.normal.z, -1.f, 1e-5f);
+			Assert::IsFalse(Raycast(QXray(Math::QXvec3(0.f, 3.f, -10.f), Math::QXvec3(0.f, 0.f, 1.f)), QXsphere(Math::QXvec3(0.f, 0.f, 0.f), 2.f), hit));
+
+			QXrayHit planeHit;
+			Assert::IsTrue(Raycast(QXray(Math::QXvec3(0.f, 5.f, 0.f), Math::QXvec3(1.f, -1.f, 0.f)), QXplane(Math::QXvec3(0.f, 1.f, 0.f), 1.f), planeHit));
+			Assert::AreEqual(planeHit.distance, 4.f, 1e-6f);
+			Assert::IsFalse(Raycast(QXray(Math::QXvec3(0.f, 5.f, 0.f), Math::QXvec3(1.f, 0.f, 0.f)), QXplane(Math::QXvec3(0.f, 1.f, 0.f), 1.f), planeHit));
+
+			Math::QXvec3 a(0.f, 0.f, 0.f), b(1.f, 0.f, 0.f), c(0.f, 1.f, 0.f);
+			QXrayHit triangleHit;
+			Assert::IsTrue(Raycast(QXray(Math::QXvec3(0.25f, 0.25f, 2.f), Math::QXvec3(0.f, 0.f, -1.f)), a, b, c, triangleHit));
+			Assert::AreEqual(triangleHit.distance, 2.f, 1e-6f);
+			Assert::AreEqual(triangleHit.normal.z, 1.f, 1e-6f);
+			Assert::IsFalse(Raycast(QXray(Math::QXvec3(0.75f, 0.75f, 2.f), Math::QXvec3(0.f, 0.f, -1.f)), a, b, c, triangleHit));
+		}
+
+		TEST_METHOD(rayPackets)
+		{
+			using namespace Math::Geometry;
+
+			std::vector<QXbox>		boxes;
+			std::vector<QXsphere>	spheres;
+			std::vector<Math::QXvec3> vertices;
+			std::vector<QXuint>		indices;
+			for (QXuint i = 0; i < 20; i++)
+			{
+				Math::QXvec3 position((QXfloat)(i % 5) * 3.f - 6.f, (QXfloat)(i / 5) * 3.f - 4.5f, (QXfloat)(i % 3) * 2.f);
+				boxes.emplace_back(position, 0.5f + 0.05f * i, 0.7f, 0.6f);
+				spheres.emplace_back(position + Math::QXvec3(1.f, 1.f, 3.f), 0.4f + 0.03f * i);
+				vertices.push_back(position + Math::QXvec3(0.f, 0.f, 6.f));
+				vertices.push_back(position + Math::QXvec3(2.f, 0.f, 6.5f));
+				vertices.push_back(position + Math::QXvec3(0.f, 2.f, 7.f));
+				indices.insert(indices.end(), { 3 * i, 3 * i + 1, 3 * i + 2 });
+			}
+
+			/* every lane of the packet finds the same hit as the ray cast alone */
+			QXrayPacket16 packet;
+			QXray rays[16];
+			for (QXuint lane = 0; lane < 16; lane++)
+			{
+				rays[lane] = QXray(Math::QXvec3((QXfloat)lane - 8.f, 0.3f * lane - 3.f, -10.f), Math::QXvec3(0.1f, -0.05f * (lane % 4), 1.f));
+				packet.SetRay(lane, rays[lane]);
+			}
+
+			Raycast(packet, boxes.data(), (QXuint)boxes.size());
+			Raycast(packet, spheres.data(), (QXuint)spheres.size());
+			Raycast(packet, vertices.data(), indices.data(), (QXuint)boxes.size());
+
+			QXuint hits{ 0 };
+			for (QXuint lane = 0; lane < 16; lane++)
+			{
+				QXrayHit single, fromBoxes, fromSpheres, fromTriangles;
+				for (QXuint i = 0; i < boxes.size(); i++)
+				{
+					if (Raycast(rays[lane], boxes[i], single))
+						fromBoxes = single, fromBoxes.index = i;
+					if (Raycast(rays[lane], spheres[i], single))
+						fromSpheres = single, fromSpheres.index = i;
+					if (Raycast(rays[lane], vertices[3 * i], vertices[3 * i + 1], vertices[3 * i + 2], single))
+						fromTriangles = single, fromTriangles.index = i;
+				}
+
+				QXrayHit expected{ single };
+				expected.index = single.distance == fromBoxes.distance ? fromBoxes.index :
+					(single.distance == fromSpheres.distance ? fromSpheres.index : fromTriangles.index);
+
+				QXrayHit packetHit{ packet.GetHit(lane) };
+				Assert::AreEqual(packetHit.distance, expected.distance, 1e-5f);
+				Assert::AreEqual(packetHit.index, expected.distance == FLT_MAX ? ~0u : expected.index);
+				Assert::AreEqual(packetHit.normal.z, expected.normal.z, 1e-5f);
+				hits += packetHit.index != ~0u;
+			}
+			Assert::IsTrue(hits > 4);
+
+			/* bounds hook: only the rays passing through the box, and only before their hit */
+			QXrayPacket4 four;
+			for (QXuint lane = 0; lane < 4; lane++)
+				four.SetRay(lane, QXray(Math::QXvec3((QXfloat)lane * 2.f, 0.f, -5.f), Math::QXvec3(0.f, 0.f, 1.f)));
+			QXfloat entry;
+			Assert::AreEqual(IntersectBounds(four, QXbox(Math::QXvec3(1.f, 0.f, 0.f), 1.5f, 1.f, 1.f), &entry), 3u);
+			Assert::AreEqual(entry, 4.f);
+			four.distance[1] = 3.f;
+			Assert::AreEqual(IntersectBounds(four, QXbox(Math::QXvec3(1.f, 0.f, 0.f), 1.5f, 1.f, 1.f)), 1u);
+		}
+		/* END Test Ray */
+
+		/* BEGIN Test Sweep */
+		TEST_METHOD(sweepSphere)
+		{
+			using namespace Math::Geometry;
+			QXsphere sphere(Math::QXvec3(-10.f, 0.f, 0.f), 0.5f);
+
+			/* fast enough to jump over a thin wall in one step */
+			QXsweepHit hit;
+			QXbox wall(Math::QXvec3(0.f, 0.f, 0.f), 0.05f, 2.f, 2.f);
+			Assert::IsTrue(SweepSphere(sphere, Math::QXvec3(20.f, 0.f, 0.f), wall, hit));
+			Assert::AreEqual(hit.time, (10.f - 0.55f) / 20.f, 1e-5f);
+			Assert::AreEqual(hit.normal.x, -1.f);
+			Assert::AreEqual(hit.point.x, -0.05f, 1e-5f);
+
+			/* grazing an edge of the wall, then passing beside it */
+			QXsweepHit edge;
+			Assert::IsTrue(SweepSphere(QXsphere(Math::QXvec3(-10.f, 2.3f, 0.f), 0.5f), Math::QXvec3(20.f, 0.f, 0.f), wall, edge));
+			Assert::AreEqual(edge.point.y, 2.f, 1e-5f);
+			Assert::AreEqual(edge.normal.Length(), 1.f, 1e-5f);
+			Assert::IsTrue(edge.time > hit.time);
+			QXsweepHit beside;
+			Assert::IsFalse(SweepSphere(QXsphere(Math::QXvec3(-10.f, 2.6f, 0.f), 0.5f), Math::QXvec3(20.f, 0.f, 0.f), wall, beside));
+
+			/* same wall as a quad turned to face x */
+			QXsweepHit quadHit;
+			QXquad quad(Math::QXref3(Math::QXvec3(0.f, 0.f, 0.f), Math::QXvec3(0.f, 1.f, 0.f), Math::QXvec3(0.f, 0.f, 1.f), Math::QXvec3(1.f, 0.f, 0.f)),
+				Math::QXvec2(2.f, 2.f));
+			Assert::IsTrue(SweepSphere(sphere, Math::QXvec3(20.f, 0.f, 0.f), quad, quadHit));
+			Assert::AreEqual(quadHit.time, 9.5f / 20.f, 1e-5f);
+			Assert::AreEqual(quadHit.normal.x, -1.f, 1e-5f);
+
+			QXsweepHit sphereHit;
+			Assert::IsTrue(SweepSphere(sphere, Math::QXvec3(20.f, 0.f, 0.f), QXsphere(Math::QXvec3(0.f, 0.f, 0.f), 1.f), sphereHit));
+			Assert::AreEqual(sphereHit.time, 8.5f / 20.f, 1e-5f);
+			Assert::AreEqual(sphereHit.point.x, -1.f, 1e-5f);
+
+			QXsweepHit planeHit;
+			Assert::IsTrue(SweepSphere(QXsphere(Math::QXvec3(0.f, 5.f, 0.f), 1.f), Math::QXvec3(0.f, -8.f, 0.f), QXplane(Math::QXvec3(0.f, 1.f, 0.f), 0.f), planeHit));
+			Assert::AreEqual(planeHit.time, 0.5f, 1e-6f);
+			Assert::AreEqual(planeHit.normal.y, 1.f);
+
+			QXsweepHit segmentHit;
+			Assert::IsTrue(SweepSphere(sphere, Math::QXvec3(20.f, 0.f, 0.f), QXsegment(Math::QXvec3(0.f, -1.f, 0.f), Math::QXvec3(0.f, 1.f, 0.f)), segmentHit));
+			Assert::AreEqual(segmentHit.time, 9.5f / 20.f, 1e-5f);
+
+			/* already touching */
+			QXsweepHit start;
+			Assert::IsTrue(SweepSphere(QXsphere(Math::QXvec3(0.f, 0.f, 0.f), 0.5f), Math::QXvec3(1.f, 0.f, 0.f), wall, start));
+			Assert::AreEqual(start.time, 0.f);
+
+			/* batch: the earliest obstacle of each particle */
+			QXbox boxes[2]{ wall, QXbox(Math::QXvec3(-5.f, 0.f, 0.f), 0.05f, 2.f, 2.f) };
+			QXsphere particles[2]{ sphere, QXsphere(Math::QXvec3(-10.f, 5.f, 0.f), 0.5f) };
+			Math::QXvec3 motions[2]{ Math::QXvec3(20.f, 0.f, 0.f), Math::QXvec3(20.f, 0.f, 0.f) };
+			QXsweepHit hits[2];
+			SweepSpheres(particles, motions, 2, boxes, 2, hits, false);
+			Assert::AreEqual(hits[0].index, 1u);
+			Assert::AreEqual(hits[1].index, ~0u);
+		}
+
+		TEST_METHOD(sweepBoxes)
+		{
+			using namespace Math::Geometry;
+
+			QXsweepHit hit;
+			QXbox a(Math::QXvec3(-5.f, 0.f, 0.f), 1.f, 1.f, 1.f), b(Math::QXvec3(5.f, 0.5f, 0.f), 1.f, 1.f, 1.f);
+			Assert::IsTrue(SweepBoxes(a, Math::QXvec3(4.f, 0.f, 0.f), b, Math::QXvec3(-4.f, 0.f, 0.f), hit));
+			Assert::AreEqual(hit.time, 1.f, 1e-6f);
+			Assert::AreEqual(hit.normal.x, -1.f);
+			Assert::AreEqual(hit.point.x, 0.f, 1e-6f);
+			QXsweepHit miss;
+			Assert::IsFalse(SweepBoxes(a, Math::QXvec3(4.f, 0.f, 0.f), b, Math::QXvec3(-3.f, 0.f, 0.f), miss));
+
+			/* a spinning plank against a box it would pass through between two steps */
+			QXorientedBox plank(Math::QXref3(Math::QXvec3(0.f, 0.f, 0.f)), Math::QXvec3(2.f, 0.1f, 0.1f));
+			QXorientedBox target(Math::QXref3(Math::QXvec3(0.f, 1.5f, 0.f)), Math::QXvec3(0.2f, 0.2f, 0.2f));
+			QXsweepHit impact;
+			Assert::IsTrue(TimeOfImpact(plank, Math::QXvec3(0.f, 0.f, 0.f), Math::QXvec3(0.f, 0.f, 3.14159265f), target,
+				Math::QXvec3(0.f, 0.f, 0.f), Math::QXvec3(0.f, 0.f, 0.f), impact));
+			Assert::IsTrue(impact.time > 0.1f && impact.time < 0.5f);
+			Assert::AreEqual(impact.normal.Length(), 1.f, 1e-3f);
+
+			/* the plank end touches the target when its top corner reaches y = 1.3 */
+			QXorientedBox at(Math::QXref3(Math::QXvec3(0.f, 0.f, 0.f), Math::QXvec3(cosf(impact.time * 3.14159265f), sinf(impact.time * 3.14159265f), 0.f),
+				Math::QXvec3(-sinf(impact.time * 3.14159265f), cosf(impact.time * 3.14159265f), 0.f), Math::QXvec3(0.f, 0.f, 1.f)), Math::QXvec3(2.f, 0.1f, 0.1f));
+			QXgjkResult result;
+			Assert::IsFalse(GjkDistance(at, target, result));
+			Assert::IsTrue(result.distance <= QX_TOI_TOLERANCE * 1.01f);
+
+			QXsweepHit away;
+			Assert::IsFalse(TimeOfImpact(plank, Math::QXvec3(0.f, -1.f, 0.f), Math::QXvec3(0.f, 0.f, 0.f), target,
+				Math::QXvec3(0.f, 0.f, 0.f), Math::QXvec3(0.f, 0.f, 0.f), away));
+		}
+		/* END Test Sweep */
+
+
+		/* BEGIN Test Polynomial */
+		TEST_METHOD(polynomialRoots)
+		{
+			/* the small root of x^2 - 1e4 x + 1 cancels out in the textbook formula */
+			Math::QXroots<2> quadratic{ Math::SolveQuadratic(1.f, -1e4f, 1.f) };
+			Assert::AreEqual(quadratic.count, 2u);
+			Assert::AreEqual(quadratic.values[0], 1e-4f, 1e-10f);
+			Assert::AreEqual(quadratic.values[1], 1e4f, 1e-2f);
+
+			Math::QXroots<2> touching{ Math::SolveQuadratic(1.f, -0.6f, 0.09f) };
+			Assert::AreEqual(touching.count, 1u);
+			Assert::AreEqual(touching.values[0], 0.3f, 1e-6f);
+			Assert::AreEqual(Math::SolveQuadratic(0.f, 2.f, -1.f).values[0], 0.5f);
+			Assert::AreEqual(Math::SolveQuadratic(1.f, 0.f, 1.f).count, 0u);
+			Assert::AreEqual(Math::SolveQuadratic(1.f, -3.f, 2.f, 1.5f, 3.f).count, 1u);
+
+			/* (x - 1)(x - 2)(x - 3) */
+			Math::QXroots<3> cubic{ Math::SolveCubic(1.f, -6.f, 11.f, -6.f) };
+			Assert::AreEqual(cubic.count, 3u);
+			for (QXuint i = 0; i < 3; i++)
+				Assert::AreEqual(cubic.values[i], (QXfloat)(i + 1), 1e-5f);
+			Assert::AreEqual(Math::SolveCubic(1.f, -6.f, 11.f, -6.f, 1.5f, 2.5f).count, 1u);
+
+			/* (x - 1)^2 (x + 2): the double root is found once */
+			Math::QXroots<3> doubleRoot{ Math::SolveCubic(1.f, 0.f, -3.f, 2.f) };
+			Assert::AreEqual(doubleRoot.count, 2u);
+			Assert::AreEqual(doubleRoot.values[0], -2.f, 1e-5f);
+			Assert::AreEqual(doubleRoot.values[1], 1.f, 1e-5f);
+
+			/* (x^2 - 1)(x^2 - 4), then a null leading coef */
+			Math::QXroots<4> quartic{ Math::SolveQuartic(1.f, 0.f, -5.f, 0.f, 4.f) };
+			Assert::AreEqual(quartic.count, 4u);
+			Assert::AreEqual(quartic.values[0], -2.f, 1e-5f);
+			Assert::AreEqual(quartic.values[1], -1.f, 1e-5f);
+			Assert::AreEqual(quartic.values[2], 1.f, 1e-5f);
+			Assert::AreEqual(quartic.values[3], 2.f, 1e-5f);
+			Assert::AreEqual(Math::SolveQuartic(0.f, 1.f, -6.f, 11.f, -6.f).count, 3u);
+			Assert::AreEqual(Math::SolveQuartic(1.f, 0.f, 0.f, 0.f, 1.f).count, 0u);
+
+			/* the old interface: smallest root in [0, 1] */
+			Assert::AreEqual(Math::QuadraticSolver(1.f, -1.f, 0.21f), 0.3f, 1e-6f);
+			Assert::AreEqual(Math::QuadraticSolver(1.f, -5.f, 6.f), -1.f);
+		}
+
+		TEST_METHOD(polynomialBatch)
+		{
+			/* more cubics than a SIMD group, so every lane width and the scalar tail run */
+			const QXuint		count{ 13 };
+			std::vector<QXfloat>	a(count), b(count), c(count), d(count), first(count), second(count), third(count);
+			for (QXuint i = 0; i < count; i++)
+			{
+				/* (x - r0)(x - r1)(x - r2) with roots in [0, 1] */
+				QXfloat r0{ 0.05f * i }, r1{ 0.1f + 0.05f * i }, r2{ 0.5f + 0.05f * i };
+				a[i] = 2.f;
+				b[i] = -2.f * (r0 + r1 + r2);
+				c[i] = 2.f * (r0 * r1 + r1 * r2 + r0 * r2);
+				d[i] = -2.f * r0 * r1 * r2;
+			}
+
+			const QXfloat*	coefficients[4]{ a.data(), b.data(), c.data(), d.data() };
+			QXfloat*		roots[3]{ first.data(), second.data(), third.data() };
+			Math::SolvePolynomials<3>(coefficients, count, roots, 0.f, 1.f, false);
+
+			for (QXuint i = 0; i < count; i++)
+			{
+				Math::QXroots<3> scalar{ Math::SolveCubic(a[i], b[i], c[i], d[i], 0.f, 1.f) };
+				for (QXuint k = 0; k < 3; k++)
+					Assert::AreEqual(roots[k][i], scalar.values[k], 1e-5f);
+
+				Assert::AreEqual(first[i], 0.05f * i, 1e-4f);
+			}
+
+			/* r2 leaves [0, 1] for the last polynomials */
+			Assert::AreEqual(third[count - 1], FLT_MAX);
+		}
+		/* END Test Polynomial */
+
+		/* BEGIN Test Capsule */
+		TEST_METHOD(segmentDistance)
+		{
+			using namespace Math::Geometry;
+			QXfloat s, t;
+
+			/* crossing at right angle, one above the other */
+			QXsegment across(Math::QXvec3(-1.f, 0.f, 0.f), Math::QXvec3(1.f, 0.f, 0.f));
+			Assert::AreEqual(SqrDistance(across, QXsegment(Math::QXvec3(0.f, 1.f, -1.f), Math::QXvec3(0.f, 1.f, 1.f)), &s, &t), 1.f, 1e-6f);
+			Assert::AreEqual(s, 0.5f, 1e-6f);
+			Assert::AreEqual(t, 0.5f, 1e-6f);
+
+			/* closest points at the ends */
+			QXsegment first(Math::QXvec3(0.f, 0.f, 0.f), Math::QXvec3(1.f, 0.f, 0.f));
+			Assert::AreEqual(SqrDistance(first, QXsegment(Math::QXvec3(2.f, 1.f, 0.f), Math::QXvec3(3.f, 1.f, 0.f)), &s, &t), 2.f, 1e-6f);
+			Assert::AreEqual(s, 1.f);
+			Assert::AreEqual(t, 0.f);
+
+			/* parallel: middle of the overlap */
+			QXsegment longer(Math::QXvec3(0.f, 0.f, 0.f), Math::QXvec3(4.f, 0.f, 0.f));
+			Assert::AreEqual(SqrDistance(longer, QXsegment(Math::QXvec3(1.f, 1.f, 0.f), Math::QXvec3(3.f, 1.f, 0.f)), &s, &t), 1.f, 1e-6f);
+			Assert::AreEqual(s, 0.5f, 1e-6f);
+			Assert::AreEqual(t, 0.5f, 1e-6f);
+
+			/* a segment reduced to a point, and a point */
+			QXsegment point(Math::QXvec3(1.f, 1.f, 1.f), Math::QXvec3(1.f, 1.f, 1.f));
+			Assert::AreEqual(SqrDistance(point, QXsegment(Math::QXvec3(0.f, 0.f, 0.f), Math::QXvec3(2.f, 0.f, 0.f)), &s, &t), 2.f, 1e-6f);
+			Assert::AreEqual(t, 0.5f, 1e-6f);
+			Assert::AreEqual(SqrDistance(QXsegment(Math::QXvec3(0.f, 0.f, 0.f), Math::QXvec3(2.f, 0.f, 0.f)), Math::QXvec3(3.f, 4.f, 0.f), &s), 17.f, 1e-5f);
+			Assert::AreEqual(s, 1.f);
+
+			/* oriented box: above a face, off a corner, crossing it */
+			QXorientedBox box(Math::QXref3(), Math::QXvec3(1.f, 1.f, 1.f));
+			Math::QXvec3 closest;
+			Assert::AreEqual(SqrDistance(QXsegment(Math::QXvec3(-3.f, 2.f, 0.f), Math::QXvec3(3.f, 2.f, 0.f)), box, &s, &closest), 1.f, 1e-5f);
+			Assert::IsTrue(s >= 1.f / 3.f - 1e-5f && s <= 2.f / 3.f + 1e-5f);
+			Assert::AreEqual(closest.y, 1.f, 1e-6f);
+			Assert::AreEqual(SqrDistance(QXsegment(Math::QXvec3(2.f, 2.f, 0.f), Math::QXvec3(4.f, 0.f, 0.f)), box, &s), 2.f, 1e-5f);
+			Assert::AreEqual(s, 0.f, 1e-5f);
+			Assert::AreEqual(SqrDistance(QXsegment(Math::QXvec3(-3.f, 0.5f, 0.f), Math::QXvec3(3.f, 0.f, 0.5f)), box), 0.f);
+
+			const QXfloat r{ 0.70710678f };
+			QXorientedBox turned(Math::QXref3(Math::QXvec3(0.f, 0.f, 0.f), Math::QXvec3(r, r, 0.f), Math::QXvec3(-r, r, 0.f),
+				Math::QXvec3(0.f, 0.f, 1.f)), Math::QXvec3(1.f, 1.f, 1.f));
+			Assert::AreEqual(SqrDistance(QXsegment(Math::QXvec3(3.f, -1.f, 0.f), Math::QXvec3(3.f, 1.f, 0.f)), turned, &s, &closest),
+				(3.f - 1.41421356f) * (3.f - 1.41421356f), 1e-5f);
+			Assert::AreEqual(s, 0.5f, 1e-5f);
+			Assert::AreEqual(closest.x, 1.41421356f, 1e-5f);
+		}
+
+		TEST_METHOD(rayCapsule)
+		{
+			using namespace Math::Geometry;
+
+			/* flat caps: side, cap from outside and from inside, parallel and orthogonal misses */
+			QXcylinder cylinder(QXsegment(Math::QXvec3(0.f, 0.f, 0.f), Math::QXvec3(0.f, 2.f, 0.f)), 1.f);
+			QXrayHit side;
+			Assert::IsTrue(Raycast(QXray(Math::QXvec3(-5.f, 1.f, 0.f), Math::QXvec3(1.f, 0.f, 0.f)), cylinder, side));
+			Assert::AreEqual(side.distance, 4.f, 1e-5f);
+			Assert::AreEqual(side.normal.x, -1.f, 1e-5f);
+			QXrayHit cap;
+			Assert::IsTrue(Raycast(QXray(Math::QXvec3(0.f, 4.f, 0.f), Math::QXvec3(0.1f, -1.f, 0.f)), cylinder, cap));
+			Assert::AreEqual(cap.distance, 2.f, 1e-5f);
+			Assert::AreEqual(cap.normal.y, 1.f, 1e-5f);
+			QXrayHit inside;
+			Assert::IsTrue(Raycast(QXray(Math::QXvec3(0.5f, 1.f, 0.f), Math::QXvec3(0.f, 1.f, 0.f)), cylinder, inside));
+			Assert::AreEqual(inside.distance, 1.f, 1e-5f);
+			Assert::AreEqual(inside.normal.y, 1.f, 1e-5f);
+			QXrayHit miss;
+			Assert::IsFalse(Raycast(QXray(Math::QXvec3(2.f, 5.f, 0.f), Math::QXvec3(0.f, -1.f, 0.f)), cylinder, miss));
+			Assert::IsFalse(Raycast(QXray(Math::QXvec3(-5.f, 3.f, 0.f), Math::QXvec3(1.f, 0.f, 0.f)), cylinder, miss));
+
+			/* rounded ends */
+			QXcapsule capsule(QXsegment(Math::QXvec3(0.f, 0.f, 0.f), Math::QXvec3(0.f, 2.f, 0.f)), 1.f);
+			QXrayHit top;
+			Assert::IsTrue(Raycast(QXray(Math::QXvec3(0.f, 5.f, 0.f), Math::QXvec3(0.f, -1.f, 0.f)), capsule, top));
+			Assert::AreEqual(top.distance, 2.f, 1e-5f);
+			Assert::AreEqual(top.normal.y, 1.f, 1e-5f);
+			QXrayHit bottom;
+			Assert::IsTrue(Raycast(QXray(Math::QXvec3(-5.f, -0.5f, 0.f), Math::QXvec3(1.f, 0.f, 0.f)), capsule, bottom));
+			Assert::AreEqual(bottom.distance, 5.f - 0.8660254f, 1e-5f);
+			Assert::AreEqual(bottom.normal.y, -0.5f, 1e-5f);
+			QXrayHit through;
+			Assert::IsTrue(Raycast(QXray(Math::QXvec3(0.f, 1.f, 0.f), Math::QXvec3(0.f, 0.f, 1.f)), capsule, through));
+			Assert::AreEqual(through.distance, 1.f, 1e-5f);
+			Assert::IsFalse(Raycast(QXray(Math::QXvec3(-5.f, 3.5f, 0.f), Math::QXvec3(1.f, 0.f, 0.f)), capsule, miss));
+
+			/* a null segment is a sphere */
+			QXrayHit sphere;
+			Assert::IsTrue(Raycast(QXray(Math::QXvec3(0.f, 0.f, -10.f), Math::QXvec3(0.f, 0.f, 1.f)),
+				QXcapsule(QXsegment(Math::QXvec3(0.f, 0.f, 0.f), Math::QXvec3(0.f, 0.f, 0.f)), 2.f), sphere));
+			Assert::AreEqual(sphere.distance, 8.f, 1e-5f);
+
+			/* packets find the nearest of several shapes, as the scalar casts */
+			QXcylinder cylinders[2]{ cylinder, QXcylinder(QXsegment(Math::QXvec3(3.f, 0.f, 0.f), Math::QXvec3(4.f, 1.f, 1.f)), 0.5f) };
+			QXcapsule capsules[2]{ capsule, QXcapsule(QXsegment(Math::QXvec3(3.f, 0.f, 0.f), Math::QXvec3(4.f, 1.f, 1.f)), 0.5f) };
+			QXrayPacket16 cylinderPacket, capsulePacket;
+			QXray rays[16];
+			for (QXuint i = 0; i < 16; i++)
+			{
+				/* aimed along the first capsule or at the second, some grazing past */
+				Math::QXvec3 origin(-6.f, 0.5f, 0.3f * (i % 5) - 0.6f);
+				Math::QXvec3 target{ i % 2 == 0 ? Math::QXvec3(0.f, 0.3f * i - 1.8f, 0.f) : Math::QXvec3(3.5f, 0.5f, 0.1f * i - 0.2f) };
+				rays[i] = QXray(origin, target - origin);
+				cylinderPacket.SetRay(i, rays[i]);
+				capsulePacket.SetRay(i, rays[i]);
+			}
+			Raycast(cylinderPacket, cylinders, 2);
+			Raycast(capsulePacket, capsules, 2);
+
+			QXuint hits{ 0 };
+			for (QXuint i = 0; i < 16; i++)
+			{
+				QXrayHit cylinderHit, capsuleHit;
+				for (QXuint k = 0; k < 2; k++)
+				{
+					if (Raycast(rays[i], cylinders[k], cylinderHit))
+						cylinderHit.index = k;
+					if (Raycast(rays[i], capsules[k], capsuleHit))
+						capsuleHit.index = k;
+				}
+
+				Assert::AreEqual(cylinderPacket.GetHit(i).index, cylinderHit.index);
+				Assert::AreEqual(cylinderPacket.GetHit(i).distance, cylinderHit.distance, 1e-4f);
+				Assert::AreEqual(capsulePacket.GetHit(i).index, capsuleHit.index);
+				Assert::AreEqual(capsulePacket.GetHit(i).distance, capsuleHit.distance, 1e-4f);
+				Assert::AreEqual(capsulePacket.GetHit(i).normal.y, capsuleHit.normal.y, 1e-4f);
+				hits += capsuleHit.index != ~0u;
+			}
+			Assert::IsTrue(hits > 4);
+		}
+
+		TEST_METHOD(contactCapsules)
+		{
+			using namespace Math::Geometry;
+			QXcontactManifold manifold;
+
+			/* parallel: both ends of the overlap, impulses kept across frames */
+			QXcapsule lying(QXsegment(Math::QXvec3(-1.f, 0.f, 0.f), Math::QXvec3(1.f, 0.f, 0.f)), 0.5f);
+			QXcapsule onTop(QXsegment(Math::QXvec3(0.f, 0.9f, 0.f), Math::QXvec3(2.f, 0.9f, 0.f)), 0.5f);
+			Assert::IsTrue(CollideCapsules(lying, onTop, manifold));
+			Assert::AreEqual(manifold.count, 2u);
+			Assert::AreEqual(manifold.normal.y, 1.f, 1e-5f);
+			for (QXuint i = 0; i < 2; i++)
+			{
+				Assert::AreEqual(manifold.points[i].depth, 0.1f, 1e-5f);
+				Assert::AreEqual(manifold.points[i].position.y, 0.45f, 1e-5f);
+				Assert::AreEqual(manifold.points[i].position.x, (QXfloat)manifold.points[i].id, 1e-5f);
+				manifold.points[i].impulse = (QXfloat)manifold.points[i].id + 1.f;
+			}
+			Assert::IsTrue(CollideCapsules(lying, onTop, manifold));
+			for (QXuint i = 0; i < 2; i++)
+				Assert::AreEqual(manifold.points[i].impulse, (QXfloat)manifold.points[i].id + 1.f);
+
+			/* crossing: one point */
+			QXcapsule crossing(QXsegment(Math::QXvec3(0.f, 0.8f, -1.f), Math::QXvec3(0.f, 0.8f, 1.f)), 0.5f);
+			Assert::IsTrue(CollideCapsules(lying, crossing, manifold));
+			Assert::AreEqual(manifold.count, 1u);
+			Assert::AreEqual(manifold.points[0].depth, 0.2f, 1e-5f);
+			Assert::AreEqual(manifold.points[0].position.y, 0.4f, 1e-5f);
+
+			QXcapsule away(QXsegment(Math::QXvec3(0.f, 1.5f, -1.f), Math::QXvec3(0.f, 1.5f, 1.f)), 0.4f);
+			Assert::IsFalse(CollideCapsules(lying, away, manifold));
+			Assert::AreEqual(manifold.count, 0u);
+
+			/* capsule lying on a box face, then hanging over its edge: the part over the face */
+			QXorientedBox box(Math::QXref3(), Math::QXvec3(1.f, 1.f, 1.f));
+			QXcontactManifold boxManifold;
+			Assert::IsTrue(CollideCapsuleBox(QXcapsule(QXsegment(Math::QXvec3(-0.5f, 1.4f, 0.f), Math::QXvec3(0.5f, 1.4f, 0.f)), 0.5f), box, boxManifold));
+			Assert::AreEqual(boxManifold.count, 2u);
+			Assert::AreEqual(boxManifold.normal.y, -1.f, 1e-5f);
+			Assert::AreEqual(boxManifold.points[0].depth, 0.1f, 1e-5f);
+			Assert::AreEqual(boxManifold.points[0].position.y, 0.95f, 1e-5f);
+			Assert::IsTrue(CollideCapsuleBox(QXcapsule(QXsegment(Math::QXvec3(0.5f, 1.4f, 0.f), Math::QXvec3(2.5f, 1.4f, 0.f)), 0.5f), box, boxManifold));
+			Assert::AreEqual(boxManifold.count, 2u);
+			Assert::AreEqual(boxManifold.points[1].position.x, 1.f, 1e-5f);
+
+			/* standing over an edge: one point */
+			Assert::IsTrue(CollideCapsuleBox(QXcapsule(QXsegment(Math::QXvec3(1.2f, 1.2f, 0.f), Math::QXvec3(1.2f, 3.f, 0.f)), 0.5f), box, boxManifold));
+			Assert::AreEqual(boxManifold.count, 1u);
+			Assert::AreEqual(boxManifold.normal.x, -0.70710678f, 1e-5f);
+			Assert::AreEqual(boxManifold.points[0].depth, 0.5f - 0.28284271f, 1e-5f);
+
+			/* segment through the box: EPA */
+			Assert::IsTrue(CollideCapsuleBox(QXcapsule(QXsegment(Math::QXvec3(-2.f, 0.5f, 0.f), Math::QXvec3(2.f, 0.5f, 0.f)), 0.25f), box, boxManifold));
+			Assert::AreEqual(boxManifold.normal.y, -1.f, 1e-3f);
+			Assert::AreEqual(boxManifold.points[0].depth, 0.75f, 1e-3f);
+
+			/* batches match the single pairs */
+			QXcapsule capsules[3]{ lying, onTop, crossing };
+			QXorientedBox boxes[1]{ box };
+			std::pair<QXuint, QXuint> pairs[3]{ { 0, 1 }, { 0, 2 }, { 1, 2 } }, boxPairs[3]{ { 0, 0 }, { 1, 0 }, { 2, 0 } };
+			QXcontactManifold manifolds[3], boxManifolds[3];
+			CollideCapsules(capsules, pairs, 3, manifolds);
+			CollideCapsuleBox(capsules, boxes, boxPairs, 3, boxManifolds);
+			for (QXuint i = 0; i < 3; i++)
+			{
+				QXcontactManifold single, singleBox;
+				Assert::AreEqual(manifolds[i].count, (QXuint)CollideCapsules(capsules[pairs[i].first], capsules[pairs[i].second], single) * single.count);
+				Assert::AreEqual(boxManifolds[i].count, (QXuint)CollideCapsuleBox(capsules[i], box, singleBox) * singleBox.count);
+			}
+		}
+		/* END Test Capsule */
+
+		/* BEGIN Test Fit */
+		TEST_METHOD(fitBox)
+		{
+			using namespace Math::Geometry;
+
+			/* 21 points: whole AVX and SSE blocks, then a scalar tail */
+			Math::QXvec3 points[21];
+			for (QXuint i = 0; i < 21; i++)
+				points[i] = Math::QXvec3(sinf(1.3f * i) * 4.f, cosf(0.7f * i) * 2.f - 1.f, (QXfloat)i * 0.5f - 3.f);
+			points[20].x = 9.f;
+
+			QXbox box{ FitBox(points, 21) };
+			Assert::AreEqual(box.GetPosition().x + box.GetHalfSizes().x, 9.f);
+			Assert::AreEqual(box.GetPosition().z - box.GetHalfSizes().z, -3.f);
+			Assert::AreEqual(box.GetPosition().z + box.GetHalfSizes().z, 7.f);
+			for (QXuint i = 0; i < 21; i++)
+				for (QXuint k = 0; k < 3; k++)
+					Assert::IsTrue(std::abs(points[i][k] - box.GetPosition()[k]) <= box.GetHalfSizes()[k] + 1e-6f);
+
+			Assert::AreEqual(FitBox(points, 0).GetHalfSizes().x, 0.f);
+		}
+
+		TEST_METHOD(fitSphere)
+		{
+			using namespace Math::Geometry;
+
+			/* cube corners and its center: the minimal sphere passes through the corners */
+			Math::QXvec3 cube[9];
+			for (QXuint i = 0; i < 8; i++)
+				cube[i] = Math::QXvec3(i & 1 ? 2.f : 0.f, i & 2 ? 2.f : 0.f, i & 4 ? 2.f : 0.f) + Math::QXvec3(1.f, -1.f, 5.f);
+			cube[8] = Math::QXvec3(2.f, 0.f, 6.f);
+			QXsphere minimal{ FitSphereWelzl(cube, 9) };
+			Assert::AreEqual(minimal.GetRadius(), 1.7320508f, 1e-5f);
+			Assert::AreEqual(minimal.GetPosition().z, 6.f, 1e-5f);
+
+			/* aligned points: half their span */
+			Math::QXvec3 line[5]{ Math::QXvec3(0.f, 0.f, 0.f), Math::QXvec3(1.f, 1.f, 1.f), Math::QXvec3(-2.f, -2.f, -2.f), Math::QXvec3(0.5f, 0.5f, 0.5f),
+				Math::QXvec3(3.f, 3.f, 3.f) };
+			Assert::AreEqual(FitSphereWelzl(line, 5).GetRadius(), 2.5f * 1.7320508f, 1e-5f);
+			Assert::AreEqual(FitSphereRitter(line, 5).GetRadius(), 2.5f * 1.7320508f, 1e-5f);
+
+			/* a large cloud, split on the threads: every point inside, Ritter no smaller than Welzl */
+			std::vector<Math::QXvec3> cloud(100000);
+			for (QXuint i = 0; i < (QXuint)cloud.size(); i++)
+			{
+				QXfloat a{ 0.001f * i }, b{ 0.0173f * i };
+				cloud[i] = Math::QXvec3(cosf(a) * cosf(b) * 3.f, sinf(a) * cosf(b) * 2.f, sinf(b)) * (0.5f + 0.5f * sinf(0.37f * i)) + Math::QXvec3(10.f, 0.f, 0.f);
+			}
+			QXsphere welzl{ FitSphereWelzl(cloud.data(), (QXuint)cloud.size()) };
+			QXsphere ritter{ FitSphereRitter(cloud.data(), (QXuint)cloud.size()) };
+			Assert::IsTrue(ritter.GetRadius() >= welzl.GetRadius());
+			Assert::IsTrue(ritter.GetRadius() < welzl.GetRadius() * 1.3f);
+			for (const Math::QXvec3& point : cloud)
+			{
+				Assert::IsTrue((point - welzl.GetPosition()).Length() <= welzl.GetRadius());
+				Assert::IsTrue((point - ritter.GetPosition()).Length() <= ritter.GetRadius());
+			}
+			Assert::AreEqual(FitSphereWelzl(cloud.data(), (QXuint)cloud.size(), false).GetRadius(), welzl.GetRadius());
+		}
+
+		TEST_METHOD(fitOrientedBox)
+		{
+			using namespace Math::Geometry;
+			const QXfloat c{ 0.8660254f }, s{ 0.5f };
+
+			/* corners of a box turned by 30 degrees: PCA finds its axes */
+			Math::QXvec3 axes[3]{ Math::QXvec3(c, s, 0.f), Math::QXvec3(-s, c, 0.f), Math::QXvec3(0.f, 0.f, 1.f) };
+			Math::QXvec3 halfSizes(3.f, 1.f, 0.5f), center(1.f, 2.f, 3.f), corners[8];
+			for (QXuint i = 0; i < 8; i++)
+				corners[i] = center + axes[0] * (i & 1 ? halfSizes.x : -halfSizes.x) + axes[1] * (i & 2 ? halfSizes.y : -halfSizes.y) +
+					axes[2] * (i & 4 ? halfSizes.z : -halfSizes.z);
+
+			QXorientedBox box{ FitOrientedBox(corners, 8) };
+			Assert::AreEqual(box.GetHalfSizes().x, 3.f, 1e-4f);
+			Assert::AreEqual(box.GetHalfSizes().y, 1.f, 1e-4f);
+			Assert::AreEqual(box.GetHalfSizes().z, 0.5f, 1e-4f);
+			Assert::AreEqual(box.GetRef().o.y, 2.f, 1e-4f);
+			Assert::AreEqual(std::abs(box.GetRef().i.Dot(axes[0])), 1.f, 1e-5f);
+			Assert::AreEqual(box.GetRef().i.Cross(box.GetRef().j).Dot(box.GetRef().k), 1.f, 1e-5f);
+
+			/* a cube gains nothing from turning: the axis aligned box */
+			Math::QXvec3 cube[8];
+			for (QXuint i = 0; i < 8; i++)
+				cube[i] = Math::QXvec3(i & 1 ? 1.f : -1.f, i & 2 ? 1.f : -1.f, i & 4 ? 1.f : -1.f);
+			QXorientedBox aligned{ FitOrientedBox(cube, 8) };
+			Assert::AreEqual(aligned.GetRef().i.x, 1.f);
+			Assert::AreEqual(aligned.GetHalfSizes().y, 1.f);
+		}
+		/* END Test Fit */
+
+		/* BEGIN Test Triangle */
+		TEST_METHOD(triangleClosestPoint)
+		{
+			using namespace Math::Geometry;
+
+			QXtriangle triangle{ Math::QXvec3(0.f, 0.f, 0.f), Math::QXvec3(4.f, 0.f, 0.f), Math::QXvec3(0.f, 4.f, 0.f) };
+			Assert::AreEqual(triangle.GetArea(), 8.f);
+			Assert::AreEqual(triangle.GetNormal().z, 1.f);
+
+			/* one point in each Voronoi region: face, the three vertices and the three edges */
+			Math::QXvec3 barycentric;
+			Math::QXvec3 closest{ triangle.GetClosestPoint(Math::QXvec3(1.f, 1.f, 3.f), &barycentric) };
+			Assert::IsTrue(closest == Math::QXvec3(1.f, 1.f, 0.f));
+			Assert::AreEqual(barycentric.x + barycentric.y + barycentric.z, 1.f, 1e-6f);
+			Assert::IsTrue(triangle.GetClosestPoint(Math::QXvec3(-1.f, -2.f, 1.f)) == Math::QXvec3(0.f, 0.f, 0.f));
+			Assert::IsTrue(triangle.GetClosestPoint(Math::QXvec3(6.f, -1.f, 0.f)) == Math::QXvec3(4.f, 0.f, 0.f));
+			Assert::IsTrue(triangle.GetClosestPoint(Math::QXvec3(-1.f, 7.f, 0.f)) == Math::QXvec3(0.f, 4.f, 0.f));
+			Assert::IsTrue(triangle.GetClosestPoint(Math::QXvec3(2.f, -3.f, 1.f)) == Math::QXvec3(2.f, 0.f, 0.f));
+			Assert::IsTrue(triangle.GetClosestPoint(Math::QXvec3(-5.f, 1.f, 0.f)) == Math::QXvec3(0.f, 1.f, 0.f));
+			closest = triangle.GetClosestPoint(Math::QXvec3(3.f, 3.f, -2.f), &barycentric);
+			Assert::AreEqual(closest.x, 2.f, 1e-6f);
+			Assert::AreEqual(closest.y, 2.f, 1e-6f);
+			Assert::AreEqual(barycentric.x, 0.f, 1e-6f);
+
+			Assert::IsTrue(triangle.IsInside(Math::QXvec3(1.f, 1.f, -5.f)));
+			Assert::IsTrue(triangle.IsInside(Math::QXvec3(2.f, 2.f, 0.f)));
+			Assert::IsFalse(triangle.IsInside(Math::QXvec3(2.1f, 2.f, 0.f)));
+			Assert::IsFalse(triangle.IsInside(Math::QXvec3(-0.1f, 1.f, 0.f)));
+			Assert::IsFalse(QXtriangle(Math::QXvec3(0.f, 0.f, 0.f), Math::QXvec3(1.f, 1.f, 1.f), Math::QXvec3(2.f, 2.f, 2.f)).IsInside(Math::QXvec3(1.f, 1.f, 1.f)));
+		}
+
+		TEST_METHOD(meshNormals)
+		{
+			using namespace Math::Geometry;
+
+			/* 201 x 201 grid on a wavy surface: 80000 triangles, split on the threads */
+			const QXuint side{ 201 };
+			std::vector<Math::QXvec3> positions(side * side);
+			std::vector<QXuint> indices;
+			for (QXuint y = 0; y < side; y++)
+				for (QXuint x = 0; x < side; x++)
+					positions[y * side + x] = Math::QXvec3(0.1f * x, 0.1f * y, 0.3f * sinf(0.05f * x) * cosf(0.07f * y));
+			for (QXuint y = 0; y + 1 < side; y++)
+				for (QXuint x = 0; x + 1 < side; x++)
+				{
+					QXuint corner{ y * side + x };
+					indices.insert(indices.end(), { corner, corner + 1, corner + side + 1, corner, corner + side + 1, corner + side });
+				}
+			QXmeshView mesh{ positions.data(), (QXuint)positions.size(), indices.data(), (QXuint)indices.size() / 3 };
+
+			std::vector<Math::QXvec3> faceNormals(mesh.triangleCount), vertexNormals(mesh.vertexCount);
+			std::vector<QXfloat> areas(mesh.triangleCount);
+			FaceNormals(mesh, faceNormals.data(), areas.data());
+			for (QXuint i = 0; i < mesh.triangleCount; i += 997)
+			{
+				QXtriangle triangle{ mesh.GetTriangle(i) };
+				Assert::AreEqual(areas[i], triangle.GetArea(), 1e-6f);
+				Assert::AreEqual(faceNormals[i].Dot(triangle.GetNormal()), 1.f, 1e-5f);
+			}
+
+			/* area weighted sum of the face normals around a vertex */
+			VertexNormals(mesh, vertexNormals.data());
+			Math::QXvec3 sum;
+			QXuint vertex{ 57 * side + 101 };
+			for (QXuint i = 0; i < mesh.triangleCount; i++)
+				for (QXuint v = 0; v < 3; v++)
+					if (indices[3 * i + v] == vertex)
+						sum += faceNormals[i] * areas[i];
+			sum.Normalize();
+			Assert::AreEqual(vertexNormals[vertex].Dot(sum), 1.f, 1e-5f);
+			Assert::AreEqual(vertexNormals[0].Length(), 1.f, 1e-5f);
+			Assert::IsTrue(vertexNormals[0].z > 0.9f);
+
+			std::vector<Math::QXvec3> serial(mesh.vertexCount);
+			VertexNormals(mesh, serial.data(), false);
+			Assert::AreEqual(serial[vertex].Dot(vertexNormals[vertex]), 1.f, 1e-5f);
+		}
+
+		TEST_METHOD(meshClosestPoint)
+		{
+			using namespace Math::Geometry;
+
+			/* open box of 5 quads: bottom and the 4 sides of a 2 x 2 x 2 cube */
+			Math::QXvec3 positions[8];
+			for (QXuint i = 0; i < 8; i++)
+				positions[i] = Math::QXvec3(i & 1 ? 1.f : -1.f, i & 2 ? 1.f : -1.f, i & 4 ? 1.f : -1.f);
+			QXuint indices[30]{ 0, 2, 3, 0, 3, 1, 0, 1, 5, 0, 5, 4, 1, 3, 7, 1, 7, 5, 3, 2, 6, 3, 6, 7, 2, 0, 4, 2, 4, 6 };
+			QXmeshView mesh{ positions, 8, indices, 10 };
+
+			QXuint triangle;
+			Math::QXvec3 closest{ ClosestPoint(mesh, Math::QXvec3(0.2f, -0.1f, 0.5f), &triangle) };
+			Assert::AreEqual(closest.x, 1.f, 1e-6f);
+			Assert::AreEqual(closest.y, -0.1f, 1e-6f);
+			Assert::AreEqual(closest.z, 0.5f, 1e-6f);
+			Assert::IsTrue(triangle >= 4 && triangle < 6);
+
+			/* below the bottom and against an open corner */
+			closest = ClosestPoint(mesh, Math::QXvec3(0.3f, 0.4f, -3.f), &triangle);
+			Assert::AreEqual(closest.z, -1.f, 1e-6f);
+			Assert::IsTrue(triangle < 2);
+			closest = ClosestPoint(mesh, Math::QXvec3(3.f, 3.f, 3.f));
+			Assert::AreEqual((closest - Math::QXvec3(1.f, 1.f, 1.f)).Length(), 0.f, 1e-6f);
+
+			/* same nearest triangle as the scalar search on a point cloud */
+			for (QXuint i = 0; i < 50; i++)
+			{
+				Math::QXvec3 point{ sinf(1.7f * i) * 2.f, cosf(2.3f * i) * 2.f, sinf(0.9f * i + 1.f) * 2.f };
+				QXfloat best{ FLT_MAX };
+				for (QXuint t = 0; t < 10; t++)
+					best = std::min(best, (mesh.GetTriangle(t).GetClosestPoint(point) - point).Length());
+				Assert::AreEqual((ClosestPoint(mesh, point) - point).Length(), best, 1e-5f);
+			}
+
+			QXmeshView empty;
+			Assert::IsTrue(ClosestPoint(empty, Math::QXvec3(1.f, 2.f, 3.f), &triangle) == Math::QXvec3(1.f, 2.f, 3.f));
+			Assert::AreEqual(triangle, 0u);
+		}
+		/* END Test Triangle */
+
+		/* BEGIN Test ConvexHull */
+		TEST_METHOD(convexHullCube)
+		{
+			using namespace Math::Geometry;
+
+			/* lattice of a cube: many points on its faces and edges, only the corners are vertices */
+			std::vector<Math::QXvec3> points;
+			for (QXuint i = 0; i < 216; i++)
+				points.push_back(Math::QXvec3(0.2f * (i % 6), 0.2f * (i / 6 % 6), 0.2f * (i / 36)) - Math::QXvec3(0.5f, 0.5f, 0.5f));
+
+			QXconvexHull hull;
+			Assert::IsTrue(hull.Build(points.data(), (QXuint)points.size()));
+			Assert::AreEqual((QXuint)hull.GetVertices().size(), 8u);
+			Assert::AreEqual((QXuint)hull.GetFaces().size(), 12u);
+			for (QXuint i = 0; i < 8; i++)
+			{
+				Math::QXvec3 vertex{ hull.GetVertices()[i] };
+				Assert::AreEqual(std::abs(vertex.x) + std::abs(vertex.y) + std::abs(vertex.z), 1.5f, 1e-6f);
+				Assert::IsTrue(points[hull.GetVertexSources()[i]] == vertex);
+			}
+			for (const QXplane& plane : hull.GetPlanes())
+				Assert::AreEqual(plane.GetDistance(), 0.5f, 1e-6f);
+
+			/* a plane, a line and fewer than 4 points have no hull */
+			std::vector<Math::QXvec3> flat(points.begin(), points.begin() + 36);
+			Assert::IsFalse(hull.Build(flat.data(), (QXuint)flat.size()));
+			Assert::IsTrue(hull.GetFaces().empty());
+			Assert::IsFalse(hull.Build(points.data(), 6));
+			Assert::IsFalse(hull.Build(points.data(), 3));
+		}
+
+		TEST_METHOD(convexHullSphere)
+		{
+			using namespace Math::Geometry;
+
+			/* points on a sphere are all vertices, then points inside it are culled */
+			std::vector<Math::QXvec3> points;
+			for (QXuint i = 0; i < 3000; i++)
+			{
+				QXfloat z{ 1.f - (2.f * i + 1.f) / 3000.f }, angle{ 2.39996323f * i };
+				QXfloat radius{ sqrtf(1.f - z * z) };
+				points.push_back(Math::QXvec3(radius * cosf(angle), radius * sinf(angle), z) * 2.f + Math::QXvec3(3.f, -1.f, 0.5f));
+			}
+			for (QXuint i = 0; i < 100000; i++)
+				points.push_back(points[i % 3000] * 0.5f + Math::QXvec3(1.5f, -0.5f, 0.25f) + Math::QXvec3(sinf(0.1f * i), cosf(0.3f * i), sinf(0.7f * i)) * 0.3f);
+
+			QXconvexHull hull;
+			Assert::IsTrue(hull.Build(points.data(), (QXuint)points.size()));
+
+			const std::vector<QXhullFace>& faces{ hull.GetFaces() };
+			Assert::AreEqual((QXuint)hull.GetVertices().size(), 3000u);
+			Assert::AreEqual((QXuint)faces.size(), 2u * 3000u - 4u);
+
+			/* each edge is shared with its neighbour in the other direction, every point is behind every face */
+			for (QXuint f = 0; f < (QXuint)faces.size(); f++)
+				for (QXuint i = 0; i < 3; i++)
+				{
+					const QXhullFace& neighbour{ faces[faces[f].neighbours[i]] };
+					QXuint shared{ 3 };
+					for (QXuint j = 0; j < 3; j++)
+						if (neighbour.vertices[j] == faces[f].vertices[(i + 1) % 3] && neighbour.vertices[(j + 1) % 3] == faces[f].vertices[i])
+							shared = j;
+					Assert::IsTrue(shared < 3);
+					Assert::AreEqual(neighbour.neighbours[shared], f);
+				}
+			for (QXuint i = 0; i < (QXuint)points.size(); i += 7)
+				for (const QXplane& plane : hull.GetPlanes())
+					Assert::IsTrue(points[i].Dot(plane.GetNormal()) - plane.GetDistance() < 1e-5f);
+
+			/* rebuilding on the same object gives the same hull */
+			Assert::IsTrue(hull.Build(points.data(), (QXuint)points.size(), false));
+			Assert::AreEqual((QXuint)hull.GetFaces().size(), 2u * 3000u - 4u);
+		}
+		/* END Test ConvexHull */
 	};
 }